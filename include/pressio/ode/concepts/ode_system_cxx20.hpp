@@ -58,6 +58,16 @@ concept OdeSystemFusingMassMatrixAndRhs =
     { A.massMatrixAndRhs(state, evalValue, M, f) } -> std::same_as<void>;
   };
 
+template <class T>
+concept OdeSystemWithConstantMassMatrix =
+  OdeSystem<T>
+  && std::copy_constructible<typename T::mass_matrix_type>
+  && requires(const T & A, typename T::mass_matrix_type & M)
+  {
+    { A.createMassMatrix() } -> std::same_as<typename T::mass_matrix_type>;
+    { A.massMatrix(M) } -> std::same_as<void>;
+  };
+
 template <class T>
 concept CompleteOdeSystem =
   requires(){ typename T::independent_variable_type; }
@@ -121,6 +131,12 @@ concept RealValuedOdeSystemFusingMassMatrixAndRhs =
       typename T::independent_variable_type,
       scalar_trait_t<typename T::state_type> >;
 
+template <class T>
+concept RealValuedOdeSystemWithConstantMassMatrix =
+  OdeSystemWithConstantMassMatrix<T>
+  && RealValuedOdeSystem<T>
+  && std::floating_point< scalar_trait_t<typename T::mass_matrix_type> >;
+
 template <class T>
 concept RealValuedOdeSystemFusingRhsAndJacobian =
      OdeSystemFusingRhsAndJacobian<T>
@@ -0,0 +1,75 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ode_advance_flush_observer.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef ODE_IMPL_ODE_ADVANCE_FLUSH_OBSERVER_HPP_
+#define ODE_IMPL_ODE_ADVANCE_FLUSH_OBSERVER_HPP_
+
+namespace pressio{ namespace ode{ namespace impl{
+
+template <class T, class = void>
+struct observer_has_flush_method : std::false_type{};
+
+template <class T>
+struct observer_has_flush_method<
+  T, mpl::void_t< decltype(std::declval<T &>().flush()) >
+  > : std::true_type{};
+
+// observers that defer work (e.g. the async observer) expose
+// a flush method that the advancers call before returning
+template <class ObserverType>
+mpl::enable_if_t< observer_has_flush_method<ObserverType>::value >
+flush_observer_if_needed(ObserverType & observer){
+  observer.flush();
+}
+
+template <class ObserverType>
+mpl::enable_if_t< !observer_has_flush_method<ObserverType>::value >
+flush_observer_if_needed(ObserverType & /*observer*/){}
+
+}}}//end namespace pressio::ode::impl
+#endif  // ODE_IMPL_ODE_ADVANCE_FLUSH_OBSERVER_HPP_
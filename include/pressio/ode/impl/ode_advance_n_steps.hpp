@@ -50,6 +50,7 @@
 #define ODE_IMPL_ODE_ADVANCE_N_STEPS_HPP_
 
 #include "ode_advance_printing_helpers.hpp"
+#include "ode_advance_flush_observer.hpp"
 
 namespace pressio{ namespace ode{ namespace impl{
 
@@ -72,10 +73,7 @@ void advance_n_steps_with_dt_policy(StepperType & stepper,
 				    Args && ... args)
 {
 
-#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
-  auto timer = Teuchos::TimeMonitor::getStackedTimer();
-  timer->start("time loop");
-#endif
+  PRESSIO_PERF_ZONE("time loop");
 
   using step_t = typename ::pressio::ode::StepCount::value_type;
   IndVarType time = start_val;
@@ -85,6 +83,7 @@ void advance_n_steps_with_dt_policy(StepperType & stepper,
   ::pressio::ode::StepSize<IndVarType> dt;
   step_t step = ::pressio::ode::first_step_value;
   PRESSIOLOG_DEBUG("impl: advance_n_steps_with_dt_policy");
+  const ::pressio::log::impl::StepSamplingScope logSampling;
   for( ; step <= numSteps.get(); ++step)
     {
       const auto stepWrap = ::pressio::ode::StepCount(step);
@@ -99,25 +98,19 @@ void advance_n_steps_with_dt_policy(StepperType & stepper,
       // which is the trivial case is a noop
       guesser(stepWrap, ::pressio::ode::StepStartAt<IndVarType>(time), odeState);
 
-#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
-      timer->start("time step");
-#endif
-      stepper(odeState,
-	      ::pressio::ode::StepStartAt<IndVarType>(time),
-	      stepWrap, dt,
-	      std::forward<Args>(args)...);
-
-#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
-      timer->stop("time step");
-#endif
+      {
+	PRESSIO_PERF_ZONE("time step");
+	stepper(odeState,
+		::pressio::ode::StepStartAt<IndVarType>(time),
+		stepWrap, dt,
+		std::forward<Args>(args)...);
+      }
 
       time += dt.get();
       observer(::pressio::ode::StepCount(step), time, odeState);
     }
 
-#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
-  timer->stop("time loop");
-#endif
+  flush_observer_if_needed(observer);
 }
 
 
@@ -56,6 +56,8 @@ void print_step_and_current_time(const typename StepCount::value_type & step,
 				 const IndVarType & time,
 				 const IndVarType & dt)
 {
+  // this marks the start of a step, which is what the log sampling counts
+  ::pressio::log::impl::beginSampledStep(step);
   PRESSIOLOG_DEBUG("starting timestep={} from time={} with dt={}",
 		   step, time, dt);
 }
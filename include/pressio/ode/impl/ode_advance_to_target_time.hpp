@@ -50,6 +50,7 @@
 #define ODE_IMPL_ODE_ADVANCE_TO_TARGET_TIME_HPP_
 
 #include "ode_advance_printing_helpers.hpp"
+#include "ode_advance_flush_observer.hpp"
 
 namespace pressio{ namespace ode{ namespace impl{
 
@@ -81,6 +82,74 @@ call_dt_policy(StepSizePolicyType && dtPolicy,
   dtPolicy(step, time, dt);
 }
 
+template <class T, class IndVarType, class = void>
+struct dt_policy_has_step_outcome_methods : std::false_type{};
+
+template <class T, class IndVarType>
+struct dt_policy_has_step_outcome_methods<
+  T, IndVarType,
+  mpl::void_t<
+    decltype(std::declval<T &>().stepAccepted
+	     (std::declval<StepCount const &>(),
+	      std::declval<::pressio::ode::StepSize<IndVarType> const &>())),
+    decltype(std::declval<T &>().stepRejected
+	     (std::declval<StepCount const &>(),
+	      std::declval<::pressio::ode::StepSize<IndVarType> &>()))
+    >
+  > : std::true_type{};
+
+// policies that adapt the step size (e.g. the PI policy) are told
+// explicitly whether the attempted step was accepted and, if not,
+// choose the step size of the next attempt. For all others, a rejected
+// step size is divided by the scaling factor returned by the policy.
+template <class StepSizePolicyType, class IndVarType>
+mpl::enable_if_t<
+  dt_policy_has_step_outcome_methods<
+    mpl::remove_cvref_t<StepSizePolicyType>, IndVarType>::value
+  >
+notify_dt_policy_step_accepted(StepSizePolicyType & dtPolicy,
+			       const StepCount & step,
+			       const ::pressio::ode::StepSize<IndVarType> & dt)
+{
+  dtPolicy.stepAccepted(step, dt);
+}
+
+template <class StepSizePolicyType, class IndVarType>
+mpl::enable_if_t<
+  !dt_policy_has_step_outcome_methods<
+    mpl::remove_cvref_t<StepSizePolicyType>, IndVarType>::value
+  >
+notify_dt_policy_step_accepted(StepSizePolicyType & /*dtPolicy*/,
+			       const StepCount & /*step*/,
+			       const ::pressio::ode::StepSize<IndVarType> & /*dt*/)
+{}
+
+template <class StepSizePolicyType, class IndVarType>
+mpl::enable_if_t<
+  dt_policy_has_step_outcome_methods<
+    mpl::remove_cvref_t<StepSizePolicyType>, IndVarType>::value
+  >
+notify_dt_policy_step_rejected(StepSizePolicyType & dtPolicy,
+			       const StepCount & step,
+			       ::pressio::ode::StepSize<IndVarType> & dt,
+			       const ::pressio::ode::StepSizeScalingFactor<IndVarType> & /*factor*/)
+{
+  dtPolicy.stepRejected(step, dt);
+}
+
+template <class StepSizePolicyType, class IndVarType>
+mpl::enable_if_t<
+  !dt_policy_has_step_outcome_methods<
+    mpl::remove_cvref_t<StepSizePolicyType>, IndVarType>::value
+  >
+notify_dt_policy_step_rejected(StepSizePolicyType & /*dtPolicy*/,
+			       const StepCount & /*step*/,
+			       ::pressio::ode::StepSize<IndVarType> & dt,
+			       const ::pressio::ode::StepSizeScalingFactor<IndVarType> & factor)
+{
+  dt = dt.get()/factor.get();
+}
+
 template <
   bool enableTimeStepRecovery,
   class StepperType,
@@ -106,10 +175,7 @@ void to_target_time_with_step_size_policy(StepperType & stepper,
     return;
   }
 
-#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
-  auto timer = Teuchos::TimeMonitor::getStackedTimer();
-  timer->start("time loop");
-#endif
+  PRESSIO_PERF_ZONE("time loop");
 
   using step_t = typename StepCount::value_type;
 
@@ -124,6 +190,7 @@ void to_target_time_with_step_size_policy(StepperType & stepper,
 
   step_t step = ::pressio::ode::first_step_value;
   PRESSIOLOG_DEBUG("impl: advance_to_target_time_with_dt_policy");
+  const ::pressio::log::impl::StepSamplingScope logSampling;
   constexpr auto eps = std::numeric_limits<IndVarType>::epsilon();
   bool condition = true;
   while (condition)
@@ -148,44 +215,40 @@ void to_target_time_with_step_size_policy(StepperType & stepper,
 
       print_step_and_current_time(step, time, dt.get());
 
-#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
-      timer->start("time step");
-#endif
-
-      if (enableTimeStepRecovery)
       {
-	bool needStop = false;
-	while(!needStop){
-	  try
-	  {
-	    stepper(odeState,
-		    ::pressio::ode::StepStartAt<IndVarType>(time),
-		    stepWrap, dt,
-		    std::forward<Args>(args)...);
-	    needStop=true;
-	  }
-	  catch (::pressio::eh::TimeStepFailure const & e)
-	  {
-	    dt = dt.get()/dtScalingFactor.get();
-	    if (dt.get() < minDt.get()){
-	      throw std::runtime_error("Violation of minimum time step while trying to recover time step");
+	PRESSIO_PERF_ZONE("time step");
+	if (enableTimeStepRecovery)
+	{
+	  bool needStop = false;
+	  while(!needStop){
+	    try
+	    {
+	      stepper(odeState,
+		      ::pressio::ode::StepStartAt<IndVarType>(time),
+		      stepWrap, dt,
+		      std::forward<Args>(args)...);
+	      needStop=true;
+	      impl::notify_dt_policy_step_accepted(dtPolicy, stepWrap, dt);
 	    }
+	    catch (::pressio::eh::TimeStepFailure const & e)
+	    {
+	      impl::notify_dt_policy_step_rejected(dtPolicy, stepWrap, dt, dtScalingFactor);
+	      if (dt.get() < minDt.get()){
+		throw std::runtime_error("Violation of minimum time step while trying to recover time step");
+	      }
 
-	    PRESSIOLOG_CRITICAL("time step={} failed, retrying with dt={}", step, dt.get());
+	      PRESSIOLOG_CRITICAL("time step={} failed, retrying with dt={}", step, dt.get());
+	    }
 	  }
 	}
+	else
+	{
+	  stepper(odeState,
+		  ::pressio::ode::StepStartAt<IndVarType>(time),
+		  stepWrap, dt,
+		  std::forward<Args>(args)...);
+	}
       }
-      else
-      {
-	stepper(odeState,
-		::pressio::ode::StepStartAt<IndVarType>(time),
-		stepWrap, dt,
-		std::forward<Args>(args)...);
-      }
-
-#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
-      timer->stop("time step");
-#endif
 
       time += dt.get();
       observer(::pressio::ode::StepCount(step), time, odeState);
@@ -199,9 +262,7 @@ void to_target_time_with_step_size_policy(StepperType & stepper,
       step++;
     }
 
-#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
-  timer->stop("time loop");
-#endif
+  flush_observer_if_needed(observer);
 }
 
 }}}//end namespace pressio::ode::impl
@@ -51,6 +51,28 @@
 
 namespace pressio{ namespace ode{ namespace impl{
 
+// some schemes (the embedded and low-storage ones) are only implemented
+// by the steppers providing a constructor for them (currently, without mass matrix)
+template<class ImplClassType, class TagType, class SystemType>
+mpl::enable_if_t<
+  std::is_constructible<ImplClassType, TagType, SystemType &&>::value,
+  ImplClassType
+  >
+create_explicit_stepper_if_supported(TagType tag, SystemType && system)
+{
+  return ImplClassType(tag, std::forward<SystemType>(system));
+}
+
+template<class ImplClassType, class TagType, class SystemType>
+mpl::enable_if_t<
+  !std::is_constructible<ImplClassType, TagType, SystemType &&>::value,
+  ImplClassType
+  >
+create_explicit_stepper_if_supported(TagType /*tag*/, SystemType && /*system*/)
+{
+  throw std::runtime_error("ode:: create_explicit_stepper: the scheme is not supported for this system");
+}
+
 template<class ImplClassType, class SystemType>
 auto create_explicit_stepper(StepScheme name,
 			     SystemType && system)
@@ -76,6 +98,21 @@ auto create_explicit_stepper(StepScheme name,
 			 std::forward<SystemType>(system));
   }
 
+  else if (name == StepScheme::DormandPrince45){
+    return create_explicit_stepper_if_supported<ImplClassType>
+      (ode::DormandPrince45(), std::forward<SystemType>(system));
+  }
+
+  else if (name == StepScheme::BogackiShampine23){
+    return create_explicit_stepper_if_supported<ImplClassType>
+      (ode::BogackiShampine23(), std::forward<SystemType>(system));
+  }
+
+  else if (name == StepScheme::LowStorageRungeKutta4){
+    return create_explicit_stepper_if_supported<ImplClassType>
+      (ode::LowStorageRungeKutta4(), std::forward<SystemType>(system));
+  }
+
   else{
     throw std::runtime_error("ode:: create_explicit_stepper: invalid StepScheme enum value");
   }
@@ -53,6 +53,31 @@
 
 namespace pressio{ namespace ode{ namespace impl{
 
+template<class T, class = void>
+struct system_has_constant_mass_matrix : std::false_type{};
+
+template<class T>
+struct system_has_constant_mass_matrix<
+  T,
+  mpl::void_t<
+    decltype( std::declval<T const &>().massMatrix
+	      (std::declval<typename T::mass_matrix_type &>()) )
+    >
+  > : std::true_type{};
+
+template<class SolverType, class MatrixType, class RhsType, class SolutionType, class = void>
+struct linear_solver_can_factorize : std::false_type{};
+
+template<class SolverType, class MatrixType, class RhsType, class SolutionType>
+struct linear_solver_can_factorize<
+  SolverType, MatrixType, RhsType, SolutionType,
+  mpl::void_t<
+    decltype( std::declval<SolverType &>().factorizeIfChanged(std::declval<MatrixType const &>()) ),
+    decltype( std::declval<SolverType &>().solveWithFactorization
+	      (std::declval<RhsType const &>(), std::declval<SolutionType &>()) )
+    >
+  > : std::true_type{};
+
 // this class is NOT meant for direct instantiation.
 // One needs to use the public create_* functions because
 // templates are handled and passed properly there.
@@ -67,6 +92,11 @@ class ExplicitStepperWithMassMatrixImpl
 {
   using mass_matrix_type = typename mpl::remove_cvref_t<SystemType>::mass_matrix_type;
 
+  // if the mass matrix is constant, it is computed once at construction
+  // and, if the linear solver allows it, factorized only once
+  static constexpr bool constant_mass_matrix =
+    system_has_constant_mass_matrix<mpl::remove_cvref_t<SystemType>>::value;
+
 public:
   using independent_variable_type  = IndVarType;
   using state_type  = StateType;
@@ -95,7 +125,9 @@ public:
       rhsInstance_{systemObj.createRhs()},
       xInstances_{systemObj.createState()},
       massMatrix_(systemObj.createMassMatrix())
-  {}
+  {
+    assembleMassMatrixIfConstant(std::integral_constant<bool, constant_mass_matrix>());
+  }
 
   ExplicitStepperWithMassMatrixImpl(ode::RungeKutta4  /*tag*/,
 				    SystemType && systemObj)
@@ -108,7 +140,9 @@ public:
 		  systemObj.createState(),
 		  systemObj.createState()},
       massMatrix_(systemObj.createMassMatrix())
-  {}
+  {
+    assembleMassMatrixIfConstant(std::integral_constant<bool, constant_mass_matrix>());
+  }
 
   ExplicitStepperWithMassMatrixImpl(ode::AdamsBashforth2 /*tag*/,
 				    SystemType && systemObj)
@@ -118,7 +152,9 @@ public:
       xInstances_{systemObj.createState(),
                   systemObj.createState()},
       massMatrix_(systemObj.createMassMatrix())
-  {}
+  {
+    assembleMassMatrixIfConstant(std::integral_constant<bool, constant_mass_matrix>());
+  }
 
   ExplicitStepperWithMassMatrixImpl(ode::SSPRungeKutta3 /*tag*/,
 				    SystemType && systemObj)
@@ -128,7 +164,9 @@ public:
       xInstances_{systemObj.createState(),
                   systemObj.createState()},
       massMatrix_(systemObj.createMassMatrix())
-  {}
+  {
+    assembleMassMatrixIfConstant(std::integral_constant<bool, constant_mass_matrix>());
+  }
 
 public:
 
@@ -203,6 +241,71 @@ public:
   }
 
 private:
+  void assembleMassMatrixIfConstant(std::true_type){
+    systemObj_.get().massMatrix(massMatrix_);
+  }
+
+  void assembleMassMatrixIfConstant(std::false_type){}
+
+  void massMatrixAndRhs(const StateType & odeState,
+			const independent_variable_type & evalTime,
+			RightHandSideType & rhs)
+  {
+    massMatrixAndRhsImpl(std::integral_constant<bool, constant_mass_matrix>(),
+			 odeState, evalTime, rhs);
+  }
+
+  void massMatrixAndRhsImpl(std::true_type,
+			    const StateType & odeState,
+			    const independent_variable_type & evalTime,
+			    RightHandSideType & rhs)
+  {
+    systemObj_.get().rhs(odeState, evalTime, rhs);
+  }
+
+  void massMatrixAndRhsImpl(std::false_type,
+			    const StateType & odeState,
+			    const independent_variable_type & evalTime,
+			    RightHandSideType & rhs)
+  {
+    systemObj_.get().massMatrixAndRhs(odeState, evalTime, massMatrix_, rhs);
+  }
+
+  // solve M x = b
+  template<class LinearSolver>
+  void solveWithMassMatrix(LinearSolver & solver,
+			   StateType & x,
+			   const RightHandSideType & b)
+  {
+    constexpr bool reuseFactorization = constant_mass_matrix
+      && linear_solver_can_factorize<
+	LinearSolver, mass_matrix_type, RightHandSideType, StateType>::value;
+    solveWithMassMatrixImpl(std::integral_constant<bool, reuseFactorization>(), solver, x, b);
+  }
+
+  template<class LinearSolver>
+  void solveWithMassMatrixImpl(std::true_type,
+			       LinearSolver & solver,
+			       StateType & x,
+			       const RightHandSideType & b)
+  {
+    // the solver checks the matrix against the one it factorized last,
+    // so a solver shared with other steppers (or refactorized by the
+    // caller on another matrix) is never used with the wrong factors
+    if (solver.factorizeIfChanged(massMatrix_)){
+      PRESSIOLOG_DEBUG("explicit stepper with MM: factorizing constant mass matrix");
+    }
+    solver.solveWithFactorization(b, x);
+  }
+
+  template<class LinearSolver>
+  void solveWithMassMatrixImpl(std::false_type,
+			       LinearSolver & solver,
+			       StateType & x,
+			       const RightHandSideType & b)
+  {
+    solver.solve(massMatrix_, x, b);
+  }
 
   template<class LinearSolver, class RhsObserverType>
   void doStepImpl(ode::ForwardEuler,
@@ -223,9 +326,9 @@ private:
     auto & fn = rhsInstance_;
     auto & x  = xInstances_[0];
 
-    systemObj_.get().massMatrixAndRhs(odeState, stepStartVal, massMatrix_, fn);
+    this->massMatrixAndRhs(odeState, stepStartVal, fn);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartVal, fn);
-    solver.solve(massMatrix_, x, fn);
+    this->solveWithMassMatrix(solver, x, fn);
 
     // need to do: y_n+1 = y_n + stepSize*x
     // odeState already contains y_n
@@ -257,9 +360,9 @@ private:
       // start up with Euler forward
 
       auto & x  = xInstances_[0];
-      systemObj_.get().massMatrixAndRhs(odeState, stepStartVal, massMatrix_, fn);
+      this->massMatrixAndRhs(odeState, stepStartVal, fn);
       rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartVal, fn);
-      solver.solve(massMatrix_, x, fn);
+      this->solveWithMassMatrix(solver, x, fn);
 
       // now compute new state y_n+1 = y_n + dt * x
       ::pressio::ops::update(odeState, one, x, stepSize);
@@ -269,9 +372,9 @@ private:
       auto & xnm1 = xInstances_[1];
       ::pressio::ops::deep_copy(xnm1, xn);
 
-      systemObj_.get().massMatrixAndRhs(odeState, stepStartVal, massMatrix_, fn);
+      this->massMatrixAndRhs(odeState, stepStartVal, fn);
       rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartVal, fn);
-      solver.solve(massMatrix_, xn, fn);
+      this->solveWithMassMatrix(solver, xn, fn);
 
       const auto cfn   = ::pressio::utils::Constants<scalar_type>::threeOvTwo()*stepSize;
       const auto cfnm1 = ::pressio::utils::Constants<scalar_type>::negOneHalf()*stepSize;
@@ -313,23 +416,23 @@ private:
     const independent_variable_type t_next{stepStartTime + stepSize};
 
     // rhs(u_n, t_n)
-    systemObj_.get().massMatrixAndRhs(odeState, stepStartTime, massMatrix_, rhs);
+    this->massMatrixAndRhs(odeState, stepStartTime, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs);
-    solver.solve(massMatrix_, x, rhs);
+    this->solveWithMassMatrix(solver, x, rhs);
     // u_1 = u_n + stepSize * x
     ::pressio::ops::update(auxState, zero, odeState, one, x, stepSize);
 
     // rhs(u_1, t_n+stepSize)
-    systemObj_.get().massMatrixAndRhs(auxState, t_next, massMatrix_, rhs);
+    this->massMatrixAndRhs(auxState, t_next, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_next, rhs);
-    solver.solve(massMatrix_, x, rhs);
+    this->solveWithMassMatrix(solver, x, rhs);
     // u_2 = 3/4*u_n + 1/4*u_1 + 1/4*stepSize*x
     ::pressio::ops::update(auxState, fourInv, odeState, threeOvFour, x, fourInv*stepSize);
 
     // rhs(u_2, t_n + 0.5*stepSize)
-    systemObj_.get().massMatrixAndRhs(auxState, t_phalf, massMatrix_, rhs);
+    this->massMatrixAndRhs(auxState, t_phalf, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_phalf, rhs);
-    solver.solve(massMatrix_, x, rhs);
+    this->solveWithMassMatrix(solver, x, rhs);
     // u_n+1 = 1/3*u_n + 2/3*u_2 + 2/3*stepSize*rhs(u_2, t_n+0.5*stepSize)
     ::pressio::ops::update(odeState, oneOvThree, auxState, twoOvThree, x, twoOvThree*stepSize);
   }
@@ -367,33 +470,33 @@ private:
 
     // stage 1:
     // rhs1 = rhs(y_n, t_n)
-    systemObj_.get().massMatrixAndRhs(odeState, stepStartTime, massMatrix_, rhs);
+    this->massMatrixAndRhs(odeState, stepStartTime, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, rhs);
-    solver.solve(massMatrix_, x1, rhs);
+    this->solveWithMassMatrix(solver, x1, rhs);
 
     // stage 2:
     // ytmp = y + rhs1*stepSize_half;
     this->rk4_stage_update_impl(auxState, odeState, x1, stepSize_half);
     // rhs2 = rhs(y_tmp, t_n+stepSize/2)
-    systemObj_.get().massMatrixAndRhs(auxState, t_phalf, massMatrix_, rhs);
+    this->massMatrixAndRhs(auxState, t_phalf, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_phalf, rhs);
-    solver.solve(massMatrix_, x2, rhs);
+    this->solveWithMassMatrix(solver, x2, rhs);
 
     // stage 3:
     // ytmp = y + rhs2*stepSize_half;
     this->rk4_stage_update_impl(auxState, odeState, x2, stepSize_half);
     // rhs3 = rhs(y_tmp)
-    systemObj_.get().massMatrixAndRhs(auxState, t_phalf, massMatrix_, rhs);
+    this->massMatrixAndRhs(auxState, t_phalf, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_phalf, rhs);
-    solver.solve(massMatrix_, x3, rhs);
+    this->solveWithMassMatrix(solver, x3, rhs);
 
     // stage 4:
     // ytmp = y + rhs3*stepSize;
     this->rk4_stage_update_impl(auxState, odeState, x3, stepSize);
     // rhs3 = rhs(y_tmp)
-    systemObj_.get().massMatrixAndRhs(auxState, t_next, massMatrix_, rhs);
+    this->massMatrixAndRhs(auxState, t_next, rhs);
     rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(3), t_next, rhs);
-    solver.solve(massMatrix_, x4, rhs);
+    this->solveWithMassMatrix(solver, x4, rhs);
 
     ::pressio::ops::update(odeState, one,
 			   x1, stepSize6, x2, stepSize3,
@@ -53,27 +53,117 @@
 
 namespace pressio{ namespace ode{ namespace impl{
 
+template<class T, class = void>
+struct supports_embedded_error_norm : std::false_type{};
+
+template<class T>
+struct supports_embedded_error_norm<
+  T,
+  mpl::void_t<
+    decltype( ::pressio::ops::norm2(std::declval<T const &>()) ),
+    decltype( ::pressio::ops::extent(std::declval<T const &>(), 0) ),
+    decltype( ::pressio::ops::abs(std::declval<T &>(), std::declval<T const &>()) ),
+    decltype( ::pressio::ops::fill(std::declval<T &>(),
+				   std::declval<typename ::pressio::Traits<T>::scalar_type>()) ),
+    decltype( ::pressio::ops::abs_pow(std::declval<T &>(), std::declval<T const &>(),
+				      std::declval<typename ::pressio::Traits<T>::scalar_type>(),
+				      std::declval<typename ::pressio::Traits<T>::scalar_type>()) ),
+    decltype( ::pressio::ops::elementwise_multiply(
+		std::declval<typename ::pressio::Traits<T>::scalar_type>(),
+		std::declval<T const &>(), std::declval<T const &>(),
+		std::declval<typename ::pressio::Traits<T>::scalar_type>(),
+		std::declval<T &>()) )
+    >
+  > : std::true_type{};
+
+// number of rhs and of candidate states needed by each scheme
+// (the embedded schemes use two extra states to compute the error norm)
+template<class SchemeTag> struct explicit_stepper_storage_size;
+
+template<> struct explicit_stepper_storage_size<void>{
+  static constexpr std::size_t num_rhs = 0;
+  static constexpr std::size_t num_embedded_states = 0;
+};
+
+template<std::size_t NumRhs, std::size_t NumEmbeddedStates>
+struct explicit_stepper_storage_size_impl{
+  static constexpr std::size_t num_rhs = NumRhs;
+  static constexpr std::size_t num_embedded_states = NumEmbeddedStates;
+};
+
+template<> struct explicit_stepper_storage_size<ode::ForwardEuler>
+  : explicit_stepper_storage_size_impl<1,0>{};
+template<> struct explicit_stepper_storage_size<ode::RungeKutta4>
+  : explicit_stepper_storage_size_impl<4,0>{};
+template<> struct explicit_stepper_storage_size<ode::AdamsBashforth2>
+  : explicit_stepper_storage_size_impl<2,0>{};
+template<> struct explicit_stepper_storage_size<ode::SSPRungeKutta3>
+  : explicit_stepper_storage_size_impl<1,0>{};
+template<> struct explicit_stepper_storage_size<ode::DormandPrince45>
+  : explicit_stepper_storage_size_impl<7,3>{};
+template<> struct explicit_stepper_storage_size<ode::BogackiShampine23>
+  : explicit_stepper_storage_size_impl<4,3>{};
+template<> struct explicit_stepper_storage_size<ode::LowStorageRungeKutta4>
+  : explicit_stepper_storage_size_impl<1,0>{};
+
+// when the scheme is only known at runtime, the storage is a vector
+// sized by the constructor, otherwise it is an array of exact size
+template<class SchemeTag, class T, std::size_t N>
+struct explicit_stepper_container{ using type = std::array<T, N>; };
+
+template<class T, std::size_t N>
+struct explicit_stepper_container<void, T, N>{ using type = std::vector<T>; };
+
 // this class is NOT meant for direct instantiation.
 // One needs to use the public create_* functions because
 // templates are handled and passed properly there.
+//
+// SchemeTag == void: the scheme is chosen at runtime and each step
+// branches on it. Otherwise, SchemeTag is one of the explicit scheme
+// tags, the storage has exactly the size needed by that scheme and
+// each step calls the corresponding implementation directly.
 template<
   class StateType,
   class IndVarType,
   class SystemType,
-  class RightHandSideType
+  class RightHandSideType,
+  class SchemeTag = void
   >
 class ExplicitStepperNoMassMatrixImpl{
 
 public:
   using independent_variable_type  = IndVarType;
   using state_type  = StateType;
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
 
 private:
+  using storage_size = explicit_stepper_storage_size<SchemeTag>;
+
   StepScheme name_;
   ::pressio::utils::InstanceOrReferenceWrapper<SystemType> systemObj_;
-  std::vector<RightHandSideType> rhsInstances_;
+  typename explicit_stepper_container<
+    SchemeTag, RightHandSideType, storage_size::num_rhs>::type rhsInstances_;
   StateType auxiliaryState_;
 
+  // only used by the embedded schemes: the candidate new state is computed
+  // here and copied to the ode state only if the step is accepted
+  typename explicit_stepper_container<
+    SchemeTag, StateType, storage_size::num_embedded_states>::type embeddedStates_;
+  bool rejectSteps_ = false;
+  scalar_type absTol_ = static_cast<scalar_type>(1e-6);
+  scalar_type relTol_ = static_cast<scalar_type>(1e-6);
+  scalar_type errorEstimate_ = {};
+
+  // embedded schemes only (first same as last): the last stage of an accepted
+  // step is the rhs at the start of the next one. Instead of copying it, the
+  // slots of the first and last stage swap roles: firstStageSlot_ is 0 or the
+  // last index. The stored rhs is reused if the step continues the one it
+  // was computed for, i.e. has step number fsalStep_ and starts at fsalTime_.
+  std::size_t firstStageSlot_ = 0;
+  bool fsalValid_ = false;
+  typename ::pressio::ode::StepCount::value_type fsalStep_ = {};
+  independent_variable_type fsalTime_ = {};
+
 public:
   ExplicitStepperNoMassMatrixImpl() = delete;
   ExplicitStepperNoMassMatrixImpl(const ExplicitStepperNoMassMatrixImpl &) = default;
@@ -116,7 +206,73 @@ public:
       auxiliaryState_{systemObj.createState()}
   {}
 
+  ExplicitStepperNoMassMatrixImpl(ode::DormandPrince45,
+				  SystemType && systemObj)
+    : name_(StepScheme::DormandPrince45),
+      systemObj_(std::forward<SystemType>(systemObj)),
+      rhsInstances_{systemObj.createRhs(),
+		    systemObj.createRhs(),
+		    systemObj.createRhs(),
+		    systemObj.createRhs(),
+		    systemObj.createRhs(),
+		    systemObj.createRhs(),
+		    systemObj.createRhs()},
+      auxiliaryState_{systemObj.createState()},
+      embeddedStates_{systemObj.createState(),
+		      systemObj.createState(),
+		      systemObj.createState()}
+  {}
+
+  ExplicitStepperNoMassMatrixImpl(ode::BogackiShampine23,
+				  SystemType && systemObj)
+    : name_(StepScheme::BogackiShampine23),
+      systemObj_(std::forward<SystemType>(systemObj)),
+      rhsInstances_{systemObj.createRhs(),
+		    systemObj.createRhs(),
+		    systemObj.createRhs(),
+		    systemObj.createRhs()},
+      auxiliaryState_{systemObj.createState()},
+      embeddedStates_{systemObj.createState(),
+		      systemObj.createState(),
+		      systemObj.createState()}
+  {}
+
+  // the low-storage scheme only needs one rhs and one auxiliary state,
+  // the latter accumulating the stage increments
+  ExplicitStepperNoMassMatrixImpl(ode::LowStorageRungeKutta4,
+				  SystemType && systemObj)
+    : name_(StepScheme::LowStorageRungeKutta4),
+      systemObj_(std::forward<SystemType>(systemObj)),
+      rhsInstances_{systemObj.createRhs()},
+      auxiliaryState_{systemObj.createState()}
+  {}
+
 public:
+  /*
+    embedded schemes only: once the tolerances are set, a step whose
+    scaled error estimate is > 1 or not finite is rejected by throwing
+    pressio::eh::TimeStepFailure and leaving the state untouched,
+    so that it can be retried with a smaller step size.
+    The rhs at the new state of an accepted step is reused as the first
+    stage of the next step, so the state must not be changed between steps.
+  */
+  void setErrorControlTolerances(scalar_type absTol, scalar_type relTol){
+    absTol_ = absTol;
+    relTol_ = relTol;
+    rejectSteps_ = true;
+  }
+
+  // scaled error estimate of the most recently attempted step
+  scalar_type errorEstimate() const{ return errorEstimate_; }
+
+  // order of the lower-order solution of the embedded pair,
+  // zero for schemes without error estimate
+  int errorEstimateOrder() const{
+    if (name_ == ode::StepScheme::DormandPrince45){ return 4; }
+    else if (name_ == ode::StepScheme::BogackiShampine23){ return 2; }
+    else{ return 0; }
+  }
+
   void operator()(StateType & odeState,
 		  const ::pressio::ode::StepStartAt<independent_variable_type> & stepStartVal,
 		  ::pressio::ode::StepCount step,
@@ -137,6 +293,31 @@ public:
 		  ::pressio::ode::StepCount step,
 		  ::pressio::ode::StepSize<independent_variable_type> stepSize,
 		  RhsObserverType & rhsObserver)
+  {
+    doStep(odeState, stepStartVal, step, stepSize, rhsObserver);
+  }
+
+private:
+  template<class RhsObserverType, class _SchemeTag = SchemeTag>
+  mpl::enable_if_t<!std::is_void<_SchemeTag>::value>
+  doStep(StateType & odeState,
+	 const ::pressio::ode::StepStartAt<independent_variable_type> & stepStartVal,
+	 ::pressio::ode::StepCount step,
+	 ::pressio::ode::StepSize<independent_variable_type> stepSize,
+	 RhsObserverType & rhsObserver)
+  {
+    doStepImpl(_SchemeTag(), odeState,
+	       stepStartVal.get(), stepSize.get(),
+	       step, rhsObserver);
+  }
+
+  template<class RhsObserverType, class _SchemeTag = SchemeTag>
+  mpl::enable_if_t<std::is_void<_SchemeTag>::value>
+  doStep(StateType & odeState,
+	 const ::pressio::ode::StepStartAt<independent_variable_type> & stepStartVal,
+	 ::pressio::ode::StepCount step,
+	 ::pressio::ode::StepSize<independent_variable_type> stepSize,
+	 RhsObserverType & rhsObserver)
   {
     if (name_ == ode::StepScheme::ForwardEuler){
       doStepImpl(ode::ForwardEuler(), odeState,
@@ -161,9 +342,26 @@ public:
 		 stepStartVal.get(), stepSize.get(),
 		 step, rhsObserver);
     }
+
+    else if (name_ == ode::StepScheme::DormandPrince45){
+      doStepImpl(ode::DormandPrince45(), odeState,
+		 stepStartVal.get(), stepSize.get(),
+		 step, rhsObserver);
+    }
+
+    else if (name_ == ode::StepScheme::BogackiShampine23){
+      doStepImpl(ode::BogackiShampine23(), odeState,
+		 stepStartVal.get(), stepSize.get(),
+		 step, rhsObserver);
+    }
+
+    else if (name_ == ode::StepScheme::LowStorageRungeKutta4){
+      doStepImpl(ode::LowStorageRungeKutta4(), odeState,
+		 stepStartVal.get(), stepSize.get(),
+		 step, rhsObserver);
+    }
   }
 
-private:
   template<class RhsObserverType>
   void doStepImpl(ode::ForwardEuler,
 		  StateType & odeState,
@@ -339,6 +537,279 @@ private:
 			   rhs3, stepSize3, rhs4, stepSize6);
   }
 
+  template<class RhsObserverType>
+  void doStepImpl(ode::DormandPrince45,
+		  StateType & odeState,
+		  const independent_variable_type & stepStartTime,
+		  const independent_variable_type & stepSize,
+		  ::pressio::ode::StepCount stepNumber,
+		  RhsObserverType & rhsObserver)
+  {
+    PRESSIOLOG_DEBUG("dormand-prince45 stepper: do step");
+
+    auto & k1 = rhsInstances_[firstStageSlot_];
+    auto & k2 = rhsInstances_[1];
+    auto & k3 = rhsInstances_[2];
+    auto & k4 = rhsInstances_[3];
+    auto & k5 = rhsInstances_[4];
+    auto & k6 = rhsInstances_[5];
+    auto & k7 = rhsInstances_[6 - firstStageSlot_];
+    auto & yNew = embeddedStates_[0];
+
+    constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+    const scalar_type h{stepSize};
+
+    // see Hairer, Norsett, Wanner, Solving ODEs I, table 5.2
+    const independent_variable_type t2{stepStartTime + h/5};
+    const independent_variable_type t3{stepStartTime + h*3/10};
+    const independent_variable_type t4{stepStartTime + h*4/5};
+    const independent_variable_type t5{stepStartTime + h*8/9};
+    const independent_variable_type t_next{stepStartTime + stepSize};
+
+    // stage 1, unless known from the last stage of the previous step
+    firstSameAsLastStage(odeState, stepStartTime, stepNumber, k1);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, k1);
+
+    // stage 2
+    ::pressio::ops::update(auxiliaryState_, zero, odeState, one, k1, h/5);
+    systemObj_.get().rhs(auxiliaryState_, t2, k2);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t2, k2);
+
+    // stage 3
+    ::pressio::ops::update(auxiliaryState_, zero, odeState, one, k1, h*3/40);
+    ::pressio::ops::update(auxiliaryState_, one, k2, h*9/40);
+    systemObj_.get().rhs(auxiliaryState_, t3, k3);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t3, k3);
+
+    // stage 4
+    ::pressio::ops::update(auxiliaryState_, zero, odeState, one, k1, h*44/45);
+    ::pressio::ops::update(auxiliaryState_, one, k2, -h*56/15, k3, h*32/9);
+    systemObj_.get().rhs(auxiliaryState_, t4, k4);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(3), t4, k4);
+
+    // stage 5
+    ::pressio::ops::update(auxiliaryState_, zero, odeState, one, k1, h*19372/6561);
+    ::pressio::ops::update(auxiliaryState_, one, k2, -h*25360/2187, k3, h*64448/6561);
+    ::pressio::ops::update(auxiliaryState_, one, k4, -h*212/729);
+    systemObj_.get().rhs(auxiliaryState_, t5, k5);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(4), t5, k5);
+
+    // stage 6
+    ::pressio::ops::update(auxiliaryState_, zero, odeState, one, k1, h*9017/3168);
+    ::pressio::ops::update(auxiliaryState_, one,
+			   k2, -h*355/33, k3, h*46732/5247,
+			   k4, h*49/176, k5, -h*5103/18656);
+    systemObj_.get().rhs(auxiliaryState_, t_next, k6);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(5), t_next, k6);
+
+    // 5th order solution
+    ::pressio::ops::update(yNew, zero, odeState, one, k1, h*35/384);
+    ::pressio::ops::update(yNew, one,
+			   k3, h*500/1113, k4, h*125/192,
+			   k5, -h*2187/6784, k6, h*11/84);
+
+    // stage 7, evaluated at the new state
+    systemObj_.get().rhs(yNew, t_next, k7);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(6), t_next, k7);
+
+    // difference between the 5th and 4th order solutions
+    ::pressio::ops::update(auxiliaryState_, zero,
+			   k1, h*71/57600, k3, -h*71/16695,
+			   k4, h*71/1920, k5, -h*17253/339200);
+    ::pressio::ops::update(auxiliaryState_, one, k6, h*22/525, k7, -h/40);
+
+    acceptOrRejectEmbeddedStep(odeState, yNew, auxiliaryState_,
+			       stepNumber, t_next, 6);
+  }
+
+  template<class RhsObserverType>
+  void doStepImpl(ode::BogackiShampine23,
+		  StateType & odeState,
+		  const independent_variable_type & stepStartTime,
+		  const independent_variable_type & stepSize,
+		  ::pressio::ode::StepCount stepNumber,
+		  RhsObserverType & rhsObserver)
+  {
+    PRESSIOLOG_DEBUG("bogacki-shampine23 stepper: do step");
+
+    auto & k1 = rhsInstances_[firstStageSlot_];
+    auto & k2 = rhsInstances_[1];
+    auto & k3 = rhsInstances_[2];
+    auto & k4 = rhsInstances_[3 - firstStageSlot_];
+    auto & yNew = embeddedStates_[0];
+
+    constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+    const scalar_type h{stepSize};
+
+    const independent_variable_type t_phalf{stepStartTime + h/2};
+    const independent_variable_type t_p3q{stepStartTime + h*3/4};
+    const independent_variable_type t_next{stepStartTime + stepSize};
+
+    // stage 1, unless known from the last stage of the previous step
+    firstSameAsLastStage(odeState, stepStartTime, stepNumber, k1);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(0), stepStartTime, k1);
+
+    // stage 2
+    ::pressio::ops::update(auxiliaryState_, zero, odeState, one, k1, h/2);
+    systemObj_.get().rhs(auxiliaryState_, t_phalf, k2);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(1), t_phalf, k2);
+
+    // stage 3
+    ::pressio::ops::update(auxiliaryState_, zero, odeState, one, k2, h*3/4);
+    systemObj_.get().rhs(auxiliaryState_, t_p3q, k3);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(2), t_p3q, k3);
+
+    // 3rd order solution
+    ::pressio::ops::update(yNew, zero, odeState, one, k1, h*2/9);
+    ::pressio::ops::update(yNew, one, k2, h/3, k3, h*4/9);
+
+    // stage 4, evaluated at the new state
+    systemObj_.get().rhs(yNew, t_next, k4);
+    rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(3), t_next, k4);
+
+    // difference between the 3rd and 2nd order solutions
+    ::pressio::ops::update(auxiliaryState_, zero,
+			   k1, -h*5/72, k2, h/12,
+			   k3, h/9, k4, -h/8);
+
+    acceptOrRejectEmbeddedStep(odeState, yNew, auxiliaryState_,
+			       stepNumber, t_next, 3);
+  }
+
+  template<class RhsObserverType>
+  void doStepImpl(ode::LowStorageRungeKutta4,
+		  StateType & odeState,
+		  const independent_variable_type & stepStartTime,
+		  const independent_variable_type & stepSize,
+		  ::pressio::ode::StepCount stepNumber,
+		  RhsObserverType & rhsObserver)
+  {
+    PRESSIOLOG_DEBUG("low-storage rk4 stepper: do step");
+
+    /*
+      five-stage, fourth-order 2N-storage scheme, see
+      Carpenter, Kennedy, NASA TM-109112, 1994, solution 3.
+      for each stage i:
+	dy = A_i*dy + stepSize*rhs(y, t_n + c_i*stepSize)
+	y  = y + B_i*dy
+      so only the state and the increment dy need to be kept
+      (plus the rhs that the system writes into)
+    */
+    constexpr scalar_type A[5] = {
+      static_cast<scalar_type>(0.),
+      static_cast<scalar_type>(-567301805773.)/1357537059087.,
+      static_cast<scalar_type>(-2404267990393.)/2016746695238.,
+      static_cast<scalar_type>(-3550918686646.)/2091501179385.,
+      static_cast<scalar_type>(-1275806237668.)/842570457699.};
+    constexpr scalar_type B[5] = {
+      static_cast<scalar_type>(1432997174477.)/9575080441755.,
+      static_cast<scalar_type>(5161836677717.)/13612068292357.,
+      static_cast<scalar_type>(1720146321549.)/2090206949498.,
+      static_cast<scalar_type>(3134564353537.)/4481467310338.,
+      static_cast<scalar_type>(2277821191437.)/14882151754819.};
+    constexpr scalar_type C[5] = {
+      static_cast<scalar_type>(0.),
+      static_cast<scalar_type>(1432997174477.)/9575080441755.,
+      static_cast<scalar_type>(2526269341429.)/6820363962896.,
+      static_cast<scalar_type>(2006345519317.)/3224310063776.,
+      static_cast<scalar_type>(2802321613138.)/2924317926251.};
+
+    constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
+    auto & rhs = rhsInstances_[0];
+    auto & dy = auxiliaryState_;
+
+    for (int i=0; i<5; ++i){
+      const independent_variable_type t_i{stepStartTime + C[i]*stepSize};
+      systemObj_.get().rhs(odeState, t_i, rhs);
+      rhsObserver(stepNumber, ::pressio::ode::IntermediateStepCount(i), t_i, rhs);
+
+      ::pressio::ops::update(dy, A[i], rhs, stepSize);
+      ::pressio::ops::update(odeState, one, dy, B[i]);
+    }
+  }
+
+  template<class rhs_t>
+  void firstSameAsLastStage(const StateType & odeState,
+			    const independent_variable_type & stepStartTime,
+			    ::pressio::ode::StepCount stepNumber,
+			    rhs_t & k1)
+  {
+    if (fsalValid_ && stepNumber.get() == fsalStep_ && stepStartTime == fsalTime_){
+      return;
+    }
+    systemObj_.get().rhs(odeState, stepStartTime, k1);
+    // still valid if this step is rejected and retried
+    fsalValid_ = true;
+    fsalStep_ = stepNumber.get();
+    fsalTime_ = stepStartTime;
+  }
+
+  // lastStageSlot: slot of the last stage when the first one is in slot 0
+  void acceptOrRejectEmbeddedStep(StateType & odeState,
+				  const StateType & yNew,
+				  const StateType & errorVector,
+				  ::pressio::ode::StepCount stepNumber,
+				  const independent_variable_type & stepEndTime,
+				  std::size_t lastStageSlot)
+  {
+    errorEstimate_ = scaledErrorNorm(odeState, yNew, errorVector);
+    PRESSIOLOG_DEBUG("embedded stepper: scaled error estimate = {:.6e}", errorEstimate_);
+
+    // a nan or inf estimate fails the test too
+    if (rejectSteps_ && !(errorEstimate_ <= ::pressio::utils::Constants<scalar_type>::one())){
+      throw ::pressio::eh::TimeStepFailure();
+    }
+    ::pressio::ops::deep_copy(odeState, yNew);
+
+    firstStageSlot_ = lastStageSlot - firstStageSlot_;
+    fsalStep_ = stepNumber.get() + 1;
+    fsalTime_ = stepEndTime;
+  }
+
+  // rms over i of err_i / (absTol + relTol*max(|y_n,i|, |y_n+1,i|)),
+  // see Hairer, Norsett, Wanner, Solving ODEs I, sec II.4.
+  // The componentwise max is computed as (a + b + |a - b|)/2.
+  template<class _StateType = StateType>
+  mpl::enable_if_t<supports_embedded_error_norm<_StateType>::value, scalar_type>
+  scaledErrorNorm(const _StateType & yOld,
+		  const _StateType & yNew,
+		  const _StateType & errorVector)
+  {
+    using std::sqrt;
+    constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+    constexpr auto two  = ::pressio::utils::Constants<scalar_type>::two();
+    constexpr auto tiny = std::numeric_limits<scalar_type>::min();
+
+    auto & weights = embeddedStates_[1];
+    auto & tmp = embeddedStates_[2];
+    ::pressio::ops::abs(weights, yOld);
+    ::pressio::ops::abs(tmp, yNew);
+    ::pressio::ops::update(weights, one, tmp, one);
+    ::pressio::ops::update(tmp, -two, weights, one);
+    ::pressio::ops::abs(tmp, tmp);
+    ::pressio::ops::update(weights, relTol_/two, tmp, relTol_/two);
+    ::pressio::ops::fill(tmp, absTol_);
+    ::pressio::ops::update(weights, one, tmp, one);
+
+    ::pressio::ops::abs_pow(tmp, weights, -one, tiny);
+    ::pressio::ops::elementwise_multiply(one, errorVector, tmp, zero, weights);
+    const auto n = static_cast<scalar_type>(::pressio::ops::extent(errorVector, 0));
+    return ::pressio::ops::norm2(weights)/sqrt(n);
+  }
+
+  template<class _StateType = StateType>
+  mpl::enable_if_t<!supports_embedded_error_norm<_StateType>::value, scalar_type>
+  scaledErrorNorm(const _StateType & /*yOld*/,
+		  const _StateType & /*yNew*/,
+		  const _StateType & /*errorVector*/)
+  {
+    throw std::runtime_error("embedded schemes require ops::norm2, extent, abs, fill, "
+			     "abs_pow and elementwise_multiply for the state");
+  }
+
   template<class rhs_t, class FactorType>
   void rk4_stage_update_impl(StateType & yIn,
 			     const StateType & stateIn,
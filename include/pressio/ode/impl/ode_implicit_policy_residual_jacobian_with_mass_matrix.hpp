@@ -140,6 +140,56 @@ public:
     }
   }
 
+  // same as above for a scheme known at compile time,
+  // used by the steppers created with the scheme as template argument
+  template <
+    class StencilStatesContainerType,
+    class StencilVelocitiesContainerType
+    >
+  void operator()(BDF1,
+		  const StateType & predictedState,
+		  const StencilStatesContainerType & stencilStatesManager,
+		  StencilVelocitiesContainerType & stencilVelocities,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type*> Jo) const
+#else
+                  jacobian_type* Jo) const
+#endif
+  {
+    (*this).template compute_impl_bdf1
+      (predictedState, stencilStatesManager,
+       stencilVelocities, rhsEvaluationTime.get(),
+       dt.get(), step.get(), R, Jo);
+  }
+
+  template <
+    class StencilStatesContainerType,
+    class StencilVelocitiesContainerType
+    >
+  void operator()(BDF2,
+		  const StateType & predictedState,
+		  const StencilStatesContainerType & stencilStatesManager,
+		  StencilVelocitiesContainerType & stencilVelocities,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type*> Jo) const
+#else
+                  jacobian_type* Jo) const
+#endif
+  {
+    (*this).template compute_impl_bdf2
+      (predictedState, stencilStatesManager,
+       stencilVelocities, rhsEvaluationTime.get(),
+       dt.get(), step.get(), R, Jo);
+  }
+
 private:
   template <
   class StencilStatesContainerType,
@@ -117,20 +117,46 @@ public:
 	       dt.get(), step.get(), R, Jo);
   }
 
+  // same as above for a scheme known at compile time,
+  // used by the steppers created with the scheme as template argument
+  template <
+    class SchemeTag,
+    class StencilStatesContainerType,
+    class StencilVelocitiesContainerType>
+  mpl::enable_if_t< is_implicit_scheme_tag<SchemeTag>::value >
+  operator()(SchemeTag tag,
+	     const StateType & predictedState,
+	     const StencilStatesContainerType & stencilStatesManager,
+	     StencilVelocitiesContainerType & stencilVelocities,
+	     const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+	     ::pressio::ode::StepCount step,
+	     const ::pressio::ode::StepSize<IndVarType> & dt,
+	     ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+	     std::optional<jacobian_type*> Jo) const
+#else
+	     jacobian_type* Jo) const
+#endif
+  {
+    trampoline(tag, predictedState, stencilStatesManager,
+	       stencilVelocities, rhsEvaluationTime.get(),
+	       dt.get(), step.get(), R, Jo);
+  }
+
 private:
   template <class... Args>
   void trampoline(StepScheme name, Args && ...args) const
   {
     if (name == StepScheme::BDF1){
-      (*this).template compute_impl_bdf1(std::forward<Args>(args)...);
+      trampoline(BDF1(), std::forward<Args>(args)...);
     }
 
     else if (name == StepScheme::BDF2){
-      (*this).template compute_impl_bdf2(std::forward<Args>(args)...);
+      trampoline(BDF2(), std::forward<Args>(args)...);
     }
 
     else if (name == StepScheme::CrankNicolson){
-      this->compute_impl_cn(std::forward<Args>(args)...);
+      trampoline(CrankNicolson(), std::forward<Args>(args)...);
     }
 
     else{
@@ -138,6 +164,21 @@ private:
     }
   }
 
+  template <class... Args>
+  void trampoline(BDF1, Args && ...args) const{
+    (*this).template compute_impl_bdf1(std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  void trampoline(BDF2, Args && ...args) const{
+    (*this).template compute_impl_bdf2(std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  void trampoline(CrankNicolson, Args && ...args) const{
+    this->compute_impl_cn(std::forward<Args>(args)...);
+  }
+
   //
   // BDF1
   //
@@ -79,9 +79,9 @@ private:
   typename StepCount::value_type stepNumber_  = {};
 
   ::pressio::utils::InstanceOrReferenceWrapper<SystemType> systemObj_;
+  // rotating the stencil storage, and rotating it back if the step
+  // fails, provides the strong guarantee for handling exceptions
   stencil_states_t stencilStates_;
-  // state object to ensure the strong guarantee for handling excpetions
-  StateType recoveryState_;
 
 public:
   StepperArbitrary() = delete;
@@ -91,8 +91,7 @@ public:
 
   StepperArbitrary(SystemType && systemObj)
     : systemObj_(std::forward<SystemType>(systemObj)),
-      stencilStates_(systemObj.createState()), //stencilstates handles right semantics
-      recoveryState_{systemObj.createState()}
+      stencilStates_(systemObj.createState()) //stencilstates handles right semantics
     {}
 
 public:
@@ -121,14 +120,14 @@ public:
     rhsEvaluationTime_ = stepStartVal.get() + dt_;
     stepNumber_ = stepNumber.get();
 
-    updateAuxiliaryStorage<numAuxStates>(odeState);
+    updateAuxiliaryStorage(odeState);
 
     try{
       solver.solve(*this, odeState, std::forward<Args>(args)...);
     }
     catch (::pressio::eh::NonlinearSolveFailure const & e)
     {
-      rollBackStates<numAuxStates>(odeState);
+      rollBackStates(odeState);
       throw ::pressio::eh::TimeStepFailure();
     }
   }
@@ -205,73 +204,19 @@ public:
   }
 
 private:
-  // one aux states
-  template<std::size_t nAux>
-  mpl::enable_if_t<nAux==1>
-  updateAuxiliaryStorage(const StateType & odeState)
+  // y_n -> y_n-1 -> ... is only a rotation of the stencil storage
+  void updateAuxiliaryStorage(const StateType & odeState)
   {
+    stencilStates_.rotate();
     auto & y_n = stencilStates_(ode::n());
-    ::pressio::ops::deep_copy(recoveryState_, y_n);
     ::pressio::ops::deep_copy(y_n, odeState);
   }
 
-  template<std::size_t nAux>
-  mpl::enable_if_t<nAux==1>
-  rollBackStates(StateType & odeState)
+  void rollBackStates(StateType & odeState)
   {
     auto & y_n = stencilStates_(ode::n());
     ::pressio::ops::deep_copy(odeState, y_n);
-    ::pressio::ops::deep_copy(y_n, recoveryState_);
-  }
-
-  // two aux states
-  template<std::size_t nAux>
-  mpl::enable_if_t<nAux==2>
-  updateAuxiliaryStorage(const StateType & odeState)
-  {
-    auto & y_n = stencilStates_(ode::n());
-    auto & y_nm1 = stencilStates_(ode::nMinusOne());
-    ::pressio::ops::deep_copy(recoveryState_, y_nm1);
-    ::pressio::ops::deep_copy(y_nm1, y_n);
-    ::pressio::ops::deep_copy(y_n, odeState);
-  }
-
-  template<std::size_t nAux>
-  mpl::enable_if_t<nAux==2>
-  rollBackStates(StateType & odeState)
-  {
-    auto & y_n = stencilStates_(ode::n());
-    auto & y_nm1 = stencilStates_(ode::nMinusOne());
-    ::pressio::ops::deep_copy(odeState, y_n);
-    ::pressio::ops::deep_copy(y_n, y_nm1);
-    ::pressio::ops::deep_copy(y_nm1, recoveryState_);
-  }
-
-  // three aux states
-  template<std::size_t nAux>
-  mpl::enable_if_t<nAux==3>
-  updateAuxiliaryStorage(const StateType & odeState)
-  {
-    auto & y_n = stencilStates_(ode::n());
-    auto & y_nm1 = stencilStates_(ode::nMinusOne());
-    auto & y_nm2 = stencilStates_(ode::nMinusTwo());
-    ::pressio::ops::deep_copy(recoveryState_, y_nm2);
-    ::pressio::ops::deep_copy(y_nm2, y_nm1);
-    ::pressio::ops::deep_copy(y_nm1, y_n);
-    ::pressio::ops::deep_copy(y_n, odeState);
-  }
-
-  template<std::size_t nAux>
-  mpl::enable_if_t<nAux==3>
-  rollBackStates(StateType & odeState)
-  {
-    auto & y_n = stencilStates_(ode::n());
-    auto & y_nm1 = stencilStates_(ode::nMinusOne());
-    auto & y_nm2 = stencilStates_(ode::nMinusTwo());
-    ::pressio::ops::deep_copy(odeState, y_n);
-    ::pressio::ops::deep_copy(y_n, y_nm1);
-    ::pressio::ops::deep_copy(y_nm1, y_nm2);
-    ::pressio::ops::deep_copy(y_nm2, recoveryState_);
+    stencilStates_.rotateBack();
   }
 };
 
@@ -51,12 +51,54 @@
 
 namespace pressio{ namespace ode{ namespace impl{
 
+// number of stencil states and of stencil rhs needed by each scheme
+template<class SchemeTag> struct implicit_stepper_stencil_size;
+
+template<std::size_t NumStates, std::size_t NumRhs>
+struct implicit_stepper_stencil_size_impl{
+  static constexpr std::size_t num_states = NumStates;
+  static constexpr std::size_t num_rhs = NumRhs;
+};
+
+template<> struct implicit_stepper_stencil_size<ode::BDF1>
+  : implicit_stepper_stencil_size_impl<1,0>{};
+template<> struct implicit_stepper_stencil_size<ode::BDF2>
+  : implicit_stepper_stencil_size_impl<2,0>{};
+template<> struct implicit_stepper_stencil_size<ode::CrankNicolson>
+  : implicit_stepper_stencil_size_impl<1,2>{};
+
+// when the scheme is only known at runtime, the stencils are dynamic
+// containers sized by the constructor, otherwise static ones of exact size
+template<class SchemeTag, class StateType, class ResidualType>
+struct implicit_stepper_stencil_containers{
+  using states_type = ImplicitStencilStatesStaticContainer<
+    StateType, implicit_stepper_stencil_size<SchemeTag>::num_states>;
+  using rhs_type = ImplicitStencilRightHandSideStaticContainer<
+    ResidualType, implicit_stepper_stencil_size<SchemeTag>::num_rhs>;
+};
+
+template<class StateType, class ResidualType>
+struct implicit_stepper_stencil_containers<void, StateType, ResidualType>{
+  using states_type = ImplicitStencilStatesDynamicContainer<StateType>;
+  using rhs_type = ImplicitStencilRightHandSideDynamicContainer<ResidualType>;
+};
+
+/*
+  SchemeTag == void: the scheme is chosen at runtime and each step and
+  each residual/jacobian evaluation branches on it.
+  Otherwise, SchemeTag is BDF1, BDF2 or CrankNicolson, the stencils have
+  exactly the size needed by that scheme, and the step as well as the
+  policy are called with the tag, so there is no runtime branching.
+  This requires the policy to accept the tag in place of the StepScheme
+  value, as the policies created from a system do.
+*/
 template<
   class IndVarType,
   class StateType,
   class ResidualType,
   class JacobianType,
-  class ResidualJacobianPolicyType
+  class ResidualJacobianPolicyType,
+  class SchemeTag = void
   >
 class ImplicitStepperStandardImpl
 {
@@ -75,21 +117,20 @@ private:
   IndVarType dt_ = {};
   int32_t step_number_  = {};
 
-  // state object to ensure the strong guarantee for handling excpetions
-  state_type recovery_state_;
-
   // stencilStates contains:
   // for bdf1: y_n
   // for bdf2: y_n, y_n-1
   // for cn  : y_n
-  ImplicitStencilStatesDynamicContainer<StateType> stencil_states_;
+  using stencil_containers = implicit_stepper_stencil_containers<
+    SchemeTag, StateType, ResidualType>;
+  typename stencil_containers::states_type stencil_states_;
 
   ::pressio::utils::InstanceOrReferenceWrapper<ResidualJacobianPolicyType> rj_policy_;
 
   // stencilRightHandSide contains:
   // for bdf1,2: nothing
   // for cn:  f(y_n,t_n) and f(y_np1, t_np1)
-  mutable ImplicitStencilRightHandSideDynamicContainer<ResidualType> stencil_rhs_;
+  mutable typename stencil_containers::rhs_type stencil_rhs_;
 
 public:
   ImplicitStepperStandardImpl() = delete;
@@ -101,7 +142,6 @@ public:
   ImplicitStepperStandardImpl(::pressio::ode::BDF1,
 			      ResidualJacobianPolicyType && rjPolicyObj)
     : name_(StepScheme::BDF1),
-      recovery_state_{rjPolicyObj.createState()},
       stencil_states_{rjPolicyObj.createState()},
       rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj))
   {}
@@ -110,7 +150,6 @@ public:
   ImplicitStepperStandardImpl(::pressio::ode::BDF2,
 			      ResidualJacobianPolicyType && rjPolicyObj)
     : name_(StepScheme::BDF2),
-      recovery_state_{rjPolicyObj.createState()},
       stencil_states_{rjPolicyObj.createState(),
 		      rjPolicyObj.createState()},
       rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj))
@@ -120,13 +159,26 @@ public:
   ImplicitStepperStandardImpl(::pressio::ode::CrankNicolson,
 			      ResidualJacobianPolicyType && rjPolicyObj)
     : name_(StepScheme::CrankNicolson),
-      recovery_state_{rjPolicyObj.createState()},
       stencil_states_{rjPolicyObj.createState()},
       rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj)),
       stencil_rhs_{rj_policy_.get().createResidual(),
                    rj_policy_.get().createResidual()}
   {}
 
+  // *** scheme fixed at compile time ***//
+  template<
+    class _SchemeTag = SchemeTag,
+    mpl::enable_if_t<!std::is_void<_SchemeTag>::value, int> = 0
+    >
+  explicit ImplicitStepperStandardImpl(ResidualJacobianPolicyType && rjPolicyObj)
+    : name_(step_scheme_of<_SchemeTag>::value),
+      stencil_states_(rjPolicyObj.createState()),
+      rj_policy_(std::forward<ResidualJacobianPolicyType>(rjPolicyObj)),
+      stencil_rhs_(createStencilRhs(
+	 std::integral_constant<bool,
+	   implicit_stepper_stencil_size<_SchemeTag>::num_rhs == 0>()))
+  {}
+
 public:
   template<class SolverType, class ...SolverArgs>
   void operator()(StateType & odeState,
@@ -137,7 +189,93 @@ public:
 		  SolverArgs && ...argsForSolver)
   {
     PRESSIOLOG_DEBUG("implicit stepper: do step");
+    doStep(odeState, stepStartVal, stepNumber, stepSize,
+	   solver, std::forward<SolverArgs>(argsForSolver)...);
+  }
+
+  StateType createState() const{ return rj_policy_.get().createState(); }
+  ResidualType createResidual() const{ return rj_policy_.get().createResidual(); }
+  JacobianType createJacobian() const{ return rj_policy_.get().createJacobian(); }
+
+  void residualAndJacobian(const StateType & odeState,
+			   ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+			   std::optional<jacobian_type*> Jo) const
+#else
+                           jacobian_type* Jo) const
+#endif
+  {
+    callPolicy(odeState, R, Jo);
+  }
+
+private:
+  template<class _SchemeTag = SchemeTag>
+  mpl::enable_if_t<!std::is_void<_SchemeTag>::value>
+  callPolicy(const StateType & odeState,
+	     ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+	     std::optional<jacobian_type*> Jo) const
+#else
+	     jacobian_type* Jo) const
+#endif
+  {
+    rj_policy_.get()(_SchemeTag(), odeState, stencil_states_, stencil_rhs_,
+		     ::pressio::ode::StepEndAt<IndVarType>(t_np1_),
+		     ::pressio::ode::StepCount(step_number_),
+		     ::pressio::ode::StepSize<IndVarType>(dt_),
+		     R, Jo);
+  }
+
+  template<class _SchemeTag = SchemeTag>
+  mpl::enable_if_t<std::is_void<_SchemeTag>::value>
+  callPolicy(const StateType & odeState,
+	     ResidualType & R,
+#ifdef PRESSIO_ENABLE_CXX17
+	     std::optional<jacobian_type*> Jo) const
+#else
+	     jacobian_type* Jo) const
+#endif
+  {
+    rj_policy_.get()(name_, odeState, stencil_states_, stencil_rhs_,
+		     ::pressio::ode::StepEndAt<IndVarType>(t_np1_),
+		     ::pressio::ode::StepCount(step_number_),
+		     ::pressio::ode::StepSize<IndVarType>(dt_),
+		     R, Jo);
+  }
+
+  // static stencil rhs container: it is empty for bdf1 and bdf2
+  typename stencil_containers::rhs_type createStencilRhs(std::true_type /*empty*/) const{
+    return typename stencil_containers::rhs_type();
+  }
 
+  typename stencil_containers::rhs_type createStencilRhs(std::false_type /*empty*/) const{
+    return typename stencil_containers::rhs_type(rj_policy_.get().createResidual());
+  }
+
+  template<class SolverType, class ...SolverArgs, class _SchemeTag = SchemeTag>
+  mpl::enable_if_t<!std::is_void<_SchemeTag>::value>
+  doStep(StateType & odeState,
+	 const ::pressio::ode::StepStartAt<independent_variable_type> & stepStartVal,
+	 ::pressio::ode::StepCount stepNumber,
+	 const ::pressio::ode::StepSize<independent_variable_type> & stepSize,
+	 SolverType & solver,
+	 SolverArgs && ...argsForSolver)
+  {
+    doStepImpl(_SchemeTag(),
+	       odeState, stepStartVal.get(), stepSize.get(),
+	       stepNumber.get(), solver,
+	       std::forward<SolverArgs>(argsForSolver)...);
+  }
+
+  template<class SolverType, class ...SolverArgs, class _SchemeTag = SchemeTag>
+  mpl::enable_if_t<std::is_void<_SchemeTag>::value>
+  doStep(StateType & odeState,
+	 const ::pressio::ode::StepStartAt<independent_variable_type> & stepStartVal,
+	 ::pressio::ode::StepCount stepNumber,
+	 const ::pressio::ode::StepSize<independent_variable_type> & stepSize,
+	 SolverType & solver,
+	 SolverArgs && ...argsForSolver)
+  {
     if (name_==::pressio::ode::StepScheme::BDF1){
       doStepImpl(::pressio::ode::BDF1(),
 		 odeState, stepStartVal.get(), stepSize.get(),
@@ -160,26 +298,6 @@ public:
     }
   }
 
-  StateType createState() const{ return rj_policy_.get().createState(); }
-  ResidualType createResidual() const{ return rj_policy_.get().createResidual(); }
-  JacobianType createJacobian() const{ return rj_policy_.get().createJacobian(); }
-
-  void residualAndJacobian(const StateType & odeState,
-			   ResidualType & R,
-#ifdef PRESSIO_ENABLE_CXX17
-			   std::optional<jacobian_type*> Jo) const
-#else
-                           jacobian_type* Jo) const
-#endif
-  {
-    rj_policy_.get()(name_, odeState, stencil_states_, stencil_rhs_,
-		     ::pressio::ode::StepEndAt<IndVarType>(t_np1_),
-		     ::pressio::ode::StepCount(step_number_),
-		     ::pressio::ode::StepSize<IndVarType>(dt_),
-		     R, Jo);
-  }
-
-private:
   template<class solver_type, class ...SolverArgs>
   void doStepImpl(::pressio::ode::BDF1,
 		  state_type & odeState,
@@ -259,12 +377,12 @@ private:
       /* for step == 2, we are going from t_1 to t_2 and:
 	 odeState = the state at t1
 
-	 for step >= 3, copy y_n -> y_n-1, and then odeState -> y_n
+	 for step >= 3, y_n becomes y_n-1 (no copy, just a rotation
+	 of the stencil storage), and then copy odeState -> y_n
       */
 
-      auto & odeState_n   = stencil_states_(ode::n());
-      auto & odeState_nm1 = stencil_states_(ode::nMinusOne());
-      ::pressio::ops::deep_copy(odeState_nm1, odeState_n);
+      stencil_states_.rotate();
+      auto & odeState_n = stencil_states_(ode::n());
       ::pressio::ops::deep_copy(odeState_n, odeState);
     }
 
@@ -273,15 +391,12 @@ private:
     }
     catch (::pressio::eh::NonlinearSolveFailure const & e)
     {
+      // revert odeState to what it was before attempting the solve,
+      // and, if the stencil was rotated, restore the previous y_n and y_n-1
       auto & odeState_n = stencil_states_(ode::n());
-      auto & odeState_nm1 = stencil_states_(ode::nMinusOne());
-
-      if (stepNumber == ::pressio::ode::first_step_value){
-	::pressio::ops::deep_copy(odeState, odeState_n);
-      }
-      else{
-	::pressio::ops::deep_copy(odeState, odeState_n);
-	::pressio::ops::deep_copy(odeState_n, odeState_nm1);
+      ::pressio::ops::deep_copy(odeState, odeState_n);
+      if (stepNumber != ::pressio::ode::first_step_value){
+	stencil_states_.rotateBack();
       }
 
       throw ::pressio::eh::TimeStepFailure();
@@ -136,6 +136,10 @@ private:
 // specialize for n:
 // so we have n, n-1, n-2, ...
 //
+// same as the static one, the states are stored in a ring of size+1
+// buffers (the extra one is a spare) so that the history can be
+// shifted and the shift undone by only permuting indices
+//
 template<class ValueType>
 class StencilDataContainerDynImpl<ValueType, ::pressio::ode::n>
 {
@@ -148,8 +152,13 @@ public:
   StencilDataContainerDynImpl(std::initializer_list<ValueType> il)
     : data_{il}, size_(data_.size())
   {
-    for (auto & it : data_){
-      ::pressio::ops::set_zero(it);
+    if (size_ > 0){
+      data_.push_back(::pressio::ops::clone(data_[0]));
+    }
+
+    for (std::size_t i=0; i<data_.size(); ++i){
+      slots_.push_back(i);
+      ::pressio::ops::set_zero(data_[i]);
     }
   }
 
@@ -162,52 +171,68 @@ public:
 public:
   std::size_t size() const{ return size_; }
 
+  // shift the history by one: n -> n-1, n-1 -> n-2, etc.
+  // The oldest state becomes the spare, and the previous spare
+  // becomes n, whose content is stale and must be overwritten.
+  void rotate(){
+    assert(size_>=1);
+    std::rotate(slots_.rbegin(), slots_.rbegin()+1, slots_.rend());
+  }
+
+  // undo the last rotate(), e.g. when a step fails
+  void rotateBack(){
+    assert(size_>=1);
+    std::rotate(slots_.begin(), slots_.begin()+1, slots_.end());
+  }
+
   // non-const overloads
   ValueType & operator()(::pressio::ode::n){
     assert( size_>=1);
-    return data_[0];
+    return data_[slots_[0]];
   }
 
   ValueType & operator()(::pressio::ode::nMinusOne){
     assert( size_>=2);
-    return data_[1];
+    return data_[slots_[1]];
   }
 
   ValueType & operator()(::pressio::ode::nMinusTwo){
     assert( size_>=3);
-    return data_[2];
+    return data_[slots_[2]];
   }
 
   ValueType & operator()(::pressio::ode::nMinusThree){
     assert( size_>=4);
-    return data_[3];
+    return data_[slots_[3]];
   }
 
   // const overloads
   ValueType const & operator()(::pressio::ode::n) const {
     assert( size_>=1);
-    return data_[0];
+    return data_[slots_[0]];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusOne) const {
     assert( size_>=2);
-    return data_[1];
+    return data_[slots_[1]];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusTwo) const {
     assert( size_>=3);
-    return data_[2];
+    return data_[slots_[2]];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusThree) const {
     assert( size_>=4);
-    return data_[3];
+    return data_[slots_[3]];
   }
 
 private:
   data_type data_;
   std::size_t size_;
-
+  // slots_[i] is the buffer holding the i-th logical position,
+  // slots_[size_] is the spare
+  std::vector<std::size_t> slots_;
 };
 
 }}}
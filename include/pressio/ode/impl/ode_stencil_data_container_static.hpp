@@ -172,16 +172,24 @@ private:
 
 
 //
-// if we start at n, we have n, n, n-1, ...
+// if we start at n, we have n, n-1, n-2, ...
+//
+// the states are stored in a ring of N+1 buffers, where the extra one
+// is a spare: the logical positions are mapped to the buffers via
+// slots_, so that shifting the history at every step (and undoing it
+// if the step fails) only permutes indices instead of copying data
 //
 template<class ValueType, std::size_t N>
 class StencilDataContainerStaticImpl<ValueType, N, ::pressio::ode::n>
 {
 public:
-  using data_type = std::array<ValueType, N>;
+  using data_type = std::array<ValueType, N+1>;
 
 private:
   data_type data_;
+  // slots_[i] is the buffer holding the i-th logical position,
+  // slots_[N] is the spare
+  std::array<std::size_t, N+1> slots_;
 
 public:
   template <std::size_t _N = N, mpl::enable_if_t<_N == 0, int> = 0>
@@ -190,7 +198,8 @@ public:
   // constructor for n == 1
   template <std::size_t _N = N, mpl::enable_if_t<_N == 1, int> = 0>
   StencilDataContainerStaticImpl(ValueType const & y)
-    : data_{::pressio::ops::clone(y)}{
+    : data_{::pressio::ops::clone(y),
+            ::pressio::ops::clone(y)}{
     setZero();
   }
 
@@ -198,6 +207,7 @@ public:
   template <std::size_t _N = N, mpl::enable_if_t<_N == 2, int> = 0>
   StencilDataContainerStaticImpl(ValueType const & y)
     : data_{::pressio::ops::clone(y),
+            ::pressio::ops::clone(y),
             ::pressio::ops::clone(y)}{
     setZero();
   }
@@ -206,6 +216,7 @@ public:
   template <std::size_t _N = N, mpl::enable_if_t<_N == 3, int> = 0>
   StencilDataContainerStaticImpl(ValueType const & y)
     : data_{::pressio::ops::clone(y),
+            ::pressio::ops::clone(y),
             ::pressio::ops::clone(y),
             ::pressio::ops::clone(y)}{
     setZero();
@@ -215,6 +226,7 @@ public:
   template <std::size_t _N = N, mpl::enable_if_t<_N == 4, int> = 0>
   StencilDataContainerStaticImpl(ValueType const & y)
     : data_{::pressio::ops::clone(y),
+            ::pressio::ops::clone(y),
             ::pressio::ops::clone(y),
             ::pressio::ops::clone(y),
             ::pressio::ops::clone(y)}{
@@ -230,56 +242,74 @@ public:
 public:
   static constexpr std::size_t size(){ return N; }
 
+  // shift the history by one: n -> n-1, n-1 -> n-2, etc.
+  // The oldest state becomes the spare, and the previous spare
+  // becomes n, whose content is stale and must be overwritten.
+  void rotate(){
+    const auto spare = slots_[N];
+    for (std::size_t i=N; i>0; --i){ slots_[i] = slots_[i-1]; }
+    slots_[0] = spare;
+  }
+
+  // undo the last rotate(), e.g. when a step fails: the states
+  // are restored exactly as they were before the rotation
+  void rotateBack(){
+    const auto first = slots_[0];
+    for (std::size_t i=0; i<N; ++i){ slots_[i] = slots_[i+1]; }
+    slots_[N] = first;
+  }
+
   ValueType & operator()(::pressio::ode::n){
     static_assert( N>=1,
       "Calling operator()(::pressio::ode::n) requires N>=1");
-    return data_[0];
+    return data_[slots_[0]];
   }
 
   ValueType & operator()(::pressio::ode::nMinusOne){
     static_assert( N>=2,
       "Calling operator()(::pressio::ode::nMinusOne) requires N>=2");
-    return data_[1];
+    return data_[slots_[1]];
   }
 
   ValueType & operator()(::pressio::ode::nMinusTwo){
     static_assert( N>=3,
       "Calling operator()(::pressio::ode::nMinusTwo) requires N>=3");
-    return data_[2];
+    return data_[slots_[2]];
   }
 
   ValueType & operator()(::pressio::ode::nMinusThree){
     static_assert( N>=4,
       "Calling operator()(::pressio::ode::nMinusThree) requires N>=4");
-    return data_[3];
+    return data_[slots_[3]];
   }
 
   ValueType const & operator()(::pressio::ode::n) const {
     static_assert( N>=1,
       "Calling operator()(::pressio::ode::n) requires N>=1");
-    return data_[0];
+    return data_[slots_[0]];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusOne) const {
     static_assert( N>=2,
       "Calling operator()(::pressio::ode::nMinusOne) requires N>=2");
-    return data_[1];
+    return data_[slots_[1]];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusTwo) const {
     static_assert( N>=3,
       "Calling operator()(::pressio::ode::nMinusTwo) requires N>=3");
-    return data_[2];
+    return data_[slots_[2]];
   }
 
   ValueType const & operator()(::pressio::ode::nMinusThree) const {
     static_assert( N>=4,
       "Calling operator()(::pressio::ode::nMinusThree) requires N>=4");
-    return data_[3];
+    return data_[slots_[3]];
   }
 
 private:
   void setZero(){
+    for (std::size_t i=0; i<=N; ++i){ slots_[i] = i; }
     for (auto & it : data_){
       ::pressio::ops::set_zero(it);
     }
@@ -0,0 +1,482 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ode_advance_parareal.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef ODE_ODE_ADVANCE_PARAREAL_HPP_
+#define ODE_ODE_ADVANCE_PARAREAL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "./impl/ode_advance_mandates.hpp"
+
+namespace pressio{ namespace ode{ namespace impl{
+
+// advances state over one time slice with a fixed step size; the step count
+// restarts at each slice so that multistep schemes do their startup again
+template <class StepperType, class StateType, class IndVarType>
+void parareal_propagate(StepperType & stepper,
+			StateType & state,
+			const IndVarType & sliceStart,
+			const IndVarType & stepSize,
+			::pressio::ode::StepCount numSteps)
+{
+  using step_t = typename ::pressio::ode::StepCount::value_type;
+  const ::pressio::ode::StepSize<IndVarType> dt(stepSize);
+  IndVarType time = sliceStart;
+  for (step_t step = ::pressio::ode::first_step_value; step <= numSteps.get(); ++step){
+    stepper(state,
+	    ::pressio::ode::StepStartAt<IndVarType>(time),
+	    ::pressio::ode::StepCount(step), dt);
+    time += stepSize;
+  }
+}
+
+/*
+  runs the fine propagators of one parareal call: the worker threads are
+  created once, each owns one fine stepper, and at every sweep they pick
+  the next slice not yet taken until all slices [firstSlice, numSlices)
+  are done. The calling thread acts as worker 0.
+  A sweep rethrows the first exception thrown by a fine stepper, if any.
+*/
+template <class FineStepperType, class StateType, class IndVarType>
+class PararealFinePropagators
+{
+  std::vector<FineStepperType> & fineSteppers_;
+  const IndVarType startVal_;
+  const IndVarType sliceSize_;
+  const IndVarType fineStepSize_;
+  const ::pressio::ode::StepCount fineStepsPerSlice_;
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable sweepStarted_;
+  std::condition_variable sweepDone_;
+  std::uint64_t sweep_ = 0;
+  std::size_t busyWorkers_ = 0;
+  bool stop_ = false;
+
+  // the current sweep
+  const std::vector<StateType> * sliceStartStates_ = nullptr;
+  std::vector<StateType> * fineResults_ = nullptr;
+  std::atomic<std::size_t> nextSlice_{0};
+  std::exception_ptr error_ = nullptr;
+
+public:
+  PararealFinePropagators(std::vector<FineStepperType> & fineSteppers,
+			  std::size_t numSlices,
+			  const IndVarType & startVal,
+			  const IndVarType & sliceSize,
+			  const IndVarType & fineStepSize,
+			  ::pressio::ode::StepCount fineStepsPerSlice)
+    : fineSteppers_(fineSteppers), startVal_(startVal), sliceSize_(sliceSize),
+      fineStepSize_(fineStepSize), fineStepsPerSlice_(fineStepsPerSlice)
+  {
+    const std::size_t numWorkers = std::min(fineSteppers.size(), numSlices);
+    try{
+      for (std::size_t w=1; w<numWorkers; ++w){
+	threads_.emplace_back(&PararealFinePropagators::workerLoop, this, w);
+      }
+    }
+    catch (...){
+      stopWorkers();
+      throw;
+    }
+  }
+
+  PararealFinePropagators(const PararealFinePropagators &) = delete;
+  PararealFinePropagators & operator=(const PararealFinePropagators &) = delete;
+
+  ~PararealFinePropagators(){ stopWorkers(); }
+
+  void operator()(const std::vector<StateType> & sliceStartStates,
+		  std::vector<StateType> & fineResults,
+		  std::size_t firstSlice)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      sliceStartStates_ = &sliceStartStates;
+      fineResults_ = &fineResults;
+      nextSlice_ = firstSlice;
+      error_ = nullptr;
+      busyWorkers_ = threads_.size();
+      ++sweep_;
+    }
+    sweepStarted_.notify_all();
+
+    work(0);
+    std::unique_lock<std::mutex> lock(mutex_);
+    sweepDone_.wait(lock, [this](){ return busyWorkers_ == 0; });
+    if (error_){
+      std::rethrow_exception(error_);
+    }
+  }
+
+private:
+  void stopWorkers(){
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    sweepStarted_.notify_all();
+    for (auto & t : threads_){ t.join(); }
+    threads_.clear();
+  }
+
+  void workerLoop(std::size_t workerId){
+    std::uint64_t lastSweep = 0;
+    while (true){
+      {
+	std::unique_lock<std::mutex> lock(mutex_);
+	sweepStarted_.wait(lock, [&](){ return stop_ || sweep_ != lastSweep; });
+	if (stop_){ return; }
+	lastSweep = sweep_;
+      }
+      work(workerId);
+      {
+	std::lock_guard<std::mutex> lock(mutex_);
+	--busyWorkers_;
+      }
+      sweepDone_.notify_one();
+    }
+  }
+
+  void work(std::size_t workerId){
+    const std::size_t numSlices = fineResults_->size();
+    try{
+      std::size_t n = 0;
+      while ( (n = nextSlice_++) < numSlices ){
+	::pressio::ops::deep_copy((*fineResults_)[n], (*sliceStartStates_)[n]);
+	parareal_propagate(fineSteppers_[workerId], (*fineResults_)[n],
+			   startVal_ + static_cast<IndVarType>(n)*sliceSize_,
+			   fineStepSize_, fineStepsPerSlice_);
+      }
+    }
+    catch (...){
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_){ error_ = std::current_exception(); }
+      // make the other workers stop early
+      nextSlice_ = numSlices;
+    }
+  }
+};
+
+// the coarse and fine steppers share the state type
+struct PararealSameStateTransfer{};
+
+// propagates the fine state in over one slice with the coarse stepper, writing
+// the result to the fine state out: the coarse stepper works on
+// restrictOp(in), and the coarse result is brought back with liftOp
+template <class CoarseStepperType, class StateType, class IndVarType, class RestrictType, class LiftType>
+void parareal_coarse_propagate(CoarseStepperType & coarseStepper,
+			       const StateType & in,
+			       StateType & out,
+			       const IndVarType & sliceStart,
+			       const IndVarType & stepSize,
+			       ::pressio::ode::StepCount numSteps,
+			       RestrictType & restrictOp,
+			       LiftType & liftOp)
+{
+  auto coarseState = restrictOp(in);
+  parareal_propagate(coarseStepper, coarseState, sliceStart, stepSize, numSteps);
+  const StateType lifted = liftOp(coarseState);
+  ::pressio::ops::deep_copy(out, lifted);
+}
+
+template <class CoarseStepperType, class StateType, class IndVarType>
+void parareal_coarse_propagate(CoarseStepperType & coarseStepper,
+			       const StateType & in,
+			       StateType & out,
+			       const IndVarType & sliceStart,
+			       const IndVarType & stepSize,
+			       ::pressio::ode::StepCount numSteps,
+			       PararealSameStateTransfer & /*unused*/,
+			       PararealSameStateTransfer & /*unused*/)
+{
+  ::pressio::ops::deep_copy(out, in);
+  parareal_propagate(coarseStepper, out, sliceStart, stepSize, numSteps);
+}
+
+template <
+  class FineStepperType, class CoarseStepperType, class StateType, class IndVarType,
+  class RestrictType, class LiftType
+  >
+int advance_parareal_impl(CoarseStepperType & coarseStepper,
+			  std::vector<FineStepperType> & fineSteppers,
+			  StateType & state,
+			  const IndVarType & startVal,
+			  const IndVarType & sliceSize,
+			  ::pressio::ode::StepCount numSlices,
+			  ::pressio::ode::StepCount coarseStepsPerSlice,
+			  ::pressio::ode::StepCount fineStepsPerSlice,
+			  int maxIterations,
+			  const typename ::pressio::Traits<StateType>::scalar_type & absoluteTolerance,
+			  const typename ::pressio::Traits<StateType>::scalar_type & relativeTolerance,
+			  RestrictType & restrictOp,
+			  LiftType & liftOp)
+{
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  constexpr auto one = ::pressio::utils::Constants<scalar_type>::one();
+  constexpr auto negOne = ::pressio::utils::Constants<scalar_type>::negOne();
+
+  if (numSlices.get() <= 0 || coarseStepsPerSlice.get() <= 0 || fineStepsPerSlice.get() <= 0){
+    throw std::runtime_error("parareal: the number of slices and steps per slice must be positive");
+  }
+
+  const auto N = static_cast<std::size_t>(numSlices.get());
+  const IndVarType coarseStepSize = sliceSize/static_cast<IndVarType>(coarseStepsPerSlice.get());
+  const IndVarType fineStepSize = sliceSize/static_cast<IndVarType>(fineStepsPerSlice.get());
+  auto sliceStart = [&](std::size_t n){ return startVal + static_cast<IndVarType>(n)*sliceSize; };
+
+  // U[n]: current approximation at the start of slice n (U[N] is the final state)
+  // G[n]: coarse propagation of U[n] from the previous iteration, lifted to the fine space
+  // F[n]: fine propagation of U[n]
+  std::vector<StateType> U, G, F;
+  for (std::size_t n=0; n<=N; ++n){ U.push_back(::pressio::ops::clone(state)); }
+  for (std::size_t n=0; n<N; ++n){
+    G.push_back(::pressio::ops::clone(state));
+    F.push_back(::pressio::ops::clone(state));
+  }
+  auto coarse = ::pressio::ops::clone(state);
+
+  // initial prediction: sequential coarse sweep
+  for (std::size_t n=0; n<N; ++n){
+    parareal_coarse_propagate(coarseStepper, U[n], G[n], sliceStart(n), coarseStepSize,
+			      coarseStepsPerSlice, restrictOp, liftOp);
+    ::pressio::ops::deep_copy(U[n+1], G[n]);
+  }
+
+  int iteration = 0;
+  // after k iterations the first k slices are exact, so at most N iterations are needed
+  const int maxIters = std::min(maxIterations, static_cast<int>(N));
+  PararealFinePropagators<FineStepperType, StateType, IndVarType> finePropagators
+    (fineSteppers, N, startVal, sliceSize, fineStepSize, fineStepsPerSlice);
+  while (iteration < maxIters)
+  {
+    const auto firstSlice = static_cast<std::size_t>(iteration);
+    ++iteration;
+
+    // fine propagation, concurrently over the slices
+    finePropagators(U, F, firstSlice);
+
+    // sequential correction: U[n+1] = G(U[n]) + F[n] - G[n]
+    // converged if ||U_new[n+1] - U_old[n+1]|| <= atol + rtol*||U_new[n+1]|| for all n
+    bool converged = true;
+    scalar_type maxChange = {};
+    for (std::size_t n=firstSlice; n<N; ++n){
+      parareal_coarse_propagate(coarseStepper, U[n], coarse, sliceStart(n), coarseStepSize,
+				coarseStepsPerSlice, restrictOp, liftOp);
+
+      // G[n] becomes the correction F[n] - G_old[n], then U[n+1] = coarse + correction
+      ::pressio::ops::update(G[n], negOne, F[n], one);
+      ::pressio::ops::update(G[n], one, coarse, one);
+      ::pressio::ops::update(U[n+1], negOne, G[n], one);
+      const auto change = ::pressio::ops::norm2(U[n+1]);
+      ::pressio::ops::deep_copy(U[n+1], G[n]);
+      ::pressio::ops::deep_copy(G[n], coarse);
+      maxChange = std::max(maxChange, change);
+      converged = converged &&
+	change <= absoluteTolerance + relativeTolerance*::pressio::ops::norm2(U[n+1]);
+    }
+
+    PRESSIOLOG_DEBUG("parareal: iteration = {}, max change = {:.6e}", iteration, maxChange);
+    if (converged){
+      break;
+    }
+  }
+
+  ::pressio::ops::deep_copy(state, U[N]);
+  return iteration;
+}
+
+} // end namespace impl
+
+/*
+  Parareal: advances state from startVal over numSlices time slices of size
+  sliceSize, using coarseStepper (cheap, e.g. a ROM or a large step size)
+  to predict the state at the slice boundaries and fineSteppers to correct
+  them, running the fine propagation of the slices concurrently on
+  fineSteppers.size() threads (the calling thread included).
+  Iterates until the change of every slice boundary state U is at most
+  absoluteTolerance + relativeTolerance*||U||, or maxIterations is reached,
+  and returns the number of iterations.
+  After numSlices iterations the result equals the sequential fine solution.
+*/
+template<class CoarseStepperType, class FineStepperType, class StateType, class IndVarType>
+#if not defined PRESSIO_ENABLE_CXX20
+  mpl::enable_if_t<
+    Steppable<CoarseStepperType>::value && Steppable<FineStepperType>::value,
+    int
+  >
+#else
+  requires Steppable<CoarseStepperType> && Steppable<FineStepperType>
+  int
+#endif
+advance_parareal(CoarseStepperType & coarseStepper,
+		 std::vector<FineStepperType> & fineSteppers,
+		 StateType & state,
+		 const IndVarType & startVal,
+		 const IndVarType & sliceSize,
+		 StepCount numSlices,
+		 StepCount coarseStepsPerSlice,
+		 StepCount fineStepsPerSlice,
+		 int maxIterations,
+		 const typename ::pressio::Traits<StateType>::scalar_type & absoluteTolerance,
+		 const typename ::pressio::Traits<StateType>::scalar_type & relativeTolerance)
+{
+  impl::mandate_on_ind_var_and_state_types(coarseStepper, state, startVal);
+  static_assert(std::is_same<StateType, typename FineStepperType::state_type>::value,
+		"StateType must be the same as FineStepperType::state_type");
+  static_assert(std::is_same<IndVarType, typename FineStepperType::independent_variable_type>::value,
+		"IndVarType must be the same as FineStepperType::independent_variable_type");
+
+  if (fineSteppers.empty()){
+    throw std::runtime_error("parareal: at least one fine stepper is needed");
+  }
+  impl::PararealSameStateTransfer identity;
+  return impl::advance_parareal_impl(coarseStepper, fineSteppers, state,
+				     startVal, sliceSize, numSlices,
+				     coarseStepsPerSlice, fineStepsPerSlice,
+				     maxIterations, absoluteTolerance, relativeTolerance,
+				     identity, identity);
+}
+
+/*
+  same as above for a coarse stepper with its own state type, e.g. a ROM:
+  restrictOp(fineState) must return the coarse state for a fine state,
+  and liftOp(coarseState) the fine state for a coarse state.
+  Both are called on the calling thread only.
+*/
+template<
+  class CoarseStepperType, class FineStepperType, class StateType, class IndVarType,
+  class RestrictType, class LiftType
+  >
+#if not defined PRESSIO_ENABLE_CXX20
+  mpl::enable_if_t<
+    Steppable<CoarseStepperType>::value && Steppable<FineStepperType>::value,
+    int
+  >
+#else
+  requires Steppable<CoarseStepperType> && Steppable<FineStepperType>
+  int
+#endif
+advance_parareal(CoarseStepperType & coarseStepper,
+		 std::vector<FineStepperType> & fineSteppers,
+		 StateType & state,
+		 const IndVarType & startVal,
+		 const IndVarType & sliceSize,
+		 StepCount numSlices,
+		 StepCount coarseStepsPerSlice,
+		 StepCount fineStepsPerSlice,
+		 int maxIterations,
+		 const typename ::pressio::Traits<StateType>::scalar_type & absoluteTolerance,
+		 const typename ::pressio::Traits<StateType>::scalar_type & relativeTolerance,
+		 RestrictType && restrictOp,
+		 LiftType && liftOp)
+{
+  using coarse_state_type = typename CoarseStepperType::state_type;
+  static_assert(std::is_same<IndVarType, typename CoarseStepperType::independent_variable_type>::value,
+		"IndVarType must be the same as CoarseStepperType::independent_variable_type");
+  static_assert(std::is_same<StateType, typename FineStepperType::state_type>::value,
+		"StateType must be the same as FineStepperType::state_type");
+  static_assert(std::is_same<IndVarType, typename FineStepperType::independent_variable_type>::value,
+		"IndVarType must be the same as FineStepperType::independent_variable_type");
+  static_assert(std::is_same<
+		coarse_state_type,
+		mpl::remove_cvref_t<decltype(restrictOp(std::declval<StateType const &>()))>
+		>::value,
+		"restrictOp(fineState) must return a CoarseStepperType::state_type");
+  static_assert(std::is_convertible<
+		decltype(liftOp(std::declval<coarse_state_type const &>())), StateType
+		>::value,
+		"liftOp(coarseState) must return a StateType");
+
+  if (fineSteppers.empty()){
+    throw std::runtime_error("parareal: at least one fine stepper is needed");
+  }
+  return impl::advance_parareal_impl(coarseStepper, fineSteppers, state,
+				     startVal, sliceSize, numSlices,
+				     coarseStepsPerSlice, fineStepsPerSlice,
+				     maxIterations, absoluteTolerance, relativeTolerance,
+				     restrictOp, liftOp);
+}
+
+// same as above with a relative tolerance only
+template<class CoarseStepperType, class FineStepperType, class StateType, class IndVarType>
+#if not defined PRESSIO_ENABLE_CXX20
+  mpl::enable_if_t<
+    Steppable<CoarseStepperType>::value && Steppable<FineStepperType>::value,
+    int
+  >
+#else
+  requires Steppable<CoarseStepperType> && Steppable<FineStepperType>
+  int
+#endif
+advance_parareal(CoarseStepperType & coarseStepper,
+		 std::vector<FineStepperType> & fineSteppers,
+		 StateType & state,
+		 const IndVarType & startVal,
+		 const IndVarType & sliceSize,
+		 StepCount numSlices,
+		 StepCount coarseStepsPerSlice,
+		 StepCount fineStepsPerSlice,
+		 int maxIterations,
+		 const typename ::pressio::Traits<StateType>::scalar_type & relativeTolerance)
+{
+  using scalar_type = typename ::pressio::Traits<StateType>::scalar_type;
+  return advance_parareal(coarseStepper, fineSteppers, state, startVal, sliceSize,
+			  numSlices, coarseStepsPerSlice, fineStepsPerSlice,
+			  maxIterations, scalar_type{}, relativeTolerance);
+}
+
+}} // end namespace pressio::ode
+#endif  // ODE_ODE_ADVANCE_PARAREAL_HPP_
@@ -82,7 +82,7 @@ advance_to_target_point_with_step_recovery(StepperType & stepper,
   impl::mandate_on_ind_var_and_state_types(stepper, state, startVal);
   using observer_t = impl::NoOpStateObserver<IndVarType, StateType>;
   impl::to_target_time_with_step_size_policy
-    <false>(stepper, startVal,
+    <true>(stepper, startVal,
 	    finalVal, state,
 	    std::forward<StepSizePolicyType>(stepSizePolicy),
 	    observer_t());
@@ -118,7 +118,7 @@ advance_to_target_point_with_step_recovery(StepperType & stepper,
 
   impl::mandate_on_ind_var_and_state_types(stepper, state, startVal);
   impl::to_target_time_with_step_size_policy<
-    false>(stepper, startVal,
+    true>(stepper, startVal,
 	   finalVal, state,
 	   std::forward<StepSizePolicyType>(stepSizePolicy),
 	   std::forward<ObserverType>(observer));
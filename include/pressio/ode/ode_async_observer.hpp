@@ -0,0 +1,265 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ode_async_observer.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef ODE_ODE_ASYNC_OBSERVER_HPP_
+#define ODE_ODE_ASYNC_OBSERVER_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace pressio{ namespace ode{ namespace impl{
+
+template <class T, class = void>
+struct async_observer_can_use_ops : std::false_type{};
+
+template <class T>
+struct async_observer_can_use_ops<
+  T,
+  mpl::void_t<
+    decltype( ::pressio::ops::clone(std::declval<T const &>()) ),
+    decltype( ::pressio::ops::deep_copy(std::declval<T &>(), std::declval<T const &>()) )
+    >
+  > : std::true_type{};
+
+// states supported by ops are copied via ops, all others
+// (e.g. std::vector) must have value semantics
+template <class T>
+mpl::enable_if_t<async_observer_can_use_ops<T>::value, T>
+async_observer_clone(const T & src){ return ::pressio::ops::clone(src); }
+
+template <class T>
+mpl::enable_if_t<!async_observer_can_use_ops<T>::value, T>
+async_observer_clone(const T & src){ return T(src); }
+
+template <class T>
+mpl::enable_if_t<async_observer_can_use_ops<T>::value>
+async_observer_copy(T & dest, const T & src){ ::pressio::ops::deep_copy(dest, src); }
+
+template <class T>
+mpl::enable_if_t<!async_observer_can_use_ops<T>::value>
+async_observer_copy(T & dest, const T & src){ dest = src; }
+
+/*
+  wraps a state observer so that it runs on a background thread.
+
+  Each call copies the state into one of a fixed number of buffers
+  and enqueues it, so the caller can continue stepping while the
+  wrapped observer processes the previous states in order.
+  When all buffers are in use, the caller blocks until one is
+  released (back-pressure), so memory is bounded by the capacity.
+
+  flush() blocks until all enqueued states have been observed and
+  rethrows the first exception thrown by the wrapped observer, if any.
+  The advancers call flush() before returning.
+*/
+template <class IndVarType, class StateType, class ObserverType>
+class AsyncStateObserver
+{
+  using step_type = typename ::pressio::ode::StepCount::value_type;
+
+  struct Item{
+    step_type step;
+    IndVarType time;
+    std::size_t slot;
+  };
+
+  struct SharedData{
+    SharedData(ObserverType && observer,
+	       const StateType & prototypeState,
+	       std::size_t capacity)
+      : observer_(std::forward<ObserverType>(observer))
+    {
+      for (std::size_t i=0; i<capacity; ++i){
+	buffers_.push_back(async_observer_clone(prototypeState));
+	freeSlots_.push_back(i);
+      }
+    }
+
+    ::pressio::utils::InstanceOrReferenceWrapper<ObserverType> observer_;
+    std::vector<StateType> buffers_;
+    std::deque<std::size_t> freeSlots_;
+    std::deque<Item> queue_;
+    std::mutex mutex_;
+    // signals the worker that an item was enqueued or that it must stop
+    std::condition_variable itemEnqueued_;
+    // signals the producer that an item was processed
+    std::condition_variable itemProcessed_;
+    bool workerBusy_ = false;
+    bool stop_ = false;
+    std::exception_ptr error_ = nullptr;
+  };
+
+  std::unique_ptr<SharedData> data_;
+  std::thread worker_;
+
+public:
+  AsyncStateObserver(ObserverType && observer,
+		     const StateType & prototypeState,
+		     std::size_t capacity)
+    : data_(new SharedData(std::forward<ObserverType>(observer),
+			   prototypeState, capacity))
+  {
+    if (capacity == 0){
+      throw std::runtime_error("async observer: the capacity must be > 0");
+    }
+    worker_ = std::thread(&AsyncStateObserver::workerLoop, data_.get());
+  }
+
+  AsyncStateObserver(AsyncStateObserver &&) = default;
+  AsyncStateObserver & operator=(AsyncStateObserver &&) = delete;
+  AsyncStateObserver(const AsyncStateObserver &) = delete;
+  AsyncStateObserver & operator=(const AsyncStateObserver &) = delete;
+
+  ~AsyncStateObserver(){
+    if (worker_.joinable()){
+      {
+	std::lock_guard<std::mutex> lock(data_->mutex_);
+	data_->stop_ = true;
+      }
+      data_->itemEnqueued_.notify_one();
+      worker_.join();
+    }
+  }
+
+  void operator()(::pressio::ode::StepCount step,
+		  IndVarType time,
+		  const StateType & state)
+  {
+    auto & d = *data_;
+    std::size_t slot = 0;
+    {
+      std::unique_lock<std::mutex> lock(d.mutex_);
+      d.itemProcessed_.wait(lock, [&d]{ return !d.freeSlots_.empty(); });
+      slot = d.freeSlots_.front();
+      d.freeSlots_.pop_front();
+    }
+
+    // the slot is owned by this thread until it is enqueued
+    async_observer_copy(d.buffers_[slot], state);
+
+    {
+      std::lock_guard<std::mutex> lock(d.mutex_);
+      d.queue_.push_back(Item{step.get(), time, slot});
+    }
+    d.itemEnqueued_.notify_one();
+  }
+
+  void flush()
+  {
+    auto & d = *data_;
+    std::unique_lock<std::mutex> lock(d.mutex_);
+    d.itemProcessed_.wait(lock, [&d]{ return d.queue_.empty() && !d.workerBusy_; });
+    if (d.error_){
+      auto e = d.error_;
+      d.error_ = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+
+private:
+  static void workerLoop(SharedData * d)
+  {
+    while (true)
+    {
+      Item item;
+      {
+	std::unique_lock<std::mutex> lock(d->mutex_);
+	d->itemEnqueued_.wait(lock, [d]{ return !d->queue_.empty() || d->stop_; });
+	if (d->queue_.empty()){
+	  // stop was requested and everything has been processed
+	  return;
+	}
+	item = d->queue_.front();
+	d->queue_.pop_front();
+	d->workerBusy_ = true;
+      }
+
+      std::exception_ptr error = nullptr;
+      try{
+	d->observer_.get()(::pressio::ode::StepCount(item.step),
+			   item.time, d->buffers_[item.slot]);
+      }
+      catch (...){
+	error = std::current_exception();
+      }
+
+      {
+	std::lock_guard<std::mutex> lock(d->mutex_);
+	if (error && !d->error_){
+	  d->error_ = error;
+	}
+	d->workerBusy_ = false;
+	d->freeSlots_.push_back(item.slot);
+      }
+      d->itemProcessed_.notify_all();
+    }
+  }
+};
+
+} // end namespace impl
+
+/*
+  the observer is called on a background thread, so it must not
+  touch data modified by the time loop other than the state it receives;
+  prototypeState is only used to allocate the buffers
+*/
+template<class IndVarType, class ObserverType, class StateType>
+auto create_async_observer(ObserverType && observer,
+			   const StateType & prototypeState,
+			   std::size_t capacity = 2)
+{
+  return impl::AsyncStateObserver<IndVarType, StateType, ObserverType>
+    (std::forward<ObserverType>(observer), prototypeState, capacity);
+}
+
+}} // end namespace pressio::ode
+#endif  // ODE_ODE_ASYNC_OBSERVER_HPP_
@@ -61,6 +61,7 @@ namespace pressio{ namespace ode{
 #if defined PRESSIO_ENABLE_CXX20
 template<class SystemType>
   requires RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>
+  && (!RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank == 1)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank == 1)
   && requires(      typename mpl::remove_cvref_t<SystemType>::state_type & s1,
@@ -72,6 +73,7 @@ template<class SystemType>
 	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > alpha)
   {
     { ::pressio::ops::deep_copy(s1, s2) };
+    { ::pressio::ops::update(s1, alpha, s2, alpha) };
     { ::pressio::ops::update(s1, alpha, s2, alpha, f1, alpha) };
     { ::pressio::ops::update(s1, alpha, f1, alpha) };
     { ::pressio::ops::update(s1, alpha, f1, alpha, f2, alpha) };
@@ -81,7 +83,8 @@ template<class SystemType>
 template<
   class SystemType,
   mpl::enable_if_t<
-    RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>::value,
+    RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>::value
+    && !RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>::value,
     int > = 0
   >
 #endif
@@ -110,12 +113,66 @@ auto create_explicit_stepper(StepScheme schemeName,                     // (1)
     (schemeName, std::forward<SystemType>(odeSystem));
 }
 
+//
+// basic, no mass matrix, scheme known at compile time:
+// e.g. create_explicit_stepper<ode::RungeKutta4>(system)
+// creates a stepper whose storage is sized for RK4 only
+// and whose step does not branch on the scheme
+//
+#if defined PRESSIO_ENABLE_CXX20
+template<class SchemeTag, class SystemType>
+  requires is_explicit_scheme_tag<SchemeTag>::value
+  && RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>
+  && (!RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank == 1)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank == 1)
+  && requires(      typename mpl::remove_cvref_t<SystemType>::state_type & s1,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s2,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & f1,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & f2,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & f3,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & f4,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > alpha)
+  {
+    { ::pressio::ops::deep_copy(s1, s2) };
+    { ::pressio::ops::update(s1, alpha, s2, alpha) };
+    { ::pressio::ops::update(s1, alpha, s2, alpha, f1, alpha) };
+    { ::pressio::ops::update(s1, alpha, f1, alpha) };
+    { ::pressio::ops::update(s1, alpha, f1, alpha, f2, alpha) };
+    { ::pressio::ops::update(s1, alpha, f1, alpha, f2, alpha, f3, alpha, f4, alpha) };
+  }
+#else
+template<
+  class SchemeTag,
+  class SystemType,
+  mpl::enable_if_t<
+    is_explicit_scheme_tag<SchemeTag>::value
+    && RealValuedOdeSystem<mpl::remove_cvref_t<SystemType>>::value
+    && !RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>::value,
+    int > = 0
+  >
+#endif
+auto create_explicit_stepper(SystemType && odeSystem)                   // (3)
+{
+
+  using sys_type = mpl::remove_cvref_t<SystemType>;
+  using ind_var_type = typename sys_type::independent_variable_type;
+  using state_type   = typename sys_type::state_type;
+  using rhs_type = typename sys_type::rhs_type;
+
+  // use "SystemType" as template arg, see above for reason
+  using impl_type = impl::ExplicitStepperNoMassMatrixImpl<
+    state_type, ind_var_type, SystemType, rhs_type, SchemeTag>;
+  return impl_type(SchemeTag(), std::forward<SystemType>(odeSystem));
+}
+
 //
 // WITH mass matrix
 //
 #if defined PRESSIO_ENABLE_CXX20
 template<class SystemType>
-  requires RealValuedOdeSystemFusingMassMatrixAndRhs<mpl::remove_cvref_t<SystemType>>
+  requires (RealValuedOdeSystemFusingMassMatrixAndRhs<mpl::remove_cvref_t<SystemType>>
+	    || RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank == 1)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank == 1)
   && (Traits<typename mpl::remove_cvref_t<SystemType>::mass_matrix_type>::rank == 2)
@@ -135,7 +192,8 @@ template<class SystemType>
 template<
   class SystemType,
   mpl::enable_if_t<
-    RealValuedOdeSystemFusingMassMatrixAndRhs<mpl::remove_cvref_t<SystemType>>::value,
+    RealValuedOdeSystemFusingMassMatrixAndRhs<mpl::remove_cvref_t<SystemType>>::value
+    || RealValuedOdeSystemWithConstantMassMatrix<mpl::remove_cvref_t<SystemType>>::value,
     int > = 0
   >
 #endif
@@ -182,5 +240,23 @@ auto create_ssprk3_stepper(Args && ...args){
     (StepScheme::SSPRungeKutta3, std::forward<Args>(args)...);
 }
 
+template<class ...Args>
+auto create_dormand_prince45_stepper(Args && ...args){
+  return create_explicit_stepper
+    (StepScheme::DormandPrince45, std::forward<Args>(args)...);
+}
+
+template<class ...Args>
+auto create_bogacki_shampine23_stepper(Args && ...args){
+  return create_explicit_stepper
+    (StepScheme::BogackiShampine23, std::forward<Args>(args)...);
+}
+
+template<class ...Args>
+auto create_lsrk4_stepper(Args && ...args){
+  return create_explicit_stepper
+    (StepScheme::LowStorageRungeKutta4, std::forward<Args>(args)...);
+}
+
 }} // end namespace pressio::ode
 #endif  // ODE_ODE_CREATE_EXPLICIT_STEPPER_HPP_
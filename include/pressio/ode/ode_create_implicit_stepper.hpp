@@ -229,6 +229,157 @@ auto create_implicit_stepper(StepScheme schemeName,
     impl_type>(schemeName, std::forward<ResidualJacobianPolicyType>(policy));
 }
 
+//
+// scheme known at compile time: e.g. create_implicit_stepper<ode::BDF2>(system)
+// creates a stepper whose stencils are sized for BDF2 only and
+// whose step and residual/jacobian evaluation do not branch on the scheme
+//
+#if defined PRESSIO_ENABLE_CXX20
+template<class SchemeTag, class SystemType>
+  requires is_implicit_scheme_tag<SchemeTag>::value
+  && RealValuedOdeSystemFusingRhsAndJacobian<mpl::remove_cvref_t<SystemType>>
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank    == 1)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank      == 1)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::jacobian_type>::rank == 2)
+  && requires(      typename mpl::remove_cvref_t<SystemType>::state_type    & s,
+	            typename mpl::remove_cvref_t<SystemType>::rhs_type      & r,
+	            typename mpl::remove_cvref_t<SystemType>::jacobian_type & J,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s1,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s2,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s3,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type   & r1,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type   & r2,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > a,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > b,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > c,
+  	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > d,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > e)
+  {
+    { ::pressio::ops::deep_copy(s, s1) };
+    { ::pressio::ops::update(r, a, s1, b, s2, c) };
+    { ::pressio::ops::update(r, a, s1, b, s2, c, s3, d) };
+    { ::pressio::ops::update(r, a, s1, b, s2, c, r1, d, r2, e) };
+    { ::pressio::ops::scale(J, a) };
+    { ::pressio::ops::add_to_diagonal(J, a) };
+  }
+#else
+template<
+  class SchemeTag,
+  class SystemType,
+  mpl::enable_if_t<
+    is_implicit_scheme_tag<SchemeTag>::value
+    && RealValuedOdeSystemFusingRhsAndJacobian<mpl::remove_cvref_t<SystemType>>::value,
+    int > = 0
+  >
+#endif
+auto create_implicit_stepper(SystemType && system)                      // (3)
+{
+
+  using system_type   = mpl::remove_cvref_t<SystemType>;
+  using ind_var_type  = typename system_type::independent_variable_type;
+  using state_type    = typename system_type::state_type;
+  using residual_type = typename system_type::rhs_type;
+  using jacobian_type = typename system_type::jacobian_type;
+
+  using policy_type = impl::ResidualJacobianStandardPolicy<
+    SystemType, ind_var_type, state_type, residual_type, jacobian_type>;
+
+  using impl_type = impl::ImplicitStepperStandardImpl<
+    ind_var_type, state_type, residual_type,
+    jacobian_type, policy_type, SchemeTag>;
+  return impl_type(policy_type(std::forward<SystemType>(system)));
+}
+
+#if defined PRESSIO_ENABLE_CXX20
+template<class SchemeTag, class SystemType>
+  requires (std::same_as<SchemeTag, BDF1> || std::same_as<SchemeTag, BDF2>)
+  && RealValuedCompleteOdeSystem<mpl::remove_cvref_t<SystemType>>
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::state_type>::rank       == 1)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::rhs_type>::rank         == 1)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::jacobian_type>::rank    == 2)
+  && (Traits<typename mpl::remove_cvref_t<SystemType>::mass_matrix_type>::rank == 2)
+  && requires(      typename mpl::remove_cvref_t<SystemType>::state_type       & s,
+	            typename mpl::remove_cvref_t<SystemType>::rhs_type         & r,
+	            typename mpl::remove_cvref_t<SystemType>::jacobian_type    & J,
+	      const typename mpl::remove_cvref_t<SystemType>::mass_matrix_type & M,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s1,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s2,
+	      const typename mpl::remove_cvref_t<SystemType>::state_type & s3,
+	      const typename mpl::remove_cvref_t<SystemType>::rhs_type & r1,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > a,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > b,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > c,
+	      ode::scalar_of_t< mpl::remove_cvref_t<SystemType> > d)
+  {
+    { ::pressio::ops::deep_copy(s, s1) };
+    { ::pressio::ops::update(s, a, s1, b, s2, c) };
+    { ::pressio::ops::update(s, a, s1, b, s2, c, s3, d) };
+    { ::pressio::ops::product(::pressio::nontranspose(), a, M, s1, b, r) };
+    { ::pressio::ops::update(r, a, r1, b) };
+    { ::pressio::ops::update(J, a, M, b)  };
+  }
+#else
+template<
+  class SchemeTag,
+  class SystemType,
+  mpl::enable_if_t<
+    (std::is_same<SchemeTag, BDF1>::value || std::is_same<SchemeTag, BDF2>::value)
+    && RealValuedCompleteOdeSystem<mpl::remove_cvref_t<SystemType>>::value,
+    int > = 0
+  >
+#endif
+auto create_implicit_stepper(SystemType && system)                      // (4)
+{
+
+  using system_type   = mpl::remove_cvref_t<SystemType>;
+  using ind_var_type  = typename system_type::independent_variable_type;
+  using state_type    = typename system_type::state_type;
+  using residual_type = typename system_type::rhs_type;
+  using jacobian_type = typename system_type::jacobian_type;
+  using mass_mat_type = typename system_type::mass_matrix_type;
+
+  using policy_type = impl::ResidualJacobianWithMassMatrixStandardPolicy<
+    SystemType, ind_var_type, state_type,
+    residual_type, jacobian_type, mass_mat_type>;
+
+  using impl_type = impl::ImplicitStepperStandardImpl<
+    ind_var_type, state_type, residual_type,
+    jacobian_type, policy_type, SchemeTag>;
+  return impl_type(policy_type(std::forward<SystemType>(system)));
+}
+
+template<
+  class SchemeTag,
+  class ResidualJacobianPolicyType
+#if not defined PRESSIO_ENABLE_CXX20
+  ,mpl::enable_if_t<
+    is_implicit_scheme_tag<SchemeTag>::value
+    && ::pressio::ode::ImplicitResidualJacobianPolicy<
+      mpl::remove_cvref_t<ResidualJacobianPolicyType>>::value, int
+    > = 0
+#endif
+  >
+#ifdef PRESSIO_ENABLE_CXX20
+requires is_implicit_scheme_tag<SchemeTag>::value
+  && ::pressio::ode::ImplicitResidualJacobianPolicy<
+  mpl::remove_cvref_t<ResidualJacobianPolicyType>
+  >
+#endif
+auto create_implicit_stepper(ResidualJacobianPolicyType && policy)     // (5)
+{
+  // the policy must also accept SchemeTag in place of the StepScheme value
+  using policy_type   = mpl::remove_cvref_t<ResidualJacobianPolicyType>;
+  using ind_var_type  = typename policy_type::independent_variable_type;
+  using state_type    = typename policy_type::state_type;
+  using residual_type = typename policy_type::residual_type;
+  using jacobian_type = typename policy_type::jacobian_type;
+
+  using impl_type = impl::ImplicitStepperStandardImpl<
+    ind_var_type, state_type, residual_type,
+    jacobian_type, ResidualJacobianPolicyType, SchemeTag>;
+  return impl_type(std::forward<ResidualJacobianPolicyType>(policy));
+}
+
 //
 // auxiliary API
 //
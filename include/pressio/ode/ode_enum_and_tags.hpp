@@ -57,6 +57,9 @@ enum class StepScheme{
   RungeKutta4,
   AdamsBashforth2,
   SSPRungeKutta3,
+  DormandPrince45,
+  BogackiShampine23,
+  LowStorageRungeKutta4,
   // implicit
   BDF1,
   BDF2,
@@ -71,6 +74,9 @@ T is_explicit_scheme(StepScheme name)
   else if (name == StepScheme::RungeKutta4){ return true; }
   else if (name == StepScheme::AdamsBashforth2){ return true; }
   else if (name == StepScheme::SSPRungeKutta3){ return true; }
+  else if (name == StepScheme::DormandPrince45){ return true; }
+  else if (name == StepScheme::BogackiShampine23){ return true; }
+  else if (name == StepScheme::LowStorageRungeKutta4){ return true; }
   else{ return false; }
 }
 
@@ -83,12 +89,54 @@ struct ForwardEuler{};
 struct RungeKutta4{};
 struct AdamsBashforth2{};
 struct SSPRungeKutta3{};
+struct DormandPrince45{};
+struct BogackiShampine23{};
+struct LowStorageRungeKutta4{};
 
 struct BDF1{};
 struct BDF2{};
 struct CrankNicolson{};
 struct ImplicitArbitrary{};
 
+// compile-time counterparts of is_explicit_scheme/is_implicit_scheme,
+// used by the create functions taking the scheme as a template argument
+template<class T> struct is_explicit_scheme_tag : std::false_type{};
+template<> struct is_explicit_scheme_tag<ForwardEuler> : std::true_type{};
+template<> struct is_explicit_scheme_tag<RungeKutta4> : std::true_type{};
+template<> struct is_explicit_scheme_tag<AdamsBashforth2> : std::true_type{};
+template<> struct is_explicit_scheme_tag<SSPRungeKutta3> : std::true_type{};
+template<> struct is_explicit_scheme_tag<DormandPrince45> : std::true_type{};
+template<> struct is_explicit_scheme_tag<BogackiShampine23> : std::true_type{};
+template<> struct is_explicit_scheme_tag<LowStorageRungeKutta4> : std::true_type{};
+
+// ImplicitArbitrary is excluded since it uses a dedicated stepper
+template<class T> struct is_implicit_scheme_tag : std::false_type{};
+template<> struct is_implicit_scheme_tag<BDF1> : std::true_type{};
+template<> struct is_implicit_scheme_tag<BDF2> : std::true_type{};
+template<> struct is_implicit_scheme_tag<CrankNicolson> : std::true_type{};
+
+template<class T> struct step_scheme_of;
+template<> struct step_scheme_of<ForwardEuler>
+  : std::integral_constant<StepScheme, StepScheme::ForwardEuler>{};
+template<> struct step_scheme_of<RungeKutta4>
+  : std::integral_constant<StepScheme, StepScheme::RungeKutta4>{};
+template<> struct step_scheme_of<AdamsBashforth2>
+  : std::integral_constant<StepScheme, StepScheme::AdamsBashforth2>{};
+template<> struct step_scheme_of<SSPRungeKutta3>
+  : std::integral_constant<StepScheme, StepScheme::SSPRungeKutta3>{};
+template<> struct step_scheme_of<DormandPrince45>
+  : std::integral_constant<StepScheme, StepScheme::DormandPrince45>{};
+template<> struct step_scheme_of<BogackiShampine23>
+  : std::integral_constant<StepScheme, StepScheme::BogackiShampine23>{};
+template<> struct step_scheme_of<LowStorageRungeKutta4>
+  : std::integral_constant<StepScheme, StepScheme::LowStorageRungeKutta4>{};
+template<> struct step_scheme_of<BDF1>
+  : std::integral_constant<StepScheme, StepScheme::BDF1>{};
+template<> struct step_scheme_of<BDF2>
+  : std::integral_constant<StepScheme, StepScheme::BDF2>{};
+template<> struct step_scheme_of<CrankNicolson>
+  : std::integral_constant<StepScheme, StepScheme::CrankNicolson>{};
+
 class nPlusOne{};
 class n{};
 class nMinusOne{};
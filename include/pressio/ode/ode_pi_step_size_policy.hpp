@@ -0,0 +1,214 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ode_pi_step_size_policy.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef ODE_ODE_PI_STEP_SIZE_POLICY_HPP_
+#define ODE_ODE_PI_STEP_SIZE_POLICY_HPP_
+
+namespace pressio{ namespace ode{ namespace impl{
+
+/*
+  step size policy for the embedded explicit schemes, meant to be
+  used with advance_to_target_point_with_step_recovery.
+
+  After an accepted step with scaled error err_n, the next step size is:
+
+    dt_{n+1} = dt_n * min(facMax, max(facMin, safety * err_n^(-alpha) * err_{n-1}^(beta)))
+
+  with alpha = 0.7/k, beta = 0.4/k, k = order of the embedded error
+  estimate + 1 (see Hairer, Wanner, Solving ODEs II, sec IV.2).
+  Rejected steps throw pressio::eh::TimeStepFailure from the stepper,
+  the advancer reports them via stepRejected, and the step is retried with
+
+    dt = dt * max(facMin, min(1, safety * err^(-1/k)))
+
+  or with dt = dt * facMin if err is not finite. At most maxRejections
+  consecutive attempts of a step can be rejected, then this throws.
+  A step that needed to be retried is not allowed to grow the step size.
+  The step size is clipped so that the final time is hit exactly.
+  The minimum step size defaults to 1e-8 times the initial one and
+  the advancer throws if a retry would go below it.
+*/
+template<class StepperType, class IndVarType>
+class PIStepSizePolicy
+{
+  std::reference_wrapper<StepperType> stepper_;
+  IndVarType finalTime_;
+  IndVarType nextStepSize_;
+  IndVarType minStepSize_;
+  IndVarType maxStepSize_ = std::numeric_limits<IndVarType>::max();
+  IndVarType safety_ = static_cast<IndVarType>(0.9);
+  IndVarType facMin_ = static_cast<IndVarType>(0.2);
+  IndVarType facMax_ = static_cast<IndVarType>(5);
+  IndVarType errPrev_ = static_cast<IndVarType>(1e-4);
+  bool currentStepWasRejected_ = false;
+  int numRejections_ = 0;
+  int maxRejections_ = 20;
+  int k_ = {};
+
+public:
+  template<class ScalarType>
+  PIStepSizePolicy(StepperType & stepper,
+		   ScalarType absTol,
+		   ScalarType relTol,
+		   const IndVarType & initialStepSize,
+		   const IndVarType & finalTime)
+    : stepper_(stepper),
+      finalTime_(finalTime),
+      nextStepSize_(initialStepSize),
+      minStepSize_(initialStepSize*static_cast<IndVarType>(1e-8)),
+      k_(stepper.errorEstimateOrder() + 1)
+  {
+    if (k_ == 1){
+      throw std::runtime_error("the PI step size policy requires an embedded scheme");
+    }
+    if (!(initialStepSize > IndVarType{})){
+      throw std::runtime_error("the PI step size policy requires a positive initial step size");
+    }
+    stepper.setErrorControlTolerances(absTol, relTol);
+  }
+
+  void setSafetyFactor(IndVarType value){ safety_ = value; }
+  void setMinStepSize(IndVarType value){
+    if (!(value > IndVarType{})){
+      throw std::runtime_error("the minimum step size must be positive");
+    }
+    minStepSize_ = value;
+  }
+  void setMaxStepSize(IndVarType value){ maxStepSize_ = value; }
+  void setMaxRejectionsPerStep(int value){
+    if (value < 0){
+      throw std::runtime_error("the maximum number of rejections cannot be negative");
+    }
+    maxRejections_ = value;
+  }
+  void setStepSizeScalingLimits(IndVarType facMin, IndVarType facMax){
+    if (!(facMin > IndVarType{} && facMin < IndVarType(1) && facMax > IndVarType(1))){
+      throw std::runtime_error("the step size scaling limits must satisfy 0 < facMin < 1 < facMax");
+    }
+    facMin_ = facMin;
+    facMax_ = facMax;
+  }
+
+  void operator()(::pressio::ode::StepCount /*step*/,
+		  ::pressio::ode::StepStartAt<IndVarType> startAt,
+		  ::pressio::ode::StepSize<IndVarType> & dt,
+		  ::pressio::ode::StepSizeMinAllowedValue<IndVarType> & minDt,
+		  ::pressio::ode::StepSizeScalingFactor<IndVarType> & reductionFactor)
+  {
+    using std::min;
+    dt = min(min(nextStepSize_, maxStepSize_), finalTime_ - startAt.get());
+    // the last step can be shorter than the minimum to hit the final time
+    minDt = min(minStepSize_, dt.get());
+    // only used by advancers that do not call stepRejected
+    reductionFactor = IndVarType(1)/facMin_;
+    currentStepWasRejected_ = false;
+    numRejections_ = 0;
+  }
+
+  void stepAccepted(::pressio::ode::StepCount /*step*/,
+		    const ::pressio::ode::StepSize<IndVarType> & dt)
+  {
+    using std::pow;
+    using std::min;
+    using std::max;
+    const IndVarType err = errorEstimate();
+    const IndVarType alpha = static_cast<IndVarType>(0.7)/k_;
+    const IndVarType beta  = static_cast<IndVarType>(0.4)/k_;
+    const IndVarType fac = safety_ * pow(err, -alpha) * pow(errPrev_, beta);
+    const IndVarType growthLimit = currentStepWasRejected_ ? IndVarType(1) : facMax_;
+    nextStepSize_ = dt.get() * min(growthLimit, max(facMin_, fac));
+    errPrev_ = max(err, static_cast<IndVarType>(1e-4));
+    PRESSIOLOG_DEBUG("pi step size policy: error = {:.6e}, next dt = {:.6e}", err, nextStepSize_);
+  }
+
+  void stepRejected(::pressio::ode::StepCount /*step*/,
+		    ::pressio::ode::StepSize<IndVarType> & dt)
+  {
+    using std::pow;
+    using std::min;
+    using std::max;
+    if (++numRejections_ > maxRejections_){
+      throw std::runtime_error("pi step size policy: too many rejections of the same step");
+    }
+    const auto err = static_cast<IndVarType>(stepper_.get().errorEstimate());
+    // a nan or inf estimate gets the largest reduction
+    const IndVarType fac = std::isfinite(err)
+      ? safety_ * pow(max(err, std::numeric_limits<IndVarType>::min()), -IndVarType(1)/k_)
+      : facMin_;
+    dt = dt.get() * max(facMin_, min(IndVarType(1), fac));
+    currentStepWasRejected_ = true;
+    PRESSIOLOG_DEBUG("pi step size policy: rejected, error = {:.6e}, retry dt = {:.6e}", err, dt.get());
+  }
+
+private:
+  IndVarType errorEstimate() const
+  {
+    const auto err = static_cast<IndVarType>(stepper_.get().errorEstimate());
+    if (!std::isfinite(err)){
+      throw std::runtime_error("pi step size policy: the error estimate is not finite");
+    }
+    constexpr auto tiny = std::numeric_limits<IndVarType>::min();
+    return std::max(err, tiny);
+  }
+};
+
+}// end namespace impl
+
+template<class StepperType, class ScalarType, class IndVarType>
+auto create_pi_step_size_policy(StepperType & stepper,
+				ScalarType absTol,
+				ScalarType relTol,
+				::pressio::ode::StepSize<IndVarType> initialStepSize,
+				const IndVarType & finalTime)
+{
+  return impl::PIStepSizePolicy<StepperType, IndVarType>
+    (stepper, absTol, relTol, initialStepSize.get(), finalTime);
+}
+
+}} // end namespace pressio::ode
+#endif  // ODE_ODE_PI_STEP_SIZE_POLICY_HPP_
@@ -52,6 +52,7 @@
 #include "./mpl.hpp"
 #include "./utils.hpp"
 #include "./type_traits.hpp"
+#include "./ops.hpp"
 
 #include "./ode_concepts.hpp"
 #include "./ode/exceptions.hpp"
@@ -66,5 +67,7 @@
 #include "./ode/ode_advance_to_target_point_variadic.hpp"
 #include "./ode/ode_advance_to_target_point_with_step_recovery.hpp"
 #include "./ode/ode_advance_to_target_point_with_step_recovery_variadic.hpp"
+#include "./ode/ode_async_observer.hpp"
+#include "./ode/ode_advance_parareal.hpp"
 
 #endif
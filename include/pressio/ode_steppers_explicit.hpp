@@ -61,5 +61,6 @@
 #include "./ode/ode_constants.hpp"
 #include "./ode/ode_enum_and_tags.hpp"
 #include "./ode/ode_create_explicit_stepper.hpp"
+#include "./ode/ode_pi_step_size_policy.hpp"
 
 #endif
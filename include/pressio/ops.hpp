@@ -69,6 +69,7 @@ template<class ...> struct matching_extents;
 #include "ops/ops_get_native.hpp"
 #include "ops/ops_known_data_type.hpp"
 #include "ops/ops_ordinal_type.hpp"
+#include "ops/ops_normal_equations_workspace.hpp"
 
 // Eigen
 #ifdef PRESSIO_ENABLE_TPL_EIGEN
@@ -88,8 +89,10 @@ template<class ...> struct matching_extents;
 #include "ops/eigen/ops_rank1_update.hpp"
 #include "ops/eigen/ops_rank2_update.hpp"
 #include "ops/eigen/ops_elementwise_multiply.hpp"
+#include "ops/eigen/ops_aliasing.hpp"
 #include "ops/eigen/ops_level2.hpp"
 #include "ops/eigen/ops_level3.hpp"
+#include "ops/eigen/ops_normal_equations.hpp"
 #endif
 
 // Kokkos
@@ -111,6 +114,7 @@ template<class ...> struct matching_extents;
 #include "ops/kokkos/ops_elementwise_multiply.hpp"
 #include "ops/kokkos/ops_level2.hpp"
 #include "ops/kokkos/ops_level3.hpp"
+#include "ops/kokkos/ops_normal_equations.hpp"
 #endif
 
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
@@ -140,6 +144,7 @@ template<class ...> struct matching_extents;
 #include "ops/tpetra/ops_multi_vector_update.hpp"
 #include "ops/tpetra/ops_level2.hpp"
 #include "ops/tpetra/ops_level3.hpp"
+#include "ops/tpetra/ops_normal_equations.hpp"
 
 // Tpetra block
 #include "ops/tpetra_block/ops_clone.hpp"
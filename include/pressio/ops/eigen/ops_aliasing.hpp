@@ -0,0 +1,103 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_aliasing.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_EIGEN_OPS_ALIASING_HPP_
+#define OPS_EIGEN_OPS_ALIASING_HPP_
+
+namespace pressio{ namespace ops{ namespace impl{
+
+template<class T, class = void>
+struct eigen_has_direct_access : std::false_type{};
+
+template<class T>
+struct eigen_has_direct_access<
+  T, mpl::enable_if_t<
+       (int(Eigen::internal::traits<T>::Flags) & int(Eigen::DirectAccessBit)) != 0
+       >
+  > : std::true_type{};
+
+/*
+ * true if the dense storage of a and b overlaps.
+ * The range spanned by each operand is computed from its data pointer
+ * and strides, so blocks/columns/diagonals of the same matrix are
+ * caught too. Operands without direct access (e.g. sparse) never share
+ * storage with a dense operand and are reported as non-overlapping.
+ */
+template<class T1, class T2>
+::pressio::mpl::enable_if_t<
+  eigen_has_direct_access<T1>::value && eigen_has_direct_access<T2>::value,
+  bool
+  >
+eigen_storage_overlaps(const T1 & a, const T2 & b)
+{
+  if (a.size() == 0 || b.size() == 0){ return false; }
+
+  auto last = [](const auto & o){
+    return o.data()
+      + (o.outerSize() - 1) * o.outerStride()
+      + (o.innerSize() - 1) * o.innerStride();
+  };
+  const void * aBegin = a.data();
+  const void * aEnd   = last(a) + 1;
+  const void * bBegin = b.data();
+  const void * bEnd   = last(b) + 1;
+  return std::less<const void*>()(aBegin, bEnd)
+    && std::less<const void*>()(bBegin, aEnd);
+}
+
+template<class T1, class T2>
+::pressio::mpl::enable_if_t<
+  !(eigen_has_direct_access<T1>::value && eigen_has_direct_access<T2>::value),
+  bool
+  >
+eigen_storage_overlaps(const T1 &, const T2 &){
+  return false;
+}
+
+}}}//end namespace pressio::ops::impl
+#endif  // OPS_EIGEN_OPS_ALIASING_HPP_
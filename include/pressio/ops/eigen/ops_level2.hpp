@@ -60,6 +60,10 @@ namespace pressio{ namespace ops{
 // - scalar type of A, x and y is the same
 // - alpha and beta types are same as scalar type
 // - scalar can be constructed from double, eg. Scalar(1)
+// The products are evaluated without a temporary (noalias) when y does not
+// share storage with A or x. If it does (e.g. y and x are the same vector,
+// or views of the same matrix), this is detected from the data pointers
+// and the product goes through a temporary, so the result is still correct.
 // Note: only applies to the overloads that inside use native Eigen operations
 
 //-------------------------------
@@ -107,10 +111,20 @@ product(::pressio::nontranspose /*unused*/,
   const auto & A_n = impl::get_native(A);
   const auto & x_n = impl::get_native(x);
   if (alpha_ == zero) {
-    ::pressio::ops::scale(y_n, beta_);
+    ::pressio::ops::scale(y, beta_);
   } else {
-    if (has_beta) { y_n = beta_ * y_n + alpha_ * A_n * x_n; }
-    else { y_n = alpha_ * A_n * x_n; }
+    const bool aliased = impl::eigen_storage_overlaps(y_n, A_n)
+      || impl::eigen_storage_overlaps(y_n, x_n);
+    if (aliased) {
+      // the product is evaluated into a temporary before y is overwritten
+      if (has_beta) { y_n = beta_ * y_n + alpha_ * A_n * x_n; }
+      else { y_n = alpha_ * A_n * x_n; }
+    }
+    else if (has_beta) {
+      y_n *= beta_;
+      y_n.noalias() += alpha_ * A_n * x_n;
+    }
+    else { y_n.noalias() = alpha_ * A_n * x_n; }
   }
 
 }
@@ -200,10 +214,20 @@ product(::pressio::transpose /*unused*/,
   const auto & A_n = impl::get_native(A);
   const auto & x_n = impl::get_native(x);
   if (alpha_ == zero) {
-    ::pressio::ops::scale(y_n, beta_);
+    ::pressio::ops::scale(y, beta_);
   } else {
-    if (has_beta) { y_n = beta_ * y_n + alpha_ * A_n.transpose() * x_n; }
-    else { y_n = alpha_ * A_n.transpose() * x_n; }
+    const bool aliased = impl::eigen_storage_overlaps(y_n, A_n)
+      || impl::eigen_storage_overlaps(y_n, x_n);
+    if (aliased) {
+      // the product is evaluated into a temporary before y is overwritten
+      if (has_beta) { y_n = beta_ * y_n + alpha_ * A_n.transpose() * x_n; }
+      else { y_n = alpha_ * A_n.transpose() * x_n; }
+    }
+    else if (has_beta) {
+      y_n *= beta_;
+      y_n.noalias() += alpha_ * A_n.transpose() * x_n;
+    }
+    else { y_n.noalias() = alpha_ * A_n.transpose() * x_n; }
   }
 }
 
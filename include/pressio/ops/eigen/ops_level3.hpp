@@ -53,6 +53,10 @@ namespace pressio{ namespace ops{
 
 /*
  * C = beta * C + alpha*op(A)*op(B)
+ * When C does not share storage with A or B the products are
+ * evaluated without a temporary (i.e. noalias). Overlapping storage
+ * is detected from the data pointers and then the product goes
+ * through a temporary, so the result is correct either way.
 */
 
 //-------------------------------------------
@@ -99,11 +103,19 @@ product(::pressio::transpose /*unused*/,
   const sc_t alpha_(alpha);
   const sc_t beta_(beta);
 
-  if (beta_ == zero) {
-    C = alpha_ * A.transpose() * B;
+  const bool aliased = impl::eigen_storage_overlaps(C, A)
+    || impl::eigen_storage_overlaps(C, B);
+  if (aliased) {
+    // the product is evaluated into a temporary before C is overwritten
+    if (beta_ == zero) { C = alpha_ * A.transpose() * B; }
+    else { C = beta_ * C + alpha_ * A.transpose() * B; }
+  }
+  else if (beta_ == zero) {
+    C.noalias() = alpha_ * A.transpose() * B;
   }
   else {
-    C = beta_ * C + alpha_ * A.transpose() * B;
+    C *= beta_;
+    C.noalias() += alpha_ * A.transpose() * B;
   }
 }
 
@@ -151,11 +163,19 @@ product(::pressio::nontranspose /*unused*/,
   const sc_t alpha_(alpha);
   const sc_t beta_(beta);
 
-  if (beta_ == zero) {
-    C = alpha_ * A * B;
+  const bool aliased = impl::eigen_storage_overlaps(C, A)
+    || impl::eigen_storage_overlaps(C, B);
+  if (aliased) {
+    // the product is evaluated into a temporary before C is overwritten
+    if (beta_ == zero) { C = alpha_ * A * B; }
+    else { C = beta_ * C + alpha_ * A * B; }
+  }
+  else if (beta_ == zero) {
+    C.noalias() = alpha_ * A * B;
   }
   else {
-    C = beta_ * C + alpha_ * A * B;
+    C *= beta_;
+    C.noalias() += alpha_ * A * B;
   }
 }
 
@@ -196,10 +216,17 @@ product(::pressio::transpose /*unused*/,
   const sc_t alpha_(alpha);
   const sc_t beta_(beta);
 
-  if (beta_ == zero) {
-    C = alpha_ * A.transpose() * A;
+  const bool aliased = impl::eigen_storage_overlaps(C, A);
+  if (aliased) {
+    // the product is evaluated into a temporary before C is overwritten
+    if (beta_ == zero) { C = alpha_ * A.transpose() * A; }
+    else { C = beta_ * C + alpha_ * A.transpose() * A; }
+  }
+  else if (beta_ == zero) {
+    C.noalias() = alpha_ * A.transpose() * A;
   } else {
-    C = beta_ * C + alpha_ * A.transpose() * A;
+    C *= beta_;
+    C.noalias() += alpha_ * A.transpose() * A;
   }
 }
 
@@ -280,10 +307,18 @@ product(::pressio::nontranspose /*unused*/,
   const sc_t alpha_(alpha);
   const sc_t beta_(beta);
 
-  if (beta_ == zero) {
-    C = alpha_ * A.native() * B;
+  const bool aliased = impl::eigen_storage_overlaps(C, A.native().diagonal())
+    || impl::eigen_storage_overlaps(C, B);
+  if (aliased) {
+    // the product is evaluated into a temporary before C is overwritten
+    if (beta_ == zero) { C = alpha_ * A.native() * B; }
+    else { C = beta_ * C + alpha_ * A.native() * B; }
+  }
+  else if (beta_ == zero) {
+    C.noalias() = alpha_ * A.native() * B;
   } else {
-    C = beta_ * C + alpha_ * A.native() * B;
+    C *= beta_;
+    C.noalias() += alpha_ * A.native() * B;
   }
 }
 
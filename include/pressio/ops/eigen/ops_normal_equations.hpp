@@ -0,0 +1,204 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_normal_equations.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_EIGEN_OPS_NORMAL_EQUATIONS_HPP_
+#define OPS_EIGEN_OPS_NORMAL_EQUATIONS_HPP_
+
+namespace pressio{ namespace ops{
+
+namespace impl{
+/*
+  number of rows of J processed per block: chosen such that
+  a block of J stays within a typical L2 cache so that all
+  contributions (H, g and the residual norm) are accumulated
+  while the block is still resident
+*/
+template<class sc_t, class index_t>
+index_t normal_equations_row_block_size(index_t numCols)
+{
+  constexpr std::size_t targetBytes = 128*1024;
+  const std::size_t nc = numCols > 0 ? (std::size_t) numCols : 1;
+  const std::size_t nb = targetBytes/(sizeof(sc_t)*nc);
+  return (index_t) (nb < 16 ? 16 : nb);
+}
+}//end namespace impl
+
+/*
+  fused kernel for normal equations:
+
+    H = J^T J,  g = J^T r,  return r^T r
+
+  computed in a single blocked pass over J and r
+*/
+template <class J_type, class r_type, class H_type, class g_type>
+::pressio::mpl::enable_if_t<
+  // common constraints
+     ::pressio::Traits<J_type>::rank == 2
+  && ::pressio::Traits<r_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_dense_matrix_eigen<J_type>::value
+  && ::pressio::is_vector_eigen<r_type>::value
+  && ::pressio::is_dense_matrix_eigen<H_type>::value
+  && ::pressio::is_vector_eigen<g_type>::value
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<J_type, r_type, H_type, g_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<J_type>::scalar_type>::value,
+  typename ::pressio::Traits<J_type>::scalar_type
+  >
+normal_equations(const J_type & J,
+		 const r_type & r,
+		 H_type & H,
+		 g_type & g)
+{
+  assert( ::pressio::ops::extent(J, 0) == ::pressio::ops::extent(r, 0) );
+  assert( ::pressio::ops::extent(H, 0) == ::pressio::ops::extent(J, 1) );
+  assert( ::pressio::ops::extent(H, 1) == ::pressio::ops::extent(J, 1) );
+  assert( ::pressio::ops::extent(g, 0) == ::pressio::ops::extent(J, 1) );
+
+  using sc_t = typename ::pressio::Traits<J_type>::scalar_type;
+  using index_t = Eigen::Index;
+  const index_t m = J.rows();
+  const index_t n = J.cols();
+  const index_t nb = impl::normal_equations_row_block_size<sc_t>(n);
+
+  H.setZero();
+  g.setZero();
+  sc_t rr{0};
+  for (index_t i=0; i<m; i+=nb){
+    const index_t len = std::min(nb, m-i);
+    const auto Jb = J.middleRows(i, len);
+    const auto rb = r.segment(i, len);
+    // only the lower triangle of H is accumulated
+    H.template selfadjointView<Eigen::Lower>().rankUpdate(Jb.transpose());
+    g.noalias() += Jb.transpose() * rb;
+    rr += rb.squaredNorm();
+  }
+
+  // fill the strictly upper triangle from the lower one
+  for (index_t j=1; j<n; ++j){
+    for (index_t i=0; i<j; ++i){
+      H(i,j) = H(j,i);
+    }
+  }
+  return rr;
+}
+
+/*
+  fused kernel for weighted normal equations:
+
+    H = J^T (WJ),  g = J^T (Wr),  return r^T (Wr)
+
+  computed in a single blocked pass over J, WJ, r and Wr
+*/
+template <
+  class J_type, class WJ_type, class r_type, class Wr_type,
+  class H_type, class g_type
+  >
+::pressio::mpl::enable_if_t<
+  // common constraints
+     ::pressio::Traits<J_type>::rank == 2
+  && ::pressio::Traits<WJ_type>::rank == 2
+  && ::pressio::Traits<r_type>::rank == 1
+  && ::pressio::Traits<Wr_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_dense_matrix_eigen<J_type>::value
+  && ::pressio::is_dense_matrix_eigen<WJ_type>::value
+  && ::pressio::is_vector_eigen<r_type>::value
+  && ::pressio::is_vector_eigen<Wr_type>::value
+  && ::pressio::is_dense_matrix_eigen<H_type>::value
+  && ::pressio::is_vector_eigen<g_type>::value
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<
+    J_type, WJ_type, r_type, Wr_type, H_type, g_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<J_type>::scalar_type>::value,
+  typename ::pressio::Traits<J_type>::scalar_type
+  >
+normal_equations(const J_type & J,
+		 const WJ_type & WJ,
+		 const r_type & r,
+		 const Wr_type & Wr,
+		 H_type & H,
+		 g_type & g)
+{
+  assert( ::pressio::ops::extent(J, 0) == ::pressio::ops::extent(WJ, 0) );
+  assert( ::pressio::ops::extent(J, 1) == ::pressio::ops::extent(WJ, 1) );
+  assert( ::pressio::ops::extent(J, 0) == ::pressio::ops::extent(r, 0) );
+  assert( ::pressio::ops::extent(r, 0) == ::pressio::ops::extent(Wr, 0) );
+  assert( ::pressio::ops::extent(H, 0) == ::pressio::ops::extent(J, 1) );
+  assert( ::pressio::ops::extent(H, 1) == ::pressio::ops::extent(J, 1) );
+  assert( ::pressio::ops::extent(g, 0) == ::pressio::ops::extent(J, 1) );
+
+  using sc_t = typename ::pressio::Traits<J_type>::scalar_type;
+  using index_t = Eigen::Index;
+  const index_t m = J.rows();
+  const index_t n = J.cols();
+  // two matrices are streamed, so halve the block
+  const index_t nb = impl::normal_equations_row_block_size<sc_t>(2*n);
+
+  H.setZero();
+  g.setZero();
+  sc_t rWr{0};
+  for (index_t i=0; i<m; i+=nb){
+    const index_t len = std::min(nb, m-i);
+    const auto Jb  = J.middleRows(i, len);
+    const auto WJb = WJ.middleRows(i, len);
+    const auto rb  = r.segment(i, len);
+    const auto Wrb = Wr.segment(i, len);
+    H.noalias() += Jb.transpose() * WJb;
+    g.noalias() += Jb.transpose() * Wrb;
+    rWr += rb.dot(Wrb);
+  }
+  return rWr;
+}
+
+}}//end namespace pressio::ops
+#endif  // OPS_EIGEN_OPS_NORMAL_EQUATIONS_HPP_
@@ -103,5 +103,132 @@ update(T & M,         const alpha_t & a,
   }
 }
 
+//----------------------------------------------------------------------
+// M = a * M + b * M1 + c * M2
+//----------------------------------------------------------------------
+template<
+  class T, class T1, class T2,
+  class a_Type, class b_Type, class c_Type
+  >
+::pressio::mpl::enable_if_t<
+  // rank-2 update common constraints
+     ::pressio::Traits<T>::rank == 2
+  && ::pressio::Traits<T1>::rank == 2
+  && ::pressio::Traits<T2>::rank == 2
+  // TPL/container specific
+  && (::pressio::is_native_container_eigen<T>::value
+   || ::pressio::is_expression_acting_on_eigen<T>::value)
+  && (::pressio::is_native_container_eigen<T1>::value
+   || ::pressio::is_expression_acting_on_eigen<T1>::value)
+  && (::pressio::is_native_container_eigen<T2>::value
+   || ::pressio::is_expression_acting_on_eigen<T2>::value)
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<T, T1, T2>::value
+  && (std::is_floating_point<typename ::pressio::Traits<T>::scalar_type>::value
+   || std::is_integral<typename ::pressio::Traits<T>::scalar_type>::value)
+  && std::is_convertible<a_Type, typename ::pressio::Traits<T>::scalar_type>::value
+  && std::is_convertible<b_Type, typename ::pressio::Traits<T>::scalar_type>::value
+  && std::is_convertible<c_Type, typename ::pressio::Traits<T>::scalar_type>::value
+  >
+update(T & M,         const a_Type & a,
+       const T1 & M1, const b_Type & b,
+       const T2 & M2, const c_Type & c)
+{
+  assert(::pressio::ops::extent(M, 0) == ::pressio::ops::extent(M1, 0));
+  assert(::pressio::ops::extent(M, 1) == ::pressio::ops::extent(M1, 1));
+  assert(::pressio::ops::extent(M, 0) == ::pressio::ops::extent(M2, 0));
+  assert(::pressio::ops::extent(M, 1) == ::pressio::ops::extent(M2, 1));
+
+  using sc_t = typename ::pressio::Traits<T>::scalar_type;
+  const auto zero = ::pressio::utils::Constants<sc_t>::zero();
+  const sc_t a_(a);
+  const sc_t b_(b);
+  const sc_t c_(c);
+
+  if (b_ == zero) {
+    ::pressio::ops::update(M, a_, M2, c_);
+  } else if (c_ == zero) {
+    ::pressio::ops::update(M, a_, M1, b_);
+  } else {
+    auto & M_n = impl::get_native(M);
+    const auto & M_n1 = impl::get_native(M1);
+    const auto & M_n2 = impl::get_native(M2);
+    if (a_ == zero) {
+      M_n = b_*M_n1 + c_*M_n2;
+    } else {
+      M_n = a_*M_n + b_*M_n1 + c_*M_n2;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// M = a * M + b * M1 + c * M2 + d * M3
+//----------------------------------------------------------------------
+template<
+  class T, class T1, class T2, class T3,
+  class a_Type, class b_Type, class c_Type, class d_Type
+  >
+::pressio::mpl::enable_if_t<
+  // rank-2 update common constraints
+     ::pressio::Traits<T>::rank == 2
+  && ::pressio::Traits<T1>::rank == 2
+  && ::pressio::Traits<T2>::rank == 2
+  && ::pressio::Traits<T3>::rank == 2
+  // TPL/container specific
+  && (::pressio::is_native_container_eigen<T>::value
+   || ::pressio::is_expression_acting_on_eigen<T>::value)
+  && (::pressio::is_native_container_eigen<T1>::value
+   || ::pressio::is_expression_acting_on_eigen<T1>::value)
+  && (::pressio::is_native_container_eigen<T2>::value
+   || ::pressio::is_expression_acting_on_eigen<T2>::value)
+  && (::pressio::is_native_container_eigen<T3>::value
+   || ::pressio::is_expression_acting_on_eigen<T3>::value)
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<T, T1, T2, T3>::value
+  && (std::is_floating_point<typename ::pressio::Traits<T>::scalar_type>::value
+   || std::is_integral<typename ::pressio::Traits<T>::scalar_type>::value)
+  && std::is_convertible<a_Type, typename ::pressio::Traits<T>::scalar_type>::value
+  && std::is_convertible<b_Type, typename ::pressio::Traits<T>::scalar_type>::value
+  && std::is_convertible<c_Type, typename ::pressio::Traits<T>::scalar_type>::value
+  && std::is_convertible<d_Type, typename ::pressio::Traits<T>::scalar_type>::value
+  >
+update(T & M,         const a_Type & a,
+       const T1 & M1, const b_Type & b,
+       const T2 & M2, const c_Type & c,
+       const T3 & M3, const d_Type & d)
+{
+  assert(::pressio::ops::extent(M, 0) == ::pressio::ops::extent(M1, 0));
+  assert(::pressio::ops::extent(M, 1) == ::pressio::ops::extent(M1, 1));
+  assert(::pressio::ops::extent(M, 0) == ::pressio::ops::extent(M2, 0));
+  assert(::pressio::ops::extent(M, 1) == ::pressio::ops::extent(M2, 1));
+  assert(::pressio::ops::extent(M, 0) == ::pressio::ops::extent(M3, 0));
+  assert(::pressio::ops::extent(M, 1) == ::pressio::ops::extent(M3, 1));
+
+  using sc_t = typename ::pressio::Traits<T>::scalar_type;
+  const auto zero = ::pressio::utils::Constants<sc_t>::zero();
+  const sc_t a_(a);
+  const sc_t b_(b);
+  const sc_t c_(c);
+  const sc_t d_(d);
+
+  if (b_ == zero) {
+    ::pressio::ops::update(M, a_, M2, c_, M3, d_);
+  } else if (c_ == zero) {
+    ::pressio::ops::update(M, a_, M1, b_, M3, d_);
+  } else if (d_ == zero) {
+    ::pressio::ops::update(M, a_, M1, b_, M2, c_);
+  } else {
+    auto & M_n = impl::get_native(M);
+    const auto & M_n1 = impl::get_native(M1);
+    const auto & M_n2 = impl::get_native(M2);
+    const auto & M_n3 = impl::get_native(M3);
+    if (a_ == zero) {
+      M_n = b_*M_n1 + c_*M_n2 + d_*M_n3;
+    } else {
+      M_n = a_*M_n + b_*M_n1 + c_*M_n2 + d_*M_n3;
+    }
+  }
+}
+
 }}//end namespace pressio::ops
 #endif  // OPS_EIGEN_OPS_RANK2_UPDATE_HPP_
@@ -51,6 +51,118 @@
 
 namespace pressio{ namespace ops{
 
+namespace impl{
+/*
+ * local part of A^T * B: with constant stride, the local rows of the
+ * multivectors are viewed as column-major matrices so that this is a
+ * single local gemm, otherwise we go column by column
+*/
+template <typename A_type, typename B_type, typename C_type>
+void _epetra_local_transpose_product(const A_type & A,
+				     const B_type & B,
+				     C_type & Cloc)
+{
+  using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
+  const int myLength = A.MyLength();
+  if (A.ConstantStride() && B.ConstantStride())
+  {
+    using view_t = Eigen::Map<
+      const Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>, 0, Eigen::OuterStride<> >;
+    const view_t Aloc(A.Values(), myLength, A.NumVectors(), Eigen::OuterStride<>(A.Stride()));
+    const view_t Bloc(B.Values(), myLength, B.NumVectors(), Eigen::OuterStride<>(B.Stride()));
+    Cloc.noalias() = Aloc.transpose() * Bloc;
+  }
+  else
+  {
+    using col_t = Eigen::Map<const Eigen::Matrix<sc_t, Eigen::Dynamic, 1> >;
+    for (int i=0; i<A.NumVectors(); i++){
+      const col_t colI(A[i], myLength);
+      for (int j=0; j<B.NumVectors(); j++){
+	Cloc(i,j) = colI.dot(col_t(B[j], myLength));
+      }
+    }
+  }
+}
+
+/*
+ * local part of A^T * A: it is symmetric, so with constant stride only
+ * the lower half is computed and then mirrored, so that a single
+ * reduction covers all of it
+*/
+template <typename A_type, typename C_type>
+void _epetra_local_gram(const A_type & A, C_type & Cloc)
+{
+  using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
+  using local_t = Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>;
+  if (A.ConstantStride())
+  {
+    using view_t = Eigen::Map<const local_t, 0, Eigen::OuterStride<> >;
+    const view_t Aloc(A.Values(), A.MyLength(), A.NumVectors(), Eigen::OuterStride<>(A.Stride()));
+    Cloc.setZero();
+    Cloc.template selfadjointView<Eigen::Lower>().rankUpdate(Aloc.transpose());
+    Cloc.template triangularView<Eigen::StrictlyUpper>() = Cloc.transpose();
+  }
+  else
+  {
+    _epetra_local_transpose_product(A, A, Cloc);
+  }
+}
+
+/*
+ * buffers for the local part of the product and its reduction: one per
+ * thread and scalar type, resized only when a larger product comes in,
+ * so that repeated products (e.g. one per nonlinear iteration) do not
+ * allocate
+*/
+template <typename sc_t>
+struct EpetraProductScratch
+{
+  using matrix_t = Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>;
+  using view_t = Eigen::Map<matrix_t>;
+  std::vector<sc_t> local;
+  std::vector<sc_t> global;
+
+  view_t localView(int rows, int cols){
+    const auto n = static_cast<std::size_t>(rows)*static_cast<std::size_t>(cols);
+    if (local.size() < n){ local.resize(n); global.resize(n); }
+    return view_t(local.data(), rows, cols);
+  }
+};
+
+template <typename sc_t>
+EpetraProductScratch<sc_t> & _epetra_product_scratch()
+{
+  thread_local EpetraProductScratch<sc_t> scratch;
+  return scratch;
+}
+
+/*
+ * C = beta * C + alpha * (sum over ranks of Cloc)
+ * with a single reduction for all entries;
+ * Cloc must be a view of the local buffer of the scratch
+*/
+template <typename A_type, typename C_loc_type, typename sc_t, typename C_type>
+void _epetra_reduce_and_update(const A_type & A,
+			       C_loc_type & Cloc,
+			       EpetraProductScratch<sc_t> & scratch,
+			       const sc_t alpha,
+			       const sc_t beta,
+			       C_type & C)
+{
+  using view_t = typename EpetraProductScratch<sc_t>::view_t;
+  view_t Cglob(scratch.global.data(), Cloc.rows(), Cloc.cols());
+  A.Comm().SumAll(Cloc.data(), Cglob.data(), static_cast<int>(Cloc.size()));
+
+  constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
+  if (beta == zero){
+    C = alpha * Cglob;
+  }
+  else{
+    C = beta * C + alpha * Cglob;
+  }
+}
+}//end namespace pressio::ops::impl
+
 /*
  * C = beta * C + alpha*op(A)*op(B)
 */
@@ -97,22 +209,13 @@ product(::pressio::transpose /*unused*/,
   assert( (std::size_t)::pressio::ops::extent(C,0) == (std::size_t)numVecsA );
   assert( (std::size_t)::pressio::ops::extent(C,1) == (std::size_t)numVecsB );
 
+  // one local gemm and a single reduction, rather than one
+  // global dot (hence one reduction) for each entry of C
   using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
-  const auto zero = ::pressio::utils::Constants<sc_t>::zero();
-  const sc_t alpha_(alpha);
-  const sc_t beta_(beta);
-  auto tmp = zero;
-  // compute dot between every column of A with every col of B
-  for (std::size_t i=0; i<(std::size_t)numVecsA; i++)
-  {
-    for (std::size_t j=0; j<(std::size_t)numVecsB; j++)
-    {
-      A(i)->Dot( *(B(j)), &tmp );
-      tmp *= alpha_;
-      C(i,j) = beta_ == zero ? zero : beta_ * C(i,j);
-      C(i,j) += tmp;
-    }
-  }
+  auto & scratch = impl::_epetra_product_scratch<sc_t>();
+  auto Cloc = scratch.localView(numVecsA, numVecsB);
+  impl::_epetra_local_transpose_product(A, B, Cloc);
+  impl::_epetra_reduce_and_update(A, Cloc, scratch, sc_t(alpha), sc_t(beta), C);
 }
 
 /* -------------------------------------------------------------------
@@ -200,32 +303,10 @@ product(::pressio::transpose /*unused*/,
   assert(C.cols() == numVecsA);
 
   using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
-  constexpr auto zero = ::pressio::utils::Constants<sc_t>::zero();
-  sc_t tmp = zero;
-  const sc_t alpha_(alpha);
-  const sc_t beta_(beta);
-  const auto apply_beta = [beta_](sc_t c) -> sc_t {
-    return beta_ == zero ? zero : beta_ * c;
-  };
-
-  // A dot A = A^T*A, which yields a symmetric matrix
-  // only need to compute half and fill remaining entries accordingly
-  for (int i=0; i< numVecsA; i++)
-  {
-    C(i,i) = apply_beta(C(i,i));
-    A(i)->Dot( *(A(i)), &tmp );
-    C(i,i) += alpha_*tmp;
-
-    for (int j=i+1; j<numVecsA; j++)
-    {
-      C(i,j) = apply_beta(C(i,j));
-      C(j,i) = apply_beta(C(j,i));
-
-      A(i)->Dot( *(A(j)), &tmp );
-      C(i,j) += alpha_*tmp;
-      C(j,i) += alpha_*tmp;
-    }
-  }
+  auto & scratch = impl::_epetra_product_scratch<sc_t>();
+  auto Cloc = scratch.localView(numVecsA, numVecsA);
+  impl::_epetra_local_gram(A, Cloc);
+  impl::_epetra_reduce_and_update(A, Cloc, scratch, sc_t(alpha), sc_t(beta), C);
 }
 
 template <
@@ -0,0 +1,393 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_normal_equations.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_KOKKOS_OPS_NORMAL_EQUATIONS_HPP_
+#define OPS_KOKKOS_OPS_NORMAL_EQUATIONS_HPP_
+
+namespace pressio{ namespace ops{
+
+namespace impl{
+
+/*
+  single pass over the operands of the (weighted) normal equations.
+
+  Each team copies a block of rows of J, r (and WJ, Wr if weighted)
+  into its scratch memory once, then its threads accumulate their
+  share of the entries of the packed [H (col-major) | g | r^T Wr]
+  from that block. Every entry is owned by one thread of the team,
+  and the array reduction sums the per-thread partial results, so the
+  result of the reduction is the (H, g, r^T Wr) tuple.
+*/
+template <class J_t, class WJ_t, class r_t, class Wr_t>
+struct KokkosNormalEquationsFunctor
+{
+  using sc_t = typename J_t::non_const_value_type;
+  using exec_space = typename J_t::execution_space;
+  using policy_type = Kokkos::TeamPolicy<exec_space>;
+  using member_type = typename policy_type::member_type;
+  using scratch_space = typename exec_space::scratch_memory_space;
+  using unmanaged_t = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using block_type = Kokkos::View<sc_t**, Kokkos::LayoutRight, scratch_space, unmanaged_t>;
+  using column_type = Kokkos::View<sc_t*, scratch_space, unmanaged_t>;
+
+  // array reduction over the n*n + n + 1 packed entries
+  using value_type = sc_t[];
+  std::size_t value_count;
+
+  J_t J_;
+  WJ_t WJ_;
+  r_t r_;
+  Wr_t Wr_;
+  bool weighted_;
+  int numRows_;
+  int numCols_;
+  int rowsPerTeam_;
+  int scratchLevel_ = 0;
+
+  KokkosNormalEquationsFunctor(const J_t & J, const WJ_t & WJ,
+			       const r_t & r, const Wr_t & Wr,
+			       bool weighted, int rowsPerTeam)
+    : value_count(J.extent(1)*J.extent(1) + J.extent(1) + 1),
+      J_(J), WJ_(WJ), r_(r), Wr_(Wr), weighted_(weighted),
+      numRows_((int) J.extent(0)), numCols_((int) J.extent(1)),
+      rowsPerTeam_(rowsPerTeam){}
+
+  // scratch needed by each team
+  std::size_t teamScratchSize() const{
+    const std::size_t one = block_type::shmem_size(rowsPerTeam_, numCols_)
+      + column_type::shmem_size(rowsPerTeam_);
+    return weighted_ ? 2*one : one;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type dst) const{
+    for (std::size_t e=0; e<value_count; ++e){ dst[e] = sc_t(0); }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type dst, const value_type src) const{
+    for (std::size_t e=0; e<value_count; ++e){ dst[e] += src[e]; }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type & team, value_type sum) const
+  {
+    const int n = numCols_;
+    const int begin = team.league_rank()*rowsPerTeam_;
+    const int end = (begin + rowsPerTeam_ < numRows_) ? begin + rowsPerTeam_ : numRows_;
+    const int numBlockRows = end - begin;
+
+    block_type Jb(team.team_scratch(scratchLevel_), rowsPerTeam_, n);
+    column_type rb(team.team_scratch(scratchLevel_), rowsPerTeam_);
+    block_type WJb = Jb;
+    column_type Wrb = rb;
+    if (weighted_){
+      WJb = block_type(team.team_scratch(scratchLevel_), rowsPerTeam_, n);
+      Wrb = column_type(team.team_scratch(scratchLevel_), rowsPerTeam_);
+    }
+
+    // the only reads of the operands from global memory
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, numBlockRows*n),
+			 [&](const int k){
+			   const int i = k / n;
+			   const int j = k % n;
+			   Jb(i,j) = J_(begin + i, j);
+			   if (weighted_){ WJb(i,j) = WJ_(begin + i, j); }
+			 });
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, numBlockRows),
+			 [&](const int i){
+			   rb(i) = r_(begin + i);
+			   if (weighted_){ Wrb(i) = Wr_(begin + i); }
+			 });
+    team.team_barrier();
+
+    const int numH = n*n;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, (int) value_count),
+			 [&](const int e){
+			   sc_t acc = sc_t(0);
+			   if (e < numH){
+			     const int a = e % n;
+			     const int b = e / n;
+			     for (int i=0; i<numBlockRows; ++i){ acc += Jb(i,a)*WJb(i,b); }
+			   }
+			   else if (e < numH + n){
+			     const int a = e - numH;
+			     for (int i=0; i<numBlockRows; ++i){ acc += Jb(i,a)*Wrb(i); }
+			   }
+			   else{
+			     for (int i=0; i<numBlockRows; ++i){ acc += rb(i)*Wrb(i); }
+			   }
+			   sum[e] += acc;
+			 });
+  }
+};
+
+/*
+  computes the packed [H (col-major) | g | r^T Wr] into the device
+  buffer, which must have n*n + n + 1 entries; does not block
+*/
+template <class J_t, class WJ_t, class r_t, class Wr_t, class buffer_t>
+void kokkos_normal_equations_reduce(const J_t & J, const WJ_t & WJ,
+				    const r_t & r, const Wr_t & Wr,
+				    bool weighted,
+				    const buffer_t & buffer)
+{
+  using functor_t = KokkosNormalEquationsFunctor<J_t, WJ_t, r_t, Wr_t>;
+  using sc_t = typename functor_t::sc_t;
+  using policy_t = typename functor_t::policy_type;
+
+  const std::size_t n = J.extent(1);
+  assert(buffer.extent(0) == n*n + n + 1);
+
+  // size the row blocks so that a team's copy of them is about 16KB
+  const std::size_t bytesPerRow = (weighted ? 2 : 1)*(n + 1)*sizeof(sc_t);
+  const std::size_t rows = (16*1024) / bytesPerRow;
+  const int rowsPerTeam = (int) (rows < 1 ? 1 : (rows > 256 ? 256 : rows));
+  const int numRows = (int) J.extent(0);
+  const int leagueSize = (numRows + rowsPerTeam - 1) / rowsPerTeam;
+
+  functor_t functor(J, WJ, r, Wr, weighted, rowsPerTeam);
+  const std::size_t scratch = functor.teamScratchSize();
+  policy_t policy(leagueSize, Kokkos::AUTO);
+  functor.scratchLevel_ = (scratch <= (std::size_t) policy_t::scratch_size_max(0)) ? 0 : 1;
+  policy.set_scratch_size(functor.scratchLevel_, Kokkos::PerTeam(scratch));
+  Kokkos::parallel_reduce("pressio::ops::normal_equations", policy, functor, buffer);
+}
+
+// copies the packed H and g into their views on the device,
+// and returns the last entry of the buffer on the host
+template <class buffer_t, class H_type, class g_type>
+typename buffer_t::non_const_value_type
+kokkos_normal_equations_unpack(const buffer_t & buffer, H_type & H, g_type & g)
+{
+  static_assert
+    (std::is_same< typename H_type::array_layout, Kokkos::LayoutLeft>::value,
+     "The kokkos matrix must be layout left");
+
+  using exec_space = typename buffer_t::execution_space;
+  const int n = (int) H.extent(0);
+  const H_type H_d = H;
+  const g_type g_d = g;
+  Kokkos::parallel_for("pressio::ops::normal_equations_unpack",
+		       Kokkos::RangePolicy<exec_space>(0, n*n + n),
+		       KOKKOS_LAMBDA(const int e){
+			 if (e < n*n){ H_d(e % n, e / n) = buffer(e); }
+			 else{ g_d(e - n*n) = buffer(e); }
+		       });
+
+  typename buffer_t::non_const_value_type result = {};
+  Kokkos::deep_copy(result, Kokkos::subview(buffer, (std::size_t) (n*n + n)));
+  return result;
+}
+}//end namespace impl
+
+/*
+  scratch for the kokkos normal equations: the device buffer receiving
+  the packed [H | g | r^T r], reallocated only if the number of columns
+  of J changes
+*/
+template<class J_type>
+class NormalEquationsWorkspace<
+  J_type, ::pressio::mpl::enable_if_t<::pressio::is_dense_matrix_kokkos<J_type>::value>
+  >
+{
+  using sc_t = typename J_type::non_const_value_type;
+  using buffer_t = Kokkos::View<sc_t*, typename J_type::device_type>;
+  buffer_t buffer_;
+
+public:
+  const buffer_t & buffer(std::size_t numCols){
+    const std::size_t count = numCols*numCols + numCols + 1;
+    if (buffer_.extent(0) != count){
+      buffer_ = buffer_t("normalEqs", count);
+    }
+    return buffer_;
+  }
+};
+
+/*
+  normal equations:
+
+    H = J^T J,  g = J^T r,  return r^T r
+
+  computed by a single team-policy reduction that reads each row
+  block of J and r once (see impl::KokkosNormalEquationsFunctor);
+  the only host synchronization is for the returned scalar.
+  Callers that evaluate this repeatedly should keep a
+  NormalEquationsWorkspace<J_type> and pass it.
+*/
+template <class J_type, class r_type, class H_type, class g_type>
+::pressio::mpl::enable_if_t<
+  // common constraints
+     ::pressio::Traits<J_type>::rank == 2
+  && ::pressio::Traits<r_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_dense_matrix_kokkos<J_type>::value
+  && ::pressio::is_vector_kokkos<r_type>::value
+  && ::pressio::is_dense_matrix_kokkos<H_type>::value
+  && ::pressio::is_vector_kokkos<g_type>::value
+  // scalar compatibility: J and r can be views of const data
+  && ::pressio::all_have_traits_and_same_scalar<H_type, g_type>::value
+  && std::is_same<typename J_type::non_const_value_type,
+		  typename ::pressio::Traits<H_type>::scalar_type>::value
+  && std::is_same<typename r_type::non_const_value_type,
+		  typename ::pressio::Traits<H_type>::scalar_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<H_type>::scalar_type>::value,
+  typename ::pressio::Traits<H_type>::scalar_type
+  >
+normal_equations(const J_type & J,
+		 const r_type & r,
+		 H_type & H,
+		 g_type & g,
+		 NormalEquationsWorkspace<J_type> & workspace)
+{
+  assert( ::pressio::ops::extent(J, 0) == ::pressio::ops::extent(r, 0) );
+  assert( ::pressio::ops::extent(H, 0) == ::pressio::ops::extent(J, 1) );
+  assert( ::pressio::ops::extent(H, 1) == ::pressio::ops::extent(J, 1) );
+  assert( ::pressio::ops::extent(g, 0) == ::pressio::ops::extent(J, 1) );
+
+  const auto & buffer = workspace.buffer(J.extent(1));
+  impl::kokkos_normal_equations_reduce(J, J, r, r, false, buffer);
+  return impl::kokkos_normal_equations_unpack(buffer, H, g);
+}
+
+template <class J_type, class r_type, class H_type, class g_type>
+::pressio::mpl::enable_if_t<
+  // common constraints
+     ::pressio::Traits<J_type>::rank == 2
+  && ::pressio::Traits<r_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_dense_matrix_kokkos<J_type>::value
+  && ::pressio::is_vector_kokkos<r_type>::value
+  && ::pressio::is_dense_matrix_kokkos<H_type>::value
+  && ::pressio::is_vector_kokkos<g_type>::value
+  // scalar compatibility: J and r can be views of const data
+  && ::pressio::all_have_traits_and_same_scalar<H_type, g_type>::value
+  && std::is_same<typename J_type::non_const_value_type,
+		  typename ::pressio::Traits<H_type>::scalar_type>::value
+  && std::is_same<typename r_type::non_const_value_type,
+		  typename ::pressio::Traits<H_type>::scalar_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<H_type>::scalar_type>::value,
+  typename ::pressio::Traits<H_type>::scalar_type
+  >
+normal_equations(const J_type & J,
+		 const r_type & r,
+		 H_type & H,
+		 g_type & g)
+{
+  NormalEquationsWorkspace<J_type> workspace;
+  return normal_equations(J, r, H, g, workspace);
+}
+
+/*
+  weighted normal equations:
+
+    H = J^T (WJ),  g = J^T (Wr),  return r^T (Wr)
+
+  same single-pass reduction as above, reading each row block
+  of J, WJ, r and Wr once
+*/
+template <
+  class J_type, class WJ_type, class r_type, class Wr_type,
+  class H_type, class g_type
+  >
+::pressio::mpl::enable_if_t<
+  // common constraints
+     ::pressio::Traits<J_type>::rank == 2
+  && ::pressio::Traits<WJ_type>::rank == 2
+  && ::pressio::Traits<r_type>::rank == 1
+  && ::pressio::Traits<Wr_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_dense_matrix_kokkos<J_type>::value
+  && ::pressio::is_dense_matrix_kokkos<WJ_type>::value
+  && ::pressio::is_vector_kokkos<r_type>::value
+  && ::pressio::is_vector_kokkos<Wr_type>::value
+  && ::pressio::is_dense_matrix_kokkos<H_type>::value
+  && ::pressio::is_vector_kokkos<g_type>::value
+  // scalar compatibility: the inputs can be views of const data
+  && ::pressio::all_have_traits_and_same_scalar<H_type, g_type>::value
+  && std::is_same<typename J_type::non_const_value_type,
+		  typename ::pressio::Traits<H_type>::scalar_type>::value
+  && std::is_same<typename WJ_type::non_const_value_type,
+		  typename ::pressio::Traits<H_type>::scalar_type>::value
+  && std::is_same<typename r_type::non_const_value_type,
+		  typename ::pressio::Traits<H_type>::scalar_type>::value
+  && std::is_same<typename Wr_type::non_const_value_type,
+		  typename ::pressio::Traits<H_type>::scalar_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<H_type>::scalar_type>::value,
+  typename ::pressio::Traits<H_type>::scalar_type
+  >
+normal_equations(const J_type & J,
+		 const WJ_type & WJ,
+		 const r_type & r,
+		 const Wr_type & Wr,
+		 H_type & H,
+		 g_type & g)
+{
+  assert( ::pressio::ops::extent(J, 0) == ::pressio::ops::extent(WJ, 0) );
+  assert( ::pressio::ops::extent(J, 1) == ::pressio::ops::extent(WJ, 1) );
+  assert( ::pressio::ops::extent(J, 0) == ::pressio::ops::extent(r, 0) );
+  assert( ::pressio::ops::extent(r, 0) == ::pressio::ops::extent(Wr, 0) );
+  assert( ::pressio::ops::extent(H, 0) == ::pressio::ops::extent(J, 1) );
+  assert( ::pressio::ops::extent(H, 1) == ::pressio::ops::extent(J, 1) );
+  assert( ::pressio::ops::extent(g, 0) == ::pressio::ops::extent(J, 1) );
+
+  NormalEquationsWorkspace<J_type> workspace;
+  const auto & buffer = workspace.buffer(J.extent(1));
+  impl::kokkos_normal_equations_reduce(J, WJ, r, Wr, true, buffer);
+  return impl::kokkos_normal_equations_unpack(buffer, H, g);
+}
+
+}}//end namespace pressio::ops
+#endif  // OPS_KOKKOS_OPS_NORMAL_EQUATIONS_HPP_
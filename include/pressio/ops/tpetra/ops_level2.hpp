@@ -360,13 +360,165 @@ product(::pressio::nontranspose /*unused*/,
     y_h(i) = t;
   });
 }
+#endif
+
+namespace impl{
+
+// host targets are filled entry by entry, kokkos ones via axpby
+template<class y_type>
+struct tpetra_transpose_product_targets_host : std::integral_constant<bool,
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+     ::pressio::is_vector_eigen<y_type>::value
+  || ::pressio::is_expression_acting_on_eigen<y_type>::value ||
+#endif
+     ::pressio::is_dense_vector_teuchos<y_type>::value
+  >{};
+
+template<class y_type>
+struct tpetra_transpose_product_targets_kokkos : std::integral_constant<bool,
+     ::pressio::is_vector_kokkos<y_type>::value
+  || ::pressio::is_expression_acting_on_kokkos<y_type>::value
+  >{};
+
+/*
+  the local products are computed, and reduced, into a view
+  living in the memory space of the multivector, as required by Tpetra::idot.
+  host targets read it through a host mirror (allocated once per request,
+  and an alias of the view itself when the memory space is host accessible),
+  kokkos targets are updated on the device via axpby.
+*/
+template<class mv_type, class y_type, class enable = void>
+struct TpetraTransposeProductTarget;
+
+template<class mv_type, class y_type>
+struct TpetraTransposeProductTarget<
+  mv_type, y_type, mpl::enable_if_t<tpetra_transpose_product_targets_host<y_type>::value>
+  >
+{
+  using scalar_type = typename ::pressio::Traits<y_type>::scalar_type;
+  using result_view_type = Kokkos::View<
+    typename mv_type::dot_type*, typename mv_type::device_type>;
+  using stored_type = y_type *;
+
+  struct Storage{
+    stored_type y;
+    typename result_view_type::HostMirror ATx_h;
+  };
+
+  static Storage store(y_type & y, const result_view_type & ATx){
+    return Storage{&y, Kokkos::create_mirror_view(ATx)};
+  }
+
+  template<class alpha_t, class beta_t>
+  static void finalize(const result_view_type & ATx, const alpha_t & alpha,
+		       const beta_t & beta, Storage & storage)
+  {
+    Kokkos::deep_copy(storage.ATx_h, ATx);
+    auto & y = *storage.y;
+    const auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+    const scalar_type alpha_(alpha);
+    const scalar_type beta_(beta);
+    for (std::size_t i=0; i<storage.ATx_h.extent(0); ++i){
+      y(i) = beta_ == zero ? zero : beta_ * y(i);
+      if (!(alpha_ == zero)){
+	y(i) += alpha_ * storage.ATx_h(i);
+      }
+    }
+  }
+};
+
+template<class mv_type, class y_type>
+struct TpetraTransposeProductTarget<
+  mv_type, y_type, mpl::enable_if_t<tpetra_transpose_product_targets_kokkos<y_type>::value>
+  >
+{
+  using scalar_type = typename ::pressio::Traits<y_type>::scalar_type;
+  using result_view_type = Kokkos::View<
+    typename mv_type::dot_type*, typename mv_type::device_type>;
+  using Storage = typename ::pressio::mpl::remove_cvref<
+    decltype(::pressio::ops::impl::get_native(std::declval<y_type &>()))>::type;
+
+  static Storage store(y_type & y, const result_view_type & /*ATx*/){
+    return ::pressio::ops::impl::get_native(y);
+  }
+
+  template<class alpha_t, class beta_t>
+  static void finalize(const result_view_type & ATx, const alpha_t & alpha,
+		       const beta_t & beta, Storage & y)
+  {
+    ::KokkosBlas::axpby(alpha, ATx, beta, y);
+  }
+};
+
+/*
+  y = beta * y + alpha*A^T*x with a single reduction:
+  the local products A_local^T x_local are computed with one gemv and
+  then summed across ranks with a single (non-blocking) all-reduce,
+  as done by Tpetra::idot. The update of y happens in wait().
+  mv_type is the Tpetra::MultiVector type of A.
+*/
+template<class mv_type, class y_type, class alpha_t, class beta_t>
+class TpetraTransposeProductRequest
+{
+  using target_t = TpetraTransposeProductTarget<mv_type, y_type>;
+  using result_view_type = typename target_t::result_view_type;
+
+public:
+  template<class x_type>
+  TpetraTransposeProductRequest(const alpha_t & alpha, const mv_type & A,
+				const x_type & x, const beta_t & beta, y_type & y)
+    : alpha_(alpha), beta_(beta),
+      ATx_("ATx", A.getNumVectors()),
+      storage_(target_t::store(y, ATx_))
+  {
+    assert(size_t(A.getNumVectors()) == size_t(::pressio::ops::extent(y,0)));
+    request_ = Tpetra::idot(ATx_, A, x);
+  }
+
+  TpetraTransposeProductRequest(const TpetraTransposeProductRequest &) = delete;
+  TpetraTransposeProductRequest & operator=(const TpetraTransposeProductRequest &) = delete;
+
+  TpetraTransposeProductRequest(TpetraTransposeProductRequest && other)
+    : alpha_(other.alpha_), beta_(other.beta_),
+      ATx_(other.ATx_), storage_(other.storage_),
+      request_(std::move(other.request_)), pending_(other.pending_)
+  {
+    other.pending_ = false;
+  }
+
+  TpetraTransposeProductRequest & operator=(TpetraTransposeProductRequest &&) = delete;
+
+  ~TpetraTransposeProductRequest(){ wait(); }
+
+  // completes the reduction and updates y
+  void wait(){
+    if (pending_){
+      request_->wait();
+      target_t::finalize(ATx_, alpha_, beta_, storage_);
+      pending_ = false;
+    }
+  }
+
+private:
+  alpha_t alpha_;
+  beta_t beta_;
+  result_view_type ATx_;
+  typename target_t::Storage storage_;
+  std::shared_ptr<Tpetra::Details::CommRequest> request_;
+  bool pending_ = true;
+};
+
+}//end namespace pressio::ops::impl
 
 // -------------------------------
 // y = beta * y + alpha*A^T*x
 //
 // x = tpetra Vector
 // A = tpetra::MultiVector
-// y = Eigen vector
+// y = Eigen vector, Teuchos vector, Kokkos vector or
+//     Pressio expression based on Eigen or Kokkos
+//
+// all the entries of y are reduced at once
 // -------------------------------
 template <class A_type, class x_type, class y_type, class alpha_t, class beta_t>
 ::pressio::mpl::enable_if_t<
@@ -377,8 +529,8 @@ template <class A_type, class x_type, class y_type, class alpha_t, class beta_t>
   // TPL/container specific
   && ::pressio::is_multi_vector_tpetra<A_type>::value
   && ::pressio::is_vector_tpetra<x_type>::value
-  && (::pressio::is_vector_eigen<y_type>::value
-   || ::pressio::is_expression_acting_on_eigen<y_type>::value)
+  && (::pressio::ops::impl::tpetra_transpose_product_targets_host<y_type>::value
+   || ::pressio::ops::impl::tpetra_transpose_product_targets_kokkos<y_type>::value)
   // scalar compatibility
   && ::pressio::all_have_traits_and_same_scalar<A_type, x_type, y_type>::value
   && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
@@ -393,35 +545,16 @@ product(::pressio::transpose /*unused*/,
 	const beta_t & beta,
 	y_type & y)
 {
-  // // dot product of each vector in A with vecB
-  //  Apparently, trilinos does not support this...
-  //    the native dot() method of multivectors is only for
-  //    dot product of two multivectors with same # of columns.
-  //    So we have to extract each column vector
-  //    from A and do dot product one a time
-
-  assert(size_t(A.getNumVectors()) == size_t(::pressio::ops::extent(y,0)));
-
-  const auto zero = ::pressio::utils::Constants<beta_t>::zero();
-  const auto numVecs = ::pressio::ops::extent(A, 1);
-  for (std::size_t i=0; i<(std::size_t)numVecs; i++)
-    {
-      // colI is a Teuchos::RCP<Vector<...>>
-      const auto colI = A.getVector(i);
-      y(i) = beta == zero ? zero : beta * y(i);
-      if (!(alpha == zero)) {
-        y(i) += alpha * colI->dot(x);
-      }
-    }
+  ::pressio::ops::impl::TpetraTransposeProductRequest<A_type, y_type, alpha_t, beta_t>
+      request(alpha, A, x, beta, y);
+  request.wait();
 }
-#endif
 
 // -------------------------------
-// y = beta * y + alpha*A^T*x
-//
-// x = tpetra Vector
-// A = tpetra::MultiVector
-// y = Kokkos vector
+// non-blocking version of the above:
+// starts the reduction and returns a request whose wait()
+// completes it and updates y, so that other work can be overlapped.
+// y must not be accessed until wait() is called (or the request is destroyed).
 // -------------------------------
 template <class A_type, class x_type, class y_type, class alpha_t, class beta_t>
 ::pressio::mpl::enable_if_t<
@@ -432,31 +565,25 @@ template <class A_type, class x_type, class y_type, class alpha_t, class beta_t>
   // TPL/container specific
   && ::pressio::is_multi_vector_tpetra<A_type>::value
   && ::pressio::is_vector_tpetra<x_type>::value
-  && (::pressio::is_vector_kokkos<y_type>::value
-   || ::pressio::is_expression_acting_on_kokkos<y_type>::value)
+  && (::pressio::ops::impl::tpetra_transpose_product_targets_host<y_type>::value
+   || ::pressio::ops::impl::tpetra_transpose_product_targets_kokkos<y_type>::value)
   // scalar compatibility
   && ::pressio::all_have_traits_and_same_scalar<A_type, x_type, y_type>::value
   && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
   && std::is_convertible<beta_t, typename ::pressio::Traits<A_type>::scalar_type>::value
   && (std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
-   || std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value)
+   || std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value),
+  ::pressio::ops::impl::TpetraTransposeProductRequest<A_type, y_type, alpha_t, beta_t>
   >
-product(::pressio::transpose /*unused*/,
-	const alpha_t & alpha,
-	const A_type & A,
-	const x_type & x,
-	const beta_t & beta,
-	y_type & y)
+iproduct(::pressio::transpose /*unused*/,
+	 const alpha_t & alpha,
+	 const A_type & A,
+	 const x_type & x,
+	 const beta_t & beta,
+	 y_type & y)
 {
-  auto y_native = ::pressio::ops::impl::get_native(y);
-  using y_native_type = typename ::pressio::mpl::remove_cvref<decltype(y_native)>::type;
-  Kokkos::View<
-    typename ::pressio::Traits<y_type>::scalar_type*,
-    typename y_native_type::device_type
-    > ATx("ATx", y.extent(0));
-  auto request = Tpetra::idot(ATx, A, x);
-  request->wait();
-  ::KokkosBlas::axpby(alpha, ATx, beta, y_native);
+  return ::pressio::ops::impl::TpetraTransposeProductRequest<
+    A_type, y_type, alpha_t, beta_t>(alpha, A, x, beta, y);
 }
 
 }}//end namespace pressio::ops
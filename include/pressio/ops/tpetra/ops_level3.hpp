@@ -176,6 +176,36 @@ product(::pressio::transpose modeA,
   return C;
 }
 
+/*
+  locally replicated map and multivector into which A^T A is computed,
+  so that all its entries are reduced with a single all-reduce.
+  Callers doing repeated products should keep one of these and pass it
+  to product, so that the map and multivector are only built once
+  (they are rebuilt only if the number of columns or the communicator change).
+*/
+template<class A_type>
+class TpetraReplicatedProductWorkspace
+{
+  using map_t = typename A_type::map_type;
+  Teuchos::RCP<const map_t> map_;
+  Teuchos::RCP<A_type> mv_;
+
+public:
+  A_type & replicatedFor(const A_type & A)
+  {
+    const auto n = A.getNumVectors();
+    const auto comm = A.getMap()->getComm();
+    if (mv_.is_null() || mv_->getNumVectors() != n
+	|| map_->getComm().get() != comm.get())
+    {
+      map_ = Teuchos::rcp(new map_t(n, A.getMap()->getIndexBase(),
+				    comm, Tpetra::LocallyReplicated));
+      mv_ = Teuchos::rcp(new A_type(map_, n));
+    }
+    return *mv_;
+  }
+};
+
 // /***********************************
 //  * special case A==B
 // **********************************/
@@ -202,38 +232,59 @@ product(::pressio::transpose /*unused*/,
 	const alpha_t & alpha,
 	const A_type & A,
 	const beta_t & beta,
-	C_type & C)
+	C_type & C,
+	TpetraReplicatedProductWorkspace<A_type> & workspace)
 {
 
-  // how many vectors are in A and mvB
   const auto numVecsA = A.getNumVectors();
   assert((std::size_t)C.rows() == (std::size_t)numVecsA);
   assert((std::size_t)C.cols() == (std::size_t)numVecsA);
   using sc_t = typename ::pressio::Traits<A_type>::scalar_type;
   const auto zero = pressio::utils::Constants<sc_t>::zero();
-  const sc_t alpha_(alpha);
   const sc_t beta_(beta);
   const auto has_beta = beta_ != zero;
-  sc_t tmp = zero;
 
-  // A dot A = A^T*A, which yields a symmetric matrix
-  // only need to compute half and fill remaining entries accordingly
-  for (std::size_t i=0; i<(std::size_t)numVecsA; i++)
-  {
-    // colI is a Teuchos::RCP<Vector<...>>
-    auto colI = A.getVector(i);
-    for (std::size_t j=i; j<(std::size_t)numVecsA; j++)
-    {
-      auto colJ = A.getVector(j);
-      tmp = alpha_*colI->dot(*colJ);
-      C(i,j) = has_beta ? beta_*C(i,j) + tmp : tmp;
-      if(j!=i){
-        C(j,i) = has_beta ? beta_*C(j,i) + tmp : tmp;
-      }
+  auto & ATA = workspace.replicatedFor(A);
+  ATA.multiply(Teuchos::ETransp::TRANS, Teuchos::ETransp::NO_TRANS,
+	       sc_t(alpha), A, A, zero);
+
+  const auto ATA_h = ATA.getLocalViewHost(Tpetra::Access::ReadOnly);
+  for (std::size_t j=0; j<(std::size_t)numVecsA; j++){
+    for (std::size_t i=0; i<(std::size_t)numVecsA; i++){
+      C(i,j) = has_beta ? beta_*C(i,j) + ATA_h(i,j) : ATA_h(i,j);
     }
   }
 }
 
+template <
+  class A_type, class C_type,
+  class alpha_t, class beta_t
+  >
+::pressio::mpl::enable_if_t<
+  // level3 common constraints
+     ::pressio::Traits<A_type>::rank == 2
+  && ::pressio::Traits<C_type>::rank == 2
+  // TPL/container specific
+  && ::pressio::is_multi_vector_tpetra<A_type>::value
+  && ::pressio::is_dense_matrix_eigen<C_type>::value
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<A_type, C_type>::value
+  && (std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
+   || std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value)
+  && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
+  && std::is_convertible<beta_t,  typename ::pressio::Traits<A_type>::scalar_type>::value
+  >
+product(::pressio::transpose modeA,
+	::pressio::nontranspose modeB,
+	const alpha_t & alpha,
+	const A_type & A,
+	const beta_t & beta,
+	C_type & C)
+{
+  TpetraReplicatedProductWorkspace<A_type> workspace;
+  product(modeA, modeB, alpha, A, beta, C, workspace);
+}
+
 template <class C_type, class A_type, class alpha_t>
 ::pressio::mpl::enable_if_t<
   // level3 common constraints
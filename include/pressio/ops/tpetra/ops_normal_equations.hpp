@@ -0,0 +1,224 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// ops_normal_equations.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef OPS_TPETRA_OPS_NORMAL_EQUATIONS_HPP_
+#define OPS_TPETRA_OPS_NORMAL_EQUATIONS_HPP_
+
+namespace pressio{ namespace ops{
+
+/*
+  scratch for the tpetra normal equations: the rank-local contributions
+  to H = J^T J, g = J^T r and r^T r are computed on the device into
+  a single buffer packed as [H (col-major) | g | r^T r], copied to its
+  host mirror and reduced with a single allreduce, regardless of the
+  number of columns of J. The buffers are only reallocated if the
+  number of columns changes.
+*/
+template<class J_type>
+class NormalEquationsWorkspace<
+  J_type, ::pressio::mpl::enable_if_t<::pressio::is_multi_vector_tpetra<J_type>::value>
+  >
+{
+  using sc_t = typename ::pressio::Traits<J_type>::scalar_type;
+  using device_buffer_t = Kokkos::View<sc_t*, typename J_type::device_type>;
+  using host_buffer_t = Kokkos::View<sc_t*, Kokkos::HostSpace>;
+
+  std::size_t numCols_ = 0;
+  device_buffer_t local_;
+  typename device_buffer_t::HostMirror localHost_;
+  host_buffer_t global_;
+
+public:
+  // returns the host buffer with the globally reduced [H | g | r^T r]
+  template<class r_type>
+  const host_buffer_t & reduce(const J_type & J, const r_type & r)
+  {
+    const std::size_t n = J.getNumVectors();
+    const std::size_t count = n*n + n + 1;
+    if (n != numCols_ || local_.extent(0) == 0){
+      local_ = device_buffer_t("normalEqsLocal", count);
+      localHost_ = Kokkos::create_mirror_view(local_);
+      global_ = host_buffer_t("normalEqsGlobal", count);
+      numCols_ = n;
+    }
+
+    // the rank-local [H | g | r^T r] in a single pass over J and r
+    const auto J_d  = J.getLocalViewDevice(Tpetra::Access::ReadOnly);
+    const auto r2_d = r.getLocalViewDevice(Tpetra::Access::ReadOnly);
+    const auto r_d  = Kokkos::subview(r2_d, Kokkos::ALL(), 0);
+    ::pressio::ops::impl::kokkos_normal_equations_reduce(J_d, J_d, r_d, r_d, false, local_);
+
+    Kokkos::deep_copy(localHost_, local_);
+    Teuchos::reduceAll<int, sc_t>(*J.getMap()->getComm(), Teuchos::REDUCE_SUM,
+				  (int) count, localHost_.data(), global_.data());
+    return global_;
+  }
+};
+
+namespace impl{
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+template <class H_type, class g_type, class buffer_t>
+::pressio::mpl::enable_if_t<::pressio::is_dense_matrix_eigen<H_type>::value>
+tpetra_normal_equations_unpack(const buffer_t & buffer, std::size_t n, H_type & H, g_type & g)
+{
+  for (std::size_t j=0; j<n; ++j){
+    for (std::size_t i=0; i<n; ++i){
+      H(i,j) = buffer(i + j*n);
+    }
+    g(j) = buffer(n*n + j);
+  }
+}
+#endif
+
+// H and g can live on the device: copy from the host buffer
+template <class H_type, class g_type, class buffer_t>
+::pressio::mpl::enable_if_t<::pressio::is_dense_matrix_kokkos<H_type>::value>
+tpetra_normal_equations_unpack(const buffer_t & buffer, std::size_t n, H_type & H, g_type & g)
+{
+  static_assert
+    (std::is_same< typename H_type::array_layout, Kokkos::LayoutLeft>::value,
+     "The kokkos matrix must be layout left");
+
+  using sc_t = typename buffer_t::non_const_value_type;
+  using unmanaged_t = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  Kokkos::View<const sc_t**, Kokkos::LayoutLeft, Kokkos::HostSpace, unmanaged_t>
+    H_h(buffer.data(), n, n);
+  Kokkos::View<const sc_t*, Kokkos::HostSpace, unmanaged_t>
+    g_h(buffer.data() + n*n, n);
+  Kokkos::deep_copy(H, H_h);
+  Kokkos::deep_copy(g, g_h);
+}
+}//end namespace impl
+
+/*
+  fused kernel for normal equations:
+
+    H = J^T J,  g = J^T r,  return r^T r
+
+  J = tpetra multivector
+  r = tpetra vector
+  H, g = Eigen or Kokkos dense matrix and vector
+
+  Callers that evaluate this repeatedly should keep a
+  NormalEquationsWorkspace<J_type> and pass it, so that the
+  scratch buffers are allocated only once.
+*/
+template <class J_type, class r_type, class H_type, class g_type>
+::pressio::mpl::enable_if_t<
+  // common constraints
+     ::pressio::Traits<J_type>::rank == 2
+  && ::pressio::Traits<r_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_multi_vector_tpetra<J_type>::value
+  && ::pressio::is_vector_tpetra<r_type>::value
+  && (
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+      (::pressio::is_dense_matrix_eigen<H_type>::value
+       && ::pressio::is_vector_eigen<g_type>::value) ||
+#endif
+      (::pressio::is_dense_matrix_kokkos<H_type>::value
+       && ::pressio::is_vector_kokkos<g_type>::value)
+      )
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<J_type, r_type, H_type, g_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<J_type>::scalar_type>::value,
+  typename ::pressio::Traits<J_type>::scalar_type
+  >
+normal_equations(const J_type & J,
+		 const r_type & r,
+		 H_type & H,
+		 g_type & g,
+		 NormalEquationsWorkspace<J_type> & workspace)
+{
+  const std::size_t n = J.getNumVectors();
+  assert( (std::size_t)::pressio::ops::extent(J, 0) == (std::size_t)::pressio::ops::extent(r, 0) );
+  assert( (std::size_t)::pressio::ops::extent(H, 0) == n );
+  assert( (std::size_t)::pressio::ops::extent(H, 1) == n );
+  assert( (std::size_t)::pressio::ops::extent(g, 0) == n );
+
+  const auto & buffer = workspace.reduce(J, r);
+  impl::tpetra_normal_equations_unpack(buffer, n, H, g);
+  return buffer(n*n + n);
+}
+
+template <class J_type, class r_type, class H_type, class g_type>
+::pressio::mpl::enable_if_t<
+  // common constraints
+     ::pressio::Traits<J_type>::rank == 2
+  && ::pressio::Traits<r_type>::rank == 1
+  && ::pressio::Traits<H_type>::rank == 2
+  && ::pressio::Traits<g_type>::rank == 1
+  // TPL/container specific
+  && ::pressio::is_multi_vector_tpetra<J_type>::value
+  && ::pressio::is_vector_tpetra<r_type>::value
+  && (
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+      (::pressio::is_dense_matrix_eigen<H_type>::value
+       && ::pressio::is_vector_eigen<g_type>::value) ||
+#endif
+      (::pressio::is_dense_matrix_kokkos<H_type>::value
+       && ::pressio::is_vector_kokkos<g_type>::value)
+      )
+  // scalar compatibility
+  && ::pressio::all_have_traits_and_same_scalar<J_type, r_type, H_type, g_type>::value
+  && std::is_floating_point<typename ::pressio::Traits<J_type>::scalar_type>::value,
+  typename ::pressio::Traits<J_type>::scalar_type
+  >
+normal_equations(const J_type & J,
+		 const r_type & r,
+		 H_type & H,
+		 g_type & g)
+{
+  NormalEquationsWorkspace<J_type> workspace;
+  return normal_equations(J, r, H, g, workspace);
+}
+
+}}//end namespace pressio::ops
+#endif  // OPS_TPETRA_OPS_NORMAL_EQUATIONS_HPP_
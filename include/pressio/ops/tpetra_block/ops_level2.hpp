@@ -168,13 +168,18 @@ product(::pressio::nontranspose mode,
   auto y_tpetra_v  = y.getVectorView();
   product(mode, alpha, A_tpetra_mv, x, beta, y_tpetra_v);
 }
+#endif
 
 // -------------------------------
 // y = beta * y + alpha*A^T*x
 //
 // x = tpetra block Vector
 // A = tpetra block MultiVector
-// y = Eigen Vector or Pressio expression based on Eigen container
+// y = Eigen vector, Teuchos vector, Kokkos vector or
+//     Pressio expression based on Eigen or Kokkos
+//
+// forwards to the tpetra overload, so all the entries of y
+// are reduced at once
 // -------------------------------
 template < class A_type, class x_type, class y_type, class alpha_t, class beta_t>
 ::pressio::mpl::enable_if_t<
@@ -185,8 +190,8 @@ template < class A_type, class x_type, class y_type, class alpha_t, class beta_t
   // TPL/container specific
   && ::pressio::is_multi_vector_tpetra_block<A_type>::value
   && ::pressio::is_vector_tpetra_block<x_type>::value
-  && (::pressio::is_vector_eigen<y_type>::value
-   || ::pressio::is_expression_acting_on_eigen<y_type>::value)
+  && (::pressio::ops::impl::tpetra_transpose_product_targets_host<y_type>::value
+   || ::pressio::ops::impl::tpetra_transpose_product_targets_kokkos<y_type>::value)
   // scalar compatibility
   && ::pressio::all_have_traits_and_same_scalar<A_type, x_type, y_type>::value
   && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
@@ -206,14 +211,9 @@ product(::pressio::transpose mode,
   auto x_tpetra_v  = static_cast<x_type>(x).getVectorView();
   product(mode, alpha, A_tpetra_mv, x_tpetra_v, beta, y);
 }
-#endif
 
 // -------------------------------
-// y = beta * y + alpha*A^T*x
-//
-// x = tpetra block Vector
-// A = tpetra block MultiVector
-// y = Kokkos vector
+// non-blocking version of the above, see the tpetra iproduct
 // -------------------------------
 template < class A_type, class x_type, class y_type, class alpha_t, class beta_t>
 ::pressio::mpl::enable_if_t<
@@ -224,26 +224,28 @@ template < class A_type, class x_type, class y_type, class alpha_t, class beta_t
   // TPL/container specific
   && ::pressio::is_multi_vector_tpetra_block<A_type>::value
   && ::pressio::is_vector_tpetra_block<x_type>::value
-  && (::pressio::is_vector_kokkos<y_type>::value
-   || ::pressio::is_expression_acting_on_kokkos<y_type>::value)
+  && (::pressio::ops::impl::tpetra_transpose_product_targets_host<y_type>::value
+   || ::pressio::ops::impl::tpetra_transpose_product_targets_kokkos<y_type>::value)
   // scalar compatibility
   && ::pressio::all_have_traits_and_same_scalar<A_type, x_type, y_type>::value
   && std::is_convertible<alpha_t, typename ::pressio::Traits<A_type>::scalar_type>::value
   && std::is_convertible<beta_t, typename ::pressio::Traits<A_type>::scalar_type>::value
   && (std::is_floating_point<typename ::pressio::Traits<A_type>::scalar_type>::value
-   || std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value)
+   || std::is_integral<typename ::pressio::Traits<A_type>::scalar_type>::value),
+  ::pressio::ops::impl::TpetraTransposeProductRequest<
+    typename A_type::mv_type, y_type, alpha_t, beta_t>
   >
-product(::pressio::transpose mode,
-	const alpha_t & alpha,
-	const A_type & A,
-	const x_type & x,
-	const beta_t & beta,
-	y_type & y)
+iproduct(::pressio::transpose mode,
+	 const alpha_t & alpha,
+	 const A_type & A,
+	 const x_type & x,
+	 const beta_t & beta,
+	 y_type & y)
 {
 
   auto A_tpetra_mv = A.getMultiVectorView();
   auto x_tpetra_v  = static_cast<x_type>(x).getVectorView();
-  product(mode, alpha, A_tpetra_mv, x_tpetra_v, beta, y);
+  return iproduct(mode, alpha, A_tpetra_mv, x_tpetra_v, beta, y);
 }
 
 }}//end namespace pressio::ops
@@ -69,16 +69,20 @@
 #include "qr/impl/qr_in_place.hpp"
 
 #ifdef PRESSIO_ENABLE_TPL_EIGEN
+#include "qr/impl/qr_comm_avoiding_impl.hpp"
 #include "qr/impl/eigen/qr_eigen_dense_out_of_place_impl.hpp"
+#include "qr/impl/eigen/qr_eigen_dense_comm_avoiding_backend.hpp"
 #endif
 
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
 #include "qr/impl/epetra/qr_epetra_multi_vector_tsqr_impl.hpp"
 #include "qr/impl/epetra/qr_epetra_mv_householder_using_eigen_impl.hpp"
 #include "qr/impl/epetra/qr_epetra_multi_vector_modified_gram_schmidt_impl.hpp"
+#include "qr/impl/epetra/qr_epetra_multi_vector_comm_avoiding_backend.hpp"
 #include "qr/impl/tpetra/qr_tpetra_multi_vector_tsqr_impl.hpp"
 #include "qr/impl/tpetra/qr_tpetra_mv_householder_using_eigen_impl.hpp"
 #include "qr/impl/tpetra/qr_tpetra_multi_vector_modified_gram_schmidt_impl.hpp"
+#include "qr/impl/tpetra/qr_tpetra_multi_vector_comm_avoiding_backend.hpp"
 #include "qr/impl/tpetra/qr_tpetra_block_multi_vector_tsqr_impl.hpp"
 #endif
 
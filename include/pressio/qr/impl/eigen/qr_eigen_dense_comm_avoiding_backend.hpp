@@ -0,0 +1,111 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// qr_eigen_dense_comm_avoiding_backend.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef QR_IMPL_EIGEN_QR_EIGEN_DENSE_COMM_AVOIDING_BACKEND_HPP_
+#define QR_IMPL_EIGEN_QR_EIGEN_DENSE_COMM_AVOIDING_BACKEND_HPP_
+
+namespace pressio{ namespace qr{ namespace impl{
+
+/* operations needed by CommAvoidingQR for Eigen dense matrices */
+template<typename MatrixType>
+class EigenDenseCommAvoidingQRBackend
+{
+public:
+  using sc_t	= typename ::pressio::Traits<MatrixType>::scalar_type;
+  using Q_type	= Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>;
+  using R_nat_t = Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>;
+
+  void createQIfNeeded(std::shared_ptr<Q_type> & Q, const MatrixType & A) const{
+    if (!Q or Q->rows()!=A.rows() or Q->cols()!=A.cols()){
+      Q = std::make_shared<Q_type>(A.rows(), A.cols());
+    }
+  }
+
+  template<class T>
+  auto columns(T & A, std::size_t start, std::size_t n) const
+    -> decltype(A.middleCols(start, n))
+  {
+    return A.middleCols(start, n);
+  }
+
+  template<class T1, class T2>
+  void deepCopy(T1 & dest, const T2 & src) const{
+    dest = src;
+  }
+
+  // G = X^T Y
+  template<class T1, class T2>
+  void gram(const T1 & X, const T2 & Y, R_nat_t & G) const{
+    G.noalias() = X.transpose() * Y;
+  }
+
+  // Y = beta*Y + alpha*X*C
+  template<class T1, class T2>
+  void update(T1 & Y, const T2 & X, const R_nat_t & C, sc_t alpha, sc_t beta) const{
+    if (beta == ::pressio::utils::Constants<sc_t>::zero()){
+      Y.noalias() = alpha * X * C;
+    }
+    else{
+      Y *= beta;
+      Y.noalias() += alpha * X * C;
+    }
+  }
+
+  // X = X*C
+  template<class T>
+  void multiplyInPlace(T & X, const R_nat_t & C){
+    work_.noalias() = X * C;
+    X = work_;
+  }
+
+private:
+  Q_type work_ = {};
+};
+
+}}} // end namespace pressio::qr::impl
+#endif  // QR_IMPL_EIGEN_QR_EIGEN_DENSE_COMM_AVOIDING_BACKEND_HPP_
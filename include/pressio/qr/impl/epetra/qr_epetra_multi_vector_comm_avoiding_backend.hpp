@@ -0,0 +1,134 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// qr_epetra_multi_vector_comm_avoiding_backend.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef QR_IMPL_EPETRA_QR_EPETRA_MULTI_VECTOR_COMM_AVOIDING_BACKEND_HPP_
+#define QR_IMPL_EPETRA_QR_EPETRA_MULTI_VECTOR_COMM_AVOIDING_BACKEND_HPP_
+
+#include <Epetra_LocalMap.h>
+
+namespace pressio{ namespace qr{ namespace impl{
+
+/*
+  operations needed by CommAvoidingQR for Epetra multivectors:
+  X^T Y is computed by Multiply into a multivector on a local map,
+  which does the local products followed by a single SumAll,
+  while X*C is purely local.
+*/
+template<typename MatrixType>
+class EpetraMVCommAvoidingQRBackend
+{
+public:
+  using sc_t	= typename ::pressio::Traits<MatrixType>::scalar_type;
+  using Q_type	= Epetra_MultiVector;
+  using R_nat_t = Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>;
+  using view_t	= std::shared_ptr<Epetra_MultiVector>;
+
+  void createQIfNeeded(std::shared_ptr<Q_type> & Q, const MatrixType & A) const{
+    if (!Q or !Q->Map().SameAs(A.Map()) or Q->NumVectors() != A.NumVectors()){
+      Q = std::make_shared<Q_type>(A.Map(), A.NumVectors());
+    }
+  }
+
+  // Epetra views are non-owning multivectors referencing the source columns
+  view_t columns(const Q_type & A, std::size_t start, std::size_t n) const{
+    return std::make_shared<Epetra_MultiVector>(View, A, (int)start, (int)n);
+  }
+
+  void deepCopy(view_t & dest, const view_t & src) const{
+    dest->Scale(::pressio::utils::Constants<sc_t>::one(), *src);
+  }
+
+  // G = X^T Y
+  void gram(const view_t & X, const view_t & Y, R_nat_t & G) const
+  {
+    const int nX = X->NumVectors();
+    const int nY = Y->NumVectors();
+    Epetra_LocalMap locMap(nX, 0, X->Comm());
+    Epetra_MultiVector Gmv(locMap, nY);
+    Gmv.Multiply('T', 'N', ::pressio::utils::Constants<sc_t>::one(), *X, *Y,
+		 ::pressio::utils::Constants<sc_t>::zero());
+
+    G.resize(nX, nY);
+    for (int j=0; j<nY; ++j){
+      for (int i=0; i<nX; ++i){
+	G(i,j) = Gmv[j][i];
+      }
+    }
+  }
+
+  // Y = beta*Y + alpha*X*C
+  void update(view_t & Y, const view_t & X, const R_nat_t & C, sc_t alpha, sc_t beta) const
+  {
+    Epetra_LocalMap locMap((int)C.rows(), 0, X->Comm());
+    Epetra_MultiVector Cmv(locMap, (int)C.cols());
+    for (int j=0; j<(int)C.cols(); ++j){
+      for (int i=0; i<(int)C.rows(); ++i){
+	Cmv[j][i] = C(i,j);
+      }
+    }
+    Y->Multiply('N', 'N', alpha, *X, Cmv, beta);
+  }
+
+  // X = X*C
+  void multiplyInPlace(view_t & X, const R_nat_t & C)
+  {
+    const int n = X->NumVectors();
+    if (!work_ or !work_->Map().SameAs(X->Map()) or work_->NumVectors() != n){
+      work_ = std::make_shared<Q_type>(X->Map(), n);
+    }
+    deepCopy(work_, X);
+    update(X, work_, C, ::pressio::utils::Constants<sc_t>::one(),
+	   ::pressio::utils::Constants<sc_t>::zero());
+  }
+
+private:
+  view_t work_ = nullptr;
+};
+
+}}} // end namespace pressio::qr::impl
+#endif  // QR_IMPL_EPETRA_QR_EPETRA_MULTI_VECTOR_COMM_AVOIDING_BACKEND_HPP_
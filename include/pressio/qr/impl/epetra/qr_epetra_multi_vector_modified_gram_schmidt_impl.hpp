@@ -67,29 +67,28 @@ public:
   ModGramSchmidtMVEpetra() = default;
   ~ModGramSchmidtMVEpetra() = default;
 
-  void computeThinOutOfPlace(const MatrixType & Ain) 
+  void computeThinOutOfPlace(const MatrixType & A)
   {
-    auto & A = const_cast<MatrixType &>(Ain);
-
     std::size_t nVecs = ::pressio::ops::extent(A,1);
     auto & ArowMap = A.Map();
     createQIfNeeded(ArowMap, nVecs);
     createLocalRIfNeeded(nVecs);
 
+    // orthogonalize a copy of A so that the input is not modified
+    Qmat_->Scale(one_, A);
+
     sc_t rkkInv = zero_;
     for (std::size_t k=0; k<nVecs; k++)
     {
-      auto & ak = A(k);
-      ak->Norm2(&localR_(k,k));
-      rkkInv = one_/localR_(k,k);
-
       auto & qk = (*Qmat_)(k);
-      qk->Update( rkkInv, *ak, zero_ );
+      qk->Norm2(&localR_(k,k));
+      rkkInv = one_/localR_(k,k);
+      qk->Scale(rkkInv);
 
       for (std::size_t j=k+1; j<nVecs; j++){
-	     auto & aj = A(j);
-	     qk->Dot(*aj, &localR_(k,j));
-	     aj->Update(-localR_(k,j), *qk, one_);
+	     auto & qj = (*Qmat_)(j);
+	     qk->Dot(*qj, &localR_(k,j));
+	     qj->Update(-localR_(k,j), *qk, one_);
       }
     }
   }
@@ -124,7 +123,7 @@ private:
 
   template <typename map_t>
   void createQIfNeeded(const map_t & map, int cols){
-    if (!Qmat_ or !Qmat_->Map().SameAs(map))
+    if (!Qmat_ or !Qmat_->Map().SameAs(map) or Qmat_->NumVectors() != cols)
       Qmat_ = std::make_shared<Q_type>(map, cols);
   }
 
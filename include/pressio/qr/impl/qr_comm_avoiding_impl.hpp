@@ -0,0 +1,189 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// qr_comm_avoiding_impl.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef QR_IMPL_QR_COMM_AVOIDING_IMPL_HPP_
+#define QR_IMPL_QR_COMM_AVOIDING_IMPL_HPP_
+
+#include <Eigen/Cholesky>
+
+namespace pressio{ namespace qr{ namespace impl{
+
+/*
+  QR factorizations where all the inner products needed to orthogonalize
+  a set of columns are computed at once as a single product X^T Y,
+  i.e. with a single global reduction for distributed objects.
+
+  CholQR2: two passes of Cholesky QR over all the columns
+
+    G1 = A^T A   = R1^T R1,   Q1 = A  R1^{-1}
+    G2 = Q1^T Q1 = R2^T R2,   Q  = Q1 R2^{-1},   R = R2 R1
+
+  so that only two reductions are needed regardless of the number of columns.
+
+  CGS2: block classical Gram-Schmidt with reorthogonalization.
+  The columns are processed in panels: each panel is projected twice
+  against the Q columns already computed (one reduction per pass)
+  and then orthogonalized internally with CholQR2.
+  This is more robust than CholQR2 for ill-conditioned matrices,
+  since the Gram matrices only involve panelWidth columns at a time.
+
+  Both leave the input matrix untouched: Q is built in separate storage.
+  The distributed operations are delegated to the BackendType,
+  the small (numVectors x numVectors) ones are done in Eigen.
+*/
+template<class MatrixType, class R_t, class AlgoTag, class BackendType>
+class CommAvoidingQR
+{
+  static_assert(std::is_same<AlgoTag, ::pressio::qr::CholQR2>::value or
+		std::is_same<AlgoTag, ::pressio::qr::CGS2>::value,
+		"CommAvoidingQR only supports the CholQR2 and CGS2 algorithms");
+
+public:
+  using sc_t	= typename ::pressio::Traits<MatrixType>::scalar_type;
+  using Q_type	= typename BackendType::Q_type;
+  using R_nat_t = Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>;
+
+  // number of columns orthogonalized together by CGS2
+  static constexpr std::size_t panelWidth_ = 16;
+
+public:
+  CommAvoidingQR() = default;
+  ~CommAvoidingQR() = default;
+
+  void computeThinOutOfPlace(const MatrixType & A)
+  {
+    const std::size_t nVecs = ::pressio::ops::extent(A,1);
+    backend_.createQIfNeeded(Qmat_, A);
+    localR_ = R_nat_t::Zero(nVecs, nVecs);
+
+    const std::size_t width =
+      std::is_same<AlgoTag, ::pressio::qr::CholQR2>::value ? nVecs : panelWidth_;
+
+    for (std::size_t start=0; start<nVecs; start+=width)
+    {
+      const std::size_t n = std::min(width, nVecs-start);
+      auto AP = backend_.columns(A, start, n);
+      auto QP = backend_.columns(*Qmat_, start, n);
+      backend_.deepCopy(QP, AP);
+
+      if (start > 0){
+	// project out the previous columns, twice
+	auto Qprev = backend_.columns(*Qmat_, 0, start);
+	for (int pass=0; pass<2; ++pass){
+	  backend_.gram(Qprev, QP, S_);
+	  backend_.update(QP, Qprev, S_, -1, 1);
+	  localR_.block(0, start, start, n) += S_;
+	}
+      }
+
+      localR_.block(start, start, n, n) = cholQR2InPlace(QP, n);
+    }
+  }
+
+  template <typename VectorType>
+  void doLinSolve(const VectorType & rhs, VectorType & y)const {
+    auto & Rm = localR_.template triangularView<Eigen::Upper>();
+    y = Rm.solve(rhs);
+  }
+
+  template < typename VectorInType, typename VectorOutType>
+  void applyQTranspose(const VectorInType & vecIn, VectorOutType & vecOut) const
+  {
+    constexpr auto beta  = ::pressio::utils::Constants<sc_t>::zero();
+    constexpr auto alpha = ::pressio::utils::Constants<sc_t>::one();
+    ::pressio::ops::product(::pressio::transpose(), alpha, *this->Qmat_, vecIn, beta, vecOut);
+  }
+
+  template < typename VectorInType, typename VectorOutType>
+  void applyRTranspose(const VectorInType & vecIn, VectorOutType & y) const
+  {
+    y = localR_.template triangularView<Eigen::Upper>().transpose() * vecIn;
+  }
+
+  const Q_type & QFactor() const {
+    return *this->Qmat_;
+  }
+
+  const R_nat_t & RFactor() const {
+    return localR_;
+  }
+
+private:
+  // orthonormalizes the columns of X in place and returns the R factor
+  template<class ViewType>
+  R_nat_t cholQR2InPlace(ViewType & X, std::size_t n)
+  {
+    R_nat_t R = R_nat_t::Identity(n, n);
+    for (int pass=0; pass<2; ++pass)
+    {
+      backend_.gram(X, X, G_);
+      Eigen::LLT<R_nat_t> llt(G_);
+      if (llt.info() != Eigen::Success){
+	throw std::runtime_error
+	  ("CholQR: the Gram matrix is not positive definite, the columns are numerically dependent");
+      }
+      const R_nat_t Rk = llt.matrixU();
+      const R_nat_t RkInv =
+	Rk.template triangularView<Eigen::Upper>().solve(R_nat_t::Identity(n, n));
+      backend_.multiplyInPlace(X, RkInv);
+      R = Rk * R;
+    }
+    return R;
+  }
+
+private:
+  BackendType backend_ = {};
+  std::shared_ptr<Q_type> Qmat_ = nullptr;
+  R_nat_t localR_ = {};
+  // Gram matrices, kept to reuse their storage
+  R_nat_t G_ = {};
+  R_nat_t S_ = {};
+};
+
+}}} // end namespace pressio::qr::impl
+#endif  // QR_IMPL_QR_COMM_AVOIDING_IMPL_HPP_
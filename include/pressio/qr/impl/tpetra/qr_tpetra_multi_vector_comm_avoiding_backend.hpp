@@ -0,0 +1,188 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// qr_tpetra_multi_vector_comm_avoiding_backend.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef QR_IMPL_TPETRA_QR_TPETRA_MULTI_VECTOR_COMM_AVOIDING_BACKEND_HPP_
+#define QR_IMPL_TPETRA_QR_TPETRA_MULTI_VECTOR_COMM_AVOIDING_BACKEND_HPP_
+
+#include <map>
+#include <utility>
+
+namespace pressio{ namespace qr{ namespace impl{
+
+/*
+  operations needed by CommAvoidingQR for Tpetra multivectors:
+  X^T Y is computed by multiply into a locally replicated
+  multivector, which does a single all-reduce for all the entries,
+  while X*C is purely local.
+*/
+template<typename MatrixType>
+class TpetraMVCommAvoidingQRBackend
+{
+public:
+  using sc_t	= typename ::pressio::Traits<MatrixType>::scalar_type;
+  using lo_t	= typename MatrixType::local_ordinal_type;
+  using go_t	= typename MatrixType::global_ordinal_type;
+  using node_t	= typename MatrixType::node_type;
+  using Q_type	= Tpetra::MultiVector<sc_t, lo_t, go_t, node_t>;
+  using map_t	= typename Q_type::map_type;
+  using R_nat_t = Eigen::Matrix<sc_t, Eigen::Dynamic, Eigen::Dynamic>;
+
+  void createQIfNeeded(std::shared_ptr<Q_type> & Q, const MatrixType & A) const{
+    if (!Q or !Q->getMap()->isSameAs(*A.getMap())
+	or Q->getNumVectors() != A.getNumVectors()){
+      Q = std::make_shared<Q_type>(A.getMap(), A.getNumVectors());
+    }
+  }
+
+  Teuchos::RCP<const Q_type> columns(const Q_type & A, std::size_t start, std::size_t n) const{
+    return A.subView(Teuchos::Range1D(start, start+n-1));
+  }
+
+  Teuchos::RCP<Q_type> columns(Q_type & A, std::size_t start, std::size_t n) const{
+    return A.subViewNonConst(Teuchos::Range1D(start, start+n-1));
+  }
+
+  template<class T1, class T2>
+  void deepCopy(T1 & dest, const T2 & src) const{
+    Tpetra::deep_copy(*dest, *src);
+  }
+
+  // G = X^T Y
+  template<class T1, class T2>
+  void gram(const T1 & X, const T2 & Y, R_nat_t & G)
+  {
+    const auto nX = X->getNumVectors();
+    const auto nY = Y->getNumVectors();
+    auto & Gmv = replicated(*X, nX, nY);
+    Gmv.multiply(Teuchos::ETransp::TRANS, Teuchos::ETransp::NO_TRANS,
+		 ::pressio::utils::Constants<sc_t>::one(), *X, *Y,
+		 ::pressio::utils::Constants<sc_t>::zero());
+
+    G.resize(nX, nY);
+    const auto G_h = Gmv.getLocalViewHost(Tpetra::Access::ReadOnly);
+    for (std::size_t j=0; j<nY; ++j){
+      for (std::size_t i=0; i<nX; ++i){
+	G(i,j) = G_h(i,j);
+      }
+    }
+  }
+
+  // Y = beta*Y + alpha*X*C
+  template<class T1, class T2>
+  void update(T1 & Y, const T2 & X, const R_nat_t & C, sc_t alpha, sc_t beta)
+  {
+    const auto & Cmv = toReplicatedMultiVector(*X, C);
+    Y->multiply(Teuchos::ETransp::NO_TRANS, Teuchos::ETransp::NO_TRANS,
+		alpha, *X, Cmv, beta);
+  }
+
+  // X = X*C
+  template<class T>
+  void multiplyInPlace(T & X, const R_nat_t & C)
+  {
+    const auto n = X->getNumVectors();
+    if (!work_ or !work_->getMap()->isSameAs(*X->getMap()) or work_->getNumVectors() != n){
+      work_ = std::make_shared<Q_type>(X->getMap(), n);
+    }
+    Tpetra::deep_copy(*work_, *X);
+    update(X, work_, C, ::pressio::utils::Constants<sc_t>::one(),
+	   ::pressio::utils::Constants<sc_t>::zero());
+  }
+
+private:
+  /*
+    locally replicated rows x cols multivector, as TpetraReplicatedProductWorkspace
+    does for A^T A: the blocks of the QR come in a few sizes only, so one map per
+    number of rows and one multivector per shape are built and then reused
+    by all the following calls (they are dropped if the communicator changes)
+  */
+  Q_type & replicated(const Q_type & X, std::size_t rows, std::size_t cols)
+  {
+    const auto comm = X.getMap()->getComm();
+    if (comm_.get() != comm.get()){
+      comm_ = comm;
+      replicatedMaps_.clear();
+      replicatedMVs_.clear();
+    }
+
+    auto & map = replicatedMaps_[rows];
+    if (map.is_null()){
+      map = Teuchos::rcp(new map_t(rows, X.getMap()->getIndexBase(),
+				   comm, Tpetra::LocallyReplicated));
+    }
+    auto & mv = replicatedMVs_[std::make_pair(rows, cols)];
+    if (mv.is_null()){
+      mv = Teuchos::rcp(new Q_type(map, cols));
+    }
+    return *mv;
+  }
+
+  const Q_type & toReplicatedMultiVector(const Q_type & X, const R_nat_t & C)
+  {
+    auto & Cmv = replicated(X, C.rows(), C.cols());
+    {
+      // the host view must be released before Cmv is used on device
+      auto C_h = Cmv.getLocalViewHost(Tpetra::Access::OverwriteAll);
+      for (std::size_t j=0; j<(std::size_t)C.cols(); ++j){
+	for (std::size_t i=0; i<(std::size_t)C.rows(); ++i){
+	  C_h(i,j) = C(i,j);
+	}
+      }
+    }
+    return Cmv;
+  }
+
+private:
+  std::shared_ptr<Q_type> work_ = nullptr;
+  Teuchos::RCP<const Teuchos::Comm<int>> comm_;
+  std::map<std::size_t, Teuchos::RCP<const map_t>> replicatedMaps_;
+  std::map<std::pair<std::size_t, std::size_t>, Teuchos::RCP<Q_type>> replicatedMVs_;
+};
+
+}}} // end namespace pressio::qr::impl
+#endif  // QR_IMPL_TPETRA_QR_TPETRA_MULTI_VECTOR_COMM_AVOIDING_BACKEND_HPP_
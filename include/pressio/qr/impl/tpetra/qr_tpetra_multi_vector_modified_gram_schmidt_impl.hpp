@@ -68,29 +68,28 @@ public:
   ModGramSchmidtMVTpetra() = default;
   ~ModGramSchmidtMVTpetra() = default;
 
-  void computeThinOutOfPlace(const MatrixType & Ain)
+  void computeThinOutOfPlace(const MatrixType & A)
   {
-    auto & A = const_cast<MatrixType &>(Ain);
-
     size_t nVecs = ::pressio::ops::extent(A,1);
     auto ArowMap = A.getMap();
     createQIfNeeded(ArowMap, nVecs);
     createLocalRIfNeeded(nVecs);
 
+    // orthogonalize a copy of A so that the input is not modified
+    Tpetra::deep_copy(*Qmat_, A);
+
     sc_t rkkInv = {};
     for (size_t k=0; k<nVecs; k++)
     {
-      auto ak = A.getVector(k);
-      localR_(k,k) = ak->norm2();
-      rkkInv = utils::Constants<sc_t>::one()/localR_(k,k);
-
       auto qk = Qmat_->getVectorNonConst(k);
-      qk->update( rkkInv, *ak, utils::Constants<sc_t>::zero() );
+      localR_(k,k) = qk->norm2();
+      rkkInv = utils::Constants<sc_t>::one()/localR_(k,k);
+      qk->scale(rkkInv);
 
       for (size_t j=k+1; j<nVecs; j++){
-      	auto aj = A.getVectorNonConst(j);
-      	localR_(k,j) = qk->dot(*aj);
-      	aj->update(-localR_(k,j), *qk, utils::Constants<sc_t>::one());
+      	auto qj = Qmat_->getVectorNonConst(j);
+      	localR_(k,j) = qk->dot(*qj);
+      	qj->update(-localR_(k,j), *qk, utils::Constants<sc_t>::one());
       }
     }
   }
@@ -126,7 +125,7 @@ private:
 
   template <typename MapType>
   void createQIfNeeded(const MapType & map, std::size_t cols){
-    if (!Qmat_ or !Qmat_->getMap()->isSameAs(*map) )
+    if (!Qmat_ or !Qmat_->getMap()->isSameAs(*map) or Qmat_->getNumVectors() != cols)
       Qmat_ = std::make_shared<Q_type>(map, cols);
   }
 
@@ -58,6 +58,11 @@ namespace pressio{ namespace qr{
 struct ModifiedGramSchmidt{};
 struct Householder{};
 
+// communication-avoiding methods computing all inner products
+// of a block of columns with a single reduction
+struct CholQR2{};
+struct CGS2{};
+
 #if defined PRESSIO_ENABLE_TPL_TRILINOS
 struct TSQR{};
 #endif
@@ -69,11 +69,16 @@ template<class matrix_t, class R_t> class ModGramSchmidtMVEpetra;
 template<class matrix_t, class R_t> class TpetraMVTSQR;
 template<class matrix_t, class R_t> class ModGramSchmidtMVTpetra;
 template<class matrix_t, class R_t> class TpetraBlockMVTSQR;
+template<class matrix_t> class EpetraMVCommAvoidingQRBackend;
+template<class matrix_t> class TpetraMVCommAvoidingQRBackend;
 #endif //PRESSIO_ENABLE_TPL_TRILINOS
 
 #ifdef PRESSIO_ENABLE_TPL_EIGEN
 template<typename matrix_type, typename R_t = void, typename enable=void>
 class QRHouseholderDenseEigenMatrix;
+
+template<class matrix_t> class EigenDenseCommAvoidingQRBackend;
+template<class matrix_t, class R_t, class algo_tag, class backend_t> class CommAvoidingQR;
 #endif
 
 template<class matrix_type, class algorithm, bool in_place, class R_type, class enable = void>
@@ -60,6 +60,11 @@ struct qr_traits_shared_all{
   static constexpr bool in_place_ = in_place;
 };
 
+template<typename algo>
+struct is_comm_avoiding_qr_algorithm : std::integral_constant<bool,
+  std::is_same<algo, qr::CholQR2>::value or
+  std::is_same<algo, qr::CGS2>::value>{};
+
 
 #ifdef PRESSIO_ENABLE_TPL_EIGEN
 /*
@@ -77,14 +82,20 @@ struct Traits<
 {
 
   static_assert( std::is_same<algo_t, qr::ModifiedGramSchmidt>::value or
-     std::is_same<algo_t, qr::Householder>::value,
-  "Currently, only ModifiedGramSchmidt and Householder are available for Eigen matrices.");
+     std::is_same<algo_t, qr::Householder>::value or
+     is_comm_avoiding_qr_algorithm<algo_t>::value,
+  "Currently, only ModifiedGramSchmidt, Householder, CholQR2 and CGS2 are available for Eigen matrices.");
 
   using traits_all_t  = qr_traits_shared_all<matrix_type, algo_t, in_place>;
   using typename traits_all_t::matrix_t;
   using typename traits_all_t::sc_t;
 
-  using impl_t = qr::impl::QRHouseholderDenseEigenMatrix<matrix_t, void>;
+  using impl_t = typename std::conditional<
+    is_comm_avoiding_qr_algorithm<algo_t>::value,
+    qr::impl::CommAvoidingQR<matrix_t, void, algo_t,
+			     qr::impl::EigenDenseCommAvoidingQRBackend<matrix_t>>,
+    qr::impl::QRHouseholderDenseEigenMatrix<matrix_t, void>
+    >::type;
   using Q_type   = typename impl_t::Q_type;
   using concrete_t  = qr::impl::QRSolver<matrix_type, algo_t, in_place, void>;
   using inplace_base_t  = qr::QRInPlaceBase<concrete_t, matrix_type>;
@@ -116,6 +127,17 @@ struct impl_class_helper<Epetra_MultiVector, qr::ModifiedGramSchmidt, R_t>{
   using impl_t = qr::impl::ModGramSchmidtMVEpetra<Epetra_MultiVector, R_t>;
 };
 
+template <class algo_tag, class R_t>
+struct impl_class_helper<
+  Epetra_MultiVector, algo_tag, R_t,
+  ::pressio::mpl::enable_if_t< is_comm_avoiding_qr_algorithm<algo_tag>::value >
+  >
+{
+  using impl_t = qr::impl::CommAvoidingQR<
+    Epetra_MultiVector, R_t, algo_tag,
+    qr::impl::EpetraMVCommAvoidingQRBackend<Epetra_MultiVector>>;
+};
+
 
 template <class matrix_t, class R_t>
 struct impl_class_helper<
@@ -150,6 +172,19 @@ struct impl_class_helper<
   using impl_t = qr::impl::ModGramSchmidtMVTpetra<matrix_t, R_t>;
 };
 
+template <class matrix_t, class algo_tag, class R_t>
+struct impl_class_helper<
+  matrix_t, algo_tag, R_t,
+  ::pressio::mpl::enable_if_t<
+    ::pressio::is_multi_vector_tpetra<matrix_t>::value and
+    is_comm_avoiding_qr_algorithm<algo_tag>::value
+    >
+  >
+{
+  using impl_t = qr::impl::CommAvoidingQR<
+    matrix_t, R_t, algo_tag, qr::impl::TpetraMVCommAvoidingQRBackend<matrix_t>>;
+};
+
 template <class matrix_t, class R_t>
 struct impl_class_helper<
   matrix_t, qr::Householder, R_t,
@@ -174,10 +209,11 @@ struct Traits<
   static_assert(
      std::is_same<algo_t, qr::ModifiedGramSchmidt>::value or
      std::is_same<algo_t, qr::Householder>::value or
-     std::is_same<algo_t, qr::TSQR>::value,
-     "Currently, only TSQR, ModifiedGramSchmidt and Householder are available for \
-     Epetra dense matrices. Use TSQR because it is fast and accurate. ModifiedGramSchmidt \
-     and Householder are just here for testing purposes. ");
+     std::is_same<algo_t, qr::TSQR>::value or
+     is_comm_avoiding_qr_algorithm<algo_t>::value,
+     "Currently, only TSQR, CholQR2, CGS2, ModifiedGramSchmidt and Householder are available for \
+     Epetra dense matrices. Use TSQR, CholQR2 or CGS2 because they are fast and accurate. \
+     ModifiedGramSchmidt and Householder are just here for testing purposes. ");
 
   using traits_all_t  = qr_traits_shared_all<Epetra_MultiVector, algo_t, in_place>;
   using typename traits_all_t::matrix_t;
@@ -207,10 +243,11 @@ struct Traits<
   static_assert(
     std::is_same<algo_t, qr::ModifiedGramSchmidt>::value or
     std::is_same<algo_t, qr::Householder>::value or
-    std::is_same<algo_t, qr::TSQR>::value,
-    "Currently, only TSQR, ModifiedGramSchmidt and Householder are available for Tpetra dense matrices. \
-    Use TSQR because it is fast and accurate. ModifiedGramSchmidt and Householder \
-    are just here for testing purposes. ");
+    std::is_same<algo_t, qr::TSQR>::value or
+    is_comm_avoiding_qr_algorithm<algo_t>::value,
+    "Currently, only TSQR, CholQR2, CGS2, ModifiedGramSchmidt and Householder are available for Tpetra \
+    dense matrices. Use TSQR, CholQR2 or CGS2 because they are fast and accurate. \
+    ModifiedGramSchmidt and Householder are just here for testing purposes. ");
 
   using traits_all_t  = qr_traits_shared_all<matrix_type, algo_t, in_place>;
   using typename traits_all_t::matrix_t;
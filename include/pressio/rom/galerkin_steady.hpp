@@ -6,6 +6,8 @@
 #include "./impl/galerkin_steady_system_default.hpp"
 #include "./impl/galerkin_steady_system_hypred.hpp"
 #include "./impl/galerkin_steady_system_masked.hpp"
+#include "./impl/galerkin_steady_system_reduced_operators.hpp"
+#include "./polynomial_reduced_operators.hpp"
 
 namespace pressio{ namespace rom{ namespace galerkin{
 
@@ -90,5 +92,18 @@ auto create_steady_problem(const TrialSubspaceType & trialSpace,   /*(3)*/
   return return_type(trialSpace, fomSystem, masker, hyperReducer);
 }
 
+// ------------------------------------------------------------------------
+// precomputed reduced operators
+// ------------------------------------------------------------------------
+
+template<class ReducedStateType>
+auto create_steady_problem(const GalerkinReducedOperators<ReducedStateType> & reducedOperators) /*(4)*/
+{
+
+  using reduced_operators_t = GalerkinReducedOperators<ReducedStateType>;
+  using return_type = impl::GalerkinSteadyReducedOperatorsSystem<reduced_operators_t>;
+  return return_type(reducedOperators);
+}
+
 }}} // end pressio::rom::galerkin
 #endif  // ROM_GALERKIN_STEADY_HPP_
@@ -4,11 +4,14 @@
 
 #include "./reduced_operators_traits.hpp"
 #include "impl/galerkin_helpers.hpp"
+#include "impl/masked_fom_sample_mesh_helpers.hpp"
 #include "impl/galerkin_unsteady_explicit_problem.hpp"
 #include "impl/galerkin_unsteady_system_default_rhs_only.hpp"
 #include "impl/galerkin_unsteady_system_hypred_rhs_only.hpp"
 #include "impl/galerkin_unsteady_system_default_rhs_with_mass_matrix.hpp"
 #include "impl/galerkin_unsteady_system_masked_rhs_only.hpp"
+#include "impl/galerkin_unsteady_system_reduced_operators.hpp"
+#include "./polynomial_reduced_operators.hpp"
 
 namespace pressio{ namespace rom{ namespace galerkin{
 
@@ -158,5 +161,25 @@ auto create_unsteady_explicit_problem(::pressio::ode::StepScheme schemeName,  /*
   return return_type(schemeName, trialSpace, fomSystem, masker, hyperReducer);
 }
 
+// -------------------------------------------------------------
+// precomputed reduced operators
+// -------------------------------------------------------------
+
+template<class ReducedStateType>
+auto create_unsteady_explicit_problem(::pressio::ode::StepScheme schemeName,  /*(5)*/
+				      const GalerkinReducedOperators<ReducedStateType> & reducedOperators)
+{
+
+  impl::valid_scheme_for_explicit_galerkin_else_throw(schemeName, "galerkin_reduced_operators_explicit");
+  using reduced_operators_t = GalerkinReducedOperators<ReducedStateType>;
+  using ind_var_type = typename reduced_operators_t::scalar_type;
+  // the "system" implements the math
+  using galerkin_system = impl::GalerkinReducedOperatorsOdeSystemOnlyRhs<
+    ind_var_type, reduced_operators_t>;
+
+  using return_type = impl::GalerkinUnsteadyExplicitProblem<galerkin_system>;
+  return return_type(schemeName, reducedOperators);
+}
+
 }}} // end pressio::rom::galerkin
 #endif  // ROM_GALERKIN_UNSTEADY_EXPLICIT_HPP_
@@ -3,12 +3,15 @@
 #define ROM_GALERKIN_UNSTEADY_IMPLICIT_HPP_
 
 #include "impl/galerkin_helpers.hpp"
+#include "impl/masked_fom_sample_mesh_helpers.hpp"
 #include "impl/galerkin_unsteady_system_default_rhs_and_jacobian.hpp"
 #include "impl/galerkin_unsteady_system_default_rhs_and_jacobian_and_mm.hpp"
 #include "impl/galerkin_unsteady_system_hypred_rhs_and_jacobian.hpp"
 #include "impl/galerkin_unsteady_system_masked_rhs_and_jacobian.hpp"
 #include "impl/galerkin_unsteady_system_fully_discrete_fom.hpp"
 #include "impl/galerkin_unsteady_system_hypred_fully_discrete_fom.hpp"
+#include "impl/galerkin_unsteady_system_reduced_operators.hpp"
+#include "./polynomial_reduced_operators.hpp"
 
 namespace pressio{ namespace rom{ namespace galerkin{
 
@@ -17,22 +20,24 @@ namespace pressio{ namespace rom{ namespace galerkin{
 // -------------------------------------------------------------
 
 #ifdef PRESSIO_ENABLE_CXX20
-template<class TrialSubspaceType, class FomSystemType>
-  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+template<class SchemeType, class TrialSubspaceType, class FomSystemType>
+  requires impl::ImplicitGalerkinScheme<SchemeType>
+  && PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
   && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
   && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #else
 template<
- class TrialSubspaceType, class FomSystemType,
+ class SchemeType, class TrialSubspaceType, class FomSystemType,
  mpl::enable_if_t<
-   PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+   impl::is_implicit_galerkin_scheme<SchemeType>::value
+   && PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
    && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
    && !RealValuedSemiDiscreteFomWithJacobianAndMassMatrixAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
    && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
    , int > = 0
   >
 #endif
-auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /*(1)*/
+auto create_unsteady_implicit_problem(SchemeType schemeName,   /*(1)*/
 				      const TrialSubspaceType & trialSpace,
 				      const FomSystemType & fomSystem)
 {
@@ -51,7 +56,7 @@ auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /
     reduced_jacobian_type, TrialSubspaceType, FomSystemType>;
 
   galerkin_system galSystem(trialSpace, fomSystem);
-  return ::pressio::ode::create_implicit_stepper(schemeName, std::move(galSystem));
+  return impl::create_implicit_galerkin_stepper(schemeName, std::move(galSystem));
 }
 
 // -------------------------------------------------------------
@@ -59,23 +64,25 @@ auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /
 // -------------------------------------------------------------
 
 #ifdef PRESSIO_ENABLE_CXX20
-template<class TrialSubspaceType, class FomSystemType>
-  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+template<class SchemeType, class TrialSubspaceType, class FomSystemType>
+  requires impl::ImplicitGalerkinSchemeWithMassMatrix<SchemeType>
+  && PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
   && RealValuedSemiDiscreteFomWithJacobianAndMassMatrixAction<
       FomSystemType, typename TrialSubspaceType::basis_matrix_type>
   && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #else
 template<
-  class TrialSubspaceType, class FomSystemType,
+  class SchemeType, class TrialSubspaceType, class FomSystemType,
   mpl::enable_if_t<
-    PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+    impl::is_implicit_galerkin_scheme_with_mass_matrix<SchemeType>::value
+    && PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
     && RealValuedSemiDiscreteFomWithJacobianAndMassMatrixAction<
          FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
     && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
     , int > = 0
   >
 #endif
-auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /*(2)*/
+auto create_unsteady_implicit_problem(SchemeType schemeName,   /*(2)*/
 				      const TrialSubspaceType & trialSpace,
 				      const FomSystemType & fomSystem)
 {
@@ -94,7 +101,7 @@ auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /
     reduced_jacobian_type, reduced_mm_type, TrialSubspaceType, FomSystemType>;
 
   galerkin_system galSystem(trialSpace, fomSystem);
-  return ::pressio::ode::create_implicit_stepper(schemeName, std::move(galSystem));
+  return impl::create_implicit_galerkin_stepper(schemeName, std::move(galSystem));
 }
 
 
@@ -103,15 +110,21 @@ auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /
 // -------------------------------------------------------------
 
 template<
+  class SchemeType,
   class TrialSubspaceType,
   class FomSystemType,
-  class HyperReducerType>
+  class HyperReducerType
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t< impl::is_implicit_galerkin_scheme<SchemeType>::value, int > = 0
+#endif
+  >
 #ifdef PRESSIO_ENABLE_CXX20
-requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+requires impl::ImplicitGalerkinScheme<SchemeType>
+&& PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
 && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
 && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #endif
-auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /*(3)*/
+auto create_unsteady_implicit_problem(SchemeType schemeName,   /*(3)*/
 				      const TrialSubspaceType & trialSpace,
 				      const FomSystemType & fomSystem,
 				      const HyperReducerType & hyperReducer)
@@ -131,7 +144,7 @@ auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /
     reduced_jacobian_type, TrialSubspaceType, FomSystemType, HyperReducerType>;
 
   galerkin_system galSystem(trialSpace, fomSystem, hyperReducer);
-  return ::pressio::ode::create_implicit_stepper(schemeName, std::move(galSystem));
+  return impl::create_implicit_galerkin_stepper(schemeName, std::move(galSystem));
 }
 
 // -------------------------------------------------------------
@@ -139,16 +152,22 @@ auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /
 // -------------------------------------------------------------
 
 template<
+  class SchemeType,
   class TrialSubspaceType,
   class FomSystemType,
   class MaskerType,
-  class HyperReducerType>
+  class HyperReducerType
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t< impl::is_implicit_galerkin_scheme<SchemeType>::value, int > = 0
+#endif
+  >
 #ifdef PRESSIO_ENABLE_CXX20
-requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+requires impl::ImplicitGalerkinScheme<SchemeType>
+&& PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
 && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
 && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #endif
-auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /*(4)*/
+auto create_unsteady_implicit_problem(SchemeType schemeName,   /*(4)*/
 				      const TrialSubspaceType & trialSpace,
 				      const FomSystemType & fomSystem,
 				      const MaskerType & masker,
@@ -170,7 +189,7 @@ auto create_unsteady_implicit_problem(::pressio::ode::StepScheme schemeName,   /
     MaskerType, HyperReducerType>;
 
   galerkin_system galSystem(trialSpace, fomSystem, masker, hyperReducer);
-  return ::pressio::ode::create_implicit_stepper(schemeName, std::move(galSystem));
+  return impl::create_implicit_galerkin_stepper(schemeName, std::move(galSystem));
 }
 
 // -------------------------------------------------------------
@@ -207,5 +226,55 @@ auto create_unsteady_implicit_problem(const TrialSubspaceType & trialSpace,    /
     TotalNumberOfDesiredStates>(std::move(galSystem));
 }
 
+// -------------------------------------------------------------
+// precomputed reduced operators
+// -------------------------------------------------------------
+
+template<
+  class SchemeType,
+  class ReducedStateType
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t< impl::is_implicit_galerkin_scheme<SchemeType>::value, int > = 0
+#endif
+  >
+#ifdef PRESSIO_ENABLE_CXX20
+requires impl::ImplicitGalerkinScheme<SchemeType>
+#endif
+auto create_unsteady_implicit_problem(SchemeType schemeName,   /*(6)*/
+				      const GalerkinReducedOperators<ReducedStateType> & reducedOperators)
+{
+
+  impl::valid_scheme_for_implicit_galerkin_else_throw(schemeName, "galerkin_reduced_operators_implicit");
+
+  using reduced_operators_t = GalerkinReducedOperators<ReducedStateType>;
+  using ind_var_type = typename reduced_operators_t::scalar_type;
+  // the "system" implements the math
+  using galerkin_system = impl::GalerkinReducedOperatorsOdeSystemRhsAndJacobian<
+    ind_var_type, reduced_operators_t>;
+
+  galerkin_system galSystem(reducedOperators);
+  return impl::create_implicit_galerkin_stepper(schemeName, std::move(galSystem));
+}
+
+// -------------------------------------------------------------
+// scheme known at compile time, passed as template argument, e.g.
+// create_unsteady_implicit_problem<ode::BDF2>(trialSpace, fomSystem, ...)
+// -------------------------------------------------------------
+
+template<
+  class SchemeTag,
+  class ...Args
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t< ::pressio::ode::is_implicit_scheme_tag<SchemeTag>::value, int > = 0
+#endif
+  >
+#ifdef PRESSIO_ENABLE_CXX20
+requires ::pressio::ode::is_implicit_scheme_tag<SchemeTag>::value
+#endif
+auto create_unsteady_implicit_problem(Args && ... args)
+{
+  return create_unsteady_implicit_problem(SchemeTag(), std::forward<Args>(args)...);
+}
+
 }}} // end pressio::rom::galerkin
 #endif  // ROM_GALERKIN_UNSTEADY_IMPLICIT_HPP_
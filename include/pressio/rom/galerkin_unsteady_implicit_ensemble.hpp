@@ -0,0 +1,62 @@
+
+#ifndef ROM_GALERKIN_UNSTEADY_IMPLICIT_ENSEMBLE_HPP_
+#define ROM_GALERKIN_UNSTEADY_IMPLICIT_ENSEMBLE_HPP_
+
+#include "impl/galerkin_helpers.hpp"
+#include "impl/galerkin_unsteady_ensemble_system.hpp"
+#include "impl/galerkin_unsteady_implicit_ensemble_problem.hpp"
+
+namespace pressio{ namespace rom{ namespace galerkin{ namespace experimental{
+
+/*
+  ensemble of implicit galerkin problems sharing the same trial subspace:
+  the reduced states of all samples are the columns of a matrix that is
+  advanced as a whole, see impl::GalerkinUnsteadyImplicitEnsembleProblem.
+  LinearSolverTag is the pressio linear solver used for the reduced
+  system of each sample.
+*/
+#ifdef PRESSIO_ENABLE_CXX20
+template<
+  class LinearSolverTag = ::pressio::linearsolvers::direct::PartialPivLU,
+  class TrialSubspaceType, class FomSystemType>
+  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+  && SemiDiscreteFomEnsembleWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
+  && ::pressio::is_vector_eigen<typename TrialSubspaceType::reduced_state_type>::value
+  && ::pressio::is_dense_matrix_eigen<typename FomSystemType::state_type>::value
+#else
+template<
+ class LinearSolverTag = ::pressio::linearsolvers::direct::PartialPivLU,
+ class TrialSubspaceType, class FomSystemType,
+ mpl::enable_if_t<
+   PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+   && SemiDiscreteFomEnsembleWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
+   && ::pressio::is_vector_eigen<typename TrialSubspaceType::reduced_state_type>::value
+   && ::pressio::is_dense_matrix_eigen<typename FomSystemType::state_type>::value
+   , int > = 0
+  >
+#endif
+auto create_unsteady_implicit_ensemble_problem(::pressio::ode::StepScheme schemeName,
+					       const TrialSubspaceType & trialSpace,
+					       const FomSystemType & fomSystem)
+{
+
+  impl::valid_scheme_for_implicit_galerkin_else_throw(schemeName, "galerkin_ensemble_implicit");
+
+  using ind_var_type = typename FomSystemType::time_type;
+  using reduced_state_type = typename TrialSubspaceType::reduced_state_type;
+  using scalar_type = typename ::pressio::Traits<reduced_state_type>::scalar_type;
+  using default_types = ImplicitGalerkinDefaultReducedOperatorsTraits<reduced_state_type>;
+  using reduced_jacobian_type = typename default_types::reduced_jacobian_type;
+  // one column per sample
+  using reduced_states_type = Eigen::Matrix<scalar_type, -1, -1>;
+
+  using galerkin_system = impl::GalerkinEnsembleOdeSystemRhsAndJacobian<
+    ind_var_type, reduced_states_type, reduced_jacobian_type,
+    TrialSubspaceType, FomSystemType>;
+
+  using return_type = impl::GalerkinUnsteadyImplicitEnsembleProblem<galerkin_system, LinearSolverTag>;
+  return return_type(schemeName, trialSpace, fomSystem);
+}
+
+}}}} // end pressio::rom::galerkin::experimental
+#endif  // ROM_GALERKIN_UNSTEADY_IMPLICIT_ENSEMBLE_HPP_
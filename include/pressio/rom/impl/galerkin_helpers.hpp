@@ -20,6 +20,49 @@ void valid_scheme_for_implicit_galerkin_else_throw(::pressio::ode::StepScheme na
   }
 }
 
+// the implicit factories take the scheme either as a StepScheme value,
+// or as its tag when it is known at compile time, in which case the
+// returned stepper is the one specialized for that scheme
+template<class T> struct is_implicit_galerkin_scheme
+  : ::pressio::ode::is_implicit_scheme_tag<T>{};
+template<> struct is_implicit_galerkin_scheme<::pressio::ode::StepScheme>
+  : std::true_type{};
+
+// with a mass matrix, only BDF1 and BDF2 are supported
+template<class T> struct is_implicit_galerkin_scheme_with_mass_matrix
+  : std::integral_constant<bool,
+      std::is_same<T, ::pressio::ode::StepScheme>::value
+      || std::is_same<T, ::pressio::ode::BDF1>::value
+      || std::is_same<T, ::pressio::ode::BDF2>::value>{};
+
+#ifdef PRESSIO_ENABLE_CXX20
+// concepts, so that the factories constrained on them still
+// subsume each other as they do through their other constraints
+template<class T>
+concept ImplicitGalerkinScheme = is_implicit_galerkin_scheme<T>::value;
+
+template<class T>
+concept ImplicitGalerkinSchemeWithMassMatrix = ImplicitGalerkinScheme<T>
+  && is_implicit_galerkin_scheme_with_mass_matrix<T>::value;
+#endif
+
+template<class SchemeTag>
+void valid_scheme_for_implicit_galerkin_else_throw(SchemeTag, const std::string &){
+  static_assert(is_implicit_galerkin_scheme<SchemeTag>::value,
+		"implicit galerkin requires an implicit scheme");
+}
+
+template<class SystemType>
+auto create_implicit_galerkin_stepper(::pressio::ode::StepScheme name,
+				      SystemType && system){
+  return ::pressio::ode::create_implicit_stepper(name, std::forward<SystemType>(system));
+}
+
+template<class SchemeTag, class SystemType>
+auto create_implicit_galerkin_stepper(SchemeTag, SystemType && system){
+  return ::pressio::ode::create_implicit_stepper<SchemeTag>(std::forward<SystemType>(system));
+}
+
 // --------------------------------------------------------------
 // CreateGalerkinRhs
 // --------------------------------------------------------------
@@ -56,5 +99,30 @@ struct CreateGalerkinMassMatrix<
 template<class JacType, class = void>
 using CreateGalerkinJacobian = CreateGalerkinMassMatrix<JacType>;
 
+// --------------------------------------------------------------
+// number of bytes read by the projection phi^T operand,
+// recorded in the "bytes streamed" counter when instrumentation is on
+// --------------------------------------------------------------
+template<class BasisType, class OperandType>
+mpl::enable_if_t< ::pressio::Traits<OperandType>::rank == 1, std::size_t >
+projection_bytes(const BasisType & phi, const OperandType & operand)
+{
+  using sc_t = typename ::pressio::Traits<BasisType>::scalar_type;
+  const std::size_t nRows = ::pressio::ops::extent(phi, 0);
+  const std::size_t nCols = ::pressio::ops::extent(phi, 1);
+  return sizeof(sc_t)*(nRows*nCols + static_cast<std::size_t>(::pressio::ops::extent(operand, 0)));
+}
+
+template<class BasisType, class OperandType>
+mpl::enable_if_t< ::pressio::Traits<OperandType>::rank == 2, std::size_t >
+projection_bytes(const BasisType & phi, const OperandType & operand)
+{
+  using sc_t = typename ::pressio::Traits<BasisType>::scalar_type;
+  const std::size_t nRows = ::pressio::ops::extent(phi, 0);
+  const std::size_t nCols = ::pressio::ops::extent(phi, 1);
+  const std::size_t nOperandCols = ::pressio::ops::extent(operand, 1);
+  return sizeof(sc_t)*nRows*(nCols + nOperandCols);
+}
+
 }}} // end pressio::rom::impl
 #endif  // ROM_IMPL_GALERKIN_HELPERS_HPP_
@@ -0,0 +1,67 @@
+
+#ifndef ROM_IMPL_GALERKIN_STEADY_SYSTEM_REDUCED_OPERATORS_HPP_
+#define ROM_IMPL_GALERKIN_STEADY_SYSTEM_REDUCED_OPERATORS_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+/*
+  Galerkin problem using precomputed reduced operators:
+
+    R = b + A x + q(x)
+    J = A + dq/dx
+
+  see PolynomialReducedOperators: no fom-sized data is ever touched
+*/
+template <class ReducedOperatorsType>
+class GalerkinSteadyReducedOperatorsSystem
+{
+public:
+  // aliases required by the pressio solvers
+  using state_type    = typename ReducedOperatorsType::reduced_state_type;
+  using residual_type = typename ReducedOperatorsType::reduced_vector_type;
+  using jacobian_type = typename ReducedOperatorsType::reduced_matrix_type;
+
+  GalerkinSteadyReducedOperatorsSystem() = delete;
+
+  explicit GalerkinSteadyReducedOperatorsSystem(const ReducedOperatorsType & reducedOperators)
+    : reducedOperators_(reducedOperators){}
+
+public:
+  state_type createState() const{
+    return reducedOperators_.get().createReducedState();
+  }
+
+  residual_type createResidual() const{
+    return reducedOperators_.get().createReducedState();
+  }
+
+  jacobian_type createJacobian() const{
+    return reducedOperators_.get().createReducedMatrix();
+  }
+
+  void residualAndJacobian(const state_type & reducedState,
+			   residual_type & reducedResidual,
+#ifdef PRESSIO_ENABLE_CXX17
+			   std::optional<jacobian_type*> reducedJacobian) const
+#else
+                           jacobian_type* reducedJacobian) const
+#endif
+  {
+    if (reducedJacobian){
+#ifdef PRESSIO_ENABLE_CXX17
+      reducedOperators_.get().evaluate(reducedState, reducedResidual, *reducedJacobian.value());
+#else
+      reducedOperators_.get().evaluate(reducedState, reducedResidual, *reducedJacobian);
+#endif
+    }
+    else{
+      reducedOperators_.get().evaluate(reducedState, reducedResidual);
+    }
+  }
+
+private:
+  std::reference_wrapper<const ReducedOperatorsType> reducedOperators_;
+};
+
+}}} // end pressio::rom::impl
+#endif  // ROM_IMPL_GALERKIN_STEADY_SYSTEM_REDUCED_OPERATORS_HPP_
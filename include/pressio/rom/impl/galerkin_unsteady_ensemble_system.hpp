@@ -0,0 +1,146 @@
+
+#ifndef ROM_IMPL_GALERKIN_UNSTEADY_ENSEMBLE_SYSTEM_HPP_
+#define ROM_IMPL_GALERKIN_UNSTEADY_ENSEMBLE_SYSTEM_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+/*
+  ensemble galerkin system: the same galerkin problem is evaluated
+  for S samples (e.g. parameter values) at once.
+  The reduced states of all samples are stored as the columns
+  of hat{Y}, and the fom computes the rhs and jacobian action
+  of all samples in a single call, so that:
+
+  fom states: Y = phi*hat{Y} (+ translation for each column)
+  rhs = phi^T fom_rhs(Y, ...)                one GEMM for all samples
+  rhs_jacobian_s = phi^T (fom_J_s phi)       one GEMM per sample
+
+- hat{Y} is the K x S matrix of reduced states
+- fom_rhs(Y, ...) is the N x S matrix of the fom rhs
+- phi is the basis
+*/
+template <
+  class IndVarType,
+  class ReducedStatesType,
+  class ReducedJacobianType,
+  class TrialSubspaceType,
+  class FomSystemType
+  >
+class GalerkinEnsembleOdeSystemRhsAndJacobian
+{
+
+  using basis_matrix_type = typename TrialSubspaceType::basis_matrix_type;
+  using fom_jac_action_result_type =
+    decltype(std::declval<FomSystemType const>().createResultOfJacobianActionOn
+	     (std::declval<basis_matrix_type const &>()) );
+
+public:
+  // required aliases
+  using independent_variable_type = IndVarType;
+  using state_type    = ReducedStatesType;
+  using rhs_type      = ReducedStatesType;
+  using jacobian_type = ReducedJacobianType;
+
+  GalerkinEnsembleOdeSystemRhsAndJacobian(const TrialSubspaceType & trialSubspace,
+					  const FomSystemType & fomSystem)
+    : trialSubspace_(trialSubspace),
+      fomSystem_(fomSystem),
+      fomRhs_(fomSystem.createRhs()),
+      numSamples_(::pressio::ops::extent(fomRhs_, 1)),
+      fomStates_(::pressio::ops::extent(fomRhs_, 0), numSamples_),
+      fomShift_(trialSubspace.createFullStateFromReducedState(trialSubspace.createReducedState())),
+      fomJacActions_(numSamples_,
+		     fomSystem.createResultOfJacobianActionOn(trialSubspace.basisOfTranslatedSpace()))
+  {}
+
+public:
+  std::size_t numberOfSamples() const{ return numSamples_; }
+
+  state_type createState() const{
+    state_type result(trialSubspace_.get().dimension(), numSamples_);
+    result.setZero();
+    return result;
+  }
+
+  rhs_type createRhs() const{
+    return createState();
+  }
+
+  jacobian_type createJacobian() const{
+    return impl::CreateGalerkinJacobian<jacobian_type>()(trialSubspace_.get().dimension());
+  }
+
+  void rhs(const state_type & reducedStates,
+	   const IndVarType & rhsEvaluationTime,
+	   rhs_type & reducedRhs) const
+  {
+    reconstructFomStates(reducedStates);
+    fomSystem_.get().rhs(fomStates_, rhsEvaluationTime, fomRhs_);
+    projectRhs(reducedRhs);
+  }
+
+  void rhsAndJacobians(const state_type & reducedStates,
+		       const IndVarType & rhsEvaluationTime,
+		       rhs_type & reducedRhs,
+		       std::vector<jacobian_type> & reducedJacobians) const
+  {
+    assert(reducedJacobians.size() == numSamples_);
+
+    reconstructFomStates(reducedStates);
+    fomSystem_.get().rhs(fomStates_, rhsEvaluationTime, fomRhs_);
+    projectRhs(reducedRhs);
+
+    // fomJacActions_[s] = fom_J_s * phi for all samples
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    fomSystem_.get().applyJacobian(fomStates_, phi, rhsEvaluationTime, fomJacActions_);
+
+    using phi_scalar_t = typename ::pressio::Traits<basis_matrix_type>::scalar_type;
+    using jac_scalar_t = typename ::pressio::Traits<jacobian_type>::scalar_type;
+    constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
+    constexpr auto beta  = ::pressio::utils::Constants<jac_scalar_t>::zero();
+    for (std::size_t s=0; s<numSamples_; ++s){
+      ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
+			      alpha, phi, fomJacActions_[s],
+			      beta, reducedJacobians[s]);
+    }
+  }
+
+private:
+  void reconstructFomStates(const state_type & reducedStates) const
+  {
+    // fomStates = phi*reducedStates + translation
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    using phi_scalar_t = typename ::pressio::Traits<basis_matrix_type>::scalar_type;
+    using fom_scalar_t = typename ::pressio::Traits<fom_states_type>::scalar_type;
+    constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
+    constexpr auto beta  = ::pressio::utils::Constants<fom_scalar_t>::zero();
+    ::pressio::ops::product(::pressio::nontranspose(), ::pressio::nontranspose(),
+			    alpha, phi, reducedStates, beta, fomStates_);
+    fomStates_.colwise() += fomShift_;
+  }
+
+  void projectRhs(rhs_type & reducedRhs) const
+  {
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    using phi_scalar_t = typename ::pressio::Traits<basis_matrix_type>::scalar_type;
+    using rhs_scalar_t = typename ::pressio::Traits<rhs_type>::scalar_type;
+    constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
+    constexpr auto beta  = ::pressio::utils::Constants<rhs_scalar_t>::zero();
+    ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
+			    alpha, phi, fomRhs_, beta, reducedRhs);
+  }
+
+private:
+  using fom_states_type = typename FomSystemType::state_type;
+
+  std::reference_wrapper<const TrialSubspaceType> trialSubspace_;
+  std::reference_wrapper<const FomSystemType> fomSystem_;
+  mutable typename FomSystemType::rhs_type fomRhs_;
+  std::size_t numSamples_;
+  mutable fom_states_type fomStates_;
+  typename TrialSubspaceType::full_state_type fomShift_;
+  mutable std::vector<fom_jac_action_result_type> fomJacActions_;
+};
+
+}}} // end pressio::rom::impl
+#endif  // ROM_IMPL_GALERKIN_UNSTEADY_ENSEMBLE_SYSTEM_HPP_
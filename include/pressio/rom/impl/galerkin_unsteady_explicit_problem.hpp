@@ -35,6 +35,15 @@ public:
     stepper_(state, sStart, sCount, sSize);
   }
 
+  // error control, only meaningful for the embedded schemes
+  template<class ScalarType>
+  void setErrorControlTolerances(ScalarType absTol, ScalarType relTol){
+    stepper_.setErrorControlTolerances(absTol, relTol);
+  }
+
+  auto errorEstimate() const{ return stepper_.errorEstimate(); }
+  int errorEstimateOrder() const{ return stepper_.errorEstimateOrder(); }
+
 private:
   GalSystem galSystem_;
   stepper_type stepper_;
@@ -0,0 +1,196 @@
+
+#ifndef ROM_IMPL_GALERKIN_UNSTEADY_IMPLICIT_ENSEMBLE_PROBLEM_HPP_
+#define ROM_IMPL_GALERKIN_UNSTEADY_IMPLICIT_ENSEMBLE_PROBLEM_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+template <class T, class MatrixType, class = void>
+struct linear_solver_has_factorize : std::false_type{};
+
+template <class T, class MatrixType>
+struct linear_solver_has_factorize<
+  T, MatrixType,
+  mpl::void_t<decltype(std::declval<T &>().factorize(std::declval<MatrixType const &>()))>
+  > : std::true_type{};
+
+/*
+  steps the reduced states of all samples of an ensemble
+  galerkin system, stored as the columns of a K x S matrix.
+
+  Each step solves, for all samples at once, the BDF1 or BDF2 system
+  with a newton iteration where the rhs, the discrete residual and the
+  reduced states of all samples are single matrices: the residual and
+  the per-sample K x K jacobians are built with the same functions used
+  by the implicit steppers. The K x K systems are then solved one sample
+  after the other, each with its own pressio linear solver of kind
+  LinearSolverTag: direct solvers factorize the jacobian and solve
+  with the factorization, the others call solve(J, R, correction).
+  As for the newton solver, the iteration stops when the largest
+  correction (default) or residual norm over the samples is below the
+  tolerance. If that does not happen within the max number of
+  iterations, or the residual has nans, the states are restored and
+  pressio::eh::TimeStepFailure is thrown, as the implicit steppers do.
+  As for the regular BDF2 stepper, the first step is done with BDF1.
+*/
+template <class GalSystem, class LinearSolverTag>
+class GalerkinUnsteadyImplicitEnsembleProblem
+{
+public:
+  // required aliases to be steppable
+  using state_type = typename GalSystem::state_type;
+  using independent_variable_type = typename GalSystem::independent_variable_type;
+  using jacobian_type = typename GalSystem::jacobian_type;
+  using scalar_type = typename ::pressio::Traits<state_type>::scalar_type;
+
+private:
+  using linear_solver_type = ::pressio::linearsolvers::Solver<LinearSolverTag, jacobian_type>;
+  using stencil_states_type =
+    ::pressio::ode::ImplicitStencilStatesStaticContainer<state_type, 2>;
+
+public:
+  template<class ...Args>
+  GalerkinUnsteadyImplicitEnsembleProblem(::pressio::ode::StepScheme schemeName,
+					  Args && ... args)
+    : schemeName_(schemeName),
+      galSystem_(std::forward<Args>(args)...),
+      residual_(galSystem_.createRhs()),
+      correction_(galSystem_.createState()),
+      stencilStates_(galSystem_.createState()),
+      jacobians_(galSystem_.numberOfSamples(), galSystem_.createJacobian()),
+      solvers_(galSystem_.numberOfSamples())
+  {
+    if (schemeName != ::pressio::ode::StepScheme::BDF1 &&
+	schemeName != ::pressio::ode::StepScheme::BDF2)
+    {
+      throw std::runtime_error("galerkin_ensemble_implicit: only BDF1 and BDF2 are supported");
+    }
+  }
+
+  std::size_t numberOfSamples() const{ return galSystem_.numberOfSamples(); }
+
+  state_type createState() const{ return galSystem_.createState(); }
+
+  void setStopTolerance(scalar_type value){ stopTolerance_ = value; }
+  void setMaxIterations(int newMax){ maxIters_ = newMax; }
+
+  void setStopCriterion(::pressio::nonlinearsolvers::Stop value){
+    using ::pressio::nonlinearsolvers::Stop;
+    if (value != Stop::WhenAbsolutel2NormOfCorrectionBelowTolerance &&
+	value != Stop::WhenAbsolutel2NormOfResidualBelowTolerance){
+      throw std::runtime_error("galerkin_ensemble_implicit: only the absolute "
+			       "correction and residual norm criteria are supported");
+    }
+    stopCriterion_ = value;
+  }
+
+  void operator()(state_type & state,
+		  pressio::ode::StepStartAt<independent_variable_type> sStart,
+		  pressio::ode::StepCount sCount,
+		  pressio::ode::StepSize<independent_variable_type> sSize)
+  {
+    const bool useBdf2 = schemeName_ == ::pressio::ode::StepScheme::BDF2
+      && sCount.get() != ::pressio::ode::first_step_value;
+
+    // y_n becomes y_n-1 (BDF2 only), then copy state -> y_n
+    if (useBdf2){
+      stencilStates_.rotate();
+    }
+    ::pressio::ops::deep_copy(stencilStates_(::pressio::ode::n()), state);
+
+    const auto dt = sSize.get();
+    const independent_variable_type t_np1 = sStart.get() + dt;
+    try{
+      if (useBdf2){
+	solve(::pressio::ode::BDF2(), state, t_np1, dt);
+      }else{
+	solve(::pressio::ode::BDF1(), state, t_np1, dt);
+      }
+    }
+    catch (::pressio::eh::NonlinearSolveFailure const & e)
+    {
+      ::pressio::ops::deep_copy(state, stencilStates_(::pressio::ode::n()));
+      if (useBdf2){
+	stencilStates_.rotateBack();
+      }
+      throw ::pressio::eh::TimeStepFailure();
+    }
+  }
+
+private:
+  template<class SchemeTag>
+  void solve(SchemeTag tag,
+	     state_type & state,
+	     const independent_variable_type & t_np1,
+	     const independent_variable_type & dt)
+  {
+    using ::pressio::nonlinearsolvers::Stop;
+    const bool stopOnResidual = stopCriterion_ == Stop::WhenAbsolutel2NormOfResidualBelowTolerance;
+
+    for (int iStep=1; iStep<=maxIters_; ++iStep)
+    {
+      // on entry to discrete_residual, the residual contains the rhs
+      galSystem_.rhsAndJacobians(state, t_np1, residual_, jacobians_);
+      ::pressio::ode::impl::discrete_residual(tag, state, residual_, stencilStates_, dt);
+
+      const scalar_type maxResidualNorm = residual_.colwise().norm().maxCoeff();
+      if (std::isnan(maxResidualNorm)){
+	PRESSIOLOG_CRITICAL("galerkin ensemble: residual has nans");
+	throw ::pressio::eh::NonlinearSolveFailure();
+      }
+      if (stopOnResidual && maxResidualNorm < stopTolerance_){
+	PRESSIOLOG_DEBUG("galerkin ensemble: iteration = {}, max residual norm = {:.6e}, stopping",
+			 iStep, maxResidualNorm);
+	return;
+      }
+
+      // J_s correction_s = R_s, for each sample
+      for (std::size_t s=0; s<jacobians_.size(); ++s){
+	auto & J = jacobians_[s];
+	::pressio::ode::impl::discrete_jacobian(tag, J, dt);
+	const auto R_s = residual_.col(s);
+	auto c_s = correction_.col(s);
+	solveSample(solvers_[s], J, R_s, c_s);
+      }
+      ::pressio::ops::update(state, 1, correction_, -1);
+
+      const scalar_type maxCorrectionNorm = correction_.colwise().norm().maxCoeff();
+      PRESSIOLOG_DEBUG("galerkin ensemble: iteration = {}, max residual norm = {:.6e}, "
+		       "max correction norm = {:.6e}", iStep, maxResidualNorm, maxCorrectionNorm);
+      if (!stopOnResidual && maxCorrectionNorm < stopTolerance_){
+	return;
+      }
+    }
+
+    PRESSIOLOG_WARN("galerkin ensemble: not converged after {} iterations", maxIters_);
+    throw ::pressio::eh::NonlinearSolveFailure();
+  }
+
+  template<class SolverType, class RType, class CType>
+  mpl::enable_if_t<linear_solver_has_factorize<SolverType, jacobian_type>::value>
+  solveSample(SolverType & solver, const jacobian_type & J, const RType & R, CType & c){
+    solver.factorize(J);
+    solver.solveWithFactorization(R, c);
+  }
+
+  template<class SolverType, class RType, class CType>
+  mpl::enable_if_t<!linear_solver_has_factorize<SolverType, jacobian_type>::value>
+  solveSample(SolverType & solver, const jacobian_type & J, const RType & R, CType & c){
+    solver.solve(J, R, c);
+  }
+
+private:
+  ::pressio::ode::StepScheme schemeName_;
+  GalSystem galSystem_;
+  scalar_type stopTolerance_ = static_cast<scalar_type>(0.000001);
+  int maxIters_ = 100;
+  ::pressio::nonlinearsolvers::Stop stopCriterion_ =
+    ::pressio::nonlinearsolvers::Stop::WhenAbsolutel2NormOfCorrectionBelowTolerance;
+  state_type residual_;
+  state_type correction_;
+  stencil_states_type stencilStates_;
+  std::vector<jacobian_type> jacobians_;
+  std::vector<linear_solver_type> solvers_;
+};
+
+}}} // end pressio::rom::impl
+#endif  // ROM_IMPL_GALERKIN_UNSTEADY_IMPLICIT_ENSEMBLE_PROBLEM_HPP_
@@ -78,7 +78,10 @@ public:
     // reconstruct fom state fomState = phi*reducedState
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
 
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    }
 
     // compute the reduced rhs
     const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
@@ -86,15 +89,24 @@ public:
     constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
     using rhs_scalar_t = typename ::pressio::Traits<rhs_type>::scalar_type;
     constexpr auto beta = ::pressio::utils::Constants<rhs_scalar_t>::zero();
-    ::pressio::ops::product(::pressio::transpose(),
-			    alpha, phi, fomRhs_,
-			    beta, reducedRhs);
+    {
+      PRESSIO_PERF_ZONE("projection");
+      PRESSIO_PERF_COUNT("bytes streamed", projection_bytes(phi, fomRhs_));
+      ::pressio::ops::product(::pressio::transpose(),
+			      alpha, phi, fomRhs_,
+			      beta, reducedRhs);
+    }
 
     if (reducedJacobian){
       // evaluate fom jacobian action: fomJacAction_ = fom_J * phi
-      fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime, fomJacAction_);
+      {
+	PRESSIO_PERF_ZONE("fom jacobian action");
+	fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime, fomJacAction_);
+      }
 
       // compute the reduced jacobian
+      PRESSIO_PERF_ZONE("projection");
+      PRESSIO_PERF_COUNT("bytes streamed", projection_bytes(phi, fomJacAction_));
       constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
       constexpr auto beta = ::pressio::utils::Constants<rhs_scalar_t>::zero();
       ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
@@ -56,7 +56,10 @@ public:
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
 
     // evaluate fomRhs
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    }
 
     // compute the reduced rhs
     const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
@@ -64,9 +67,13 @@ public:
     constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
     using rhs_scalar_t = typename ::pressio::Traits<rhs_type>::scalar_type;
     constexpr auto beta = ::pressio::utils::Constants<rhs_scalar_t>::zero();
-    ::pressio::ops::product(::pressio::transpose(),
-			    alpha, phi, fomRhs_,
-			    beta, reducedRhs);
+    {
+      PRESSIO_PERF_ZONE("projection");
+      PRESSIO_PERF_COUNT("bytes streamed", projection_bytes(phi, fomRhs_));
+      ::pressio::ops::product(::pressio::transpose(),
+			      alpha, phi, fomRhs_,
+			      beta, reducedRhs);
+    }
   }
 
 private:
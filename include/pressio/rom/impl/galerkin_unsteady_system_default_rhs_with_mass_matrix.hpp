@@ -4,6 +4,18 @@
 
 namespace pressio{ namespace rom{ namespace impl{
 
+/*
+  explicit galerkin system with mass matrix:
+
+    phi^T M(phi*hat{y}, t) phi d hat{y}/dt = phi^T fom_rhs(phi*hat{y}, t)
+
+  If, besides applyMassMatrix(state, operand, time, result), the fom
+  also provides applyMassMatrix(operand, result), the fom mass matrix
+  is taken to be constant: the reduced mass matrix phi^T M phi is then
+  computed only once at construction, and this system exposes the
+  constant mass matrix API (rhs and massMatrix) so that the stepper
+  can reuse the same factorization for all steps and stages.
+*/
 template <
   class IndVarType,
   class ReducedStateType,
@@ -19,6 +31,10 @@ class GalerkinDefaultOdeSystemOnlyRhsAndMassMatrix
     decltype(std::declval<FomSystemType const>().createResultOfMassMatrixActionOn
 	     (std::declval<basis_matrix_type const &>()) );
 
+  static constexpr bool constant_fom_mass_matrix =
+    has_const_apply_mass_matrix_method_accept_operand_result_return_void<
+      FomSystemType, basis_matrix_type, fom_mm_action_result_type>::value;
+
 public:
   // required aliases
   using independent_variable_type = IndVarType;
@@ -32,8 +48,11 @@ public:
       fomSystem_(fomSystem),
       fomState_(trialSubspace.createFullState()),
       fomRhs_(fomSystem.createRhs()),
-      fomMMAction_(fomSystem.createResultOfMassMatrixActionOn(trialSubspace_.get().basisOfTranslatedSpace()))
-  {}
+      fomMMAction_(fomSystem.createResultOfMassMatrixActionOn(trialSubspace_.get().basisOfTranslatedSpace())),
+      reducedMassMatrix_(createMassMatrix())
+  {
+    computeReducedMassMatrixIfConstant(std::integral_constant<bool, constant_fom_mass_matrix>());
+  }
 
 public:
   state_type createState() const{
@@ -53,11 +72,49 @@ public:
 			mass_matrix_type & reducedMassMat,
 			rhs_type & reducedRhs) const
   {
+    computeReducedRhs(reducedState, rhsEvaluationTime, reducedRhs);
+
+    if (constant_fom_mass_matrix){
+      ::pressio::ops::deep_copy(reducedMassMat, reducedMassMatrix_);
+    }
+    else{
+      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+      {
+	PRESSIO_PERF_ZONE("fom mass matrix action");
+	fomSystem_.get().applyMassMatrix(fomState_, phi, rhsEvaluationTime, fomMMAction_);
+      }
+      computeReducedMassMatrix(reducedMassMat);
+    }
+  }
+
+  // only available if the fom mass matrix is constant
+  template<bool _constant = constant_fom_mass_matrix, mpl::enable_if_t<_constant, int> = 0>
+  void rhs(const state_type & reducedState,
+	   const IndVarType & rhsEvaluationTime,
+	   rhs_type & reducedRhs) const
+  {
+    computeReducedRhs(reducedState, rhsEvaluationTime, reducedRhs);
+  }
+
+  // only available if the fom mass matrix is constant
+  template<bool _constant = constant_fom_mass_matrix, mpl::enable_if_t<_constant, int> = 0>
+  void massMatrix(mass_matrix_type & reducedMassMat) const
+  {
+    ::pressio::ops::deep_copy(reducedMassMat, reducedMassMatrix_);
+  }
 
+private:
+  void computeReducedRhs(const state_type & reducedState,
+			 const IndVarType & rhsEvaluationTime,
+			 rhs_type & reducedRhs) const
+  {
     // reconstruct fom state fomState = phi*reducedState
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
     // evaluate fomRhs
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    }
 
     // compute the reduced rhs
     const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
@@ -65,24 +122,50 @@ public:
     constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
     using rhs_scalar_t = typename ::pressio::Traits<rhs_type>::scalar_type;
     constexpr auto beta = ::pressio::utils::Constants<rhs_scalar_t>::zero();
-    ::pressio::ops::product(::pressio::transpose(),
-			    alpha, phi, fomRhs_,
-			    beta, reducedRhs);
-
-    fomSystem_.get().applyMassMatrix(fomState_, phi, rhsEvaluationTime, fomMMAction_);
+    {
+      PRESSIO_PERF_ZONE("projection");
+      PRESSIO_PERF_COUNT("bytes streamed", projection_bytes(phi, fomRhs_));
+      ::pressio::ops::product(::pressio::transpose(),
+			      alpha, phi, fomRhs_,
+			      beta, reducedRhs);
+    }
+  }
 
-    // compute the reduced mass matrix
+  // reducedMassMat = phi^T fomMMAction_
+  void computeReducedMassMatrix(mass_matrix_type & reducedMassMat) const
+  {
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    using phi_scalar_t = typename ::pressio::Traits<basis_matrix_type>::scalar_type;
+    constexpr auto alpha = ::pressio::utils::Constants<phi_scalar_t>::one();
+    using mm_scalar_t = typename ::pressio::Traits<mass_matrix_type>::scalar_type;
+    constexpr auto beta = ::pressio::utils::Constants<mm_scalar_t>::zero();
+    PRESSIO_PERF_ZONE("projection");
+    PRESSIO_PERF_COUNT("bytes streamed", projection_bytes(phi, fomMMAction_));
     ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
 			    alpha, phi, fomMMAction_,
 			    beta, reducedMassMat);
   }
 
+  void computeReducedMassMatrixIfConstant(std::true_type)
+  {
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    {
+      PRESSIO_PERF_ZONE("fom mass matrix action");
+      fomSystem_.get().applyMassMatrix(phi, fomMMAction_);
+    }
+    computeReducedMassMatrix(reducedMassMatrix_);
+  }
+
+  void computeReducedMassMatrixIfConstant(std::false_type){}
+
 private:
   std::reference_wrapper<const TrialSubspaceType> trialSubspace_;
   std::reference_wrapper<const FomSystemType> fomSystem_;
   mutable typename FomSystemType::state_type fomState_;
   mutable typename FomSystemType::rhs_type fomRhs_;
   mutable fom_mm_action_result_type fomMMAction_;
+  // phi^T M phi, only used if the fom mass matrix is constant
+  mass_matrix_type reducedMassMatrix_;
 };
 
 }}} // end pressio::rom::impl
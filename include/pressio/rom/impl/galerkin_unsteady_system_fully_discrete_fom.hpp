@@ -138,7 +138,7 @@ private:
 			 bool computeJacobian,
 			 States && ... states) const
   {
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
 
 #ifdef PRESSIO_ENABLE_CXX17
     if (computeJacobian){
@@ -92,7 +92,7 @@ public:
     const auto & yn   = fomStatesManager_(::pressio::ode::n());
     try
     {
-      const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
       fomSystem_.get().discreteTimeResidualAndJacobianAction(currentStepNumber, time_np1,
 							     dt, fomResidual_, phi,
 							     computeJacobian, fomJacAction_,
@@ -125,7 +125,7 @@ public:
     const auto & ynm1 = fomStatesManager_(::pressio::ode::nMinusOne());
 
     try{
-      const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
       fomSystem_.get().discreteTimeResidualAndJacobianAction(currentStepNumber, time_np1,
 							     dt, fomResidual_, phi,
 							     computeJacobian, fomJacAction_,
@@ -82,11 +82,17 @@ public:
   {
 
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    }
     hyperReducer_(fomRhs_, rhsEvaluationTime, reducedRhs);
     if (reducedJacobian){
       const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
-      fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime, fomJacAction_);
+      {
+	PRESSIO_PERF_ZONE("fom jacobian action");
+	fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime, fomJacAction_);
+      }
 #ifdef PRESSIO_ENABLE_CXX17
       hyperReducer_(fomJacAction_, rhsEvaluationTime, *reducedJacobian.value());
 #else
@@ -58,7 +58,10 @@ public:
     // reconstruct fom state fomState = phi*reducedState
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
     // evaluate fomRhs
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, fomRhs_);
+    }
     // evaluate reduced rhs
     hyperReducer_(fomRhs_, rhsEvaluationTime, reducedRhs);
   }
@@ -18,6 +18,10 @@ so that it boils down to:
 rhs = hyperReducer masked(fom_rhs(phi*hat{y}, ...))
 rhs_jacobian = hyperReducer masked(d(fom_rhs(phi*hat{y}, ...))/dy phi)
 
+if the fom provides rhsAtSampleMesh and/or applyJacobianAtSampleMesh,
+the masked operators are computed directly and the corresponding
+full-size fom operators are never allocated
+
 */
 template <
   class IndVarType,
@@ -39,7 +43,6 @@ class GalerkinMaskedOdeSystemRhsAndJacobian
     decltype(std::declval<FomSystemType const>().createResultOfJacobianActionOn
 	     (std::declval<basis_matrix_type const &>()));
 
-  // deduce the masked types
   // deduce the masked types
   using masked_fom_rhs_type =
     decltype(std::declval<MaskerType const>().createResultOfMaskActionOn
@@ -49,6 +52,12 @@ class GalerkinMaskedOdeSystemRhsAndJacobian
     decltype(std::declval<MaskerType const>().createResultOfMaskActionOn
 	     (std::declval<unmasked_fom_jac_action_result_type const &>()));
 
+  static constexpr bool rhs_at_sample_mesh =
+    fom_has_rhs_at_sample_mesh<FomSystemType, masked_fom_rhs_type>::value;
+  static constexpr bool jac_action_at_sample_mesh =
+    fom_has_apply_jacobian_at_sample_mesh<
+      FomSystemType, TrialSubspaceType, masked_fom_jac_action_result_type>::value;
+
 public:
   // required aliases
   using independent_variable_type = IndVarType;
@@ -65,10 +74,12 @@ public:
       fomState_(trialSubspace.createFullState()),
       hyperReducer_(hyperReducer),
       masker_(masker),
-      unMaskedFomRhs_(fomSystem.createRhs()),
-      unMaskedFomJacAction_(fomSystem.createResultOfJacobianActionOn(trialSubspace_.get().basisOfTranslatedSpace())),
-      maskedFomRhs_(masker.createResultOfMaskActionOn(unMaskedFomRhs_)),
-      maskedFomJacAction_(masker.createResultOfMaskActionOn(unMaskedFomJacAction_))
+      unMaskedFomRhs_([&fomSystem](){ return fomSystem.createRhs(); }),
+      unMaskedFomJacAction_([&fomSystem, &trialSubspace](){
+	return fomSystem.createResultOfJacobianActionOn(trialSubspace.basisOfTranslatedSpace()); }),
+      maskedFomRhs_(create_masked_fom_rhs<masked_fom_rhs_type>(fomSystem, masker)),
+      maskedFomJacAction_(create_masked_fom_jacobian_action<masked_fom_jac_action_result_type>
+			  (fomSystem, masker, trialSubspace.basisOfTranslatedSpace()))
   {}
 
 public:
@@ -95,14 +106,12 @@ public:
   {
 
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, unMaskedFomRhs_);
-    masker_(unMaskedFomRhs_, maskedFomRhs_);
+    computeMaskedFomRhs(std::integral_constant<bool, rhs_at_sample_mesh>(), rhsEvaluationTime);
     hyperReducer_(maskedFomRhs_, rhsEvaluationTime, reducedRhs);
 
     if (reducedJacobian){
-      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
-      fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime, unMaskedFomJacAction_);
-      masker_(unMaskedFomJacAction_, maskedFomJacAction_);
+      computeMaskedFomJacAction(std::integral_constant<bool, jac_action_at_sample_mesh>(),
+				rhsEvaluationTime);
 #ifdef PRESSIO_ENABLE_CXX17
       hyperReducer_(maskedFomJacAction_, rhsEvaluationTime, *reducedJacobian.value());
 #else
@@ -111,6 +120,45 @@ public:
     }
   }
 
+private:
+  void computeMaskedFomRhs(std::true_type, const IndVarType & rhsEvaluationTime) const
+  {
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhsAtSampleMesh(fomState_, rhsEvaluationTime, maskedFomRhs_);
+    }
+  }
+
+  void computeMaskedFomRhs(std::false_type, const IndVarType & rhsEvaluationTime) const
+  {
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, unMaskedFomRhs_.get());
+    }
+    masker_(unMaskedFomRhs_.get(), maskedFomRhs_);
+  }
+
+  void computeMaskedFomJacAction(std::true_type, const IndVarType & rhsEvaluationTime) const
+  {
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    {
+      PRESSIO_PERF_ZONE("fom jacobian action");
+      fomSystem_.get().applyJacobianAtSampleMesh(fomState_, phi, rhsEvaluationTime,
+						 maskedFomJacAction_);
+    }
+  }
+
+  void computeMaskedFomJacAction(std::false_type, const IndVarType & rhsEvaluationTime) const
+  {
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    {
+      PRESSIO_PERF_ZONE("fom jacobian action");
+      fomSystem_.get().applyJacobian(fomState_, phi, rhsEvaluationTime,
+				     unMaskedFomJacAction_.get());
+    }
+    masker_(unMaskedFomJacAction_.get(), maskedFomJacAction_);
+  }
+
 private:
   std::reference_wrapper<const TrialSubspaceType> trialSubspace_;
   std::reference_wrapper<const FomSystemType> fomSystem_;
@@ -118,9 +166,11 @@ private:
   std::reference_wrapper<const HyperReducerType> hyperReducer_;
   std::reference_wrapper<const MaskerType> masker_;
 
-  // UNMASKED objects
-  mutable unmasked_fom_rhs_type unMaskedFomRhs_;
-  mutable unmasked_fom_jac_action_result_type unMaskedFomJacAction_;
+  // UNMASKED objects, only allocated if needed
+  mutable UnmaskedFomOperatorStorage<
+    unmasked_fom_rhs_type, !rhs_at_sample_mesh> unMaskedFomRhs_;
+  mutable UnmaskedFomOperatorStorage<
+    unmasked_fom_jac_action_result_type, !jac_action_at_sample_mesh> unMaskedFomJacAction_;
 
   // MASKED objects
   mutable masked_fom_rhs_type maskedFomRhs_;
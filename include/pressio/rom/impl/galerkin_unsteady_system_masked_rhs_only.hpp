@@ -13,6 +13,9 @@ namespace pressio{ namespace rom{ namespace impl{
 - fom_rhs is the fom RHS
 - phi is the basis
 - HrOp is the hyper-red operator
+
+if the fom provides rhsAtSampleMesh, the masked rhs is computed
+directly and the full-size fom rhs is never allocated
 */
 template <
   class IndVarType,
@@ -31,6 +34,9 @@ class GalerkinMaskedOdeSystemOnlyRhs
     decltype(std::declval<MaskerType const>().createResultOfMaskActionOn
 	     (std::declval<unmasked_fom_rhs_type const &>()));
 
+  static constexpr bool rhs_at_sample_mesh =
+    fom_has_rhs_at_sample_mesh<FomSystemType, masked_fom_rhs_type>::value;
+
 public:
   // required aliases
   using independent_variable_type = IndVarType;
@@ -46,8 +52,8 @@ public:
       fomState_(trialSubspace.createFullState()),
       hyperReducer_(hyperReducer),
       masker_(masker),
-      unMaskedFomRhs_(fomSystem.createRhs()),
-      maskedFomRhs_(masker.createResultOfMaskActionOn(unMaskedFomRhs_))
+      unMaskedFomRhs_([&fomSystem](){ return fomSystem.createRhs(); }),
+      maskedFomRhs_(create_masked_fom_rhs<masked_fom_rhs_type>(fomSystem, masker))
   {}
 
 public:
@@ -66,21 +72,37 @@ public:
 
     // reconstruct fom state fomState = phi*reducedState
     trialSubspace_.get().mapFromReducedState(reducedState, fomState_);
-    // evaluate fomRhs
-    fomSystem_.get().rhs(fomState_, rhsEvaluationTime, unMaskedFomRhs_);
-    // mask it
-    masker_(unMaskedFomRhs_, maskedFomRhs_);
+    // evaluate the fom rhs on the sample mesh
+    computeMaskedFomRhs(std::integral_constant<bool, rhs_at_sample_mesh>(), rhsEvaluationTime);
     // evaluate reduced rhs
     hyperReducer_(maskedFomRhs_, rhsEvaluationTime, reducedRhs);
   }
 
+private:
+  void computeMaskedFomRhs(std::true_type, const IndVarType & rhsEvaluationTime) const
+  {
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhsAtSampleMesh(fomState_, rhsEvaluationTime, maskedFomRhs_);
+    }
+  }
+
+  void computeMaskedFomRhs(std::false_type, const IndVarType & rhsEvaluationTime) const
+  {
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhs(fomState_, rhsEvaluationTime, unMaskedFomRhs_.get());
+    }
+    masker_(unMaskedFomRhs_.get(), maskedFomRhs_);
+  }
+
 private:
   std::reference_wrapper<const TrialSubspaceType> trialSubspace_;
   std::reference_wrapper<const FomSystemType> fomSystem_;
   mutable typename FomSystemType::state_type fomState_;
   std::reference_wrapper<const HyperReducerType> hyperReducer_;
   std::reference_wrapper<const MaskerType> masker_;
-  mutable unmasked_fom_rhs_type unMaskedFomRhs_;
+  mutable UnmaskedFomOperatorStorage<unmasked_fom_rhs_type, !rhs_at_sample_mesh> unMaskedFomRhs_;
   mutable masked_fom_rhs_type maskedFomRhs_;
 };
 
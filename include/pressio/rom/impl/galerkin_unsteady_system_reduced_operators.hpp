@@ -0,0 +1,101 @@
+
+#ifndef ROM_IMPL_GALERKIN_UNSTEADY_SYSTEM_REDUCED_OPERATORS_HPP_
+#define ROM_IMPL_GALERKIN_UNSTEADY_SYSTEM_REDUCED_OPERATORS_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+/*
+  Galerkin system using precomputed reduced operators:
+
+     d hat{y}/dt = b + A hat{y} + q(hat{y})
+
+  see PolynomialReducedOperators: no fom-sized data is ever touched.
+  Since the operators are precomputed, the fom must be autonomous.
+*/
+template <class IndVarType, class ReducedOperatorsType>
+class GalerkinReducedOperatorsOdeSystemOnlyRhs
+{
+public:
+  // required aliases
+  using independent_variable_type = IndVarType;
+  using state_type = typename ReducedOperatorsType::reduced_state_type;
+  using rhs_type   = typename ReducedOperatorsType::reduced_vector_type;
+
+  GalerkinReducedOperatorsOdeSystemOnlyRhs() = delete;
+
+  explicit GalerkinReducedOperatorsOdeSystemOnlyRhs(const ReducedOperatorsType & reducedOperators)
+    : reducedOperators_(reducedOperators){}
+
+  state_type createState() const{
+    return reducedOperators_.get().createReducedState();
+  }
+
+  rhs_type createRhs() const{
+    return reducedOperators_.get().createReducedState();
+  }
+
+  void rhs(const state_type & reducedState,
+	   const IndVarType & /*rhsEvaluationTime*/,
+	   rhs_type & reducedRhs) const
+  {
+    reducedOperators_.get().evaluate(reducedState, reducedRhs);
+  }
+
+private:
+  std::reference_wrapper<const ReducedOperatorsType> reducedOperators_;
+};
+
+template <class IndVarType, class ReducedOperatorsType>
+class GalerkinReducedOperatorsOdeSystemRhsAndJacobian
+{
+public:
+  // required aliases
+  using independent_variable_type = IndVarType;
+  using state_type    = typename ReducedOperatorsType::reduced_state_type;
+  using rhs_type      = typename ReducedOperatorsType::reduced_vector_type;
+  using jacobian_type = typename ReducedOperatorsType::reduced_matrix_type;
+
+  GalerkinReducedOperatorsOdeSystemRhsAndJacobian() = delete;
+
+  explicit GalerkinReducedOperatorsOdeSystemRhsAndJacobian(const ReducedOperatorsType & reducedOperators)
+    : reducedOperators_(reducedOperators){}
+
+  state_type createState() const{
+    return reducedOperators_.get().createReducedState();
+  }
+
+  rhs_type createRhs() const{
+    return reducedOperators_.get().createReducedState();
+  }
+
+  jacobian_type createJacobian() const{
+    return reducedOperators_.get().createReducedMatrix();
+  }
+
+  void rhsAndJacobian(const state_type & reducedState,
+		      const IndVarType & /*rhsEvaluationTime*/,
+		      rhs_type & reducedRhs,
+#ifdef PRESSIO_ENABLE_CXX17
+		      std::optional<jacobian_type*> reducedJacobian) const
+#else
+                      jacobian_type* reducedJacobian) const
+#endif
+  {
+    if (reducedJacobian){
+#ifdef PRESSIO_ENABLE_CXX17
+      reducedOperators_.get().evaluate(reducedState, reducedRhs, *reducedJacobian.value());
+#else
+      reducedOperators_.get().evaluate(reducedState, reducedRhs, *reducedJacobian);
+#endif
+    }
+    else{
+      reducedOperators_.get().evaluate(reducedState, reducedRhs);
+    }
+  }
+
+private:
+  std::reference_wrapper<const ReducedOperatorsType> reducedOperators_;
+};
+
+}}} // end pressio::rom::impl
+#endif  // ROM_IMPL_GALERKIN_UNSTEADY_SYSTEM_REDUCED_OPERATORS_HPP_
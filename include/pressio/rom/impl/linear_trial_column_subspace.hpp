@@ -16,7 +16,14 @@ struct CreateReducedState<
 {
   template<class BasisType>
   ReducedStateType operator()(const BasisType & basis){
-    return ReducedStateType(::pressio::ops::extent(basis, 1));
+    const auto numBasis = ::pressio::ops::extent(basis, 1);
+    // a fixed-size reduced state must match the number of basis vectors
+    constexpr auto fixedSize = static_cast<long long>(ReducedStateType::SizeAtCompileTime);
+    if (fixedSize != static_cast<long long>(Eigen::Dynamic) &&
+	fixedSize != static_cast<long long>(numBasis)){
+      throw std::runtime_error("the size of the fixed-size reduced state differs from the number of basis vectors");
+    }
+    return ReducedStateType(numBasis);
   }
 };
 #endif
@@ -13,5 +13,34 @@ void valid_scheme_for_lspg_else_throw(::pressio::ode::StepScheme name){
   }
 }
 
+// the unsteady factories take the scheme either as a StepScheme value,
+// or as its tag when it is known at compile time: in the latter case
+// the problem, its stepper and its residual/jacobian policy are
+// specialized for that scheme and do not branch on it at runtime
+template<class T> struct is_lspg_scheme : std::false_type{};
+template<> struct is_lspg_scheme<::pressio::ode::StepScheme> : std::true_type{};
+template<> struct is_lspg_scheme<::pressio::ode::BDF1> : std::true_type{};
+template<> struct is_lspg_scheme<::pressio::ode::BDF2> : std::true_type{};
+
+#ifdef PRESSIO_ENABLE_CXX20
+// a concept, so that the factories constrained on it still
+// subsume each other as they do through their other constraints
+template<class T>
+concept LspgScheme = is_lspg_scheme<T>::value;
+#endif
+
+template<class SchemeTag>
+void valid_scheme_for_lspg_else_throw(SchemeTag){
+  static_assert(is_lspg_scheme<SchemeTag>::value,
+		"LSPG currently accepting BDF1 or BDF2");
+}
+
+// void when the scheme is only known at runtime
+template<class SchemeType> struct scheme_tag_of{ using type = SchemeType; };
+template<> struct scheme_tag_of<::pressio::ode::StepScheme>{ using type = void; };
+
+template<class SchemeType>
+using scheme_tag_of_t = typename scheme_tag_of<SchemeType>::type;
+
 }}} // end pressio::rom::impl
 #endif  // ROM_IMPL_LSPG_HELPERS_HPP_
@@ -71,6 +71,9 @@ public:
 		       std::initializer_list<fom_state_type> il)
     : trialSubspace_(trialSubspace), data_(il)
   {
+    for (std::size_t i=0; i<data_.size(); i++){
+      slots_.push_back(i);
+    }
     this->setZero();
   }
 
@@ -79,22 +82,22 @@ public:
 
   // n+1
   fom_state_type const & operator()(::pressio::ode::nPlusOne) const {
-    assert(data_.size() >=1); return data_[0];
+    assert(data_.size() >=1); return data_[slots_[0]];
   }
 
   // n
   fom_state_type const & operator()(::pressio::ode::n) const {
-    assert(data_.size() >=2); return data_[1];
+    assert(data_.size() >=2); return data_[slots_[1]];
   }
 
   // n-1
   fom_state_type const & operator()(::pressio::ode::nMinusOne) const {
-    assert(data_.size() >=3); return data_[2];
+    assert(data_.size() >=3); return data_[slots_[2]];
   }
 
   // n-2
   fom_state_type const & operator()(::pressio::ode::nMinusTwo) const {
-    assert(data_.size() >=4); return data_[3];
+    assert(data_.size() >=4); return data_[slots_[3]];
   }
 
   // n+1
@@ -102,7 +105,7 @@ public:
   void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
 				    ::pressio::ode::nPlusOne /*tag*/){
     assert(data_.size() >=1);
-    trialSubspace_.get().mapFromReducedState(romStateIn, data_[0]);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slots_[0]]);
   }
 
   // n
@@ -110,7 +113,7 @@ public:
   void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
 				    ::pressio::ode::n /*tag*/){
     assert(data_.size() >=2);
-    trialSubspace_.get().mapFromReducedState(romStateIn, data_[1]);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slots_[1]]);
   }
 
   // n-1
@@ -118,7 +121,7 @@ public:
   void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
 				    ::pressio::ode::nMinusOne /*tag*/){
     assert(data_.size() >=3);
-    trialSubspace_.get().mapFromReducedState(romStateIn, data_[2]);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slots_[2]]);
   }
 
   // n-2
@@ -126,7 +129,7 @@ public:
   void reconstructAtWithoutStencilUpdate(const RomStateType & romStateIn,
 				    ::pressio::ode::nMinusTwo /*tag*/){
     assert(data_.size() >=4);
-    trialSubspace_.get().mapFromReducedState(romStateIn, data_[4]);
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slots_[3]]);
   }
 
   template <class RomStateType>
@@ -136,30 +139,13 @@ public:
 
     assert(data_.size() >=2);
 
-    if (data_.size() == 2){
-      /* when n == 2, it means I only have n+1 and n
-       * so reconstructing at n, we just overwrite data_[1] */
-      trialSubspace_.get().mapFromReducedState(romStateIn, data_[1]);
-    }
-    else if (data_.size() == 3){
-      /* when n == 3, we have y_n+1, y_n, y_n-1 */
-      // y_n becomes  y_n-1
-      ::pressio::ops::deep_copy(data_[2], data_[1]);
-      // reconstruct y_n
-      trialSubspace_.get().mapFromReducedState(romStateIn, data_[1]);
-    }
-    else if (data_.size() == 4){
-      /* when n == 4, we have y_n+1, y_n, y_n-1, y_n-2 */
-
-      // y_n-1 becomes y_n-2
-      ::pressio::ops::deep_copy(data_[3], data_[2]);
-
-      // y_n   becomes y_n-1
-      ::pressio::ops::deep_copy(data_[2], data_[1]);
+    /* y_n becomes y_n-1, y_n-1 becomes y_n-2, etc: this only rotates
+       the history slots (i.e. all but n+1), so that the slot of the
+       oldest state is reused for the new y_n without copying any data */
+    std::rotate(slots_.rbegin(), slots_.rbegin()+1, slots_.rend()-1);
 
-      // reconstruct y_n
-      trialSubspace_.get().mapFromReducedState(romStateIn, data_[1]);
-    }
+    // reconstruct y_n
+    trialSubspace_.get().mapFromReducedState(romStateIn, data_[slots_[1]]);
   }
 
 private:
@@ -171,6 +157,9 @@ private:
 private:
   std::reference_wrapper<const TrialSubspaceType> trialSubspace_;
   data_type data_;
+  // slots_[i] is the index in data_ of the i-th stencil state:
+  // 0 -> n+1, 1 -> n, 2 -> n-1, 3 -> n-2
+  std::vector<std::size_t> slots_;
 };
 
 template <class TrialSubspaceType>
@@ -227,6 +216,19 @@ auto create_lspg_fom_states_manager(const TrialSubspaceType & trialSubspace)
   }
 }
 
+// scheme known at compile time
+template <class TrialSubspaceType>
+auto create_lspg_fom_states_manager(::pressio::ode::BDF1,
+				    const TrialSubspaceType & trialSubspace){
+  return create_lspg_fom_states_manager<2>(trialSubspace);
+}
+
+template <class TrialSubspaceType>
+auto create_lspg_fom_states_manager(::pressio::ode::BDF2,
+				    const TrialSubspaceType & trialSubspace){
+  return create_lspg_fom_states_manager<3>(trialSubspace);
+}
+
 }}}//end namespace pressio::rom::impl
 
 #endif  // ROM_IMPL_LSPG_UNSTEADY_FOM_STATES_MANAGER_HPP_
@@ -95,7 +95,7 @@ public:
   }
 
   discrete_jacobian_type createDiscreteJacobian() const{
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
     discrete_jacobian_type J(fomSystem_.get().createResultOfDiscreteTimeJacobianActionOn(phi));
     return J;
   }
@@ -117,7 +117,7 @@ public:
     doFomStatesReconstruction(currentStepNumber, lspg_state_np1, lspg_state_n);
     const auto & ynp1 = fomStatesManager_(::pressio::ode::nPlusOne());
     const auto & yn   = fomStatesManager_(::pressio::ode::n());
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
 
     try
     {
@@ -149,7 +149,7 @@ public:
     const auto & ynp1 = fomStatesManager_(::pressio::ode::nPlusOne());
     const auto & yn   = fomStatesManager_(::pressio::ode::n());
     const auto & ynm1 = fomStatesManager_(::pressio::ode::nMinusOne());
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
 
     try{
       fomSystem_.get().discreteTimeResidualAndJacobianAction(currentStepNumber, time_np1, dt,
@@ -4,10 +4,10 @@
 
 namespace pressio{ namespace rom{ namespace impl{
 
-template <int TotalNumberOfDesiredStates, class = void>
+template <int TotalNumberOfDesiredStates, class SchemeTag, class = void>
 struct DeducedStepperType;
 
-template <> struct DeducedStepperType<-1>{
+template <> struct DeducedStepperType<-1, void>{
   // note: to deduce the stepper_type it does not really matter
   // what scheme enum value we use, as long as it is an implicit one
   template<class T>
@@ -17,9 +17,19 @@ template <> struct DeducedStepperType<-1>{
 			 ));
 };
 
+template <class SchemeTag>
+struct DeducedStepperType<
+  -1, SchemeTag, mpl::enable_if_t< !std::is_void<SchemeTag>::value >
+  >
+{
+  template<class T>
+  using type = decltype(::pressio::ode::create_implicit_stepper<
+			SchemeTag>(std::declval<T &>()));
+};
+
 template <int TotalNumberOfDesiredStates>
 struct DeducedStepperType<
-  TotalNumberOfDesiredStates,
+  TotalNumberOfDesiredStates, void,
   mpl::enable_if_t< (TotalNumberOfDesiredStates>0) >
   >
 {
@@ -28,15 +38,21 @@ struct DeducedStepperType<
 			TotalNumberOfDesiredStates>(std::declval<T &>()));
 };
 
+/*
+  SchemeTag == void: the scheme is chosen at runtime by the constructor.
+  Otherwise, SchemeTag is ode::BDF1 or ode::BDF2 and the stepper as well
+  as the residual/jacobian policy are specialized for that scheme.
+*/
 template <
   int TotalNumberOfDesiredStates,
   class TrialSubspaceType,
-  class ResJacPolicyOrFullyDiscreteSystemType
+  class ResJacPolicyOrFullyDiscreteSystemType,
+  class SchemeTag = void
   >
 class LspgUnsteadyProblem
 {
 
-  using stepper_type = typename DeducedStepperType<TotalNumberOfDesiredStates>::template
+  using stepper_type = typename DeducedStepperType<TotalNumberOfDesiredStates, SchemeTag>::template
     type<ResJacPolicyOrFullyDiscreteSystemType>;
 
   using fom_states_manager_type = LspgFomStatesManager<TrialSubspaceType>;
@@ -51,7 +67,9 @@ public:
     class FomSystemType,
     class ...Args,
     int _TotalNumberOfDesiredStates = TotalNumberOfDesiredStates,
-    mpl::enable_if_t< _TotalNumberOfDesiredStates == -1, int > = 0
+    class _SchemeTag = SchemeTag,
+    mpl::enable_if_t< _TotalNumberOfDesiredStates == -1
+		      && std::is_void<_SchemeTag>::value, int > = 0
     >
   LspgUnsteadyProblem(::pressio::ode::StepScheme odeSchemeName,
 		      const TrialSubspaceType & trialSubspace,
@@ -63,6 +81,26 @@ public:
       stepper_( ::pressio::ode::create_implicit_stepper(odeSchemeName, rjPolicyOrFullyDiscreteSystem_))
   {}
 
+  template<
+    class _SchemeTag,
+    class FomSystemType,
+    class ...Args,
+    int _TotalNumberOfDesiredStates = TotalNumberOfDesiredStates,
+    mpl::enable_if_t< _TotalNumberOfDesiredStates == -1
+		      && !std::is_void<SchemeTag>::value
+		      && std::is_same<_SchemeTag, SchemeTag>::value, int > = 0
+    >
+  LspgUnsteadyProblem(_SchemeTag odeScheme,
+		      const TrialSubspaceType & trialSubspace,
+		      const FomSystemType & fomSystem,
+		      Args && ... args)
+    : fomStatesManager_(create_lspg_fom_states_manager(odeScheme, trialSubspace)),
+      rjPolicyOrFullyDiscreteSystem_(trialSubspace, fomSystem, fomStatesManager_,
+				     std::forward<Args>(args)...),
+      stepper_( ::pressio::ode::create_implicit_stepper<
+		SchemeTag>(rjPolicyOrFullyDiscreteSystem_))
+  {}
+
   template<
     class FomSystemType,
     class ...Args,
@@ -89,7 +89,7 @@ public:
   }
 
   jacobian_type createJacobian() const{
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
     return fomSystem_.get().createResultOfJacobianActionOn(phi);
   }
 
@@ -110,23 +110,13 @@ public:
   {
 
     if (odeSchemeName == ::pressio::ode::StepScheme::BDF1){
-      (*this).template compute_impl_bdf<ode::BDF1>
-	(predictedReducedState, reducedStatesStencilManager,
-	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+      (*this)(::pressio::ode::BDF1(), predictedReducedState, reducedStatesStencilManager,
+	      fomRhsStencilManger, rhsEvaluationTime, step, dt, R, Jo);
     }
 
-    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2)
-    {
-      if (step.get() == ::pressio::ode::first_step_value){
-	(*this).template compute_impl_bdf<ode::BDF1>
-	  (predictedReducedState, reducedStatesStencilManager,
-	   rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
-      }
-      else{
-	(*this).template compute_impl_bdf<ode::BDF2>
-	  (predictedReducedState, reducedStatesStencilManager,
-	   rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
-      }
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2){
+      (*this)(::pressio::ode::BDF2(), predictedReducedState, reducedStatesStencilManager,
+	      fomRhsStencilManger, rhsEvaluationTime, step, dt, R, Jo);
     }
 
     else{
@@ -134,6 +124,55 @@ public:
     }
   }
 
+  // same as above for a scheme known at compile time,
+  // used by the problems created with the scheme as template argument
+  template <class StencilStatesContainerType, class StencilRhsContainerType>
+  void operator()(::pressio::ode::BDF1,
+		  const state_type & predictedReducedState,
+		  const StencilStatesContainerType & reducedStatesStencilManager,
+		  StencilRhsContainerType & fomRhsStencilManger,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  residual_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type *> Jo) const
+#else
+		  jacobian_type * Jo) const
+#endif
+  {
+    (*this).template compute_impl_bdf<ode::BDF1>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+  }
+
+  template <class StencilStatesContainerType, class StencilRhsContainerType>
+  void operator()(::pressio::ode::BDF2,
+		  const state_type & predictedReducedState,
+		  const StencilStatesContainerType & reducedStatesStencilManager,
+		  StencilRhsContainerType & fomRhsStencilManger,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  residual_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type *> Jo) const
+#else
+		  jacobian_type * Jo) const
+#endif
+  {
+    if (step.get() == ::pressio::ode::first_step_value){
+      (*this).template compute_impl_bdf<ode::BDF1>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+    else{
+      (*this).template compute_impl_bdf<ode::BDF2>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+  }
+
 private:
   template <class OdeTag, class StencilStatesContainerType>
   void compute_impl_bdf(const state_type & predictedReducedState,
@@ -173,7 +212,10 @@ private:
     }
 
     // always compute residual
-    fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+    }
     // default lspg does not do anything special, so we can use the
     // available ode functions for computing the discrete residual
     ::pressio::ode::impl::discrete_residual(OdeTag(), fomStateAt_np1,
@@ -192,7 +234,10 @@ private:
 
       // first, store J*phi into J
       const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
-      fomSystem_.get().applyJacobian(fomStateAt_np1, phi, rhsEvaluationTime, J);
+      {
+	PRESSIO_PERF_ZONE("fom jacobian action");
+	fomSystem_.get().applyJacobian(fomStateAt_np1, phi, rhsEvaluationTime, J);
+      }
 
       // second, we just need to update J properly
       using basis_sc_t = typename ::pressio::Traits<
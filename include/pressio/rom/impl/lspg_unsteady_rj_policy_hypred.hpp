@@ -94,7 +94,7 @@ public:
   }
 
   jacobian_type createJacobian() const{
-    const auto phi = trialSubspace_.get().basisOfTranslatedSpace();
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
     return fomSystem_.get().createResultOfJacobianActionOn(phi);
   }
 
@@ -114,25 +114,14 @@ public:
 #endif
   {
 
-    if (odeSchemeName == ::pressio::ode::StepScheme::BDF1)
-    {
-      (*this).template compute_impl_bdf<ode::BDF1>
-	(predictedReducedState, reducedStatesStencilManager,
-	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    if (odeSchemeName == ::pressio::ode::StepScheme::BDF1){
+      (*this)(::pressio::ode::BDF1(), predictedReducedState, reducedStatesStencilManager,
+	      fomRhsStencilManger, rhsEvaluationTime, step, dt, R, Jo);
     }
 
-    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2)
-    {
-      if (step.get() == ::pressio::ode::first_step_value){
-	(*this).template compute_impl_bdf<ode::BDF1>
-	  (predictedReducedState, reducedStatesStencilManager,
-	   rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
-      }
-      else{
-	(*this).template compute_impl_bdf<ode::BDF2>
-	  (predictedReducedState, reducedStatesStencilManager,
-	   rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
-      }
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2){
+      (*this)(::pressio::ode::BDF2(), predictedReducedState, reducedStatesStencilManager,
+	      fomRhsStencilManger, rhsEvaluationTime, step, dt, R, Jo);
     }
 
     else{
@@ -140,6 +129,55 @@ public:
     }
   }
 
+  // same as above for a scheme known at compile time,
+  // used by the problems created with the scheme as template argument
+  template <class StencilStatesContainerType, class StencilRhsContainerType>
+  void operator()(::pressio::ode::BDF1,
+		  const state_type & predictedReducedState,
+		  const StencilStatesContainerType & reducedStatesStencilManager,
+		  StencilRhsContainerType & fomRhsStencilManger,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  residual_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type *> Jo) const
+#else
+		  jacobian_type * Jo) const
+#endif
+  {
+    (*this).template compute_impl_bdf<ode::BDF1>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+  }
+
+  template <class StencilStatesContainerType, class StencilRhsContainerType>
+  void operator()(::pressio::ode::BDF2,
+		  const state_type & predictedReducedState,
+		  const StencilStatesContainerType & reducedStatesStencilManager,
+		  StencilRhsContainerType & fomRhsStencilManger,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  residual_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type *> Jo) const
+#else
+		  jacobian_type * Jo) const
+#endif
+  {
+    if (step.get() == ::pressio::ode::first_step_value){
+      (*this).template compute_impl_bdf<ode::BDF1>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+    else{
+      (*this).template compute_impl_bdf<ode::BDF2>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+  }
+
 private:
   template <class OdeTag, class StencilStatesContainerType>
   void compute_impl_bdf(const state_type & predictedReducedState,
@@ -186,7 +224,10 @@ private:
 	 3. call the hypRedUpdater to handle the rest
       */
       // step 1
-      fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+      {
+	PRESSIO_PERF_ZONE("fom rhs");
+	fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+      }
       // step 2
       const auto & fomStateAt_n = fomStatesManager_(::pressio::ode::n());
       using fom_state_type = typename FomSystemType::state_type;
@@ -213,7 +254,10 @@ private:
 	 3. call the hypRedUpdater to handle the rest
       */
       // step 1
-      fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+      {
+	PRESSIO_PERF_ZONE("fom rhs");
+	fomSystem_.get().rhs(fomStateAt_np1, rhsEvaluationTime, R);
+      }
       // step 2
       const auto & fomStateAt_n = fomStatesManager_(::pressio::ode::n());
       const auto & fomStateAt_nm1 = fomStatesManager_(::pressio::ode::nMinusOne());
@@ -248,7 +292,10 @@ private:
 
       // first, store J*phi into J
       const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
-      fomSystem_.get().applyJacobian(fomStateAt_np1, phi, rhsEvaluationTime, J);
+      {
+	PRESSIO_PERF_ZONE("fom jacobian action");
+	fomSystem_.get().applyJacobian(fomStateAt_np1, phi, rhsEvaluationTime, J);
+      }
 
       using sc_t = typename ::pressio::Traits<
 	typename TrialSubspaceType::basis_matrix_type>::scalar_type;
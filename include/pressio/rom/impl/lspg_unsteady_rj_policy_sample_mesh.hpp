@@ -0,0 +1,247 @@
+
+#ifndef ROM_IMPL_LSPG_UNSTEADY_RJ_POLICY_SAMPLE_MESH_HPP_
+#define ROM_IMPL_LSPG_UNSTEADY_RJ_POLICY_SAMPLE_MESH_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+/*
+  masked lspg for a fom that can evaluate its operators
+  directly on the sample mesh, see masked_fom_sample_mesh_helpers.hpp.
+
+  This computes the same residual and jacobian as the mask decorator
+  applied to the default policy, i.e. for BDF1:
+
+    R = mask(y_n+1) - mask(y_n) - dt*f_s(y_n+1)
+    J = mask(phi) - dt*(df/dy)_s phi
+
+  where f_s and (df/dy)_s phi are computed by the fom on the sample mesh,
+  so that the full-size fom rhs and jacobian action are never computed.
+  Only the fom states need to be masked, and since the basis is constant
+  mask(phi) is computed once at construction.
+  The masked objects are created via createRhsAtSampleMesh when the fom
+  provides it, otherwise by masking a full-size rhs created temporarily.
+*/
+template <
+  class IndVarType,
+  class ReducedStateType,
+  class LspgResidualType,
+  class LspgJacobianType,
+  class TrialSubspaceType,
+  class FomSystemType,
+  class MaskerType
+  >
+class LspgUnsteadySampleMeshResidualJacobianPolicy
+{
+  using masked_states_type = std::array<LspgResidualType, 3>;
+
+  // gives access to the masked stencil states with the same
+  // interface as the fom states manager, so that we can reuse
+  // the discrete residual functions from ode
+  struct MaskedStencilStates{
+    const masked_states_type & data_;
+    const LspgResidualType & operator()(::pressio::ode::n) const{ return data_[1]; }
+    const LspgResidualType & operator()(::pressio::ode::nMinusOne) const{ return data_[2]; }
+  };
+
+public:
+  // required
+  using independent_variable_type = IndVarType;
+  using state_type    = ReducedStateType;
+  using residual_type = LspgResidualType;
+  using jacobian_type = LspgJacobianType;
+
+public:
+  LspgUnsteadySampleMeshResidualJacobianPolicy(const TrialSubspaceType & trialSubspace,
+					       const FomSystemType & fomSystem,
+					       LspgFomStatesManager<TrialSubspaceType> & fomStatesManager,
+					       const MaskerType & masker)
+    : trialSubspace_(trialSubspace),
+      fomSystem_(fomSystem),
+      fomStatesManager_(fomStatesManager),
+      masker_(masker),
+      maskedStates_{createResidual(), createResidual(), createResidual()},
+      maskedPhi_(createJacobian())
+  {
+    masker(trialSubspace.basisOfTranslatedSpace(), maskedPhi_);
+  }
+
+public:
+  state_type createState() const{
+    return trialSubspace_.get().createReducedState();
+  }
+
+  residual_type createResidual() const{
+    return create_masked_fom_rhs<residual_type>(fomSystem_.get(), masker_.get());
+  }
+
+  // masking the basis only allocates the sample mesh rows
+  jacobian_type createJacobian() const{
+    const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+    return masker_.get().createResultOfMaskActionOn(phi);
+  }
+
+  template <class StencilStatesContainerType, class StencilRhsContainerType>
+  void operator()(::pressio::ode::StepScheme odeSchemeName,
+		  const state_type & predictedReducedState,
+		  const StencilStatesContainerType & reducedStatesStencilManager,
+		  StencilRhsContainerType & fomRhsStencilManger,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  residual_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type *> Jo) const
+#else
+		  jacobian_type * Jo) const
+#endif
+  {
+
+    if (odeSchemeName == ::pressio::ode::StepScheme::BDF1){
+      (*this)(::pressio::ode::BDF1(), predictedReducedState, reducedStatesStencilManager,
+	      fomRhsStencilManger, rhsEvaluationTime, step, dt, R, Jo);
+    }
+
+    else if (odeSchemeName == ::pressio::ode::StepScheme::BDF2){
+      (*this)(::pressio::ode::BDF2(), predictedReducedState, reducedStatesStencilManager,
+	      fomRhsStencilManger, rhsEvaluationTime, step, dt, R, Jo);
+    }
+
+    else{
+      throw std::runtime_error("Invalid choice of StepScheme for sample mesh unsteady LSPG");
+    }
+  }
+
+  // same as above for a scheme known at compile time,
+  // used by the problems created with the scheme as template argument
+  template <class StencilStatesContainerType, class StencilRhsContainerType>
+  void operator()(::pressio::ode::BDF1,
+		  const state_type & predictedReducedState,
+		  const StencilStatesContainerType & reducedStatesStencilManager,
+		  StencilRhsContainerType & /*fomRhsStencilManger*/,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  residual_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type *> Jo) const
+#else
+		  jacobian_type * Jo) const
+#endif
+  {
+    (*this).template compute_impl_bdf<ode::BDF1>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+  }
+
+  template <class StencilStatesContainerType, class StencilRhsContainerType>
+  void operator()(::pressio::ode::BDF2,
+		  const state_type & predictedReducedState,
+		  const StencilStatesContainerType & reducedStatesStencilManager,
+		  StencilRhsContainerType & /*fomRhsStencilManger*/,
+		  const ::pressio::ode::StepEndAt<IndVarType> & rhsEvaluationTime,
+		  ::pressio::ode::StepCount step,
+		  const ::pressio::ode::StepSize<IndVarType> & dt,
+		  residual_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+		  std::optional<jacobian_type *> Jo) const
+#else
+		  jacobian_type * Jo) const
+#endif
+  {
+    if (step.get() == ::pressio::ode::first_step_value){
+      (*this).template compute_impl_bdf<ode::BDF1>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+    else{
+      (*this).template compute_impl_bdf<ode::BDF2>
+	(predictedReducedState, reducedStatesStencilManager,
+	 rhsEvaluationTime.get(), dt.get(), step.get(), R, Jo);
+    }
+  }
+
+private:
+  template <class OdeTag, class StencilStatesContainerType>
+  void compute_impl_bdf(const state_type & predictedReducedState,
+			const StencilStatesContainerType & reducedStatesStencilManager,
+			const IndVarType & rhsEvaluationTime,
+			const IndVarType & dt,
+			const typename ::pressio::ode::StepCount::value_type & step,
+			residual_type & R,
+#ifdef PRESSIO_ENABLE_CXX17
+			std::optional<jacobian_type *> & Jo) const
+#else
+		        jacobian_type * Jo) const
+#endif
+  {
+    static_assert( std::is_same<OdeTag, ode::BDF1>::value ||
+		   std::is_same<OdeTag, ode::BDF2>::value, "");
+
+    // same logic as the default policy for the fom states,
+    // but here we also need to keep the masked ones in sync
+    auto & fomStates = fomStatesManager_.get();
+    fomStates.reconstructAtWithoutStencilUpdate(predictedReducedState,
+						::pressio::ode::nPlusOne());
+    const auto & fomStateAt_np1 = fomStates(::pressio::ode::nPlusOne());
+    masker_(fomStateAt_np1, maskedStates_[0]);
+
+    if (stepTracker_ != step){
+      const auto & lspgStateAt_n = reducedStatesStencilManager(::pressio::ode::n());
+      fomStates.reconstructAtWithStencilUpdate(lspgStateAt_n, ::pressio::ode::n());
+      masker_(fomStates(::pressio::ode::n()), maskedStates_[1]);
+      if (fomStates.size() >= 3){
+	masker_(fomStates(::pressio::ode::nMinusOne()), maskedStates_[2]);
+      }
+      stepTracker_ = step;
+    }
+
+    {
+      PRESSIO_PERF_ZONE("fom rhs");
+      fomSystem_.get().rhsAtSampleMesh(fomStateAt_np1, rhsEvaluationTime, R);
+    }
+    ::pressio::ode::impl::discrete_residual(OdeTag(), maskedStates_[0], R,
+					    MaskedStencilStates{maskedStates_}, dt);
+
+    if (Jo){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & J = *Jo.value();
+#else
+      auto & J = *Jo;
+#endif
+
+      const auto & phi = trialSubspace_.get().basisOfTranslatedSpace();
+      {
+	PRESSIO_PERF_ZONE("fom jacobian action");
+	fomSystem_.get().applyJacobianAtSampleMesh(fomStateAt_np1, phi, rhsEvaluationTime, J);
+      }
+
+      using basis_sc_t = typename ::pressio::Traits<
+	typename TrialSubspaceType::basis_matrix_type>::scalar_type;
+      const auto one = ::pressio::utils::Constants<basis_sc_t>::one();
+      IndVarType factor = {};
+      if (std::is_same<OdeTag, ode::BDF1>::value){
+	factor = dt*::pressio::ode::constants::bdf1<IndVarType>::c_f_;
+      }
+      else{
+	factor = dt*::pressio::ode::constants::bdf2<IndVarType>::c_f_;
+      }
+      ::pressio::ops::update(J, factor, maskedPhi_, one);
+    }
+  }
+
+private:
+  using raw_step_type = typename ::pressio::ode::StepCount::value_type;
+  static_assert(std::is_signed<raw_step_type>::value, "");
+  mutable raw_step_type stepTracker_ = -1;
+
+  std::reference_wrapper<const TrialSubspaceType> trialSubspace_;
+  std::reference_wrapper<const FomSystemType> fomSystem_;
+  std::reference_wrapper<LspgFomStatesManager<TrialSubspaceType>> fomStatesManager_;
+  std::reference_wrapper<const MaskerType> masker_;
+  // masked fom states at n+1, n, n-1
+  mutable masked_states_type maskedStates_;
+  jacobian_type maskedPhi_;
+};
+
+}}}
+#endif  // ROM_IMPL_LSPG_UNSTEADY_RJ_POLICY_SAMPLE_MESH_HPP_
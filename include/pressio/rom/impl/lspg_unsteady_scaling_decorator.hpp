@@ -83,8 +83,10 @@ public:
   {}
 
 public:
-  template <class StencilStatesContainerType, class StencilRhsContainerType>
-  void operator()(::pressio::ode::StepScheme odeSchemeName,
+  // SchemeType is either the StepScheme value or, for a scheme
+  // known at compile time, its tag: both are forwarded as they are
+  template <class SchemeType, class StencilStatesContainerType, class StencilRhsContainerType>
+  void operator()(SchemeType odeSchemeName,
 		  const state_type & predictedReducedState,
 		  const StencilStatesContainerType & reducedStatesStencilManager,
 		  StencilRhsContainerType & fomRhsStencilManger,
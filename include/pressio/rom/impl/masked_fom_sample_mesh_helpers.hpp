@@ -0,0 +1,127 @@
+
+#ifndef ROM_IMPL_MASKED_FOM_SAMPLE_MESH_HELPERS_HPP_
+#define ROM_IMPL_MASKED_FOM_SAMPLE_MESH_HELPERS_HPP_
+
+namespace pressio{ namespace rom{ namespace impl{
+
+/*
+  a masked problem normally evaluates the fom operators on the full mesh
+  and then applies the masker to extract the sample mesh entries.
+  If the fom system also provides:
+
+    void rhsAtSampleMesh(const state_type &, const time_type &, masked_rhs &) const;
+
+    void applyJacobianAtSampleMesh(const state_type &, const basis_matrix_type &,
+                                   const time_type &, masked_jac_action &) const;
+
+  where the result objects are those created by the masker, these are
+  called directly and the full-size operators are never computed nor stored.
+
+  The masked result objects are created by the fom if it provides:
+
+    masked_rhs createRhsAtSampleMesh() const;
+
+    masked_jac_action createResultOfJacobianActionAtSampleMeshOn(const basis_matrix_type &) const;
+
+  Otherwise they are created by masking a full-size object,
+  which is only a temporary used at construction.
+*/
+template <class FomSystemType, class MaskedRhsType>
+using fom_has_rhs_at_sample_mesh =
+  has_const_rhs_at_sample_mesh_method_accept_state_indvar_result_return_void<
+    FomSystemType, typename FomSystemType::state_type,
+    typename FomSystemType::time_type, MaskedRhsType>;
+
+template <class FomSystemType, class TrialSubspaceType, class MaskedJacActionType>
+using fom_has_apply_jacobian_at_sample_mesh =
+  has_const_apply_jacobian_at_sample_mesh_method_accept_state_operand_time_result_return_void<
+    FomSystemType, typename FomSystemType::state_type,
+    typename TrialSubspaceType::basis_matrix_type,
+    typename FomSystemType::time_type, MaskedJacActionType>;
+
+template<class MaskedRhsType, class FomSystemType, class MaskerType>
+mpl::enable_if_t<
+  has_const_create_rhs_at_sample_mesh_method_return_result<
+    FomSystemType, MaskedRhsType>::value,
+  MaskedRhsType
+  >
+create_masked_fom_rhs(const FomSystemType & fomSystem, const MaskerType & /*masker*/)
+{
+  return fomSystem.createRhsAtSampleMesh();
+}
+
+template<class MaskedRhsType, class FomSystemType, class MaskerType>
+mpl::enable_if_t<
+  !has_const_create_rhs_at_sample_mesh_method_return_result<
+    FomSystemType, MaskedRhsType>::value,
+  MaskedRhsType
+  >
+create_masked_fom_rhs(const FomSystemType & fomSystem, const MaskerType & masker)
+{
+  return masker.createResultOfMaskActionOn(fomSystem.createRhs());
+}
+
+template<class MaskedJacActionType, class FomSystemType, class MaskerType, class BasisType>
+mpl::enable_if_t<
+  has_const_create_result_of_jacobian_action_at_sample_mesh_on<
+    FomSystemType, BasisType, MaskedJacActionType>::value,
+  MaskedJacActionType
+  >
+create_masked_fom_jacobian_action(const FomSystemType & fomSystem,
+				  const MaskerType & /*masker*/,
+				  const BasisType & basis)
+{
+  return fomSystem.createResultOfJacobianActionAtSampleMeshOn(basis);
+}
+
+template<class MaskedJacActionType, class FomSystemType, class MaskerType, class BasisType>
+mpl::enable_if_t<
+  !has_const_create_result_of_jacobian_action_at_sample_mesh_on<
+    FomSystemType, BasisType, MaskedJacActionType>::value,
+  MaskedJacActionType
+  >
+create_masked_fom_jacobian_action(const FomSystemType & fomSystem,
+				  const MaskerType & masker,
+				  const BasisType & basis)
+{
+  return masker.createResultOfMaskActionOn(fomSystem.createResultOfJacobianActionOn(basis));
+}
+
+/*
+  storage for an unmasked (full-size) fom operator:
+  it is only allocated if the operator cannot be evaluated
+  directly on the sample mesh, i.e. if IsNeeded == true
+*/
+template <class T, bool IsNeeded>
+class UnmaskedFomOperatorStorage
+{
+  T value_;
+
+public:
+  template<
+    class CreatorType,
+    mpl::enable_if_t<
+      !std::is_same<mpl::remove_cvref_t<CreatorType>, UnmaskedFomOperatorStorage>::value, int
+      > = 0
+    >
+  explicit UnmaskedFomOperatorStorage(CreatorType && creator)
+    : value_(creator()){}
+
+  T & get(){ return value_; }
+};
+
+template <class T>
+class UnmaskedFomOperatorStorage<T, false>
+{
+public:
+  template<
+    class CreatorType,
+    mpl::enable_if_t<
+      !std::is_same<mpl::remove_cvref_t<CreatorType>, UnmaskedFomOperatorStorage>::value, int
+      > = 0
+    >
+  explicit UnmaskedFomOperatorStorage(CreatorType && /*unused*/){}
+};
+
+}}} // end pressio::rom::impl
+#endif  // ROM_IMPL_MASKED_FOM_SAMPLE_MESH_HELPERS_HPP_
@@ -4,6 +4,8 @@
 
 #include "./impl/lspg_steady_system_default.hpp"
 #include "./impl/lspg_steady_system_masked.hpp"
+#include "./impl/galerkin_steady_system_reduced_operators.hpp"
+#include "./polynomial_reduced_operators.hpp"
 
 namespace pressio{ namespace rom{ namespace lspg{
 
@@ -110,5 +112,19 @@ auto create_steady_problem(const TrialSubspaceType & trialSpace,  /*(4)*/
 
 } // end experimental
 
+// -------------------------------------------------------------
+// precomputed reduced operators
+// the normal equations of a linear fom are a square reduced
+// system, so this is solved like the Galerkin one
+// -------------------------------------------------------------
+template<class ReducedStateType>
+auto create_steady_problem(const LspgReducedOperators<ReducedStateType> & reducedOperators) /*(5)*/
+{
+
+  using reduced_operators_t = LspgReducedOperators<ReducedStateType>;
+  using system_type = impl::GalerkinSteadyReducedOperatorsSystem<reduced_operators_t>;
+  return system_type(reducedOperators);
+}
+
 }}} // end pressio::rom::lspg
 #endif  // ROM_LSPG_STEADY_HPP_
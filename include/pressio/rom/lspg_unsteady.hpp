@@ -6,6 +6,8 @@
 #include "./impl/lspg_unsteady_fom_states_manager.hpp"
 #include "./impl/lspg_unsteady_rj_policy_default.hpp"
 #include "./impl/lspg_unsteady_rj_policy_hypred.hpp"
+#include "./impl/masked_fom_sample_mesh_helpers.hpp"
+#include "./impl/lspg_unsteady_rj_policy_sample_mesh.hpp"
 #include "./impl/lspg_unsteady_fully_discrete_system.hpp"
 #include "./impl/lspg_unsteady_mask_decorator.hpp"
 #include "./impl/lspg_unsteady_scaling_decorator.hpp"
@@ -17,14 +19,20 @@ namespace pressio{ namespace rom{ namespace lspg{
 // default
 // -------------------------------------------------------------
 template<
+  class SchemeType,
   class TrialSubspaceType,
-  class FomSystemType>
+  class FomSystemType
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t< impl::is_lspg_scheme<SchemeType>::value, int > = 0
+#endif
+  >
 #ifdef PRESSIO_ENABLE_CXX20
-requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+requires impl::LspgScheme<SchemeType>
+&& PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
 && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
 && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #endif
-auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(1)*/
+auto create_unsteady_problem(SchemeType schemeName,    /*(1)*/
 			     const TrialSubspaceType & trialSpace,
 			     const FomSystemType & fomSystem)
 {
@@ -47,7 +55,8 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(1)*/
     lspg_residual_type, lspg_jacobian_type,
     TrialSubspaceType, FomSystemType>;
 
-  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<TrialSubspaceType, rj_policy_type>;
+  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<
+    TrialSubspaceType, rj_policy_type, impl::scheme_tag_of_t<SchemeType>>;
   return return_type(schemeName, trialSpace, fomSystem);
 }
 
@@ -56,17 +65,19 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(1)*/
 // -------------------------------------------------------------
 
 #ifdef PRESSIO_ENABLE_CXX20
-template<class TrialSubspaceType, class FomSystemType, class MaskerType>
-  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+template<class SchemeType, class TrialSubspaceType, class FomSystemType, class MaskerType>
+  requires impl::LspgScheme<SchemeType>
+  && PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
   && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
   && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
   && MaskableWith<typename FomSystemType::rhs_type, MaskerType>
   && MaskableWith<impl::fom_jac_action_on_trial_space_t<FomSystemType, TrialSubspaceType>, MaskerType>
 #else
 template<
-  class TrialSubspaceType, class FomSystemType, class MaskerType,
+  class SchemeType, class TrialSubspaceType, class FomSystemType, class MaskerType,
   mpl::enable_if_t<
-    PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+    impl::is_lspg_scheme<SchemeType>::value
+    && PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
     && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
     && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
     && MaskableWith<typename FomSystemType::rhs_type, MaskerType>::value
@@ -74,7 +85,7 @@ template<
     , int> = 0
   >
 #endif
-auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(2)*/
+auto create_unsteady_problem(SchemeType schemeName,    /*(2)*/
 			     const TrialSubspaceType & trialSpace,
 			     const FomSystemType & fomSystem,
 			     const MaskerType & masker)
@@ -94,7 +105,7 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(2)*/
     decltype(std::declval<MaskerType const>().createResultOfMaskActionOn
 	     (std::declval<lspg_unmasked_jacobian_type const &>()));
 
-  using rj_policy_type =
+  using decorated_rj_policy_type =
     impl::LspgMaskDecorator<
       MaskerType, lspg_residual_type, lspg_jacobian_type,
       impl::LspgUnsteadyResidualJacobianPolicy<
@@ -104,7 +115,22 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(2)*/
 	>
     >;
 
-  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<TrialSubspaceType, rj_policy_type>;
+  // if the fom can evaluate its operators on the sample mesh,
+  // use them directly to avoid computing the full-size ones
+  using sample_mesh_rj_policy_type =
+    impl::LspgUnsteadySampleMeshResidualJacobianPolicy<
+      ind_var_type, reduced_state_type,
+      lspg_residual_type, lspg_jacobian_type,
+      TrialSubspaceType, FomSystemType, MaskerType>;
+
+  using rj_policy_type = mpl::conditional_t<
+    impl::fom_has_rhs_at_sample_mesh<FomSystemType, lspg_residual_type>::value
+    && impl::fom_has_apply_jacobian_at_sample_mesh<
+      FomSystemType, TrialSubspaceType, lspg_jacobian_type>::value,
+    sample_mesh_rj_policy_type, decorated_rj_policy_type>;
+
+  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<
+    TrialSubspaceType, rj_policy_type, impl::scheme_tag_of_t<SchemeType>>;
   return return_type(schemeName, trialSpace, fomSystem, masker);
 }
 
@@ -113,21 +139,23 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(2)*/
 // -------------------------------------------------------------
 
 #ifdef PRESSIO_ENABLE_CXX20
-template<class TrialSubspaceType, class FomSystemType, class HypRedUpdaterType>
-  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+template<class SchemeType, class TrialSubspaceType, class FomSystemType, class HypRedUpdaterType>
+  requires impl::LspgScheme<SchemeType>
+  && PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
   && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
   && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #else
-template<class TrialSubspaceType, class FomSystemType, class HypRedUpdaterType,
+template<class SchemeType, class TrialSubspaceType, class FomSystemType, class HypRedUpdaterType,
   mpl::enable_if_t<
-    PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+    impl::is_lspg_scheme<SchemeType>::value
+    && PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
     && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
     && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
     && !MaskableWith<typename FomSystemType::rhs_type, HypRedUpdaterType>::value
     , int> = 0
   >
 #endif
-auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(3)*/
+auto create_unsteady_problem(SchemeType schemeName,    /*(3)*/
 			     const TrialSubspaceType & trialSpace,
 			     const FomSystemType & fomSystem,
 			     const HypRedUpdaterType & hypRedUpdater)
@@ -148,7 +176,8 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(3)*/
     lspg_residual_type, lspg_jacobian_type,
     TrialSubspaceType, FomSystemType, HypRedUpdaterType>;
 
-  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<TrialSubspaceType, rj_policy_type>;
+  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<
+    TrialSubspaceType, rj_policy_type, impl::scheme_tag_of_t<SchemeType>>;
   return return_type(schemeName, trialSpace, fomSystem, hypRedUpdater);
 }
 
@@ -160,15 +189,21 @@ namespace experimental{
 // -------------------------------------------------------------
 
 template<
+  class SchemeType,
   class TrialSubspaceType,
   class FomSystemType,
-  class ScalingOperatorType>
+  class ScalingOperatorType
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t< impl::is_lspg_scheme<SchemeType>::value, int > = 0
+#endif
+  >
 #ifdef PRESSIO_ENABLE_CXX20
-requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+requires impl::LspgScheme<SchemeType>
+&& PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
 && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
 && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #endif
-auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(4)*/
+auto create_unsteady_problem(SchemeType schemeName,    /*(4)*/
 			     const TrialSubspaceType & trialSpace,
 			     const FomSystemType & fomSystem,
 			     const ScalingOperatorType & scaler)
@@ -193,7 +228,8 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(4)*/
 	>
     >;
 
-  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<TrialSubspaceType, rj_policy_type>;
+  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<
+    TrialSubspaceType, rj_policy_type, impl::scheme_tag_of_t<SchemeType>>;
   return return_type(schemeName, trialSpace, fomSystem, scaler);
 }
 
@@ -202,16 +238,22 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(4)*/
 // -------------------------------------------------------------
 
 template<
+  class SchemeType,
   class TrialSubspaceType,
   class FomSystemType,
   class HypRedUpdaterType,
-  class ScalingOperatorType>
+  class ScalingOperatorType
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t< impl::is_lspg_scheme<SchemeType>::value, int > = 0
+#endif
+  >
 #ifdef PRESSIO_ENABLE_CXX20
-requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+requires impl::LspgScheme<SchemeType>
+&& PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
 && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
 && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
 #endif
-auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(5)*/
+auto create_unsteady_problem(SchemeType schemeName,    /*(5)*/
 			     const TrialSubspaceType & trialSpace,
 			     const FomSystemType & fomSystem,
 			     const HypRedUpdaterType & hypRedUpdater,
@@ -237,11 +279,35 @@ auto create_unsteady_problem(::pressio::ode::StepScheme schemeName,    /*(5)*/
 	>
     >;
 
-  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<TrialSubspaceType, rj_policy_type>;
+  using return_type = impl::LspgUnsteadyProblemSemiDiscreteAPI<
+    TrialSubspaceType, rj_policy_type, impl::scheme_tag_of_t<SchemeType>>;
   return return_type(schemeName, trialSpace, fomSystem, scaler, hypRedUpdater);
 }
 
 
+// -------------------------------------------------------------
+// scheme known at compile time, passed as template argument, e.g.
+// create_unsteady_problem<ode::BDF2>(trialSpace, fomSystem, ...)
+// -------------------------------------------------------------
+
+template<
+  class SchemeTag,
+  class ...Args
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t<
+      impl::is_lspg_scheme<SchemeTag>::value
+      && !std::is_same<SchemeTag, ::pressio::ode::StepScheme>::value, int > = 0
+#endif
+  >
+#ifdef PRESSIO_ENABLE_CXX20
+requires impl::LspgScheme<SchemeTag>
+&& (!std::same_as<SchemeTag, ::pressio::ode::StepScheme>)
+#endif
+auto create_unsteady_problem(Args && ... args)
+{
+  return create_unsteady_problem(SchemeTag(), std::forward<Args>(args)...);
+}
+
 } //end namespace experimental
 
 
@@ -281,5 +347,28 @@ auto create_unsteady_problem(const TrialSubspaceType & trialSpace,     /*(6)*/
   return return_type(trialSpace, fomSystem);
 }
 
+// -------------------------------------------------------------
+// scheme known at compile time, passed as template argument, e.g.
+// create_unsteady_problem<ode::BDF2>(trialSpace, fomSystem, ...)
+// -------------------------------------------------------------
+
+template<
+  class SchemeTag,
+  class ...Args
+#if not defined PRESSIO_ENABLE_CXX20
+  , mpl::enable_if_t<
+      impl::is_lspg_scheme<SchemeTag>::value
+      && !std::is_same<SchemeTag, ::pressio::ode::StepScheme>::value, int > = 0
+#endif
+  >
+#ifdef PRESSIO_ENABLE_CXX20
+requires impl::LspgScheme<SchemeTag>
+&& (!std::same_as<SchemeTag, ::pressio::ode::StepScheme>)
+#endif
+auto create_unsteady_problem(Args && ... args)
+{
+  return create_unsteady_problem(SchemeTag(), std::forward<Args>(args)...);
+}
+
 }}} // end pressio::rom::lspg
 #endif  // ROM_LSPG_UNSTEADY_HPP_
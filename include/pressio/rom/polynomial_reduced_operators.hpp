@@ -0,0 +1,359 @@
+
+#ifndef ROM_POLYNOMIAL_REDUCED_OPERATORS_HPP_
+#define ROM_POLYNOMIAL_REDUCED_OPERATORS_HPP_
+
+namespace pressio{ namespace rom{
+
+enum class FomPolynomialDegree{ Linear, Quadratic };
+
+/*
+  precomputed reduced operators of a fom that is (at most) quadratic
+  in the reduced coordinates x, i.e. a reduced residual or rhs of the form:
+
+    r(x) = b + A x + q(x),   q_i(x) = x^T H_i x
+
+  - b is the reduced constant term (n)
+  - A is the reduced linear operator (n x n)
+  - H_i, i=0,...,n-1, are the slices of the reduced third-order tensor
+
+  and its jacobian:
+
+    J(x) = A + [ x^T (H_i + H_i^T) ]_i
+
+  Once assembled, evaluating r and J only involves reduced-size data,
+  so the online cost does not depend on the size of the fom.
+  Only the symmetric part of each H_i matters, so that is what is stored.
+
+  The same math describes the Galerkin system and the LSPG normal
+  equations, but the two are not interchangeable, so KindTag records
+  which one the operators represent: use GalerkinReducedOperators or
+  LspgReducedOperators, each accepted only by its own create functions.
+*/
+struct GalerkinReducedOperatorsTag{};
+struct LspgReducedOperatorsTag{};
+
+template<class ReducedStateType, class KindTag, class = void>
+class PolynomialReducedOperators;
+
+template<class ReducedStateType>
+using GalerkinReducedOperators =
+  PolynomialReducedOperators<ReducedStateType, GalerkinReducedOperatorsTag>;
+
+template<class ReducedStateType>
+using LspgReducedOperators =
+  PolynomialReducedOperators<ReducedStateType, LspgReducedOperatorsTag>;
+
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+template<class ReducedStateType, class KindTag>
+class PolynomialReducedOperators<
+  ReducedStateType, KindTag,
+  mpl::enable_if_t< ::pressio::is_vector_eigen<ReducedStateType>::value >
+  >
+{
+public:
+  using kind_tag = KindTag;
+  using reduced_state_type  = ReducedStateType;
+  using scalar_type = typename ::pressio::Traits<ReducedStateType>::scalar_type;
+  using reduced_vector_type = ReducedStateType;
+  using reduced_matrix_type = ::pressio::impl::eigen_square_matrix_for_vector_t<ReducedStateType>;
+
+  PolynomialReducedOperators(reduced_matrix_type linearTerm,
+			     reduced_vector_type constantTerm)
+    : A_(std::move(linearTerm)),
+      b_(std::move(constantTerm)),
+      tmp_(b_)
+  {
+    if (A_.rows() != b_.size() || A_.cols() != b_.size()){
+      throw std::runtime_error("PolynomialReducedOperators: the linear term must be n x n, with n the size of the constant term");
+    }
+  }
+
+  PolynomialReducedOperators(reduced_matrix_type linearTerm,
+			     reduced_vector_type constantTerm,
+			     const std::vector<reduced_matrix_type> & quadraticTerm)
+    : PolynomialReducedOperators(std::move(linearTerm), std::move(constantTerm))
+  {
+    if (quadraticTerm.size() != (std::size_t) b_.size()){
+      throw std::runtime_error("PolynomialReducedOperators: the quadratic term must have one n x n slice per reduced equation");
+    }
+    for (const auto & Hi : quadraticTerm){
+      if (Hi.rows() != b_.size() || Hi.cols() != b_.size()){
+	throw std::runtime_error("PolynomialReducedOperators: each slice of the quadratic term must be n x n");
+      }
+      symH_.emplace_back(Hi + Hi.transpose());
+    }
+  }
+
+  std::size_t dimension() const{ return b_.size(); }
+  bool hasQuadraticTerm() const{ return !symH_.empty(); }
+
+  const reduced_matrix_type & linearTerm() const{ return A_; }
+  const reduced_vector_type & constantTerm() const{ return b_; }
+
+  reduced_state_type createReducedState() const{
+    reduced_state_type result(b_);
+    result.setZero();
+    return result;
+  }
+
+  reduced_matrix_type createReducedMatrix() const{
+    reduced_matrix_type result(A_);
+    result.setZero();
+    return result;
+  }
+
+  // r = b + A x + q(x)
+  template<class ResultType>
+  void evaluate(const reduced_state_type & x, ResultType & r) const
+  {
+    r = b_;
+    r.noalias() += A_ * x;
+    for (std::size_t i=0; i<symH_.size(); ++i){
+      tmp_.noalias() = symH_[i] * x;
+      r(i) += static_cast<scalar_type>(0.5) * x.dot(tmp_);
+    }
+  }
+
+  // r = b + A x + q(x), J = A + dq/dx
+  template<class ResultType, class JacobianType>
+  void evaluate(const reduced_state_type & x, ResultType & r, JacobianType & J) const
+  {
+    r = b_;
+    r.noalias() += A_ * x;
+    J = A_;
+    for (std::size_t i=0; i<symH_.size(); ++i){
+      tmp_.noalias() = symH_[i] * x;
+      r(i) += static_cast<scalar_type>(0.5) * x.dot(tmp_);
+      J.row(i) += tmp_.transpose();
+    }
+  }
+
+private:
+  reduced_matrix_type A_;
+  reduced_vector_type b_;
+  std::vector<reduced_matrix_type> symH_;
+  mutable reduced_vector_type tmp_;
+};
+#endif
+
+namespace impl{
+
+/*
+  assemble the reduced operators of a fom that is linear or quadratic
+  in the state, from fom evaluations only:
+  with s the affine shift, phi the basis and f the fom residual/rhs,
+
+    b   = phi^T f(s)
+    A   = phi^T df/dx(s) phi
+    H_i(j,k) = 1/2 phi_i^T (df/dx(s + phi_k) - df/dx(s)) phi_j
+
+  the latter being exact for a quadratic fom since df/dx is then
+  affine in the state. This needs dimension()+1 jacobian actions.
+  evalFom(fomState, fomResult, fomJacAction) must evaluate f and df/dx*phi.
+*/
+template<class TrialSubspaceType, class FomVecType, class FomJacActionType, class EvalFomType>
+auto assemble_galerkin_polynomial_reduced_operators(const TrialSubspaceType & trialSpace,
+						    FomPolynomialDegree degree,
+						    FomVecType & fomResult,
+						    FomJacActionType & fomJacAction,
+						    EvalFomType && evalFom)
+{
+  using reduced_state_type = typename TrialSubspaceType::reduced_state_type;
+  using return_type = GalerkinReducedOperators<reduced_state_type>;
+  using reduced_matrix_type = typename return_type::reduced_matrix_type;
+  using scalar_type = typename return_type::scalar_type;
+  constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+  constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+
+  const auto & phi = trialSpace.basisOfTranslatedSpace();
+  auto fomState = trialSpace.createFullState();
+  auto reducedState = trialSpace.createReducedState();
+  const auto n = trialSpace.dimension();
+
+  reduced_state_type b(reducedState);
+  reduced_matrix_type A(n, n);
+  trialSpace.mapFromReducedState(reducedState, fomState);
+  evalFom(fomState, fomResult, fomJacAction);
+  ::pressio::ops::product(::pressio::transpose(), one, phi, fomResult, zero, b);
+  ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
+			  one, phi, fomJacAction, zero, A);
+
+  if (degree == FomPolynomialDegree::Linear){
+    return return_type(std::move(A), std::move(b));
+  }
+
+  // D[k] = phi^T (df/dx(s + phi_k) - df/dx(s)) phi
+  std::vector<reduced_matrix_type> D(n, reduced_matrix_type(n, n));
+  for (std::size_t k=0; k<n; ++k){
+    reducedState(k) = one;
+    trialSpace.mapFromReducedState(reducedState, fomState);
+    evalFom(fomState, fomResult, fomJacAction);
+    ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
+			    one, phi, fomJacAction, zero, D[k]);
+    D[k] -= A;
+    reducedState(k) = zero;
+  }
+
+  std::vector<reduced_matrix_type> H(n, reduced_matrix_type(n, n));
+  const auto quarter = static_cast<scalar_type>(0.25);
+  for (std::size_t i=0; i<n; ++i){
+    for (std::size_t j=0; j<n; ++j){
+      for (std::size_t k=0; k<n; ++k){
+	H[i](j,k) = quarter*(D[k](i,j) + D[j](i,k));
+      }
+    }
+  }
+  return return_type(std::move(A), std::move(b), H);
+}
+} // end namespace impl
+
+namespace galerkin{
+
+/*
+  offline: assemble the Galerkin reduced operators of a steady fom
+  that is linear (affine) or quadratic in the state
+*/
+#ifdef PRESSIO_ENABLE_CXX20
+template<class TrialSubspaceType, class FomSystemType>
+  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+  && RealValuedSteadyFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
+  && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
+#else
+template<
+  class TrialSubspaceType, class FomSystemType,
+  mpl::enable_if_t<
+    PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+    && RealValuedSteadyFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
+    && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
+    , int > = 0
+  >
+#endif
+auto create_reduced_operators(const TrialSubspaceType & trialSpace,   /*(1)*/
+			      const FomSystemType & fomSystem,
+			      FomPolynomialDegree degree = FomPolynomialDegree::Linear)
+{
+  const auto & phi = trialSpace.basisOfTranslatedSpace();
+  auto fomResidual = fomSystem.createResidual();
+  auto fomJacAction = fomSystem.createResultOfJacobianActionOn(phi);
+  using jac_action_type = decltype(fomJacAction);
+  return impl::assemble_galerkin_polynomial_reduced_operators
+    (trialSpace, degree, fomResidual, fomJacAction,
+     [&fomSystem, &phi](const typename FomSystemType::state_type & fomState,
+			typename FomSystemType::residual_type & r,
+			jac_action_type & jacAction)
+     {
+#ifdef PRESSIO_ENABLE_CXX17
+       fomSystem.residualAndJacobianAction(fomState, r, phi,
+					   std::optional<jac_action_type *>(&jacAction));
+#else
+       fomSystem.residualAndJacobianAction(fomState, r, phi, &jacAction);
+#endif
+     });
+}
+
+/*
+  offline: assemble the Galerkin reduced operators of a semi-discrete fom
+  that is linear (affine) or quadratic in the state.
+  The fom must be autonomous, it is evaluated at evaluationTime.
+*/
+#ifdef PRESSIO_ENABLE_CXX20
+template<class TrialSubspaceType, class FomSystemType>
+  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+  && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
+  && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
+#else
+template<
+  class TrialSubspaceType, class FomSystemType,
+  mpl::enable_if_t<
+    PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+    && RealValuedSemiDiscreteFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
+    && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
+    , int > = 0
+  >
+#endif
+auto create_reduced_operators(const TrialSubspaceType & trialSpace,   /*(2)*/
+			      const FomSystemType & fomSystem,
+			      const typename FomSystemType::time_type & evaluationTime,
+			      FomPolynomialDegree degree = FomPolynomialDegree::Linear)
+{
+  const auto & phi = trialSpace.basisOfTranslatedSpace();
+  auto fomRhs = fomSystem.createRhs();
+  auto fomJacAction = fomSystem.createResultOfJacobianActionOn(phi);
+  using jac_action_type = decltype(fomJacAction);
+  return impl::assemble_galerkin_polynomial_reduced_operators
+    (trialSpace, degree, fomRhs, fomJacAction,
+     [&fomSystem, &phi, evaluationTime](const typename FomSystemType::state_type & fomState,
+					typename FomSystemType::rhs_type & f,
+					jac_action_type & jacAction)
+     {
+       fomSystem.rhs(fomState, evaluationTime, f);
+       fomSystem.applyJacobian(fomState, phi, evaluationTime, jacAction);
+     });
+}
+} // end namespace galerkin
+
+namespace lspg{
+
+/*
+  offline: assemble the LSPG reduced operators of a steady fom that
+  is linear (affine) in the state, r(x) = r(s) + J phi x, for which
+  the LSPG solution satisfies the normal equations:
+
+    (J phi)^T (J phi) x + (J phi)^T r(s) = 0
+
+  so these are precomputed and solved online as a reduced square system.
+  A quadratic fom does not lead to a quadratic reduced system, so it is
+  not supported here.
+*/
+#ifdef PRESSIO_ENABLE_CXX20
+template<class TrialSubspaceType, class FomSystemType>
+  requires PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>
+  && RealValuedSteadyFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>
+  && std::same_as<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>
+#else
+template<
+  class TrialSubspaceType, class FomSystemType,
+  mpl::enable_if_t<
+    PossiblyAffineRealValuedTrialColumnSubspace<TrialSubspaceType>::value
+    && RealValuedSteadyFomWithJacobianAction<FomSystemType, typename TrialSubspaceType::basis_matrix_type>::value
+    && std::is_same<typename TrialSubspaceType::full_state_type, typename FomSystemType::state_type>::value
+    , int > = 0
+  >
+#endif
+auto create_reduced_operators(const TrialSubspaceType & trialSpace,
+			      const FomSystemType & fomSystem)
+{
+  using reduced_state_type = typename TrialSubspaceType::reduced_state_type;
+  using return_type = LspgReducedOperators<reduced_state_type>;
+  using reduced_matrix_type = typename return_type::reduced_matrix_type;
+  using scalar_type = typename return_type::scalar_type;
+  constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
+  constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
+
+  const auto & phi = trialSpace.basisOfTranslatedSpace();
+  auto fomState = trialSpace.createFullState();
+  auto fomResidual = fomSystem.createResidual();
+  auto fomJacAction = fomSystem.createResultOfJacobianActionOn(phi);
+  using jac_action_type = decltype(fomJacAction);
+
+  auto reducedState = trialSpace.createReducedState();
+  trialSpace.mapFromReducedState(reducedState, fomState);
+#ifdef PRESSIO_ENABLE_CXX17
+  fomSystem.residualAndJacobianAction(fomState, fomResidual, phi,
+				      std::optional<jac_action_type *>(&fomJacAction));
+#else
+  fomSystem.residualAndJacobianAction(fomState, fomResidual, phi, &fomJacAction);
+#endif
+
+  const auto n = trialSpace.dimension();
+  reduced_state_type b(reducedState);
+  reduced_matrix_type A(n, n);
+  ::pressio::ops::product(::pressio::transpose(), one, fomJacAction, fomResidual, zero, b);
+  ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
+			  one, fomJacAction, zero, A);
+  return return_type(std::move(A), std::move(b));
+}
+} // end namespace lspg
+
+}} // end pressio::rom
+#endif  // ROM_POLYNOMIAL_REDUCED_OPERATORS_HPP_
@@ -268,6 +268,100 @@ struct has_const_rhs_method_accept_state_indvar_result_return_void<
       >::value
     >
   > : std::true_type{};
+// ---------------------------------------------------------------
+
+template <class T, class StateType, class IndVarType, class RhsType, class = void>
+struct has_const_rhs_at_sample_mesh_method_accept_state_indvar_result_return_void
+  : std::false_type{};
+
+template <class T, class StateType, class IndVarType, class RhsType>
+struct has_const_rhs_at_sample_mesh_method_accept_state_indvar_result_return_void<
+  T, StateType, IndVarType, RhsType,
+  ::pressio::mpl::enable_if_t<
+    std::is_void<
+      decltype(
+	       std::declval<T const>().rhsAtSampleMesh(
+					  std::declval<StateType const&>(),
+					  std::declval<IndVarType const &>(),
+					  std::declval<RhsType &>()
+					  )
+	   )
+      >::value
+    >
+  > : std::true_type{};
+// ---------------------------------------------------------------
+
+template <
+  class T,
+  class StateType,
+  class OperandType,
+  class TimeType,
+  class ResultType,
+  class = void
+  >
+struct has_const_apply_jacobian_at_sample_mesh_method_accept_state_operand_time_result_return_void
+  : std::false_type{};
+
+template <
+  class T,
+  class StateType,
+  class OperandType,
+  class TimeType,
+  class ResultType
+  >
+struct has_const_apply_jacobian_at_sample_mesh_method_accept_state_operand_time_result_return_void<
+  T, StateType, OperandType, TimeType, ResultType,
+  ::pressio::mpl::void_t<
+    decltype
+    (
+     std::declval<T const>().applyJacobianAtSampleMesh
+     (
+      std::declval<StateType const&>(),
+      std::declval<OperandType const&>(),
+      std::declval<TimeType const &>(),
+      std::declval<ResultType &>()
+      )
+     )
+    >
+  >: std::true_type{};
+// ---------------------------------------------------------------
+
+template <class T, class ResultType, class = void>
+struct has_const_create_rhs_at_sample_mesh_method_return_result
+  : std::false_type{};
+
+template <class T, class ResultType>
+struct has_const_create_rhs_at_sample_mesh_method_return_result<
+  T, ResultType,
+  mpl::enable_if_t<
+    std::is_same<
+      decltype(std::declval<T const>().createRhsAtSampleMesh()),
+      ResultType
+      >::value
+    >
+  > : std::true_type{};
+// ---------------------------------------------------------------
+
+template <class T, class OperandType, class ResultType, class = void>
+struct has_const_create_result_of_jacobian_action_at_sample_mesh_on
+  : std::false_type{};
+
+template <class T, class OperandType, class ResultType>
+struct has_const_create_result_of_jacobian_action_at_sample_mesh_on<
+  T, OperandType, ResultType,
+  mpl::enable_if_t<
+    std::is_same<
+      decltype
+      (
+       std::declval<T const>().createResultOfJacobianActionAtSampleMeshOn
+       (
+	std::declval<OperandType const &>()
+	)
+       ),
+      ResultType
+      >::value
+    >
+  > : std::true_type{};
 
 }} // end pressio::rom
 #endif  // ROM_PREDICATES_HPP_
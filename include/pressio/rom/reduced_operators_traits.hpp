@@ -4,6 +4,16 @@
 
 namespace pressio{ namespace rom{
 
+/*
+  for Eigen, the reduced matrices have the same compile-time size as
+  the reduced state if the latter is a small fixed-size vector,
+  e.g. Eigen::Matrix<double, 10, 1>: all reduced operators (and the
+  solvers' work objects, which are created from them) are then
+  fixed-size and do not need any heap allocation. Otherwise, i.e.
+  for dynamic reduced states or fixed ones larger than
+  impl::eigen_max_fixed_square_matrix_dimension, they are dynamic.
+*/
+
 /*
   steady galerkin
 */
@@ -27,7 +37,7 @@ struct SteadyGalerkinDefaultReducedOperatorsTraits<
   // if the reduced state is Eigen vector,
   // it makes sense to use an Eigen dense matrix to store
   // the Galerkin jacobian since all reduced operators are dense
-  using reduced_jacobian_type = Eigen::Matrix<typename Traits<T>::scalar_type, -1, -1>;
+  using reduced_jacobian_type = ::pressio::impl::eigen_square_matrix_for_vector_t<T>;
 };
 #endif
 
@@ -66,7 +76,7 @@ struct ExplicitGalerkinDefaultReducedOperatorsTraits<
 {
   using reduced_state_type    = T;
   using reduced_rhs_type = T;
-  using reduced_mass_matrix_type = Eigen::Matrix<typename Traits<T>::scalar_type, -1, -1>;
+  using reduced_mass_matrix_type = ::pressio::impl::eigen_square_matrix_for_vector_t<T>;
 };
 #endif
 
@@ -107,8 +117,8 @@ struct ImplicitGalerkinDefaultReducedOperatorsTraits<
 {
   using reduced_state_type    = T;
   using reduced_residual_type = T;
-  using reduced_jacobian_type = Eigen::Matrix<typename Traits<T>::scalar_type, -1, -1>;
-  using reduced_mass_matrix_type = Eigen::Matrix<typename Traits<T>::scalar_type, -1, -1>;
+  using reduced_jacobian_type = ::pressio::impl::eigen_square_matrix_for_vector_t<T>;
+  using reduced_mass_matrix_type = ::pressio::impl::eigen_square_matrix_for_vector_t<T>;
 };
 #endif
 
@@ -153,7 +163,7 @@ struct SteadyLspgDefaultReducedOperatorsTraits<
 {
   using reduced_state_type = T;
   using gradient_type = T;
-  using hessian_type = Eigen::Matrix<typename Traits<T>::scalar_type, -1, -1>;
+  using hessian_type = ::pressio::impl::eigen_square_matrix_for_vector_t<T>;
 };
 #endif
 
@@ -175,7 +185,7 @@ struct UnsteadyLspgDefaultReducedOperatorsTraits<
 {
   using reduced_state_type = T;
   using gradient_type = T;
-  using hessian_type = Eigen::Matrix<typename Traits<T>::scalar_type, -1, -1>;
+  using hessian_type = ::pressio::impl::eigen_square_matrix_for_vector_t<T>;
 };
 #endif
 
@@ -333,6 +333,42 @@ struct SemiDiscreteFomWithJacobianAndMassMatrixAction<
   > : std::true_type{};
 
 
+/*
+  ensemble of semi-discrete foms: state_type and rhs_type store one
+  sample per column, and the action of the jacobian of each sample
+  is computed in a single call into a vector of results
+*/
+template<class T, class JacobianActionOperandType, class enable = void>
+struct SemiDiscreteFomEnsembleWithJacobianAction : std::false_type{};
+
+template<class T, class JacobianActionOperandType>
+struct SemiDiscreteFomEnsembleWithJacobianAction<
+  T, JacobianActionOperandType,
+  mpl::enable_if_t<
+       SemiDiscreteFom<T>::value
+    && ::pressio::Traits<typename T::state_type>::rank == 2
+    && ::pressio::Traits<typename T::rhs_type>::rank == 2
+    && ::pressio::rom::has_const_create_result_of_jacobian_action_on<
+	 T,  JacobianActionOperandType>::value
+    && std::is_copy_constructible<
+	 impl::fom_jac_action_t<T, JacobianActionOperandType>
+	 >::value
+    && std::is_void<
+       decltype
+       (
+	std::declval<T const>().applyJacobian
+	(
+	 std::declval<typename T::state_type const&>(),
+	 std::declval<JacobianActionOperandType const&>(),
+	 std::declval<typename T::time_type const &>(),
+	 std::declval<std::vector<impl::fom_jac_action_t<T, JacobianActionOperandType>> &>()
+	 )
+	)
+       >::value
+    >
+  > : std::true_type{};
+
+
 template<class T, int TotalNumStates, class JacobianActionOperandType, class = void>
 struct FullyDiscreteSystemWithJacobianAction : std::false_type{};
 
@@ -52,6 +52,7 @@
 #include <concepts>
 #include "concepts_helpers.hpp"
 #include "./impl/ode_has_const_discrete_residual_jacobian_action_method.hpp"
+#include "predicates.hpp"
 
 namespace pressio{ namespace rom{
 
@@ -217,6 +218,25 @@ concept SemiDiscreteFomWithJacobianAndMassMatrixAction =
   && SemiDiscreteFomWithMassMatrixAction<T, OperandType>;
 
 
+template<class T, class JacobianActionOperandType>
+concept SemiDiscreteFomEnsembleWithJacobianAction =
+  SemiDiscreteFom<T>
+  && ::pressio::Traits<typename T::state_type>::rank == 2
+  && ::pressio::Traits<typename T::rhs_type>::rank == 2
+  && requires(const T & A,
+	      const JacobianActionOperandType & operand)
+  {
+    { A.createResultOfJacobianActionOn(operand) } -> std::copy_constructible;
+  }
+  && requires(const T & A,
+	      const typename T::state_type    & states,
+	      const typename T::time_type     & evalTime,
+	      const JacobianActionOperandType & operand,
+	      std::vector<impl::fom_jac_action_t<T, JacobianActionOperandType>> & results)
+  {
+    { A.applyJacobian(states, operand, evalTime, results) } -> std::same_as<void>;
+  };
+
 template<class T, int TotalNumStates, class JacobianActionOperandType>
 concept FullyDiscreteSystemWithJacobianAction =
   (TotalNumStates == 2 || TotalNumStates == 3)
@@ -62,5 +62,6 @@
 #include "rom/reduced_operators_traits.hpp"
 #include "rom/galerkin_unsteady_explicit.hpp"
 #include "rom/galerkin_unsteady_implicit.hpp"
+#include "rom/galerkin_unsteady_implicit_ensemble.hpp"
 
 #endif
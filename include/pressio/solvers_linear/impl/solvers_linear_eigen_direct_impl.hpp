@@ -71,29 +71,167 @@ public:
     "the native eigen solver must be direct to use in EigenDirect");
 
 public:
+  // factorize A: the factorization is kept and can be reused
+  // via solveWithFactorization for any number of right-hand sides
+  void factorize(const MatrixType & A) {
+    this->computeFactorization(A);
+    fingerprint_.record(A);
+  }
+
+  // factorize A only if it differs from the matrix used for the
+  // current factorization, returns true if a factorization happened
+  bool factorizeIfChanged(const MatrixType & A) {
+    if (!fingerprint_.update(A) && isFactorized_){
+      return false;
+    }
+    this->computeFactorization(A);
+    return true;
+  }
+
+  // the caller states that the matrix passed to the next solve(A, ...)
+  // or factorizeIfChanged(A) is the one already factorized, so the
+  // factorization is reused without checking A
+  void markMatrixUnchanged() {
+    if (isFactorized_){ fingerprint_.skipNextCheck(); }
+  }
+
+  bool isFactorized() const { return isFactorized_; }
+
+  template <typename T>
+  void solveWithFactorization(const T& b, T & y) {
+    assert(isFactorized_);
+    this->solveWithFactorizationImpl(b, y);
+  }
+
   void resetLinearSystem(const MatrixType& A) {
-    mysolver_.compute(A);
+    this->factorize(A);
   }
 
   template <typename T>
   void solve(const T& b, T & y) {
-    y = mysolver_.solve(b);
+    this->solveWithFactorization(b, y);
   }
 
   template <typename T>
   void solve(const MatrixType & A, const T& b, T & y) {
-    this->resetLinearSystem(A);
-    this->solve(b, y);
+    this->factorizeIfChanged(A);
+    this->solveWithFactorization(b, y);
   }
 
   template <typename T>
   void solveAllowMatOverwrite(MatrixType & A, const T& b, T & y) {
-    this->resetLinearSystem(A);
-    this->solve(b, y);
+    this->solve(A, b, y);
+  }
+
+private:
+  template <typename _MatrixType = MatrixType>
+  mpl::enable_if_t<!::pressio::is_sparse_matrix_eigen<_MatrixType>::value>
+  computeFactorization(const _MatrixType & A) {
+    mysolver_.compute(A);
+    isFactorized_ = true;
+  }
+
+  // the sparse factorizations need compressed storage:
+  // an uncompressed A is compressed into a copy, A is not touched
+  template <typename _MatrixType = MatrixType>
+  mpl::enable_if_t<::pressio::is_sparse_matrix_eigen<_MatrixType>::value>
+  computeFactorization(const _MatrixType & A) {
+    if (A.isCompressed()){
+      mysolver_.compute(A);
+    }
+    else{
+      compressedA_ = A;
+      compressedA_.makeCompressed();
+      mysolver_.compute(compressedA_);
+    }
+    isFactorized_ = true;
+  }
+
+  template <typename T>
+  mpl::enable_if_t<
+    !(T::ColsAtCompileTime == 1 &&
+      ::pressio::is_dense_matrix_eigen<MatrixType>::value &&
+      (std::is_same<TagType, ::pressio::linearsolvers::direct::HouseholderQR>::value ||
+       std::is_same<TagType, ::pressio::linearsolvers::direct::ColPivHouseholderQR>::value))
+    >
+  solveWithFactorizationImpl(const T& b, T & y) {
+    y = mysolver_.solve(b);
+  }
+
+  // for the dense QR factorizations, Eigen's solve copies the rhs into a new
+  // temporary at every call, so for a single rhs we do the same steps
+  // (apply Q^T, then solve with R) in a workspace that is reused
+  template <typename T, typename _TagType = TagType>
+  mpl::enable_if_t<
+    T::ColsAtCompileTime == 1 &&
+    ::pressio::is_dense_matrix_eigen<MatrixType>::value &&
+    std::is_same<_TagType, ::pressio::linearsolvers::direct::HouseholderQR>::value
+    >
+  solveWithFactorizationImpl(const T& b, T & y)
+  {
+    const auto rank = (std::min)(mysolver_.rows(), mysolver_.cols());
+    work_ = b;
+    this->applyQAdjointToWork(rank);
+    mysolver_.matrixQR().topLeftCorner(rank, rank)
+      .template triangularView<Eigen::Upper>().solveInPlace(work_.topRows(rank));
+    y.topRows(rank) = work_.topRows(rank);
+    y.bottomRows(mysolver_.cols() - rank).setZero();
+  }
+
+  template <typename T, typename _TagType = TagType>
+  mpl::enable_if_t<
+    T::ColsAtCompileTime == 1 &&
+    ::pressio::is_dense_matrix_eigen<MatrixType>::value &&
+    std::is_same<_TagType, ::pressio::linearsolvers::direct::ColPivHouseholderQR>::value
+    >
+  solveWithFactorizationImpl(const T& b, T & y)
+  {
+    const auto rank = mysolver_.nonzeroPivots();
+    if (rank == 0){
+      y.setZero();
+      return;
+    }
+
+    work_ = b;
+    this->applyQAdjointToWork(rank);
+    mysolver_.matrixQR().topLeftCorner(rank, rank)
+      .template triangularView<Eigen::Upper>().solveInPlace(work_.topRows(rank));
+    const auto & perm = mysolver_.colsPermutation().indices();
+    for (decltype(mysolver_.cols()) i = 0; i < rank; ++i){
+      y(perm(i)) = work_(i);
+    }
+    for (decltype(mysolver_.cols()) i = rank; i < mysolver_.cols(); ++i){
+      y(perm(i)) = scalar_type(0);
+    }
+  }
+
+  // work_ <- Q^T work_ using the first rank reflectors stored in matrixQR,
+  // applied one by one: Eigen's applyOnTheLeft evaluates tau*v into a
+  // temporary for each reflector
+  template <typename IndexType>
+  void applyQAdjointToWork(IndexType rank)
+  {
+    const auto & qr = mysolver_.matrixQR();
+    const auto & tau = mysolver_.hCoeffs();
+    const auto n = work_.size();
+    for (IndexType k = 0; k < rank; ++k){
+      const auto len = n - k - 1;
+      const auto v = qr.col(k).tail(len);
+      auto x = work_.tail(len);
+      const scalar_type w = (work_(k) + v.dot(x)) * Eigen::numext::conj(tau(k));
+      work_(k) -= w;
+      for (decltype(work_.size()) i = 0; i < len; ++i){
+        x(i) -= w * v(i);
+      }
+    }
   }
 
 private:
   native_solver_type mysolver_ = {};
+  bool isFactorized_ = false;
+  MatrixFingerprint fingerprint_ = {};
+  MatrixType compressedA_ = {};
+  Eigen::Matrix<scalar_type, Eigen::Dynamic, 1> work_ = {};
 };
 
 }}} // end namespace pressio::solvers::linear::impl
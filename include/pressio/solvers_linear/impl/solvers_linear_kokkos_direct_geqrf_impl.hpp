@@ -101,16 +101,14 @@ public:
   /*
    * enable if:
    * the matrix has layout left (i.e. column major)
-   * T is a kokkos vector
+   * T is a kokkos vector or a column-major kokkos matrix
    * T has host execution space
    * T and MatrixType have same execution space
    */
   template <typename _MatrixType = MatrixType, typename T>
   mpl::enable_if_t<
     mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
-    and ::pressio::is_vector_kokkos<T>::value 
-    /*and ::pressio::containers::details::traits<T>::has_host_execution_space and*/
-    and mpl::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
+    and valid_kokkos_direct_solve_rhs<T, _MatrixType>::value
   >
   solve(const _MatrixType & A, const T& b, T & y)
   {
@@ -127,16 +125,14 @@ public:
   /*
    * enable if:
    * the matrix has layout left (i.e. column major)
-   * T is a kokkos vector 
+   * T is a kokkos vector or a column-major kokkos matrix
    * T has host execution space
    * T and MatrixType have same execution space
    */
   template <typename _MatrixType = MatrixType, typename T>
   mpl::enable_if_t<
     mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
-    and ::pressio::is_vector_kokkos<T>::value 
-    /*::pressio::containers::details::traits<T>::has_host_execution_space and*/
-    and mpl::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
+    and valid_kokkos_direct_solve_rhs<T, _MatrixType>::value
   >
   solveAllowMatOverwrite(_MatrixType & A, const T& b, T & y)
   {
@@ -146,8 +142,9 @@ public:
     assert(A.extent(0) == b.extent(0) );
     assert(A.extent(1) == y.extent(0) );
 
-    // only one rhs 
-    constexpr int nRhs = 1;
+    // one rhs for each column of b
+    const int nRhs = kokkos_direct_solve_num_rhs(b);
+    assert(nRhs == kokkos_direct_solve_num_rhs(y));
     // just use n, since rows == cols
     const auto n = A.extent(0);
 
@@ -175,11 +172,26 @@ public:
     // Note that A is overwritten starting from here!
     // we need to deep copy b into y and pass y to ormqr
     // because it is overwritten with Q^T b
-    Kokkos::deep_copy(y, b);
+    if (y.data() != b.data()){
+      Kokkos::deep_copy(y, b);
+    }
 
-    // compute Q^T b
+    // ormqr needs a workspace that grows with the number of rhs
     const char side = 'L';
     const char trans = 'T';
+    if (nRhs > ormqrNumRhs_){
+      scalar_type workQuery = {};
+      lpk_.ORMQR(side, trans, n, nRhs, n, A.data(), n, tau_.data(),
+		 y.data(), n, &workQuery, -1, &info);
+      const int ormqrLwork = static_cast<int>(workQuery);
+      if (ormqrLwork > lwork_){
+	work_.resize(ormqrLwork);
+	lwork_ = ormqrLwork;
+      }
+      ormqrNumRhs_ = nRhs;
+    }
+
+    // compute Q^T b
     lpk_.ORMQR(side, trans, n, nRhs, n,
     	       A.data(),
     	       n,
@@ -212,6 +224,8 @@ private:
   // if lwork == -1, then geqrf does a query of what is needed.
   // more details are shown in the code above on how we use lwork
   int lwork_ = -1;
+  // largest number of rhs for which the work array is large enough for ormqr
+  int ormqrNumRhs_ = 0;
 
   std::vector<scalar_type> work_ = {0};
   std::vector<scalar_type> tau_ = {};
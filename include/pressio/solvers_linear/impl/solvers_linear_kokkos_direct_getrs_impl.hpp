@@ -98,46 +98,97 @@ public:
 // because this uses teuchos lapack wrapper
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
   /*
+   * factorize A = P L U and keep the factors,
+   * so that they can be reused via solveWithFactorization
    * enable if:
    * the matrix has layout left (i.e. column major)
-   * T is a kokkos vector 
+   */
+  template < typename _MatrixType = MatrixType>
+  mpl::enable_if_t<
+    mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value
+  >
+  factorize(const _MatrixType & A)
+  {
+    this->factorizeCopyOf(A);
+    fingerprint_.record(A);
+  }
+
+  /*
+   * factorize A only if it differs from the matrix used for
+   * the current factorization, returns true if it factorized
+   */
+  template < typename _MatrixType = MatrixType>
+  mpl::enable_if_t<
+    mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value,
+    bool
+  >
+  factorizeIfChanged(const _MatrixType & A)
+  {
+    if (!fingerprint_.update(A) and isFactorized_){
+      return false;
+    }
+    this->factorizeCopyOf(A);
+    return true;
+  }
+
+  /*
+   * the caller states that the matrix passed to the next solve(A, ...)
+   * or factorizeIfChanged(A) is the one already factorized,
+   * so the factors are reused without checking A
+   */
+  void markMatrixUnchanged()
+  {
+    if (isFactorized_){ fingerprint_.skipNextCheck(); }
+  }
+
+  bool isFactorized() const { return isFactorized_; }
+
+  /*
+   * solve using the factors computed by the last call to factorize
+   * enable if:
+   * T is a kokkos vector or a column-major kokkos matrix
+   * T and MatrixType have same execution space
+   */
+  template <typename T>
+  mpl::enable_if_t<
+    valid_kokkos_direct_solve_rhs<T, MatrixType>::value
+  >
+  solveWithFactorization(const T& b, T & y)
+  {
+    assert(isFactorized_);
+    solveInPlaceWithFactors(auxMat_, b, y);
+  }
+
+  /*
+   * enable if:
+   * the matrix has layout left (i.e. column major)
+   * T is a kokkos vector or a column-major kokkos matrix
    * has host execution space
    * T and MatrixType have same execution space
    */
   template < typename _MatrixType = MatrixType, typename T>
   mpl::enable_if_t<
     mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
-    and ::pressio::is_vector_kokkos<T>::value 
-    /*::pressio::containers::details::traits<T>::has_host_execution_space and*/
-    and mpl::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
+    and valid_kokkos_direct_solve_rhs<T, _MatrixType>::value
   >
   solve(const _MatrixType & A, const T& b, T & y)
   {
-    const auto Aext0 = A.extent(0);
-    const auto Aext1 = A.extent(1);
-    if (Aext0 != auxMat_.extent(0) or Aext1 != auxMat_.extent(1))
-    {
-      Kokkos::resize(auxMat_, Aext0, Aext1);
-    }
-
-    Kokkos::deep_copy(auxMat_, A);
-    this->solveAllowMatOverwrite(auxMat_, b, y);
+    this->factorizeIfChanged(A);
+    this->solveWithFactorization(b, y);
   }
 
 
   /*
    * enable if:
    * the matrix has layout left (i.e. column major)
-   * T is a kokkos vector 
+   * T is a kokkos vector or a column-major kokkos matrix
    * has host execution space
    * T and MatrixType have same execution space
    */
   template < typename _MatrixType = MatrixType, typename T>
   mpl::enable_if_t<
     mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
-    and ::pressio::is_vector_kokkos<T>::value 
-    /*::pressio::containers::details::traits<T>::has_host_execution_space and*/
-    and mpl::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
+    and valid_kokkos_direct_solve_rhs<T, _MatrixType>::value
   >
   solveAllowMatOverwrite(_MatrixType & A, const T& b, T & y)
   {
@@ -146,28 +197,72 @@ public:
     // gerts is for square matrices
     assert(A.extent(0) == A.extent(1) );
 
-    // only one rhs
-    constexpr int nRhs = 1;
-    // just use n, since rows == cols
-    const auto n = A.extent(0);
+    // the factors are stored in A, not in auxMat_
+    fingerprint_.invalidate();
+    isFactorized_ = false;
+    factorizeInPlace(A);
+    solveInPlaceWithFactors(A, b, y);
+  }
 
-    int info = 0;
-    const int ipivSz = n;
-    // this needs to be moved out, does not make sense to construct it every time
-    std::vector<int> ipiv(ipivSz);
+private:
+  template <typename _MatrixType>
+  void factorizeCopyOf(const _MatrixType & A)
+  {
+    // gerts is for square matrices
+    assert(A.extent(0) == A.extent(1) );
+
+    const auto Aext0 = A.extent(0);
+    const auto Aext1 = A.extent(1);
+    if (Aext0 != auxMat_.extent(0) or Aext1 != auxMat_.extent(1))
+    {
+      Kokkos::resize(auxMat_, Aext0, Aext1);
+    }
+    Kokkos::deep_copy(auxMat_, A);
+
+    factorizeInPlace(auxMat_);
+    isFactorized_ = true;
+  }
+
+  template <typename _MatrixType>
+  void factorizeInPlace(_MatrixType & A)
+  {
+    // just use n, since rows == cols
+    const int n = A.extent(0);
+    // only reallocate the pivots when the size changes
+    if (ipiv_.size() != static_cast<std::size_t>(n)){
+      ipiv_.resize(n);
+    }
 
     // LU factorize using GETRF
-    lpk_.GETRF(n, n, A.data(), n, ipiv.data(), &info);
+    int info = 0;
+    lpk_.GETRF(n, n, A.data(), n, ipiv_.data(), &info);
     assert(info == 0);
+  }
+
+  template <typename _MatrixType, typename T>
+  void solveInPlaceWithFactors(const _MatrixType & A, const T& b, T & y)
+  {
+    assert(A.extent(0) == b.extent(0) );
+    assert(A.extent(1) == y.extent(0) );
+
+    // one rhs for each column of b
+    const int nRhs = kokkos_direct_solve_num_rhs(b);
+    assert(nRhs == kokkos_direct_solve_num_rhs(y));
+    const int n = A.extent(0);
 
     // we need to deep copy b into y and pass y
     // because getrs overwrite the RHS in place with the solution
-    Kokkos::deep_copy(y, b);
+    if (y.data() != b.data()){
+      Kokkos::deep_copy(y, b);
+    }
 
+    int info = 0;
     const char ct = 'N';
-    lpk_.GETRS(ct, n, nRhs, A.data(), n, ipiv.data(), y.data(), y.extent(0), &info);
+    lpk_.GETRS(ct, n, nRhs, A.data(), n, ipiv_.data(), y.data(), kokkos_direct_solve_ldb(y), &info);
     assert(info == 0);
   }
+
+public:
 #endif
 
 
@@ -245,6 +340,9 @@ public:
   Teuchos::LAPACK<int, scalar_type> lpk_;
 
   MatrixType auxMat_ = {};
+  std::vector<int> ipiv_ = {};
+  bool isFactorized_ = false;
+  MatrixFingerprint fingerprint_ = {};
 #endif
 
 #if defined PRESSIO_ENABLE_TPL_KOKKOS and defined KOKKOS_ENABLE_CUDA
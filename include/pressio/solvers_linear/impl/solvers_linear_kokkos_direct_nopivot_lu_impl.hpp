@@ -0,0 +1,239 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// solvers_linear_kokkos_direct_nopivot_lu_impl.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_KOKKOS_DIRECT_NOPIVOT_LU_IMPL_HPP_
+#define SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_KOKKOS_DIRECT_NOPIVOT_LU_IMPL_HPP_
+
+namespace pressio { namespace linearsolvers{ namespace impl{
+
+/*
+  LU without pivoting, computed and applied by a single team
+  launched in the execution space of the matrix, so that the
+  factors, the rhs and the solution never leave the memory space
+  of the matrix (no host LAPACK, no host copies).
+
+  Without pivoting this is only meant for matrices that do not
+  need it, e.g. symmetric positive definite or diagonally dominant
+  ones like the normal equations of Gauss-Newton and LM.
+  The factorization is right-looking: at step k the threads of the
+  team first scale the column below the pivot, then each updates
+  its share of the columns of the trailing submatrix, with the
+  rows of each column split over the vector lanes.
+  The substitutions split the row updates in the same way,
+  and a matrix rhs assigns its columns to the threads.
+*/
+template<typename A_type, typename MatrixType>
+using valid_kokkos_nopivot_lu_matrix = std::integral_constant<bool,
+  ::pressio::is_dense_matrix_kokkos<A_type>::value
+  and mpl::is_same<typename A_type::traits::array_layout, Kokkos::LayoutLeft>::value
+  and mpl::is_same<typename A_type::traits::execution_space,
+		   typename MatrixType::traits::execution_space>::value
+  and mpl::is_same<typename A_type::non_const_value_type,
+		   typename MatrixType::non_const_value_type>::value
+  >;
+
+template<typename MatrixType>
+class KokkosDirect<::pressio::linearsolvers::direct::NoPivotLU, MatrixType>
+{
+public:
+  using solver_tag	= ::pressio::linearsolvers::direct::NoPivotLU;
+  using this_type       = KokkosDirect<solver_tag, MatrixType>;
+  using matrix_type	= MatrixType;
+  using scalar_type     = typename MatrixType::value_type;
+  using exe_space       = typename MatrixType::traits::execution_space;
+  using solver_traits   = ::pressio::linearsolvers::Traits<solver_tag>;
+  using policy_type     = Kokkos::TeamPolicy<exe_space>;
+  using member_type     = typename policy_type::member_type;
+
+  static_assert( solver_traits::kokkos_enabled == true,
+		 "the native solver must suppport kokkos to use in KokkosDirect");
+  static_assert( solver_traits::direct == true,
+		 "the native solver must be direct to use in KokkosDirect");
+  static_assert( mpl::is_same<typename MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value,
+		 "NoPivotLU currently requires a column-major (LayoutLeft) matrix");
+
+public:
+  KokkosDirect() = default;
+  KokkosDirect(const KokkosDirect &) = delete;
+
+  // A can be any column-major kokkos matrix with the same execution space
+  // and scalar as MatrixType, e.g. normal_eqs_default_hessian_t
+  template <typename A_type>
+  mpl::enable_if_t< valid_kokkos_nopivot_lu_matrix<A_type, MatrixType>::value >
+  factorize(const A_type & A)
+  {
+    assert(A.extent(0) == A.extent(1) );
+    if (A.extent(0) != factors_.extent(0) or A.extent(1) != factors_.extent(1)){
+      Kokkos::resize(factors_, A.extent(0), A.extent(1));
+    }
+    Kokkos::deep_copy(factors_, A);
+
+    const auto F = factors_;
+    Kokkos::parallel_for("pressio::NoPivotLU::factorize",
+			 policy_type(1, Kokkos::AUTO),
+			 KOKKOS_LAMBDA(const member_type & team){
+			   const int n = F.extent(0);
+			   for (int k=0; k<n; ++k){
+			     const scalar_type pivot = F(k,k);
+			     Kokkos::parallel_for(Kokkos::TeamThreadRange(team, k+1, n),
+						  [&](const int i){ F(i,k) /= pivot; });
+			     team.team_barrier();
+
+			     Kokkos::parallel_for(Kokkos::TeamThreadRange(team, k+1, n),
+						  [&](const int j){
+						    const scalar_type ukj = F(k,j);
+						    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, k+1, n),
+									 [&](const int i){ F(i,j) -= F(i,k)*ukj; });
+						  });
+			     team.team_barrier();
+			   }
+			 });
+    isFactorized_ = true;
+  }
+
+  bool isFactorized() const { return isFactorized_; }
+
+  template <typename T>
+  mpl::enable_if_t< valid_kokkos_direct_solve_rhs<T, MatrixType>::value >
+  solveWithFactorization(const T & b, T & y)
+  {
+    assert(isFactorized_);
+    assert(factors_.extent(0) == b.extent(0) );
+    if (y.data() != b.data()){
+      Kokkos::deep_copy(y, b);
+    }
+    solveInPlace(y);
+  }
+
+  // the factorization is always recomputed: comparing A with the
+  // factored matrix would need a copy to host for device matrices
+  template <typename A_type, typename T>
+  mpl::enable_if_t<
+    valid_kokkos_nopivot_lu_matrix<A_type, MatrixType>::value
+    and valid_kokkos_direct_solve_rhs<T, MatrixType>::value
+    >
+  solve(const A_type & A, const T & b, T & y)
+  {
+    this->factorize(A);
+    this->solveWithFactorization(b, y);
+  }
+
+  template <typename A_type, typename T>
+  mpl::enable_if_t<
+    valid_kokkos_nopivot_lu_matrix<A_type, MatrixType>::value
+    and valid_kokkos_direct_solve_rhs<T, MatrixType>::value
+    >
+  solveAllowMatOverwrite(A_type & A, const T & b, T & y)
+  {
+    this->solve(A, b, y);
+  }
+
+private:
+  template <typename T>
+  mpl::enable_if_t< ::pressio::is_vector_kokkos<T>::value >
+  solveInPlace(T & y)
+  {
+    const auto F = factors_;
+    const auto x = y;
+    Kokkos::parallel_for("pressio::NoPivotLU::solve",
+			 policy_type(1, Kokkos::AUTO),
+			 KOKKOS_LAMBDA(const member_type & team){
+			   const int n = F.extent(0);
+			   // forward substitution, L has a unit diagonal
+			   for (int k=0; k<n-1; ++k){
+			     Kokkos::parallel_for(Kokkos::TeamThreadRange(team, k+1, n),
+						  [&](const int i){ x(i) -= F(i,k)*x(k); });
+			     team.team_barrier();
+			   }
+			   // back substitution
+			   for (int k=n-1; k>=0; --k){
+			     Kokkos::single(Kokkos::PerTeam(team), [&](){ x(k) /= F(k,k); });
+			     team.team_barrier();
+			     Kokkos::parallel_for(Kokkos::TeamThreadRange(team, 0, k),
+						  [&](const int i){ x(i) -= F(i,k)*x(k); });
+			     team.team_barrier();
+			   }
+			 });
+  }
+
+  template <typename T>
+  mpl::enable_if_t< ::pressio::is_dense_matrix_kokkos<T>::value >
+  solveInPlace(T & Y)
+  {
+    const auto F = factors_;
+    const auto X = Y;
+    Kokkos::parallel_for("pressio::NoPivotLU::solve",
+			 policy_type(1, Kokkos::AUTO),
+			 KOKKOS_LAMBDA(const member_type & team){
+			   const int n = F.extent(0);
+			   const int numRhs = X.extent(1);
+			   // the columns of X are independent, so no barrier is needed
+			   Kokkos::parallel_for(Kokkos::TeamThreadRange(team, numRhs),
+						[&](const int j){
+						  for (int k=0; k<n-1; ++k){
+						    const scalar_type xkj = X(k,j);
+						    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, k+1, n),
+									 [&](const int i){ X(i,j) -= F(i,k)*xkj; });
+						  }
+						  for (int k=n-1; k>=0; --k){
+						    const scalar_type xkj = X(k,j)/F(k,k);
+						    Kokkos::single(Kokkos::PerThread(team), [&](){ X(k,j) = xkj; });
+						    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, 0, k),
+									 [&](const int i){ X(i,j) -= F(i,k)*xkj; });
+						  }
+						});
+			 });
+  }
+
+private:
+  MatrixType factors_ = {};
+  bool isFactorized_ = false;
+};
+
+}}} // end namespace pressio::linearsolvers::impl
+#endif  // SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_KOKKOS_DIRECT_NOPIVOT_LU_IMPL_HPP_
@@ -85,74 +85,167 @@ public:
 
 // because this uses teuchos lapack wrapper
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
+  /*
+   * Cholesky-factorize A and keep the factor,
+   * so that it can be reused via solveWithFactorization
+   * enable if:
+   * the matrix has layout left (i.e. column major)
+   */
+  template <typename _MatrixType = MatrixType>
+  mpl::enable_if_t<
+    mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value
+  >
+  factorize(const _MatrixType & A)
+  {
+    this->factorizeCopyOf(A);
+    fingerprint_.record(A);
+  }
+
+  /*
+   * factorize A only if it differs from the matrix used for
+   * the current factorization, returns true if it factorized
+   */
+  template <typename _MatrixType = MatrixType>
+  mpl::enable_if_t<
+    mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value,
+    bool
+  >
+  factorizeIfChanged(const _MatrixType & A)
+  {
+    if (!fingerprint_.update(A) and isFactorized_){
+      return false;
+    }
+    this->factorizeCopyOf(A);
+    return true;
+  }
+
+  /*
+   * the caller states that the matrix passed to the next solve(A, ...)
+   * or factorizeIfChanged(A) is the one already factorized,
+   * so the factors are reused without checking A
+   */
+  void markMatrixUnchanged()
+  {
+    if (isFactorized_){ fingerprint_.skipNextCheck(); }
+  }
+
+  bool isFactorized() const { return isFactorized_; }
+
+  /*
+   * solve using the factor computed by the last call to factorize
+   * enable if:
+   * T is a kokkos vector or a column-major kokkos matrix
+   * T and MatrixType have same execution space
+   */
+  template <typename T>
+  mpl::enable_if_t<
+    valid_kokkos_direct_solve_rhs<T, MatrixType>::value
+  >
+  solveWithFactorization(const T& b, T & y)
+  {
+    assert(isFactorized_);
+    solveInPlaceWithFactors(auxMat_, b, y);
+  }
 
   /*
    * enable if:
    * the matrix has layout left (i.e. column major)
-   * T is a kokkos vector 
+   * T is a kokkos vector or a column-major kokkos matrix
    * has host execution space
    * T and MatrixType have same execution space
    */
   template <typename _MatrixType = MatrixType, typename T>
   mpl::enable_if_t<
     mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
-    and ::pressio::is_vector_kokkos<T>::value 
-    /*and ::pressio::containers::details::traits<T>::has_host_execution_space and*/
-    and mpl::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
+    and valid_kokkos_direct_solve_rhs<T, _MatrixType>::value
   >
   solve(const _MatrixType & A, const T& b, T & y)
   {
-    const auto Aext0 = A.extent(0);
-    const auto Aext1 = A.extent(1);
-    if (Aext0 != auxMat_.extent(0) or Aext1 != auxMat_.extent(1))
-    {
-      Kokkos::resize(auxMat_, Aext0, Aext1);
-    }
-
-    Kokkos::deep_copy(auxMat_, A);
-    this->solveAllowMatOverwrite(auxMat_, b, y);
+    this->factorizeIfChanged(A);
+    this->solveWithFactorization(b, y);
   }
 
 
   /*
    * enable if:
    * the matrix has layout left (i.e. column major)
-   * T is a kokkos vector 
+   * T is a kokkos vector or a column-major kokkos matrix
    * has host execution space
    * T and MatrixType have same execution space
    */
   template <typename _MatrixType = MatrixType, typename T>
   mpl::enable_if_t<
     mpl::is_same<typename _MatrixType::traits::array_layout, Kokkos::LayoutLeft>::value 
-    and ::pressio::is_vector_kokkos<T>::value 
-    /*and ::pressio::containers::details::traits<T>::has_host_execution_space and*/
-    and mpl::is_same<typename T::traits::execution_space, typename _MatrixType::traits::execution_space>::value
+    and valid_kokkos_direct_solve_rhs<T, _MatrixType>::value
   >
   solveAllowMatOverwrite(_MatrixType & A, const T& b, T & y)
   {
     assert(A.extent(0) == b.extent(0) );
     assert(A.extent(1) == y.extent(0) );
+    // potrs is for symmetric pos def
+    assert(A.extent(0) == A.extent(1) );
 
+    // the factor is stored in A, not in auxMat_
+    fingerprint_.invalidate();
+    isFactorized_ = false;
+    factorizeInPlace(A);
+    solveInPlaceWithFactors(A, b, y);
+  }
+
+private:
+  template <typename _MatrixType>
+  void factorizeCopyOf(const _MatrixType & A)
+  {
     // potrs is for symmetric pos def
     assert(A.extent(0) == A.extent(1) );
 
-    // only one rhs
-    constexpr int nRhs = 1;
+    const auto Aext0 = A.extent(0);
+    const auto Aext1 = A.extent(1);
+    if (Aext0 != auxMat_.extent(0) or Aext1 != auxMat_.extent(1))
+    {
+      Kokkos::resize(auxMat_, Aext0, Aext1);
+    }
+    Kokkos::deep_copy(auxMat_, A);
+
+    factorizeInPlace(auxMat_);
+    isFactorized_ = true;
+  }
+
+  template <typename _MatrixType>
+  void factorizeInPlace(_MatrixType & A)
+  {
     // just use n, since rows == cols
-    const auto n = A.extent(0);
+    const int n = A.extent(0);
 
     // Cholesky factorization
     int info = 0;
     lpk_.POTRF(uplo_, n, A.data(), n, &info);
     assert(info == 0);
+  }
+
+  template <typename _MatrixType, typename T>
+  void solveInPlaceWithFactors(const _MatrixType & A, const T& b, T & y)
+  {
+    assert(A.extent(0) == b.extent(0) );
+    assert(A.extent(1) == y.extent(0) );
+
+    // one rhs for each column of b
+    const int nRhs = kokkos_direct_solve_num_rhs(b);
+    assert(nRhs == kokkos_direct_solve_num_rhs(y));
+    const int n = A.extent(0);
 
     // we need to deep copy b into y and pass y
     // because we overwrite the RHS in place with the solution
-    Kokkos::deep_copy(y, b);
+    if (y.data() != b.data()){
+      Kokkos::deep_copy(y, b);
+    }
 
-    lpk_.POTRS(uplo_, n, nRhs, A.data(), n, y.data(), y.extent(0), &info);
+    int info = 0;
+    lpk_.POTRS(uplo_, n, nRhs, A.data(), n, y.data(), kokkos_direct_solve_ldb(y), &info);
     assert(info == 0);
   }
+
+public:
 #endif
 
   const char uplo_ = 'U';
@@ -160,6 +253,8 @@ public:
 #ifdef PRESSIO_ENABLE_TPL_TRILINOS
   Teuchos::LAPACK<int, scalar_type> lpk_;
   MatrixType auxMat_ = {};
+  bool isFactorized_ = false;
+  MatrixFingerprint fingerprint_ = {};
 #endif
 };
 
@@ -0,0 +1,102 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// solvers_linear_kokkos_direct_rhs.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_KOKKOS_DIRECT_RHS_HPP_
+#define SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_KOKKOS_DIRECT_RHS_HPP_
+
+namespace pressio { namespace linearsolvers{ namespace impl{
+
+/*
+  the right-hand side (and solution) of a kokkos direct solve can be:
+  - a kokkos vector, i.e. a single rhs
+  - a column-major kokkos matrix, i.e. one rhs per column
+  and must have the same execution space as the matrix
+*/
+template<typename T, typename MatrixType, typename enable = void>
+struct valid_kokkos_direct_solve_rhs : std::false_type{};
+
+template<typename T, typename MatrixType>
+struct valid_kokkos_direct_solve_rhs<
+  T, MatrixType,
+  mpl::enable_if_t<
+    (::pressio::is_vector_kokkos<T>::value
+     or (::pressio::is_dense_matrix_kokkos<T>::value
+	 and mpl::is_same<typename T::traits::array_layout, Kokkos::LayoutLeft>::value))
+    and mpl::is_same<typename T::traits::execution_space,
+		     typename MatrixType::traits::execution_space>::value
+    >
+  > : std::true_type{};
+
+template<typename T>
+mpl::enable_if_t<::pressio::is_vector_kokkos<T>::value, int>
+kokkos_direct_solve_num_rhs(const T & /*b*/){
+  return 1;
+}
+
+template<typename T>
+mpl::enable_if_t<::pressio::is_dense_matrix_kokkos<T>::value, int>
+kokkos_direct_solve_num_rhs(const T & b){
+  return static_cast<int>(b.extent(1));
+}
+
+// leading dimension to pass to lapack: a layout-left matrix of rhs
+// can be a subview whose columns are not contiguous with each other
+template<typename T>
+mpl::enable_if_t<::pressio::is_vector_kokkos<T>::value, int>
+kokkos_direct_solve_ldb(const T & b){
+  return std::max(1, static_cast<int>(b.extent(0)));
+}
+
+template<typename T>
+mpl::enable_if_t<::pressio::is_dense_matrix_kokkos<T>::value, int>
+kokkos_direct_solve_ldb(const T & b){
+  return std::max(1, static_cast<int>(b.stride(1)));
+}
+
+}}} // end namespace pressio::linearsolvers::impl
+#endif  // SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_KOKKOS_DIRECT_RHS_HPP_
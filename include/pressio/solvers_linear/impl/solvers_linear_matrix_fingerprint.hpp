@@ -0,0 +1,268 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// solvers_linear_matrix_fingerprint.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_MATRIX_FINGERPRINT_HPP_
+#define SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_MATRIX_FINGERPRINT_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace pressio { namespace linearsolvers{ namespace impl{
+
+/*
+  A fingerprint of a matrix made of its extents, a hash of its
+  values and a copy of the hashed words. Used by the direct solvers
+  to detect that solve(A, ...) is called with the same matrix used
+  for the current factorization, so that the factorization can be
+  reused. Equal hashes are confirmed by comparing A word by word
+  with the stored copy, in the same O(nnz) pass that computes the
+  hash, so a hash collision cannot make a changed matrix look
+  unchanged. This is negligible compared to the cost of a
+  factorization, and the copy is overwritten in place.
+  A caller that knows the matrix did not change can skip
+  the next check altogether via skipNextCheck().
+*/
+class MatrixFingerprint
+{
+  bool valid_ = false;
+  bool skipNext_ = false;
+  std::size_t ext0_ = 0;
+  std::size_t ext1_ = 0;
+  std::uint64_t hash_ = 0;
+  std::vector<std::uint64_t> words_;
+
+  static constexpr std::uint64_t fnvOffset_ = 14695981039346656037ull;
+  static constexpr std::uint64_t fnvPrime_  = 1099511628211ull;
+
+  // hashes the words of a matrix and compares them with,
+  // then overwrites, the words stored for the previous one
+  struct Visitor
+  {
+    std::vector<std::uint64_t> & words;
+    std::uint64_t hash = fnvOffset_;
+    std::size_t count = 0;
+    bool same = true;
+
+    void operator()(std::uint64_t w){
+      hash ^= w;
+      hash *= fnvPrime_;
+      hash ^= hash >> 32;
+      if (count < words.size()){
+	if (words[count] != w){
+	  same = false;
+	  words[count] = w;
+	}
+      }
+      else{
+	same = false;
+	words.push_back(w);
+      }
+      ++count;
+    }
+  };
+
+  template<class T>
+  static void visit(Visitor & v, const T & value){
+    constexpr std::size_t nWords = (sizeof(T) + sizeof(std::uint64_t) - 1)/sizeof(std::uint64_t);
+    std::uint64_t words[nWords] = {};
+    std::memcpy(words, &value, sizeof(T));
+    for (std::size_t i=0; i<nWords; ++i){
+      v(words[i]);
+    }
+  }
+
+  template<class T>
+  static void visitRange(Visitor & v, const T * ptr, std::size_t count){
+    for (std::size_t i=0; i<count; ++i){
+      visit(v, ptr[i]);
+    }
+  }
+
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+  template<class MatrixType>
+  static mpl::enable_if_t<
+    ::pressio::is_dense_matrix_eigen<MatrixType>::value or
+    ::pressio::is_sparse_matrix_eigen<MatrixType>::value,
+    std::size_t>
+  extent(const MatrixType & A, int i){
+    return static_cast<std::size_t>(i==0 ? A.rows() : A.cols());
+  }
+
+  template<class MatrixType>
+  static mpl::enable_if_t<::pressio::is_dense_matrix_eigen<MatrixType>::value, bool>
+  computeHash(const MatrixType & A, Visitor & v)
+  {
+    for (decltype(A.cols()) j=0; j<A.cols(); ++j){
+      for (decltype(A.rows()) i=0; i<A.rows(); ++i){
+	visit(v, A(i,j));
+      }
+    }
+    return true;
+  }
+
+  template<class MatrixType>
+  static mpl::enable_if_t<::pressio::is_sparse_matrix_eigen<MatrixType>::value, bool>
+  computeHash(const MatrixType & A, Visitor & v)
+  {
+    if (A.isCompressed()){
+      visitRange(v, A.outerIndexPtr(), static_cast<std::size_t>(A.outerSize()+1));
+      visitRange(v, A.innerIndexPtr(), static_cast<std::size_t>(A.nonZeros()));
+      visitRange(v, A.valuePtr(),      static_cast<std::size_t>(A.nonZeros()));
+      return true;
+    }
+
+    // uncompressed storage has free slots after each inner vector,
+    // so only the actual entries are hashed, one inner vector at a time
+    for (decltype(A.outerSize()) j=0; j<A.outerSize(); ++j){
+      visit(v, j);
+      for (typename MatrixType::InnerIterator it(A, j); it; ++it){
+	visit(v, it.index());
+	visit(v, it.value());
+      }
+    }
+    return true;
+  }
+#endif
+
+#ifdef PRESSIO_ENABLE_TPL_KOKKOS
+  template<class MatrixType>
+  static mpl::enable_if_t<::pressio::is_dense_matrix_kokkos<MatrixType>::value, std::size_t>
+  extent(const MatrixType & A, int i){
+    return static_cast<std::size_t>(A.extent(i));
+  }
+
+  template<class MatrixType>
+  static mpl::enable_if_t<
+    ::pressio::is_dense_matrix_kokkos<MatrixType>::value and
+    Kokkos::SpaceAccessibility<
+      Kokkos::HostSpace, typename MatrixType::memory_space>::accessible,
+    bool>
+  computeHash(const MatrixType & A, Visitor & v)
+  {
+    for (std::size_t j=0; j<A.extent(1); ++j){
+      for (std::size_t i=0; i<A.extent(0); ++i){
+	visit(v, A(i,j));
+      }
+    }
+    return true;
+  }
+
+  // for device matrices we do not pay for a copy to host:
+  // there is no fingerprint and a refactorization always happens
+  template<class MatrixType>
+  static mpl::enable_if_t<
+    ::pressio::is_dense_matrix_kokkos<MatrixType>::value and
+    !Kokkos::SpaceAccessibility<
+      Kokkos::HostSpace, typename MatrixType::memory_space>::accessible,
+    bool>
+  computeHash(const MatrixType & /*A*/, Visitor & /*v*/)
+  {
+    return false;
+  }
+#endif
+
+  // fingerprint A, returns true if it is identical to the one stored
+  template<class MatrixType>
+  bool recordAndCompare(const MatrixType & A)
+  {
+    skipNext_ = false;
+    const std::size_t e0 = extent(A, 0);
+    const std::size_t e1 = extent(A, 1);
+    const bool sameExtents = (e0 == ext0_ and e1 == ext1_);
+    ext0_ = e0;
+    ext1_ = e1;
+
+    Visitor v{words_};
+    const bool hadValid = valid_;
+    valid_ = computeHash(A, v);
+    if (!valid_){
+      words_.clear();
+      return false;
+    }
+
+    words_.resize(v.count);
+    const bool sameHash = (v.hash == hash_);
+    hash_ = v.hash;
+    return hadValid and sameExtents and sameHash and v.same;
+  }
+
+public:
+  void invalidate(){
+    valid_ = false;
+    skipNext_ = false;
+  }
+
+  bool isValid() const{ return valid_; }
+
+  // the next call to update() assumes the matrix is unchanged
+  // and returns false without computing its fingerprint
+  void skipNextCheck(){ skipNext_ = true; }
+
+  template<class MatrixType>
+  void record(const MatrixType & A)
+  {
+    this->recordAndCompare(A);
+  }
+
+  // compute the fingerprint of A once, store it and
+  // return true if it differs from the one previously stored
+  // (always true when no fingerprint can be computed for A)
+  template<class MatrixType>
+  bool update(const MatrixType & A)
+  {
+    if (skipNext_){
+      skipNext_ = false;
+      return false;
+    }
+    return !this->recordAndCompare(A);
+  }
+};
+
+}}} // end namespace pressio::linearsolvers::impl
+#endif  // SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_MATRIX_FINGERPRINT_HPP_
@@ -49,15 +49,19 @@
 #ifndef SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_SOLVER_SELECTOR_IMPL_HPP_
 #define SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_SOLVER_SELECTOR_IMPL_HPP_
 
+#include "solvers_linear_matrix_fingerprint.hpp"
+
 #ifdef PRESSIO_ENABLE_TPL_EIGEN
 #include "solvers_linear_eigen_direct_impl.hpp"
 #include "solvers_linear_eigen_iterative_impl.hpp"
 #endif
 #ifdef PRESSIO_ENABLE_TPL_KOKKOS
+#include "solvers_linear_kokkos_direct_rhs.hpp"
 #include "solvers_linear_kokkos_direct_geqrf_impl.hpp"
 #include "solvers_linear_kokkos_direct_getrs_impl.hpp"
 #include "solvers_linear_kokkos_direct_potrs_lower_impl.hpp"
 #include "solvers_linear_kokkos_direct_potrs_upper_impl.hpp"
+#include "solvers_linear_kokkos_direct_nopivot_lu_impl.hpp"
 #endif
 
 namespace pressio{ namespace linearsolvers{ namespace impl{
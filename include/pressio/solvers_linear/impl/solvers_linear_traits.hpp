@@ -238,5 +238,17 @@ struct Traits<::pressio::linearsolvers::direct::geqrf>
 #endif
 };
 
+template <>
+struct Traits<::pressio::linearsolvers::direct::NoPivotLU>
+{
+  static constexpr bool direct = true;
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+  static constexpr bool eigen_enabled = false;
+#endif
+#ifdef PRESSIO_ENABLE_TPL_KOKKOS
+  static constexpr bool kokkos_enabled = true;
+#endif
+};
+
 }}
 #endif  // SOLVERS_LINEAR_IMPL_SOLVERS_LINEAR_TRAITS_HPP_
@@ -65,6 +65,8 @@ struct potrsL {};
 struct potrsU {};
 struct getrs{};
 struct geqrf{};
+// LU without pivoting, for matrices not needing it (e.g. normal equations)
+struct NoPivotLU{};
 }
 
 }}
@@ -4,20 +4,20 @@
 
 namespace pressio{ namespace nonlinearsolvers{ namespace impl{
 
+// r = r(state), for systems fusing the residual and jacobian
 #ifdef PRESSIO_ENABLE_CXX20
-  template<class RegistryType, class StateType, class SystemType>
-  requires NonlinearSystemFusingResidualAndJacobian<SystemType>
+template<class SystemType, class StateType, class ResidualType>
+requires NonlinearSystemFusingResidualAndJacobian<SystemType>
 #else
-  template<
-    class RegistryType, class StateType, class SystemType,
-    mpl::enable_if_t<NonlinearSystemFusingResidualAndJacobian<SystemType>::value, int> = 0
+template<
+  class SystemType, class StateType, class ResidualType,
+  mpl::enable_if_t<NonlinearSystemFusingResidualAndJacobian<SystemType>::value, int> = 0
   >
 #endif
-void compute_residual(RegistryType & reg,
-		      const StateType & state,
-		      const SystemType & system)
+void evaluate_residual(const SystemType & system,
+		       const StateType & state,
+		       ResidualType & r)
 {
-  auto & r = reg.template get<ResidualTag>();
 #ifdef PRESSIO_ENABLE_CXX17
   system.residualAndJacobian(state, r, {});
 #else
@@ -25,27 +25,44 @@ void compute_residual(RegistryType & reg,
 #endif
 }
 
+// r = r(state), for systems only providing the residual
 #ifdef PRESSIO_ENABLE_CXX20
-template<class RegistryType, class StateType, class SystemType>
+template<class SystemType, class StateType, class ResidualType>
 requires NonlinearSystem<SystemType>
+      && (!NonlinearSystemFusingResidualAndJacobian<SystemType>)
 #else
 template<
-  class RegistryType, class StateType, class SystemType,
-  mpl::enable_if_t< NonlinearSystem<SystemType>::value, int> = 0
+  class SystemType, class StateType, class ResidualType,
+  mpl::enable_if_t<
+    NonlinearSystem<SystemType>::value
+    && !NonlinearSystemFusingResidualAndJacobian<SystemType>::value, int> = 0
   >
 #endif
+void evaluate_residual(const SystemType & system,
+		       const StateType & state,
+		       ResidualType & r)
+{
+  system.residual(state, r);
+}
+
+template<class RegistryType, class StateType, class SystemType>
 void compute_residual(RegistryType & reg,
 		      const StateType & state,
 		      const SystemType & system)
 {
+  PRESSIO_PERF_ZONE("residual");
+  PRESSIO_PERF_COUNT("residual evaluations", 1);
   auto & r = reg.template get<ResidualTag>();
-  system.residual(state, r);
+  evaluate_residual(system, state, r);
 }
 
 template<class RegistryType, class SystemType>
 void compute_residual_and_jacobian(RegistryType & reg,
 				   const SystemType & system)
 {
+  PRESSIO_PERF_ZONE("residual and jacobian");
+  PRESSIO_PERF_COUNT("residual evaluations", 1);
+  PRESSIO_PERF_COUNT("jacobian evaluations", 1);
   const auto & state = reg.template get<StateTag>();
   auto & r = reg.template get<ResidualTag>();
   auto & j = reg.template get<JacobianTag>();
@@ -79,6 +96,183 @@ auto compute_half_sum_of_squares(const T & operand)
   return std::pow(normVal, two)*(one/two);
 }
 
+/*
+  detect if ops provides the fused normal equations kernel
+  computing H = J^T J, g = J^T r and r^T r in a single pass
+*/
+template <class JType, class RType, class HType, class GType, class = void>
+struct has_ops_normal_equations : std::false_type{};
+
+template <class JType, class RType, class HType, class GType>
+struct has_ops_normal_equations<
+  JType, RType, HType, GType,
+  ::pressio::mpl::void_t<
+    decltype(
+	     ::pressio::ops::normal_equations(std::declval<JType const &>(),
+					      std::declval<RType const &>(),
+					      std::declval<HType &>(),
+					      std::declval<GType &>())
+	     )
+    >
+  > : std::true_type{};
+
+template <class JType, class RType, class HType, class GType, class = void>
+struct has_ops_normal_equations_with_workspace : std::false_type{};
+
+template <class JType, class RType, class HType, class GType>
+struct has_ops_normal_equations_with_workspace<
+  JType, RType, HType, GType,
+  ::pressio::mpl::void_t<
+    decltype(
+	     ::pressio::ops::normal_equations(std::declval<JType const &>(),
+					      std::declval<RType const &>(),
+					      std::declval<HType &>(),
+					      std::declval<GType &>(),
+					      std::declval<::pressio::ops::NormalEquationsWorkspace<JType> &>())
+	     )
+    >
+  > : std::true_type{};
+
+template <
+  class JType, class WJType, class RType, class WRType,
+  class HType, class GType, class = void
+  >
+struct has_ops_weighted_normal_equations : std::false_type{};
+
+template <
+  class JType, class WJType, class RType, class WRType,
+  class HType, class GType
+  >
+struct has_ops_weighted_normal_equations<
+  JType, WJType, RType, WRType, HType, GType,
+  ::pressio::mpl::void_t<
+    decltype(
+	     ::pressio::ops::normal_equations(std::declval<JType const &>(),
+					      std::declval<WJType const &>(),
+					      std::declval<RType const &>(),
+					      std::declval<WRType const &>(),
+					      std::declval<HType &>(),
+					      std::declval<GType &>())
+	     )
+    >
+  > : std::true_type{};
+
+// backends needing scratch for the normal equations get the one held by the registry
+template<class JType, class RType, class HType, class GType>
+mpl::enable_if_t<
+  has_ops_normal_equations_with_workspace<JType, RType, HType, GType>::value,
+  scalar_trait_t<HType>
+  >
+call_ops_normal_equations(const JType & J, const RType & r, HType & H, GType & g,
+			  ::pressio::ops::NormalEquationsWorkspace<JType> & workspace)
+{
+  return ::pressio::ops::normal_equations(J, r, H, g, workspace);
+}
+
+template<class JType, class RType, class HType, class GType>
+mpl::enable_if_t<
+  !has_ops_normal_equations_with_workspace<JType, RType, HType, GType>::value,
+  scalar_trait_t<HType>
+  >
+call_ops_normal_equations(const JType & J, const RType & r, HType & H, GType & g,
+			  ::pressio::ops::NormalEquationsWorkspace<JType> & /*workspace*/)
+{
+  return ::pressio::ops::normal_equations(J, r, H, g);
+}
+
+// H = J^T J, g = J^T r, returns 0.5 * r^T r
+template<class JType, class RType, class HType, class GType>
+mpl::enable_if_t<
+  has_ops_normal_equations<JType, RType, HType, GType>::value,
+  scalar_trait_t<HType>
+  >
+compute_normal_equations_and_half_sum_of_squares(const JType & J,
+						 const RType & r,
+						 HType & H,
+						 GType & g,
+						 ::pressio::ops::NormalEquationsWorkspace<JType> & workspace)
+{
+  PRESSIO_PERF_ZONE("normal equations");
+  using sc_t = scalar_trait_t<HType>;
+  constexpr auto one = ::pressio::utils::Constants<sc_t>::one();
+  constexpr auto two = ::pressio::utils::Constants<sc_t>::two();
+  // fused: single pass over J and r
+  const auto rr = call_ops_normal_equations(J, r, H, g, workspace);
+  return rr*(one/two);
+}
+
+template<class JType, class RType, class HType, class GType>
+auto compute_normal_equations_and_half_sum_of_squares(const JType & J,
+						      const RType & r,
+						      HType & H,
+						      GType & g,
+						      ::pressio::ops::NormalEquationsWorkspace<JType> & /*workspace*/)
+  -> mpl::enable_if_t<
+       !has_ops_normal_equations<JType, RType, HType, GType>::value,
+       decltype(compute_half_sum_of_squares(r))
+     >
+{
+  PRESSIO_PERF_ZONE("normal equations");
+  constexpr auto pT  = ::pressio::transpose();
+  constexpr auto pnT = ::pressio::nontranspose();
+  ::pressio::ops::product(pT, pnT, 1, J, 0, H);
+  ::pressio::ops::product(pT, 1, J, r, 0, g);
+  return compute_half_sum_of_squares(r);
+}
+
+// H = J^T WJ, g = J^T Wr, returns 0.5 * r^T Wr
+template<
+  class JType, class WJType, class RType, class WRType,
+  class HType, class GType
+  >
+mpl::enable_if_t<
+  has_ops_weighted_normal_equations<JType, WJType, RType, WRType, HType, GType>::value,
+  scalar_trait_t<HType>
+  >
+compute_normal_equations_and_half_weighted_sum_of_squares(const JType & J,
+							  const WJType & WJ,
+							  const RType & r,
+							  const WRType & Wr,
+							  HType & H,
+							  GType & g)
+{
+  PRESSIO_PERF_ZONE("normal equations");
+  using sc_t = scalar_trait_t<HType>;
+  constexpr auto one = ::pressio::utils::Constants<sc_t>::one();
+  constexpr auto two = ::pressio::utils::Constants<sc_t>::two();
+  // fused: single pass over J, WJ, r and Wr
+  const auto rWr = ::pressio::ops::normal_equations(J, WJ, r, Wr, H, g);
+  return rWr*(one/two);
+}
+
+template<
+  class JType, class WJType, class RType, class WRType,
+  class HType, class GType
+  >
+auto compute_normal_equations_and_half_weighted_sum_of_squares(const JType & J,
+							       const WJType & WJ,
+							       const RType & r,
+							       const WRType & Wr,
+							       HType & H,
+							       GType & g)
+  -> mpl::enable_if_t<
+       !has_ops_weighted_normal_equations<JType, WJType, RType, WRType, HType, GType>::value,
+       mpl::remove_cvref_t<decltype(::pressio::ops::dot(r, Wr))>
+     >
+{
+  PRESSIO_PERF_ZONE("normal equations");
+  constexpr auto pT  = ::pressio::transpose();
+  constexpr auto pnT = ::pressio::nontranspose();
+  ::pressio::ops::product(pT, pnT, 1, J, WJ, 0, H);
+  ::pressio::ops::product(pT, 1, J, Wr, 0, g);
+
+  const auto v = ::pressio::ops::dot(r, Wr);
+  using sc_t = mpl::remove_cvref_t< decltype(v) >;
+  constexpr auto one  = ::pressio::utils::Constants<sc_t>::one();
+  constexpr auto two  = ::pressio::utils::Constants<sc_t>::two();
+  return v*(one/two);
+}
+
 template<class RegistryType, class StateType, class SystemType>
 auto compute_nonlinearls_objective(GaussNewtonNormalEqTag /*tag*/,
 				   RegistryType & reg,
@@ -153,13 +347,9 @@ auto compute_nonlinearls_operators_and_objective(GaussNewtonNormalEqTag /*tag*/,
   const auto & J = reg.template get<JacobianTag>();
   auto & g = reg.template get<GradientTag>();
   auto & H = reg.template get<HessianTag>();
-  constexpr auto pT  = ::pressio::transpose();
-  constexpr auto pnT = ::pressio::nontranspose();
+  auto & workspace = reg.template get<NormalEquationsWorkspaceTag>();
   // H = J_r^T J_r, g = J_r^T r
-  ::pressio::ops::product(pT, pnT, 1, J, 0, H);
-  ::pressio::ops::product(pT, 1, J, r, 0, g);
-
-  return compute_half_sum_of_squares(r);
+  return compute_normal_equations_and_half_sum_of_squares(J, r, H, g, workspace);
 }
 
 #ifdef PRESSIO_ENABLE_CXX20
@@ -207,8 +397,6 @@ auto compute_nonlinearls_operators_and_objective(WeightedGaussNewtonNormalEqTag
 {
   compute_residual_and_jacobian(reg, system);
 
-  constexpr auto pT  = ::pressio::transpose();
-  constexpr auto pnT = ::pressio::nontranspose();
   const auto & W = reg.template get<WeightingOperatorTag>();
   const auto & r = reg.template get<ResidualTag>();
   const auto & J = reg.template get<JacobianTag>();
@@ -219,14 +407,8 @@ auto compute_nonlinearls_operators_and_objective(WeightedGaussNewtonNormalEqTag
 
   W.get()(r, Wr);
   W.get()(J, WJ);
-  ::pressio::ops::product(pT, pnT, 1, J, WJ, 0, H);
-  ::pressio::ops::product(pT, 1, J, Wr, 0, g);
-
-  using sc_t = scalar_trait_t<typename SystemType::state_type>;
-  const auto v = ::pressio::ops::dot(r, Wr);
-  constexpr auto one  = ::pressio::utils::Constants<sc_t>::one();
-  constexpr auto two  = ::pressio::utils::Constants<sc_t>::two();
-  return v*(one/two);
+  // H = J_r^T W J_r, g = J_r^T W r
+  return compute_normal_equations_and_half_weighted_sum_of_squares(J, WJ, r, Wr, H, g);
 }
 
 
@@ -247,17 +429,16 @@ auto compute_nonlinearls_operators_and_objective(LevenbergMarquardtNormalEqTag /
 {
   compute_residual_and_jacobian(reg, system);
 
-  constexpr auto pT  = ::pressio::transpose();
-  constexpr auto pnT = ::pressio::nontranspose();
   const auto & r = reg.template get<ResidualTag>();
   const auto & J = reg.template get<JacobianTag>();
   auto & g = reg.template get<GradientTag>();
   auto & H = reg.template get<LevenbergMarquardtUndampedHessianTag>();
   auto & scaledH = reg.template get<HessianTag>();
   const auto & damp = reg.template get<LevenbergMarquardtDampingTag>();
+  auto & workspace = reg.template get<NormalEquationsWorkspaceTag>();
 
-  ::pressio::ops::product(pT, pnT, 1, J, 0, H);
-  ::pressio::ops::product(pT, 1, J, r, 0, g);
+  // H = J_r^T J_r, g = J_r^T r
+  const auto objective = compute_normal_equations_and_half_sum_of_squares(J, r, H, g, workspace);
 
   // compute scaledH = H + mu*diag(H)
   ::pressio::ops::deep_copy(scaledH, H);
@@ -265,7 +446,7 @@ auto compute_nonlinearls_operators_and_objective(LevenbergMarquardtNormalEqTag /
   auto diaglmH = ::pressio::diag(scaledH);
   ::pressio::ops::update(diaglmH, 1, diagH, damp);
 
-  return compute_half_sum_of_squares(r);
+  return objective;
 }
 
 template<class RegistryType>
@@ -281,7 +462,10 @@ void solve_newton_step(RegistryType & reg)
   auto & c = reg.template get<CorrectionTag>();
   auto & solver = reg.template get<InnerSolverTag>();
   // solve J_r correction = r
-  solver.get().solve(J, r, c);
+  {
+    PRESSIO_PERF_ZONE("linear solve");
+    solver.get().solve(J, r, c);
+  }
   // scale by -1 for sign convention
   using c_t = mpl::remove_cvref_t<decltype(c)>;
   using scalar_type = typename ::pressio::Traits<c_t>::scalar_type;
@@ -295,6 +479,7 @@ void solve_hessian_gradient_linear_system(RegistryType & reg)
   const auto & H = reg.template get<HessianTag>();
   auto & c = reg.template get<CorrectionTag>();
   auto & solver = reg.template get<InnerSolverTag>();
+  PRESSIO_PERF_ZONE("linear solve");
   solver.get().solve(H, g, c);
 }
 
@@ -367,6 +552,7 @@ void compute_correction(GaussNewtonQrTag /*tag*/,
   auto & c = reg.template get<CorrectionTag>();
   auto & QTr = reg.template get<QTransposeResidualTag>();
   auto & solver = reg.template get<InnerSolverTag>();
+  PRESSIO_PERF_ZONE("linear solve");
 
   // factorize J = QR
   solver.get().computeThin(J);
@@ -442,5 +628,123 @@ void compute_norm_internal_diagnostics(const RegistryType & reg,
   };//end switch
 }
 
+/*
+  evaluates the norm diagnostics at the end of each iteration,
+  by default each of them is computed with ops::norm2
+*/
+template<class StateType, class ScalarType, class = void>
+class NormDiagnosticsEvaluator
+{
+public:
+  template<class RegistryType, class DiagnosticsContainerType>
+  void operator()(const RegistryType & reg,
+		  bool isInitial,
+		  DiagnosticsContainerType & normDiagnostics,
+		  InternalDiagnostic /*stopMetric*/)
+  {
+    std::for_each(normDiagnostics.begin(), normDiagnostics.end(),
+		  [&reg, isInitial](auto & v){
+		    compute_norm_internal_diagnostics(reg, isInitial, v);
+		  });
+  }
+};
+
+#ifdef PRESSIO_ENABLE_TPL_KOKKOS
+template<class Tag, class RegistryType, class ViewType>
+mpl::enable_if_t< !RegistryType::template contains<Tag>(), bool >
+reduce_norm2_if_tag_if_present(Tag /*t*/,
+			       const RegistryType & /*reg*/,
+			       const ViewType & /*result*/)
+{ return false; }
+
+template<class Tag, class RegistryType, class ViewType>
+mpl::enable_if_t< RegistryType::template contains<Tag>(), bool >
+reduce_norm2_if_tag_if_present(Tag /*t*/,
+			       const RegistryType & reg,
+			       const ViewType & result)
+{
+  // result is a rank-0 view, so this does not wait for the reduction
+  ::KokkosBlas::nrm2(result, reg.template get<Tag>());
+  return true;
+}
+
+template<class RegistryType, class ViewType>
+bool reduce_norm_internal_diagnostic(const RegistryType & reg,
+				     InternalDiagnostic name,
+				     const ViewType & result)
+{
+  switch(name)
+  {
+    case InternalDiagnostic::residualAbsoluteRelativel2Norm:
+      return reduce_norm2_if_tag_if_present(ResidualTag{}, reg, result);
+
+    case InternalDiagnostic::correctionAbsoluteRelativel2Norm:
+      return reduce_norm2_if_tag_if_present(CorrectionTag{}, reg, result);
+
+    case InternalDiagnostic::gradientAbsoluteRelativel2Norm:
+      return reduce_norm2_if_tag_if_present(GradientTag{}, reg, result);
+
+    default: return false;
+  };//end switch
+}
+
+/*
+  for kokkos states the norms are reduced into a device view, one
+  entry per diagnostic, and only the entry used by the stopping
+  criterion is copied to the host every iteration. All of them are
+  copied, with a single transfer, only when info logging is compiled
+  in, since then the logger prints them.
+*/
+template<class StateType, class ScalarType>
+class NormDiagnosticsEvaluator<
+  StateType, ScalarType,
+  mpl::enable_if_t< ::pressio::is_vector_kokkos<StateType>::value >
+  >
+{
+  using norms_type = Kokkos::View<ScalarType*, typename StateType::memory_space>;
+  norms_type norms_ = {};
+  typename norms_type::HostMirror normsHost_ = {};
+  std::vector<char> reduced_ = {};
+
+public:
+  template<class RegistryType, class DiagnosticsContainerType>
+  void operator()(const RegistryType & reg,
+		  bool isInitial,
+		  DiagnosticsContainerType & normDiagnostics,
+		  InternalDiagnostic stopMetric)
+  {
+    auto & metrics = normDiagnostics.data();
+    const std::size_t count = metrics.size();
+    if (norms_.extent(0) != count){
+      norms_ = norms_type("pressio::normDiagnostics", count);
+      normsHost_ = Kokkos::create_mirror_view(norms_);
+      reduced_.resize(count);
+    }
+
+    int stopIndex = -1;
+    for (std::size_t i=0; i<count; ++i){
+      reduced_[i] = reduce_norm_internal_diagnostic(reg, metrics[i].name(),
+						    Kokkos::subview(norms_, i));
+      if (reduced_[i] && metrics[i].name() == stopMetric){
+	stopIndex = static_cast<int>(i);
+      }
+    }
+
+#if PRESSIO_LOG_ACTIVE_MIN_LEVEL <= PRESSIO_LOG_LEVEL_INFO
+    Kokkos::deep_copy(normsHost_, norms_);
+    for (std::size_t i=0; i<count; ++i){
+      if (reduced_[i]){ metrics[i].update(normsHost_(i), isInitial); }
+    }
+#else
+    if (stopIndex >= 0){
+      Kokkos::deep_copy(Kokkos::subview(normsHost_, stopIndex),
+			Kokkos::subview(norms_, stopIndex));
+      metrics[stopIndex].update(normsHost_(stopIndex), isInitial);
+    }
+#endif
+  }
+};
+#endif
+
 }}}
 #endif
@@ -13,8 +13,15 @@ struct SystemTag{};
 // this represent ths Q^T *r for QR gauss newton
 struct QTransposeResidualTag{};
 
+// this represents correction * diag(H) used for the LM gain factor
+struct LevenbergMarquardtScaledCorrectionTag{};
+
+// scratch passed to ops::normal_equations, see ops::NormalEquationsWorkspace
+struct NormalEquationsWorkspaceTag{};
+
 
 struct NewtonTag{};
+struct NewtonKrylovTag{};
 struct GaussNewtonNormalEqTag{};
 struct WeightedGaussNewtonNormalEqTag{};
 struct LevenbergMarquardtNormalEqTag{};
@@ -0,0 +1,309 @@
+
+#ifndef SOLVERS_NONLINEAR_IMPL_JACOBIAN_REUSE_HPP_
+#define SOLVERS_NONLINEAR_IMPL_JACOBIAN_REUSE_HPP_
+
+namespace pressio{
+namespace nonlinearsolvers{
+namespace impl{
+
+/*
+  Controls the reuse of the jacobian (and, for least-squares, the hessian)
+  across nonlinear iterations (frozen-jacobian/Shamanskii-type iterations).
+
+  When enabled, the operators computed at one iteration are kept for up
+  to maxReuse subsequent iterations, during which only the residual
+  (and the operators depending on it) are recomputed.
+  The operators are recomputed earlier if the norm of the monitored
+  quantity (the residual for Newton, the gradient for least-squares)
+  did not contract by at least the given factor at the last iteration.
+  Reuse only starts once an iteration with freshly computed operators
+  has contracted, i.e. once the iterate is in the region where the
+  frozen operators are a good enough model.
+
+  The decision is taken before evaluating the residual, from the
+  contraction observed at the previous iteration, so that each
+  iteration evaluates the residual exactly once: the systems compute
+  the jacobian fused with the residual, so checking the new residual
+  first would mean evaluating it twice whenever the reuse is rejected.
+
+  maxReuse == 0 means the operators are recomputed at every iteration,
+  which is the default behavior.
+*/
+template<class ScalarType>
+class JacobianReuseController
+{
+  int maxReuse_ = 0;
+  ScalarType contractionThreshold_ = static_cast<ScalarType>(0.5);
+  int numReused_ = 0;
+  ScalarType lastNorm_ = {};
+  bool contracting_ = false;
+
+public:
+  void set(int maxReuse, ScalarType contractionThreshold){
+    if (maxReuse < 0){
+      throw std::runtime_error("jacobian reuse: maxReuse must be non-negative");
+    }
+    maxReuse_ = maxReuse;
+    contractionThreshold_ = contractionThreshold;
+  }
+
+  int maxReuse() const { return maxReuse_; }
+  ScalarType contractionThreshold() const { return contractionThreshold_; }
+  bool isEnabled() const { return maxReuse_ > 0; }
+
+  bool mayReuse(bool isFirstIteration) const{
+    return isEnabled() && !isFirstIteration
+      && numReused_ < maxReuse_ && contracting_;
+  }
+
+  // forces the operators to be recomputed at the next iteration
+  void requestRecompute(){
+    numReused_ = maxReuse_;
+  }
+
+  void markRecomputed(ScalarType normValue, bool isFirstIteration){
+    numReused_ = 0;
+    contracting_ = !isFirstIteration
+      && normValue <= contractionThreshold_*lastNorm_;
+    lastNorm_ = normValue;
+  }
+
+  // records the norm obtained with the frozen operators:
+  // if it did not contract enough, the next iteration recomputes them
+  void markReused(ScalarType normValue){
+    ++numReused_;
+    contracting_ = normValue <= contractionThreshold_*lastNorm_;
+    lastNorm_ = normValue;
+  }
+};
+
+template<class SolverType, class RhsType, class SolutionType, class = void>
+struct linear_solver_can_reuse_factorization : std::false_type{};
+
+template<class SolverType, class RhsType, class SolutionType>
+struct linear_solver_can_reuse_factorization<
+  SolverType, RhsType, SolutionType,
+  ::pressio::mpl::void_t<
+    decltype( std::declval<const SolverType &>().isFactorized() ),
+    decltype( std::declval<SolverType &>().solveWithFactorization
+	      (std::declval<RhsType const &>(), std::declval<SolutionType &>()) )
+    >
+  > : std::true_type{};
+
+/*
+  solve A x = b where A is the same matrix passed to the previous solve:
+  if the linear solver exposes its factorization, reuse it directly
+  without even checking that A is unchanged
+*/
+template<class SolverType, class MatrixType, class RhsType, class SolutionType>
+mpl::enable_if_t< linear_solver_can_reuse_factorization<SolverType, RhsType, SolutionType>::value >
+solve_with_frozen_matrix(SolverType & solver,
+			 const MatrixType & A,
+			 const RhsType & b,
+			 SolutionType & x)
+{
+  PRESSIO_PERF_ZONE("linear solve");
+  if (solver.isFactorized()){
+    solver.solveWithFactorization(b, x);
+  }
+  else{
+    solver.solve(A, b, x);
+  }
+}
+
+template<class SolverType, class MatrixType, class RhsType, class SolutionType>
+mpl::enable_if_t< !linear_solver_can_reuse_factorization<SolverType, RhsType, SolutionType>::value >
+solve_with_frozen_matrix(SolverType & solver,
+			 const MatrixType & A,
+			 const RhsType & b,
+			 SolutionType & x)
+{
+  PRESSIO_PERF_ZONE("linear solve");
+  solver.solve(A, b, x);
+}
+
+/*
+  Newton: computes the residual and, unless reused, the jacobian,
+  evaluating the residual once either way.
+  Returns true if the jacobian has been recomputed.
+*/
+template<class RegistryType, class SystemType, class ScalarType>
+bool compute_residual_and_jacobian_or_reuse(RegistryType & reg,
+					    const SystemType & system,
+					    JacobianReuseController<ScalarType> & controller,
+					    bool isFirstIteration)
+{
+  const auto & r = reg.template get<ResidualTag>();
+
+  if (controller.mayReuse(isFirstIteration)){
+    PRESSIOLOG_DEBUG("nonlinsolver: reusing jacobian");
+    const auto & state = reg.template get<StateTag>();
+    compute_residual(reg, state, system);
+    controller.markReused(::pressio::ops::norm2(r));
+    return false;
+  }
+
+  compute_residual_and_jacobian(reg, system);
+  if (controller.isEnabled()){
+    controller.markRecomputed(::pressio::ops::norm2(r), isFirstIteration);
+  }
+  return true;
+}
+
+/*
+  least-squares: recompute only what depends on the residual,
+  keeping the jacobian and hessian from the previous iteration.
+*/
+template<class RegistryType, class StateType, class SystemType>
+auto compute_nonlinearls_operators_and_objective_with_frozen_jacobian(GaussNewtonNormalEqTag tag,
+								     RegistryType & reg,
+								     const StateType & state,
+								     const SystemType & system)
+{
+  const auto objective = compute_nonlinearls_objective(tag, reg, state, system);
+  compute_gradient(reg);
+  return objective;
+}
+
+template<class RegistryType, class StateType, class SystemType>
+auto compute_nonlinearls_operators_and_objective_with_frozen_jacobian(GaussNewtonQrTag tag,
+								     RegistryType & reg,
+								     const StateType & state,
+								     const SystemType & system)
+{
+  const auto objective = compute_nonlinearls_objective(tag, reg, state, system);
+  compute_gradient(reg);
+  return objective;
+}
+
+template<class RegistryType, class StateType, class SystemType>
+auto compute_nonlinearls_operators_and_objective_with_frozen_jacobian(WeightedGaussNewtonNormalEqTag tag,
+								     RegistryType & reg,
+								     const StateType & state,
+								     const SystemType & system)
+{
+  // this also computes Wr
+  const auto objective = compute_nonlinearls_objective(tag, reg, state, system);
+
+  // g = J_r^T W r
+  constexpr auto pT = ::pressio::transpose();
+  const auto & J  = reg.template get<JacobianTag>();
+  const auto & Wr = reg.template get<WeightedResidualTag>();
+  auto & g = reg.template get<GradientTag>();
+  ::pressio::ops::product(pT, 1, J, Wr, 0, g);
+  return objective;
+}
+
+template<class RegistryType, class StateType, class SystemType>
+auto compute_nonlinearls_operators_and_objective_with_frozen_jacobian(LevenbergMarquardtNormalEqTag tag,
+								     RegistryType & reg,
+								     const StateType & state,
+								     const SystemType & system)
+{
+  const auto objective = compute_nonlinearls_objective(tag, reg, state, system);
+  compute_gradient(reg);
+
+  // the damping might have changed, so recompute scaledH = H + mu*diag(H)
+  const auto & H = reg.template get<LevenbergMarquardtUndampedHessianTag>();
+  auto & scaledH = reg.template get<HessianTag>();
+  const auto & damp = reg.template get<LevenbergMarquardtDampingTag>();
+  ::pressio::ops::deep_copy(scaledH, H);
+  const auto diagH = ::pressio::diag(H);
+  auto diaglmH = ::pressio::diag(scaledH);
+  ::pressio::ops::update(diaglmH, 1, diagH, damp);
+  return objective;
+}
+
+/*
+  least-squares: computes the operators and the objective,
+  reusing the jacobian and hessian if possible.
+  Returns true if the jacobian has been recomputed.
+*/
+template<class Tag, class RegistryType, class SystemType, class ScalarType, class ObjectiveType>
+bool compute_nonlinearls_operators_and_objective_or_reuse(Tag tag,
+							  RegistryType & reg,
+							  const SystemType & system,
+							  JacobianReuseController<ScalarType> & controller,
+							  bool isFirstIteration,
+							  ObjectiveType & objective)
+{
+  const auto & g = reg.template get<GradientTag>();
+
+  if (controller.mayReuse(isFirstIteration)){
+    PRESSIOLOG_DEBUG("nonlinsolver: reusing jacobian and hessian");
+    const auto & state = reg.template get<StateTag>();
+    objective =
+      compute_nonlinearls_operators_and_objective_with_frozen_jacobian(tag, reg, state, system);
+    controller.markReused(::pressio::ops::norm2(g));
+    return false;
+  }
+
+  objective = compute_nonlinearls_operators_and_objective(tag, reg, system);
+  if (controller.isEnabled()){
+    controller.markRecomputed(::pressio::ops::norm2(g), isFirstIteration);
+  }
+  return true;
+}
+
+template<class RegistryType>
+void solve_newton_step_with_frozen_jacobian(RegistryType & reg)
+{
+  const auto & r = reg.template get<ResidualTag>();
+  const auto & J = reg.template get<JacobianTag>();
+  auto & c = reg.template get<CorrectionTag>();
+  auto & solver = reg.template get<InnerSolverTag>();
+  // solve J_r correction = r, then scale by -1 for sign convention
+  solve_with_frozen_matrix(solver.get(), J, r, c);
+  using c_t = mpl::remove_cvref_t<decltype(c)>;
+  using scalar_type = typename ::pressio::Traits<c_t>::scalar_type;
+  pressio::ops::scale(c, utils::Constants<scalar_type>::negOne() );
+}
+
+template<class Tag, class RegistryType>
+void compute_correction_with_frozen_jacobian(Tag tag, RegistryType & reg){
+  compute_correction(tag, reg);
+}
+
+template<class RegistryType>
+void compute_correction_with_frozen_hessian(RegistryType & reg)
+{
+  const auto & g = reg.template get<GradientTag>();
+  const auto & H = reg.template get<HessianTag>();
+  auto & c = reg.template get<CorrectionTag>();
+  auto & solver = reg.template get<InnerSolverTag>();
+  solve_with_frozen_matrix(solver.get(), H, g, c);
+  ::pressio::ops::scale(c, -1);
+}
+
+template<class RegistryType>
+void compute_correction_with_frozen_jacobian(GaussNewtonNormalEqTag /*tag*/,
+					     RegistryType & reg)
+{
+  compute_correction_with_frozen_hessian(reg);
+}
+
+template<class RegistryType>
+void compute_correction_with_frozen_jacobian(WeightedGaussNewtonNormalEqTag /*tag*/,
+					     RegistryType & reg)
+{
+  compute_correction_with_frozen_hessian(reg);
+}
+
+template<class RegistryType>
+void compute_correction_with_frozen_jacobian(GaussNewtonQrTag /*tag*/,
+					     RegistryType & reg)
+{
+  // same as compute_correction but the factorization
+  // of J computed at a previous iteration is reused
+  const auto & r  = reg.template get<ResidualTag>();
+  auto & c = reg.template get<CorrectionTag>();
+  auto & QTr = reg.template get<QTransposeResidualTag>();
+  auto & solver = reg.template get<InnerSolverTag>();
+  PRESSIO_PERF_ZONE("linear solve");
+  solver.get().applyQTranspose(r, QTr);
+  solver.get().solve(QTr, c);
+  ::pressio::ops::scale(c, -1);
+}
+
+}}}
+#endif
@@ -0,0 +1,377 @@
+
+#ifndef SOLVERS_NONLINEAR_IMPL_NEWTON_KRYLOV_HPP_
+#define SOLVERS_NONLINEAR_IMPL_NEWTON_KRYLOV_HPP_
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace pressio{ namespace nonlinearsolvers{ namespace impl{
+
+/*
+  Forcing term eta_k for the inexact Newton step ||J_k c_k + r_k|| <= eta_k ||r_k||.
+
+  By default this is the second choice of Eisenstat and Walker:
+    eta_k = gamma (||r_k|| / ||r_k-1||)^alpha,
+  safeguarded so that it does not drop too fast:
+    eta_k = max(eta_k, gamma eta_k-1^alpha) if gamma eta_k-1^alpha > 0.1,
+  and bounded by etaMax. The first iteration uses eta0.
+  Alternatively, a constant forcing term can be used.
+*/
+template<class ScalarType>
+class EisenstatWalkerForcing
+{
+  bool constant_ = false;
+  ScalarType eta0_   = static_cast<ScalarType>(0.5);
+  ScalarType etaMax_ = static_cast<ScalarType>(0.9);
+  ScalarType gamma_  = static_cast<ScalarType>(0.9);
+  ScalarType alpha_  = static_cast<ScalarType>(2);
+  ScalarType etaPrev_ = {};
+  ScalarType residualNormPrev_ = {};
+
+public:
+  void setEisenstatWalker(ScalarType gamma, ScalarType alpha,
+			  ScalarType eta0, ScalarType etaMax)
+  {
+    constant_ = false;
+    gamma_ = gamma;
+    alpha_ = alpha;
+    eta0_ = eta0;
+    etaMax_ = etaMax;
+  }
+
+  void setConstant(ScalarType eta){
+    constant_ = true;
+    eta0_ = eta;
+  }
+
+  ScalarType next(bool isFirstIteration, ScalarType residualNorm)
+  {
+    ScalarType eta = eta0_;
+    if (!constant_ && !isFirstIteration && residualNormPrev_ > ScalarType{0})
+    {
+      eta = gamma_ * std::pow(residualNorm / residualNormPrev_, alpha_);
+      const ScalarType safeguard = gamma_ * std::pow(etaPrev_, alpha_);
+      if (safeguard > static_cast<ScalarType>(0.1)){
+	eta = (std::max)(eta, safeguard);
+      }
+      eta = (std::min)(eta, etaMax_);
+    }
+    etaPrev_ = eta;
+    residualNormPrev_ = residualNorm;
+    return eta;
+  }
+};
+
+/*
+  Restarted GMRES(m) for A x = b that only needs the action of A,
+  with modified Gram-Schmidt and Givens rotations on the Hessenberg matrix.
+  The Krylov basis and the small dense arrays are allocated once,
+  so repeated solves do not allocate.
+*/
+template<class VectorType, class ScalarType>
+class MatrixFreeGmres
+{
+  int restart_ = 30;
+  int maxIters_ = 200;
+  std::vector<VectorType> basis_;
+  VectorType w_;
+  // column-major (restart_+1) x restart_ Hessenberg matrix
+  std::vector<ScalarType> H_;
+  std::vector<ScalarType> cs_;
+  std::vector<ScalarType> sn_;
+  std::vector<ScalarType> g_;
+  std::vector<ScalarType> y_;
+  int iterations_ = 0;
+  ScalarType relativeResidual_ = {};
+
+public:
+  explicit MatrixFreeGmres(const VectorType & prototype)
+    : w_(::pressio::ops::clone(prototype))
+  {
+    this->allocate();
+  }
+
+  void setRestart(int restart){
+    if (restart < 1){
+      throw std::runtime_error("gmres: the restart length must be >= 1");
+    }
+    restart_ = restart;
+    this->allocate();
+  }
+
+  void setMaxIterations(int maxIters){ maxIters_ = maxIters; }
+
+  int iterations() const{ return iterations_; }
+  ScalarType relativeResidual() const{ return relativeResidual_; }
+
+  /*
+    starting from x = 0, iterate until ||b - A x|| <= relTol ||b||
+    or the max number of iterations is reached, returns true if converged.
+    applyA(v, Av) must compute Av = A v.
+  */
+  template<class OperatorType>
+  bool solve(OperatorType && applyA,
+	     const VectorType & b,
+	     VectorType & x,
+	     ScalarType relTol)
+  {
+    constexpr auto zero = ::pressio::utils::Constants<ScalarType>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<ScalarType>::one();
+
+    ::pressio::ops::set_zero(x);
+    iterations_ = 0;
+    relativeResidual_ = zero;
+
+    const ScalarType bNorm = ::pressio::ops::norm2(b);
+    if (bNorm == zero){
+      return true;
+    }
+    const ScalarType target = relTol * bNorm;
+
+    // the first basis vector is the (normalized) residual, which is b since x = 0
+    ::pressio::ops::deep_copy(basis_[0], b);
+    ScalarType residualNorm = bNorm;
+    while (true)
+    {
+      ::pressio::ops::scale(basis_[0], one / residualNorm);
+      std::fill(g_.begin(), g_.end(), zero);
+      g_[0] = residualNorm;
+
+      int k = 0;
+      for (int j = 0; j < restart_ && iterations_ < maxIters_; ++j)
+      {
+	applyA(basis_[j], w_);
+	++iterations_;
+	k = j + 1;
+
+	for (int i = 0; i <= j; ++i){
+	  const ScalarType h = ::pressio::ops::dot(w_, basis_[i]);
+	  this->H(i, j) = h;
+	  ::pressio::ops::update(w_, one, basis_[i], -h);
+	}
+	const ScalarType hNext = ::pressio::ops::norm2(w_);
+	this->H(j+1, j) = hNext;
+
+	// apply the previous rotations to the new column, then eliminate H(j+1,j)
+	for (int i = 0; i < j; ++i){
+	  const ScalarType tmp = cs_[i] * this->H(i, j) + sn_[i] * this->H(i+1, j);
+	  this->H(i+1, j) = -sn_[i] * this->H(i, j) + cs_[i] * this->H(i+1, j);
+	  this->H(i, j) = tmp;
+	}
+	const ScalarType denom = std::sqrt(this->H(j, j) * this->H(j, j) + hNext * hNext);
+	cs_[j] = (denom == zero) ? one  : this->H(j, j) / denom;
+	sn_[j] = (denom == zero) ? zero : hNext / denom;
+	this->H(j, j) = denom;
+	this->H(j+1, j) = zero;
+	g_[j+1] = -sn_[j] * g_[j];
+	g_[j]   =  cs_[j] * g_[j];
+
+	residualNorm = std::abs(g_[j+1]);
+	// hNext == 0 means the Krylov space is invariant, so the solution is exact
+	if (residualNorm <= target || hNext == zero){
+	  break;
+	}
+	::pressio::ops::deep_copy(basis_[j+1], w_);
+	::pressio::ops::scale(basis_[j+1], one / hNext);
+      }
+
+      // x += V_k y, where y solves the k x k upper triangular system H y = g
+      for (int i = k - 1; i >= 0; --i){
+	ScalarType sum = g_[i];
+	for (int l = i + 1; l < k; ++l){
+	  sum -= this->H(i, l) * y_[l];
+	}
+	y_[i] = (this->H(i, i) == zero) ? zero : sum / this->H(i, i);
+      }
+      for (int i = 0; i < k; ++i){
+	::pressio::ops::update(x, one, basis_[i], y_[i]);
+      }
+
+      if (residualNorm <= target || iterations_ >= maxIters_ || k == 0){
+	break;
+      }
+
+      // restart from the true residual b - A x
+      applyA(x, w_);
+      ::pressio::ops::deep_copy(basis_[0], b);
+      ::pressio::ops::update(basis_[0], one, w_, -one);
+      residualNorm = ::pressio::ops::norm2(basis_[0]);
+      if (residualNorm <= target){
+	break;
+      }
+    }
+
+    relativeResidual_ = residualNorm / bNorm;
+    return residualNorm <= target;
+  }
+
+private:
+  ScalarType & H(int i, int j){ return H_[i + j * (restart_ + 1)]; }
+
+  void allocate()
+  {
+    basis_.clear();
+    basis_.reserve(restart_ + 1);
+    for (int i = 0; i < restart_ + 1; ++i){
+      basis_.push_back(::pressio::ops::clone(w_));
+    }
+    H_.assign((restart_ + 1) * restart_, ScalarType{});
+    cs_.assign(restart_, ScalarType{});
+    sn_.assign(restart_, ScalarType{});
+    g_.assign(restart_ + 1, ScalarType{});
+    y_.assign(restart_, ScalarType{});
+  }
+};
+
+/*
+  Inner solver of the Newton-Krylov method: solves J c = r with GMRES
+  to the accuracy given by the forcing term, where J v is either
+  provided by the system via applyJacobian(state, v, Jv), or
+  approximated by the forward difference (r(x + h v) - r(x)) / h,
+  with h = sqrt(eps) (1 + ||x||) / ||v||.
+  The Jacobian is never formed.
+*/
+template<class StateType, class ScalarType>
+class NewtonKrylovInnerSolver
+{
+public:
+  using scalar_type = ScalarType;
+
+private:
+  MatrixFreeGmres<StateType, ScalarType> gmres_;
+  EisenstatWalkerForcing<ScalarType> forcing_ = {};
+  StateType perturbedState_;
+  StateType perturbedResidual_;
+
+public:
+  template<class SystemType>
+  explicit NewtonKrylovInnerSolver(const SystemType & system)
+    : gmres_(system.createResidual()),
+      perturbedState_(system.createState()),
+      perturbedResidual_(system.createResidual()){}
+
+  MatrixFreeGmres<StateType, ScalarType> & gmres(){ return gmres_; }
+  EisenstatWalkerForcing<ScalarType> & forcing(){ return forcing_; }
+
+  template<class SystemType>
+  void solve(const SystemType & system,
+	     const StateType & state,
+	     const StateType & residual,
+	     StateType & correction,
+	     bool isFirstIteration)
+  {
+    const ScalarType residualNorm = ::pressio::ops::norm2(residual);
+    const ScalarType eta = forcing_.next(isFirstIteration, residualNorm);
+    const ScalarType stateNorm = ::pressio::ops::norm2(state);
+
+    auto jacobianAction = [&](const StateType & v, StateType & Jv){
+      this->applyJacobian(system, state, stateNorm, residual, v, Jv);
+    };
+
+    const bool converged = gmres_.solve(jacobianAction, residual, correction, eta);
+    PRESSIO_PERF_COUNT("krylov iterations", gmres_.iterations());
+    PRESSIOLOG_DEBUG("newton-krylov: forcing term = {:.6e}, gmres iterations = {}, relative residual = {:.6e}",
+		     eta, gmres_.iterations(), gmres_.relativeResidual());
+    if (!converged){
+      PRESSIOLOG_DEBUG("newton-krylov: gmres did not reach the forcing term");
+    }
+  }
+
+private:
+#ifdef PRESSIO_ENABLE_CXX20
+  template<class SystemType>
+  requires NonlinearSystemWithJacobianAction<SystemType>
+#else
+  template<
+    class SystemType,
+    mpl::enable_if_t<NonlinearSystemWithJacobianAction<SystemType>::value, int> = 0
+    >
+#endif
+  void applyJacobian(const SystemType & system,
+		     const StateType & state,
+		     ScalarType /*stateNorm*/,
+		     const StateType & /*residual*/,
+		     const StateType & v,
+		     StateType & Jv)
+  {
+    system.applyJacobian(state, v, Jv);
+  }
+
+#ifdef PRESSIO_ENABLE_CXX20
+  template<class SystemType>
+  requires (!NonlinearSystemWithJacobianAction<SystemType>)
+#else
+  template<
+    class SystemType,
+    mpl::enable_if_t<!NonlinearSystemWithJacobianAction<SystemType>::value, int> = 0
+    >
+#endif
+  void applyJacobian(const SystemType & system,
+		     const StateType & state,
+		     ScalarType stateNorm,
+		     const StateType & residual,
+		     const StateType & v,
+		     StateType & Jv)
+  {
+    constexpr auto zero = ::pressio::utils::Constants<ScalarType>::zero();
+    constexpr auto one  = ::pressio::utils::Constants<ScalarType>::one();
+
+    const ScalarType vNorm = ::pressio::ops::norm2(v);
+    if (vNorm == zero){
+      ::pressio::ops::set_zero(Jv);
+      return;
+    }
+
+    const ScalarType h = std::sqrt(std::numeric_limits<ScalarType>::epsilon())
+      * (one + stateNorm) / vNorm;
+    ::pressio::ops::deep_copy(perturbedState_, state);
+    ::pressio::ops::update(perturbedState_, one, v, h);
+    evaluate_residual(system, perturbedState_, perturbedResidual_);
+    PRESSIO_PERF_COUNT("residual evaluations", 1);
+
+    ::pressio::ops::deep_copy(Jv, perturbedResidual_);
+    ::pressio::ops::update(Jv, one / h, residual, -one / h);
+  }
+};
+
+/*
+  stages of the Newton-Krylov iteration, see root_solving_loop_impl:
+  only the residual is computed, and the correction comes from the Krylov solve
+*/
+template<class RegistryType, class SystemType, class ReuseControllerType>
+bool compute_newton_operators(NewtonKrylovTag /*tag*/,
+			      RegistryType & reg,
+			      const SystemType & system,
+			      ReuseControllerType & /*reuseController*/,
+			      bool /*isFirstIteration*/)
+{
+  const auto & state = reg.template get<StateTag>();
+  compute_residual(reg, state, system);
+  return true;
+}
+
+template<class RegistryType, class SystemType>
+void compute_newton_correction(NewtonKrylovTag /*tag*/,
+			       RegistryType & reg,
+			       const SystemType & system,
+			       bool /*jacobianRecomputed*/,
+			       bool isFirstIteration)
+{
+  /* same sign convention as the Newton step:
+     solve J_r correction = r, then scale by -1 */
+  const auto & state = reg.template get<StateTag>();
+  const auto & r = reg.template get<ResidualTag>();
+  auto & c = reg.template get<CorrectionTag>();
+  auto & solver = reg.template get<InnerSolverTag>();
+  {
+    PRESSIO_PERF_ZONE("linear solve");
+    solver.get().solve(system, state, r, c, isFirstIteration);
+  }
+  using c_t = mpl::remove_cvref_t<decltype(c)>;
+  using scalar_type = typename ::pressio::Traits<c_t>::scalar_type;
+  pressio::ops::scale(c, utils::Constants<scalar_type>::negOne() );
+}
+
+}}}
+#endif
@@ -2,6 +2,8 @@
 #ifndef SOLVERS_NONLINEAR_IMPL_LEAST_SQUARES_SOLVER_HPP_
 #define SOLVERS_NONLINEAR_IMPL_LEAST_SQUARES_SOLVER_HPP_
 
+#include <utility>
+
 namespace pressio{
 namespace nonlinearsolvers{
 namespace impl{
@@ -12,7 +14,9 @@ template<
   class RegistryType,
   class ToleranceType,
   class DiagnosticsContainerType,
+  class NormDiagnosticsEvaluatorType,
   class DiagnosticsLoggerType,
+  class ReuseControllerType,
   class UpdaterType>
 void nonlin_ls_solving_loop_impl(ProblemTag problemTag,
 				 const UserDefinedSystemType & system,
@@ -20,10 +24,13 @@ void nonlin_ls_solving_loop_impl(ProblemTag problemTag,
 				 Stop stopEnumValue,
 				 ToleranceType stopTolerance,
 				 DiagnosticsContainerType & normDiagnostics,
+				 NormDiagnosticsEvaluatorType & normEvaluator,
 				 const DiagnosticsLoggerType & logger,
 				 int maxIters,
+				 ReuseControllerType & reuseController,
 				 UpdaterType && updater)
 {
+  PRESSIO_PERF_ZONE("nonlinear solve");
 
   auto mustStop = [
 #ifdef PRESSIO_ENABLE_CXX17
@@ -46,13 +53,22 @@ void nonlin_ls_solving_loop_impl(ProblemTag problemTag,
     };
   };
 
+  const InternalDiagnostic stopMetric =
+    public_to_internal_diagnostic(stop_criterion_to_public_diagnostic(stopEnumValue));
+
   int iStep = 0;
   while (++iStep <= maxIters){
+    PRESSIO_PERF_COUNT("nonlinear iterations", 1);
     const bool isFirstIteration = iStep==1;
 
     // 1. compute operators
+    bool operatorsRecomputed = true;
     try{
-      auto objValue = compute_nonlinearls_operators_and_objective(problemTag, reg, system);
+      using obj_value_type = decltype(compute_nonlinearls_operators_and_objective(problemTag, reg, system));
+      obj_value_type objValue = {};
+      operatorsRecomputed = compute_nonlinearls_operators_and_objective_or_reuse(problemTag, reg, system,
+										 reuseController,
+										 isFirstIteration, objValue);
       normDiagnostics[InternalDiagnostic::objectiveAbsoluteRelative].update(objValue, isFirstIteration);
     }
     catch (::pressio::eh::ResidualEvaluationFailureUnrecoverable const &e){
@@ -65,17 +81,26 @@ void nonlin_ls_solving_loop_impl(ProblemTag problemTag,
     }
 
     // 2. solve for correction
-    compute_correction(problemTag, reg);
+    if (operatorsRecomputed){
+      compute_correction(problemTag, reg);
+    }else{
+      compute_correction_with_frozen_jacobian(problemTag, reg);
+    }
 
     /* stage 3 */
-    std::for_each(normDiagnostics.begin(), normDiagnostics.end(),
-		  [&reg, isFirstIteration](auto & v){
-		    compute_norm_internal_diagnostics(reg, isFirstIteration, v);
-		  });
+    normEvaluator(reg, isFirstIteration, normDiagnostics, stopMetric);
     logger(iStep, normDiagnostics);
 
     /* stage 4*/
     if (mustStop(iStep)){
+      // with frozen operators, the iteration converges to a point where
+      // the *old* jacobian is orthogonal to the residual, so convergence
+      // must be confirmed with freshly computed operators
+      if (!operatorsRecomputed && iStep < maxIters){
+	PRESSIOLOG_DEBUG("nonlinsolver: confirming convergence with new jacobian");
+	reuseController.requestRecompute();
+	continue;
+      }
       PRESSIOLOG_DEBUG("nonlinsolver: stopping");
       break;
     }
@@ -120,7 +145,9 @@ class NonLinLeastSquares : public RegistryType
   using diagnostics_container = DiagnosticsContainer<
     InternalDiagnosticDataWithAbsoluteRelativeTracking<ScalarType> >;
   diagnostics_container diagnostics_;
+  NormDiagnosticsEvaluator<StateType, ScalarType> normEvaluator_ = {};
   DiagnosticsLogger diagnosticsLogger_ = {};
+  JacobianReuseController<ScalarType> reuseController_ = {};
 
 public:
   template<class ...Args>
@@ -161,6 +188,12 @@ public:
   void setStopTolerance(ScalarType value) { stopTolerance_ = value; }
   void setMaxIterations(int newMax)       { maxIters_ = newMax; }
 
+  // keep the jacobian and hessian for up to maxReuse iterations,
+  // or until an iteration fails to contract ||g|| by the given factor
+  void setJacobianReuse(int maxReuse, ScalarType contractionThreshold = 0.5){
+    reuseController_.set(maxReuse, contractionThreshold);
+  }
+
   // this method can be used when passing a system object
   // that is different but syntactically and semantically equivalent
   // to the one used for constructing the solver
@@ -213,8 +246,8 @@ private:
 
     nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				stopEnValue_, stopTolerance_,
-				diagnostics_, diagnosticsLogger_,
-				maxIters_,
+				diagnostics_, normEvaluator_, diagnosticsLogger_,
+				maxIters_, reuseController_,
 				DefaultUpdater());
   }
 
@@ -222,9 +255,9 @@ private:
   void solve_with_line_search_impl(const SystemType & system,
 				   StateType & solutionInOut)
   {
+    // the trial state is owned by the registry, so no allocation here
     auto extReg = reference_capture_registry_and_extend_with<
-      StateTag, LineSearchTrialStateTag,
-      StateType &, StateType>(*this, solutionInOut, system.createState());
+      StateTag, StateType &>(*this, solutionInOut);
 
     // the solve method potentially be called multiple times
     // so we need to reset the data in the registry everytime
@@ -233,14 +266,14 @@ private:
     if (updateEnValue_ == Update::BacktrackStrictlyDecreasingObjective){
       nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				  stopEnValue_, stopTolerance_,
-				  diagnostics_, diagnosticsLogger_,
-				  maxIters_,
+				  diagnostics_, normEvaluator_, diagnosticsLogger_,
+				  maxIters_, reuseController_,
 				  BacktrackStrictlyDecreasingObjectiveUpdater{});
     }else{
       nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				  stopEnValue_, stopTolerance_,
-				  diagnostics_, diagnosticsLogger_,
-				  maxIters_,
+				  diagnostics_, normEvaluator_, diagnosticsLogger_,
+				  maxIters_, reuseController_,
 				  BacktrackStrictlyDecreasingObjectiveUpdater{});
     }
   }
@@ -250,28 +283,28 @@ private:
   solve_lm_impl(const SystemType & system,
 		StateType & solutionInOut)
   {
+    // the trial state is owned by the registry, so no allocation here
     auto extReg = reference_capture_registry_and_extend_with<
-      StateTag, LineSearchTrialStateTag,
-      StateType &, StateType>(*this, solutionInOut, system.createState());
+      StateTag, StateType &>(*this, solutionInOut);
 
     // the solve method potentially be called multiple times
     // so we need to reset the data in the registry everytime
     reset_for_new_solve_loop(tag_, extReg);
 
     if (updateEnValue_ == Update::LMSchedule1){
-      using up_t = LMSchedule1Updater<ScalarType, StateType>;
+      using up_t = LMSchedule1Updater<ScalarType>;
       nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				  stopEnValue_, stopTolerance_,
-				  diagnostics_, diagnosticsLogger_,
-				  maxIters_,
-				  up_t(solutionInOut));
+				  diagnostics_, normEvaluator_, diagnosticsLogger_,
+				  maxIters_, reuseController_,
+				  up_t{});
     }else{
-      using up_t = LMSchedule2Updater<ScalarType, StateType>;
+      using up_t = LMSchedule2Updater<ScalarType>;
       nonlin_ls_solving_loop_impl(tag_, system, extReg,
 				  stopEnValue_, stopTolerance_,
-				  diagnostics_, diagnosticsLogger_,
-				  maxIters_,
-				  up_t(solutionInOut));
+				  diagnostics_, normEvaluator_, diagnosticsLogger_,
+				  maxIters_, reuseController_,
+				  up_t{});
     }
   }
 
@@ -8,6 +8,12 @@ namespace pressio{
 namespace nonlinearsolvers{
 namespace impl{
 
+/*
+  All operands, including the scratch used by the line searches and
+  the LM updaters, are created once here and reused by every solve,
+  so that repeated solves with the same solver do not allocate.
+*/
+
 #define GETMETHOD(N) \
   template<class Tag, mpl::enable_if_t< std::is_same<Tag, Tag##N >::value, int> = 0> \
   auto & get(){ return d##N##_; } \
@@ -28,6 +34,7 @@ class RegistryNewton
   using Tag4 = nonlinearsolvers::JacobianTag;
   using Tag5 = nonlinearsolvers::InnerSolverTag;
   using Tag6 = nonlinearsolvers::impl::SystemTag;
+  using Tag7 = nonlinearsolvers::LineSearchTrialStateTag;
 
   state_t d1_;
   state_t d2_;
@@ -35,6 +42,7 @@ class RegistryNewton
   j_t d4_;
   utils::InstanceOrReferenceWrapper<InnSolverType> d5_;
   SystemType const * d6_;
+  state_t d7_;
 
 public:
   template<class _InnSolverType>
@@ -44,7 +52,58 @@ public:
       d3_(system.createResidual()),
       d4_(system.createJacobian()),
       d5_(std::forward<_InnSolverType>(innS)),
-      d6_(&system){}
+      d6_(&system),
+      d7_(system.createState()){}
+
+  template<class TagToFind>
+  static constexpr bool contains(){
+    return (mpl::variadic::find_if_binary_pred_t<TagToFind, std::is_same,
+	   Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7>::value) < 7;
+  }
+
+  GETMETHOD(1)
+  GETMETHOD(2)
+  GETMETHOD(3)
+  GETMETHOD(4)
+  GETMETHOD(5)
+  GETMETHOD(6)
+  GETMETHOD(7)
+};
+
+/*
+  Newton-Krylov: there is no jacobian, the inner solver
+  only needs the action of the jacobian on a vector
+*/
+template<class SystemType, class InnSolverType>
+class RegistryNewtonKrylov
+{
+  using state_t    = typename SystemType::state_type;
+  using r_t        = typename SystemType::residual_type;
+  using scalar_t   = typename mpl::remove_cvref_t<InnSolverType>::scalar_type;
+
+  using Tag1 = nonlinearsolvers::CorrectionTag;
+  using Tag2 = nonlinearsolvers::InitialGuessTag;
+  using Tag3 = nonlinearsolvers::ResidualTag;
+  using Tag4 = nonlinearsolvers::InnerSolverTag;
+  using Tag5 = nonlinearsolvers::impl::SystemTag;
+  using Tag6 = nonlinearsolvers::LineSearchTrialStateTag;
+
+  state_t d1_;
+  state_t d2_;
+  r_t d3_;
+  utils::InstanceOrReferenceWrapper<InnSolverType> d4_;
+  SystemType const * d5_;
+  state_t d6_;
+
+public:
+  template<class _InnSolverType>
+  RegistryNewtonKrylov(const SystemType & system, _InnSolverType && innS)
+    : d1_(system.createState()),
+      d2_(system.createState()),
+      d3_(system.createResidual()),
+      d4_(std::forward<_InnSolverType>(innS)),
+      d5_(&system),
+      d6_(system.createState()){}
 
   template<class TagToFind>
   static constexpr bool contains(){
@@ -58,6 +117,15 @@ public:
   GETMETHOD(4)
   GETMETHOD(5)
   GETMETHOD(6)
+
+  void setKrylovRestart(int restart){ d4_.get().gmres().setRestart(restart); }
+  void setMaxKrylovIterations(int maxIters){ d4_.get().gmres().setMaxIterations(maxIters); }
+
+  void setConstantForcingTerm(scalar_t eta){ d4_.get().forcing().setConstant(eta); }
+  void setEisenstatWalkerForcingTerm(scalar_t gamma, scalar_t alpha,
+				     scalar_t eta0, scalar_t etaMax){
+    d4_.get().forcing().setEisenstatWalker(gamma, alpha, eta0, etaMax);
+  }
 };
 
 template<class SystemType, class InnSolverType>
@@ -78,6 +146,8 @@ class RegistryGaussNewtonNormalEqs
   using Tag6 = nonlinearsolvers::HessianTag;
   using Tag7 = nonlinearsolvers::InnerSolverTag;
   using Tag8 = nonlinearsolvers::impl::SystemTag;
+  using Tag9 = nonlinearsolvers::LineSearchTrialStateTag;
+  using Tag10 = nonlinearsolvers::impl::NormalEquationsWorkspaceTag;
 
   state_t d1_;
   state_t d2_;
@@ -87,6 +157,8 @@ class RegistryGaussNewtonNormalEqs
   hessian_t d6_;
   utils::InstanceOrReferenceWrapper<InnSolverType> d7_;
   SystemType const * d8_;
+  state_t d9_;
+  ::pressio::ops::NormalEquationsWorkspace<j_t> d10_;
 
 public:
   template<class _InnSolverType>
@@ -98,12 +170,14 @@ public:
       d5_(system.createState()),
       d6_( hg_default::createHessian(system.createState()) ),
       d7_(std::forward<_InnSolverType>(innS)),
-      d8_(&system){}
+      d8_(&system),
+      d9_(system.createState()),
+      d10_{}{}
 
   template<class TagToFind>
   static constexpr bool contains(){
     return (mpl::variadic::find_if_binary_pred_t<TagToFind, std::is_same,
-	   Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8>::value) < 8;
+	   Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8, Tag9, Tag10>::value) < 10;
   }
 
   GETMETHOD(1)
@@ -114,6 +188,8 @@ public:
   GETMETHOD(6)
   GETMETHOD(7)
   GETMETHOD(8)
+  GETMETHOD(9)
+  GETMETHOD(10)
 };
 
 template<class SystemType, class InnSolverType, class WeightingOpType>
@@ -137,6 +213,7 @@ class RegistryWeightedGaussNewtonNormalEqs
   using Tag9  = nonlinearsolvers::InnerSolverTag;
   using Tag10 = nonlinearsolvers::WeightingOperatorTag;
   using Tag11 = nonlinearsolvers::impl::SystemTag;
+  using Tag12 = nonlinearsolvers::LineSearchTrialStateTag;
 
   state_t d1_;
   state_t d2_;
@@ -149,6 +226,7 @@ class RegistryWeightedGaussNewtonNormalEqs
   utils::InstanceOrReferenceWrapper<InnSolverType> d9_;
   utils::InstanceOrReferenceWrapper<WeightingOpType> d10_;
   SystemType const * d11_;
+  state_t d12_;
 
 public:
   template<class _InnSolverType, class _WeightingOpType>
@@ -165,12 +243,13 @@ public:
       d8_( hg_default::createHessian(system.createState()) ),
       d9_(std::forward<InnSolverType>(innS)),
       d10_(std::forward<_WeightingOpType>(weigher)),
-      d11_(&system){}
+      d11_(&system),
+      d12_(system.createState()){}
 
   template<class TagToFind>
   static constexpr bool contains(){
     return (mpl::variadic::find_if_binary_pred_t<TagToFind, std::is_same,
-	    Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8, Tag9, Tag10, Tag11>::value) < 11;
+	    Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8, Tag9, Tag10, Tag11, Tag12>::value) < 12;
   }
 
   GETMETHOD(1)
@@ -184,6 +263,7 @@ public:
   GETMETHOD(9)
   GETMETHOD(10)
   GETMETHOD(11)
+  GETMETHOD(12)
 };
 
 
@@ -204,6 +284,7 @@ class RegistryGaussNewtonQr
   using Tag6 = nonlinearsolvers::impl::QTransposeResidualTag;
   using Tag7 = nonlinearsolvers::InnerSolverTag;
   using Tag8 = nonlinearsolvers::impl::SystemTag;
+  using Tag9 = nonlinearsolvers::LineSearchTrialStateTag;
 
   state_t d1_;
   state_t d2_;
@@ -213,6 +294,7 @@ class RegistryGaussNewtonQr
   QTr_t d6_;
   utils::InstanceOrReferenceWrapper<QRSolverType> d7_;
   SystemType const * d8_;
+  state_t d9_;
 
 public:
   template<class QRType>
@@ -224,12 +306,13 @@ public:
       d5_(system.createState()),
       d6_(system.createState()),
       d7_(std::forward<QRType>(qrs)),
-      d8_(&system){}
+      d8_(&system),
+      d9_(system.createState()){}
 
   template<class TagToFind>
   static constexpr bool contains(){
     return (mpl::variadic::find_if_binary_pred_t<TagToFind, std::is_same,
-	   Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8>::value) < 8;
+	   Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8, Tag9>::value) < 9;
   }
 
   GETMETHOD(1)
@@ -240,6 +323,7 @@ public:
   GETMETHOD(6)
   GETMETHOD(7)
   GETMETHOD(8)
+  GETMETHOD(9)
 };
 
 template<class SystemType, class InnSolverType>
@@ -264,6 +348,9 @@ class RegistryLevMarNormalEqs
   using Tag8 = nonlinearsolvers::LevenbergMarquardtDampingTag;
   using Tag9 = nonlinearsolvers::InnerSolverTag;
   using Tag10 = nonlinearsolvers::impl::SystemTag;
+  using Tag11 = nonlinearsolvers::LineSearchTrialStateTag;
+  using Tag12 = nonlinearsolvers::impl::LevenbergMarquardtScaledCorrectionTag;
+  using Tag13 = nonlinearsolvers::impl::NormalEquationsWorkspaceTag;
 
   state_t d1_;
   state_t d2_;
@@ -275,6 +362,9 @@ class RegistryLevMarNormalEqs
   lm_damp_t d8_;
   utils::InstanceOrReferenceWrapper<InnSolverType> d9_;
   SystemType const * d10_;
+  state_t d11_;
+  state_t d12_;
+  ::pressio::ops::NormalEquationsWorkspace<j_t> d13_;
 
 public:
   template<class _InnSolverType>
@@ -288,12 +378,15 @@ public:
       d7_( hg_default::createHessian(system.createState()) ),
       d8_{},
       d9_(std::forward<_InnSolverType>(innS)),
-      d10_(&system){}
+      d10_(&system),
+      d11_(system.createState()),
+      d12_(system.createState()),
+      d13_{}{}
 
   template<class TagToFind>
   static constexpr bool contains(){
     return (mpl::variadic::find_if_binary_pred_t<TagToFind, std::is_same,
-	    Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8, Tag9, Tag10>::value) < 10;
+	    Tag1, Tag2, Tag3, Tag4, Tag5, Tag6, Tag7, Tag8, Tag9, Tag10, Tag11, Tag12, Tag13>::value) < 13;
   }
 
   GETMETHOD(1)
@@ -306,6 +399,9 @@ public:
   GETMETHOD(8)
   GETMETHOD(9)
   GETMETHOD(10)
+  GETMETHOD(11)
+  GETMETHOD(12)
+  GETMETHOD(13)
 };
 
 }}}
@@ -2,10 +2,42 @@
 #ifndef SOLVERS_NONLINEAR_IMPL_ROOT_FINDER_HPP_
 #define SOLVERS_NONLINEAR_IMPL_ROOT_FINDER_HPP_
 
+#include <utility>
+
 namespace pressio{
 namespace nonlinearsolvers{
 namespace impl{
 
+/*
+  stages of the Newton iteration: compute the residual and, unless reused,
+  the jacobian, then solve for the correction with the inner linear solver.
+  Returns true if the jacobian has been recomputed.
+*/
+template<class RegistryType, class SystemType, class ReuseControllerType>
+bool compute_newton_operators(NewtonTag /*tag*/,
+			      RegistryType & reg,
+			      const SystemType & system,
+			      ReuseControllerType & reuseController,
+			      bool isFirstIteration)
+{
+  return compute_residual_and_jacobian_or_reuse(reg, system,
+						reuseController, isFirstIteration);
+}
+
+template<class RegistryType, class SystemType>
+void compute_newton_correction(NewtonTag /*tag*/,
+			       RegistryType & reg,
+			       const SystemType & /*system*/,
+			       bool jacobianRecomputed,
+			       bool /*isFirstIteration*/)
+{
+  if (jacobianRecomputed){
+    solve_newton_step(reg);
+  }else{
+    solve_newton_step_with_frozen_jacobian(reg);
+  }
+}
+
 template<
   class ProblemTag,
   class UserDefinedSystemType,
@@ -13,8 +45,9 @@ template<
   class ToleranceType,
   class NormDiagnosticsContainerType,
   class DiagnosticsLoggerType,
+  class ReuseControllerType,
   class UpdaterType>
-void root_solving_loop_impl(ProblemTag /*problemTag*/,
+void root_solving_loop_impl(ProblemTag problemTag,
           const UserDefinedSystemType & system,
           RegistryType & reg,
           Stop stopEnumValue,
@@ -22,14 +55,17 @@ void root_solving_loop_impl(ProblemTag /*problemTag*/,
           NormDiagnosticsContainerType & normDiagnostics,
           const DiagnosticsLoggerType & logger,
           int maxIters,
+          ReuseControllerType & reuseController,
           UpdaterType && updater)
 {
+  PRESSIO_PERF_ZONE("nonlinear solve");
 
   using state_type = typename UserDefinedSystemType::state_type;
 
   auto objective = [&reg, &system](const state_type & stateIn){
+    PRESSIO_PERF_COUNT("residual evaluations", 1);
     auto & r = reg.template get<ResidualTag>();
-    system.residualAndJacobian(stateIn, r, {});
+    evaluate_residual(system, stateIn, r);
     return ::pressio::ops::norm2(r);
   };
 
@@ -57,9 +93,13 @@ void root_solving_loop_impl(ProblemTag /*problemTag*/,
 
   int iStep = 0;
   while (++iStep <= maxIters){
+    PRESSIO_PERF_COUNT("nonlinear iterations", 1);
+
     /* stage 1 */
+    bool jacobianRecomputed = true;
     try{
-      compute_residual_and_jacobian(reg, system);
+      jacobianRecomputed = compute_newton_operators(problemTag, reg, system,
+						    reuseController, iStep==1);
     }
     catch (::pressio::eh::ResidualEvaluationFailureUnrecoverable const &e){
       PRESSIOLOG_CRITICAL(e.what());
@@ -71,7 +111,7 @@ void root_solving_loop_impl(ProblemTag /*problemTag*/,
     }
 
     /* stage 2 */
-    solve_newton_step(reg);
+    compute_newton_correction(problemTag, reg, system, jacobianRecomputed, iStep==1);
 
     /* stage 3 */
     std::for_each(normDiagnostics.begin(), normDiagnostics.end(),
@@ -120,6 +160,7 @@ class RootFinder : public RegistryType
     InternalDiagnosticDataWithAbsoluteRelativeTracking<NormValueType> >;
   norm_diagnostics_container normDiagnostics_;
   DiagnosticsLogger diagnosticsLogger_ = {};
+  JacobianReuseController<NormValueType> reuseController_ = {};
 
 public:
   template<class ...Args>
@@ -157,6 +198,12 @@ public:
   void setStopTolerance(NormValueType value) { stopTolerance_ = value; }
   void setMaxIterations(int newMax)          { maxIters_ = newMax; }
 
+  // keep the jacobian for up to maxReuse iterations,
+  // or until an iteration fails to contract ||R|| by the given factor
+  void setJacobianReuse(int maxReuse, NormValueType contractionThreshold = 0.5){
+    reuseController_.set(maxReuse, contractionThreshold);
+  }
+
   template<class SystemType>
   void solve(const SystemType & system, StateType & solutionInOut)
   {
@@ -169,18 +216,18 @@ public:
 	StateTag, StateType &>(*this, solutionInOut);
       root_solving_loop_impl(tag_, system, extReg, stopEnValue_, stopTolerance_,
 			     normDiagnostics_, diagnosticsLogger_, maxIters_,
-			     DefaultUpdater());
+			     reuseController_, DefaultUpdater());
 
     }
     else if (updateEnValue_ == Update::BacktrackStrictlyDecreasingObjective)
     {
+      // the trial state is owned by the registry, so no allocation here
       auto extReg = reference_capture_registry_and_extend_with<
-	StateTag, LineSearchTrialStateTag,
-	StateType &, StateType>(*this, solutionInOut, system.createState());
+	StateTag, StateType &>(*this, solutionInOut);
 
       root_solving_loop_impl(tag_, system, extReg, stopEnValue_, stopTolerance_,
 			     normDiagnostics_, diagnosticsLogger_, maxIters_,
-			     BacktrackStrictlyDecreasingObjectiveUpdater{});
+			     reuseController_, BacktrackStrictlyDecreasingObjectiveUpdater{});
 
     }
     else{
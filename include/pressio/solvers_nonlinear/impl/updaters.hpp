@@ -57,6 +57,8 @@ public:
     scalar_type ftrial = {};
     while (true)
       {
+	PRESSIO_PERF_ZONE("line search trial");
+	PRESSIO_PERF_COUNT("line search trials", 1);
 	if (std::abs(alpha) <= alpha_lower_bound){
 	  const auto msg = ": in armijo, alpha = " + std::to_string(alpha)
 	    + " <= " + std::to_string(alpha_lower_bound)
@@ -114,6 +116,8 @@ public:
     PRESSIOLOG_DEBUG("start backtracking");
     while (true)
       {
+	PRESSIO_PERF_ZONE("line search trial");
+	PRESSIO_PERF_COUNT("line search trials", 1);
 	if (std::abs(alpha) <= alpha_lower_bound){
 	  /*
 	    Presently set an exit alpha drops below 0.001; anything smaller
@@ -141,11 +145,10 @@ public:
   }
 };
 
-template<class RegistryType, class ObjF, class ScalarType, class StateType>
+template<class RegistryType, class ObjF, class ScalarType>
 auto lm_gain_factor(RegistryType & reg,
 		    ObjF & objective,
-		    ScalarType objectiveValueAtCurrentNewtonStep,
-		    StateType & cDiagH)
+		    ScalarType objectiveValueAtCurrentNewtonStep)
 {
   using scalar_type = std::remove_const_t<ScalarType>;
   constexpr auto zero = ::pressio::utils::Constants<scalar_type>::zero();
@@ -158,6 +161,7 @@ auto lm_gain_factor(RegistryType & reg,
   const auto & g = reg.template get<GradientTag>();
   const auto & H = reg.template get<LevenbergMarquardtUndampedHessianTag>();
   const auto & damp = reg.template get<LevenbergMarquardtDampingTag>();
+  auto & cDiagH = reg.template get<LevenbergMarquardtScaledCorrectionTag>();
 
   // numerator
   ::pressio::ops::update(trialState, zero, state, one, correction, one);
@@ -174,7 +178,7 @@ auto lm_gain_factor(RegistryType & reg,
 }
 
 
-template<class ScalarType, class StateType>
+template<class ScalarType>
 class LMSchedule1Updater
 {
   using scalar_type = std::remove_const_t<ScalarType>;
@@ -184,10 +188,6 @@ class LMSchedule1Updater
   const scalar_type p_ = cnst::three();
   const scalar_type tau_ = cnst::one();
   scalar_type nu_ = cnst::two();
-  StateType cDiagH_;
-
-public:
-  LMSchedule1Updater(const StateType & stateIn) : cDiagH_(ops::clone(stateIn)){}
 
 public:
   template<class RegType, class Objective>
@@ -201,7 +201,7 @@ public:
     const auto & correction  = reg.template get<CorrectionTag>();
     auto & state = reg.template get<StateTag>();
 
-    const scalar_type rho = lm_gain_factor(reg, obj, objectiveValueAtCurrentNewtonStep, cDiagH_);
+    const scalar_type rho = lm_gain_factor(reg, obj, objectiveValueAtCurrentNewtonStep);
     constexpr auto one  = ::pressio::utils::Constants<scalar_type>::one();
     constexpr auto two  = ::pressio::utils::Constants<scalar_type>::two();
     if (rho > 0){
@@ -220,7 +220,7 @@ public:
   }
 };
 
-template<class ScalarType, class StateType>
+template<class ScalarType>
 class LMSchedule2Updater
 {
   using scalar_type = std::remove_const_t<ScalarType>;
@@ -231,10 +231,6 @@ class LMSchedule2Updater
   const scalar_type beta_	   = cnst::two();
   const scalar_type gammaInv_ = cnst::one()/cnst::three();
   const scalar_type tau_	   = cnst::one();
-  StateType cDiagH_;
-
-public:
-  LMSchedule2Updater(const StateType & stateIn) : cDiagH_(ops::clone(stateIn)){}
 
 public:
   template<class RegType, class Objective>
@@ -254,7 +250,7 @@ public:
     const auto tenToSev  = std::pow(ten, seven);
     const auto tenToNegSev  = std::pow(ten, negSeven);
 
-    const scalar_type rho = lm_gain_factor(reg, obj, objectiveValueAtCurrentNewtonStep, cDiagH_);
+    const scalar_type rho = lm_gain_factor(reg, obj, objectiveValueAtCurrentNewtonStep);
     if (rho < rho1_){
       damp = std::min(damp*beta_, tenToSev);
     }
@@ -98,6 +98,20 @@ struct NonlinearSystemFusingResidualAndJacobian<
    >
   > : std::true_type{};
 
+template<class T, class enable = void>
+struct NonlinearSystemWithJacobianAction : std::false_type{};
+
+template<class T>
+struct NonlinearSystemWithJacobianAction<
+  T,
+  mpl::enable_if_t<
+    ::pressio::has_state_typedef<T>::value
+    && ::pressio::has_residual_typedef<T>::value
+    && ::pressio::nonlinearsolvers::has_const_apply_jacobian_method_accept_state_operand_result_return_void<
+      T, typename T::state_type, typename T::state_type, typename T::residual_type>::value
+   >
+  > : std::true_type{};
+
 
 template<class T, class = void> struct RealValuedNonlinearSystem : std::false_type{};
 template<class T> struct RealValuedNonlinearSystem<
@@ -83,6 +83,16 @@ concept NonlinearSystemFusingResidualAndJacobian =
     { A.residualAndJacobian(state, r, j)  } -> std::same_as<void>;
   };
 
+template <class T>
+concept NonlinearSystemWithJacobianAction =
+  requires(const T & A,
+	   const typename T::state_type & state,
+	   const typename T::state_type & v,
+	   typename T::residual_type & Jv)
+  {
+    { A.applyJacobian(state, v, Jv) } -> std::same_as<void>;
+  };
+
 template <class T>
 concept RealValuedNonlinearSystem =
   NonlinearSystem<T>
@@ -55,6 +55,7 @@
 #include "./impl/registries.hpp"
 #include "./impl/diagnostics.hpp"
 #include "./impl/functions.hpp"
+#include "./impl/jacobian_reuse.hpp"
 #include "./impl/updaters.hpp"
 #include "./impl/root_finder.cpp"
 
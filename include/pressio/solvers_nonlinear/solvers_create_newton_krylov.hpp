@@ -0,0 +1,135 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// solvers_create_newton_krylov.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLVERS_NONLINEAR_SOLVERS_CREATE_NEWTON_KRYLOV_HPP_
+#define SOLVERS_NONLINEAR_SOLVERS_CREATE_NEWTON_KRYLOV_HPP_
+
+#include "solvers_default_types.hpp"
+#include "./impl/solvers_tagbased_registry.hpp"
+#include "./impl/internal_tags.hpp"
+#include "./impl/registries.hpp"
+#include "./impl/diagnostics.hpp"
+#include "./impl/functions.hpp"
+#include "./impl/jacobian_reuse.hpp"
+#include "./impl/updaters.hpp"
+#include "./impl/newton_krylov.hpp"
+#include "./impl/root_finder.cpp"
+
+namespace pressio{
+
+/*To solve a determined system of nonlinear equations:
+  r(x) = 0, for r \in R^n and x \in R^n,
+  with an inexact Newton method where each J_k delta_k = - r_k
+  is solved with GMRES using only the action of the Jacobian.
+
+  The action J v is computed via system.applyJacobian(x, v, Jv) if the system
+  provides it, otherwise via finite differences of the residual,
+  so the Jacobian is never assembled nor stored.
+  The GMRES tolerance is chosen via Eisenstat-Walker forcing terms.
+
+  preconditions
+  - system must bind to an object that outlives the return of this function
+  - the state and residual must be of the same type
+
+  effects
+  - this function does not solve anything, only prepares for one
+  - only the create* methods will be called on "sytem"
+
+  post-conditions
+  - the returned object own all memory allocations
+*/
+
+template<class SystemType>
+#ifdef PRESSIO_ENABLE_CXX20
+  requires (nonlinearsolvers::RealValuedNonlinearSystem<SystemType>
+	    || nonlinearsolvers::RealValuedNonlinearSystemFusingResidualAndJacobian<SystemType>)
+  && std::same_as<typename SystemType::state_type, typename SystemType::residual_type>
+  && (Traits<typename SystemType::state_type>::rank == 1)
+  && requires(typename SystemType::state_type & a,
+	      typename SystemType::state_type & b,
+	      nonlinearsolvers::scalar_of_t<SystemType> alpha,
+	      nonlinearsolvers::scalar_of_t<SystemType> beta,
+	      nonlinearsolvers::scalar_of_t<SystemType> gamma)
+  {
+    { ::pressio::ops::norm2(std::as_const(a)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+    { ::pressio::ops::dot(std::as_const(a), std::as_const(b)) }
+      -> std::same_as< nonlinearsolvers::scalar_of_t<SystemType> >;
+
+    { ::pressio::ops::clone(std::as_const(a)) } -> std::same_as<typename SystemType::state_type>;
+    { ::pressio::ops::set_zero(a) };
+    { ::pressio::ops::deep_copy(b, std::as_const(a)) };
+    { ::pressio::ops::scale (a, alpha) };
+    { ::pressio::ops::update(a,	alpha, std::as_const(b), beta) };
+    { ::pressio::ops::update(a,	alpha, std::as_const(b), beta, std::as_const(b), gamma) };
+  }
+#endif
+auto create_newton_krylov_solver(const SystemType & system)
+{
+  static_assert(std::is_same<
+		typename SystemType::state_type, typename SystemType::residual_type>::value,
+		"Newton-Krylov currently requires the state and residual to be of the same type");
+
+  using nonlinearsolvers::Diagnostic;
+  const std::vector<Diagnostic> diagnostics =
+    {Diagnostic::residualAbsolutel2Norm,
+     Diagnostic::residualRelativel2Norm,
+     Diagnostic::correctionAbsolutel2Norm,
+     Diagnostic::correctionRelativel2Norm};
+
+  using tag      = nonlinearsolvers::impl::NewtonKrylovTag;
+  using state_t  = typename SystemType::state_type;
+  using scalar_t = nonlinearsolvers::scalar_of_t<SystemType>;
+  using inner_t  = nonlinearsolvers::impl::NewtonKrylovInnerSolver<state_t, scalar_t>;
+  using reg_t    = nonlinearsolvers::impl::RegistryNewtonKrylov<SystemType, inner_t>;
+  return nonlinearsolvers::impl::RootFinder<tag, state_t, reg_t, scalar_t>
+    (tag{}, diagnostics, system, inner_t(system));
+}
+
+} //end namespace pressio
+#endif  // SOLVERS_NONLINEAR_SOLVERS_CREATE_NEWTON_KRYLOV_HPP_
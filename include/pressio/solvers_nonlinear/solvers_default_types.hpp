@@ -16,7 +16,8 @@ template<class T>
 struct normal_eqs_default_types<
   T, mpl::enable_if_t<::pressio::is_vector_eigen<T>::value> >
 {
-  using hessian_type = Eigen::Matrix<typename Traits<T>::scalar_type, -1, -1>;
+  // fixed-size if the state is small and fixed-size, e.g. for reduced systems
+  using hessian_type = ::pressio::impl::eigen_square_matrix_for_vector_t<T>;
   using gradient_type = T;
 
   static hessian_type createHessian(const T & v){
@@ -26,6 +27,24 @@ struct normal_eqs_default_types<
 };
 #endif
 
+#ifdef PRESSIO_ENABLE_TPL_KOKKOS
+// the hessian lives in the same memory/execution space as the state,
+// so the whole normal equations pipeline stays there
+template<class T>
+struct normal_eqs_default_types<
+  T, mpl::enable_if_t<::pressio::is_vector_kokkos<T>::value> >
+{
+  using hessian_type = Kokkos::View<
+    typename Traits<T>::scalar_type**, Kokkos::LayoutLeft, typename T::device_type>;
+  using gradient_type = T;
+
+  static hessian_type createHessian(const T & v){
+    const auto ext = ::pressio::ops::extent(v, 0);
+    return hessian_type("hessian", ext, ext);
+  }
+};
+#endif
+
 template<class T> using normal_eqs_default_hessian_t =
   typename normal_eqs_default_types<T>::hessian_type;
 template<class T> using normal_eqs_default_gradient_t =
@@ -43,5 +62,12 @@ struct valid_state_for_least_squares<
   > : std::true_type{};
 #endif
 
+#ifdef PRESSIO_ENABLE_TPL_KOKKOS
+template<class T>
+struct valid_state_for_least_squares<
+  T, mpl::enable_if_t< ::pressio::is_vector_kokkos<T>::value >
+  > : std::true_type{};
+#endif
+
 }}
 #endif
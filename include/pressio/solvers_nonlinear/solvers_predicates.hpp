@@ -157,6 +157,38 @@ struct has_const_jacobian_method_accept_state_result_return_void<
   > : std::true_type{};
 
 
+template <
+  class T,
+  class StateType,
+  class OperandType,
+  class ResultType,
+  class = void
+  >
+struct has_const_apply_jacobian_method_accept_state_operand_result_return_void
+  : std::false_type{};
+
+template <
+  class T,
+  class StateType,
+  class OperandType,
+  class ResultType
+  >
+struct has_const_apply_jacobian_method_accept_state_operand_result_return_void<
+  T, StateType, OperandType, ResultType,
+  mpl::enable_if_t<
+    std::is_void<
+      decltype(
+         std::declval<T const>().applyJacobian
+            (
+              std::declval<StateType const &>(),
+              std::declval<OperandType const &>(),
+              std::declval<ResultType &>()
+            )
+         )
+      >::value
+    >
+  > : std::true_type{};
+
 template <
   class T,
   class StateType,
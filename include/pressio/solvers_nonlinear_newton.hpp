@@ -60,5 +60,6 @@
 #include "solvers_nonlinear/solvers_exceptions.hpp"
 #include "solvers_nonlinear/solvers_nonlinear_enums_and_tags.hpp"
 #include "solvers_nonlinear/solvers_create_newton.hpp"
+#include "solvers_nonlinear/solvers_create_newton_krylov.hpp"
 
 #endif
@@ -148,6 +148,30 @@ struct is_dynamic_dense_matrix_eigen<
     T::ColsAtCompileTime != Eigen::Dynamic
     >
   > : std::true_type{};
+
+/* an Eigen::Map of a dense DYNAMIC eigen matrix: a non-owning view of
+ * existing storage (e.g. a memory-mapped basis), usable wherever a
+ * dense dynamic matrix is read. Copying, hence cloning, it yields
+ * another view of the same storage, and it cannot be resized.
+*/
+template <typename T, typename enable = void>
+struct is_dense_matrix_map_eigen : std::false_type {};
+
+template <typename PlainType, int MapOptions, typename StrideType>
+struct is_dense_matrix_map_eigen<
+  Eigen::Map<PlainType, MapOptions, StrideType>,
+  mpl::enable_if_t<
+    is_dynamic_dense_matrix_eigen<typename std::remove_const<PlainType>::type>::value
+    >
+  > : std::true_type{};
+
+template<typename T>
+struct is_dynamic_dense_matrix_eigen<
+  T,
+  mpl::enable_if_t<
+    is_dense_matrix_map_eigen<typename std::remove_cv<T>::type>::value
+    >
+  > : std::true_type{};
 //----------------------------------------------------------------------
 
 template <typename T, typename enable = void>
@@ -189,6 +213,34 @@ struct is_dense_matrix_eigen<
     is_dynamic_dense_matrix_eigen<T>::value
     >
   > : std::true_type{};
+//----------------------------------------------------------------------
+
+namespace impl{
+/*
+  n x n dense matrix paired with an Eigen vector of size n, e.g. the
+  jacobian or hessian of a reduced system: fixed-size only if the vector
+  is fixed-size and small, since a fixed n x n matrix lives on the stack
+  and the compile-time unrolling stops paying off for large n.
+  Above the cap (30 x 30 doubles, about 7 KB) this falls back to a
+  dynamic matrix, allocated once when the operator is created.
+*/
+constexpr int eigen_max_fixed_square_matrix_dimension = 30;
+
+template <typename VectorType>
+struct eigen_square_matrix_for_vector
+{
+  static constexpr int size =
+    (VectorType::SizeAtCompileTime != Eigen::Dynamic &&
+     VectorType::SizeAtCompileTime <= eigen_max_fixed_square_matrix_dimension)
+    ? VectorType::SizeAtCompileTime : Eigen::Dynamic;
+
+  using type = Eigen::Matrix<typename VectorType::Scalar, size, size>;
+};
+
+template <typename VectorType>
+using eigen_square_matrix_for_vector_t =
+  typename eigen_square_matrix_for_vector<VectorType>::type;
+}//end namespace impl
 
 }//end namespace
 #endif  // TYPE_TRAITS_NATIVE_EIGEN_DENSE_MATRIX_HPP_
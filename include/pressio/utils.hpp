@@ -57,10 +57,12 @@
 #include "./utils/utils_make_unique.hpp"
 #include "./utils/utils_instance_or_reference_wrapper.hpp"
 #include "./utils/utils_read_ascii_matrix_std_vec_vec.hpp"
+#include "./utils/utils_binary_matrix_io.hpp"
 
 #ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
 #include "./utils/utils_teuchos_performance_monitor.hpp"
 #endif
+#include "./utils/utils_performance_monitor.hpp"
 
 #include "./utils/io/utils_colorize_print.hpp"
 #include "./utils/io/utils_print_helper.hpp"
@@ -6,6 +6,8 @@
 #include "utils_logger_impl.hpp"
 #endif
 
+#include <atomic>
+
 namespace pressio{
 
 #if PRESSIO_LOG_ACTIVE_MIN_LEVEL != PRESSIO_LOG_LEVEL_OFF
@@ -14,6 +16,50 @@ using logger = spdlog::logger;
 
 namespace log{
 
+namespace impl{
+/*
+  step sampling: trace, debug and info messages are only issued during
+  every k-th time step of the ode advancers, i.e. steps 1, k+1, 2k+1, ...
+  Outside of a time loop nothing is sampled out.
+  The period is global, while whether the current step is sampled out is
+  per thread, since each thread may be advancing its own time loop.
+*/
+template <typename T = int>
+std::atomic<T> & stepSamplingPeriod()
+{
+  static std::atomic<T> value{1};
+  return value;
+}
+
+template <typename T = bool>
+T & isSampledOut()
+{
+  static thread_local T value{false};
+  return value;
+}
+
+template <typename StepType>
+void beginSampledStep(const StepType & step)
+{
+  const auto period = stepSamplingPeriod().load(std::memory_order_relaxed);
+  isSampledOut() = period > 1 && ((step - 1) % period) != 0;
+}
+
+// to use around a time loop so that sampling stops with it
+struct StepSamplingScope
+{
+  StepSamplingScope() : wasSampledOut_(isSampledOut()){}
+  StepSamplingScope(const StepSamplingScope &) = delete;
+  StepSamplingScope & operator=(const StepSamplingScope &) = delete;
+  ~StepSamplingScope(){ isSampledOut() = wasSampledOut_; }
+
+private:
+  // restored on exit, so that a nested time loop does not
+  // change the sampling of the enclosing one
+  bool wasSampledOut_;
+};
+}//end namespace pressio::log::impl
+
 #if !defined PRESSIO_ENABLE_TPL_PYBIND11
 template<typename ...Args>
 void initialize(::pressio::logto en, Args && ... args)
@@ -22,10 +68,10 @@ void initialize(::pressio::logto en, Args && ... args)
   auto logger = ::pressio::log::impl::create(en, std::forward<Args>(args)...);
   // logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%s:%#] [fnc=%!] : %v");
 
-  // note that the sinks can have different levels. By using trace for the
-  // main logger we make sure it is up to the sinks or the global
+  // note that the sinks can have different levels. The main logger
+  // uses the lowest of them, so it is up to the sinks or the global
   // define to set the minlevel of output.
-  logger->set_level(spdlog::level::trace);
+  ::pressio::log::impl::updateLoggerLevel(*logger);
 
   // set the singleton
   spdlog::set_default_logger(logger);
@@ -42,10 +88,10 @@ void initialize(::pressio::logto en, std::string fileName)
   auto logger = ::pressio::log::impl::create(en, fileName);
   // logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%s:%#] [fnc=%!] : %v");
 
-  // note that the sinks can have different levels. By using trace for the
-  // main logger we make sure it is up to the sinks or the global
+  // note that the sinks can have different levels. The main logger
+  // uses the lowest of them, so it is up to the sinks or the global
   // define to set the minlevel of output.
-  logger->set_level(spdlog::level::trace);
+  ::pressio::log::impl::updateLoggerLevel(*logger);
 
   // set the singleton
   spdlog::set_default_logger(logger);
@@ -64,10 +110,10 @@ void initialize2(::pressio::logto en)
   auto logger = ::pressio::log::impl::create(en, "null");
   // logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%s:%#] [fnc=%!] : %v");
 
-  // note that the sinks can have different levels. By using trace for the
-  // main logger we make sure it is up to the sinks or the global
+  // note that the sinks can have different levels. The main logger
+  // uses the lowest of them, so it is up to the sinks or the global
   // define to set the minlevel of output.
-  logger->set_level(spdlog::level::trace);
+  ::pressio::log::impl::updateLoggerLevel(*logger);
 
   // set the singleton
   spdlog::set_default_logger(logger);
@@ -77,6 +123,27 @@ void initialize2(::pressio::logto en)
 
 #endif//PRESSIO_ENABLE_TPL_PYBIND11
 
+/*
+  Same as initialize, but the calling thread only copies each message
+  into a preallocated ring buffer of queueCapacity slots, and a
+  background thread formats and writes them. This never blocks:
+  if the buffer is full, the message is dropped.
+*/
+template <typename T = void>
+void initializeAsync(::pressio::logto en,
+		     std::string fileName = "log.txt",
+		     std::size_t queueCapacity = 8192)
+{
+#if PRESSIO_LOG_ACTIVE_MIN_LEVEL != PRESSIO_LOG_LEVEL_OFF
+  auto logger = ::pressio::log::impl::createAsync(en, fileName, queueCapacity);
+  ::pressio::log::impl::updateLoggerLevel(*logger);
+
+  // set the singleton
+  spdlog::set_default_logger(logger);
+  logger->log(spdlog::level::info, "Initializing pressio logger (async)");
+#endif
+}
+
 
 // Return an existing logger or nullptr if a logger with such name doesn't exist.
 // example: spdlog::get("my_logger")->info("hello {}", "world");
@@ -124,7 +191,7 @@ template <typename T= void> void setVerbosity(std::initializer_list<::pressio::l
 {
 #if PRESSIO_LOG_ACTIVE_MIN_LEVEL != PRESSIO_LOG_LEVEL_OFF
   auto logger = ::pressio::log::get("pressioLogger");
-  std::vector<spdlog::sink_ptr> & sinks = logger->sinks();
+  std::vector<spdlog::sink_ptr> & sinks = impl::writingSinks(*logger);
   // make sure the number of levels is same as sinks
   if (levels.size() != sinks.size())
     throw std::runtime_error("log: number of levels to set != number of sinks");
@@ -135,9 +202,37 @@ template <typename T= void> void setVerbosity(std::initializer_list<::pressio::l
 		  auto spdlog_l = impl::pressioLogLevelToSpdlogLevel(*l++);
 		  s->set_level(spdlog_l);
 		});
+  impl::updateLoggerLevel(*logger);
 #endif
 }
 
+// Only log from the given ranks of the world communicator,
+// the logger of all other ranks is turned off.
+#ifdef PRESSIO_ENABLE_TPL_PYBIND11
+template <typename T> void setActiveRanks(T ranks)
+#else
+template <typename T= void> void setActiveRanks(std::initializer_list<int> ranks)
+#endif
+{
+#if PRESSIO_LOG_ACTIVE_MIN_LEVEL != PRESSIO_LOG_LEVEL_OFF
+  const auto rank = impl::myRank();
+  impl::thisRankIsActive() =
+    std::find(ranks.begin(), ranks.end(), rank) != ranks.end();
+  impl::updateLoggerLevel(*::pressio::log::get("pressioLogger"));
+#endif
+}
+
+// Only issue the trace, debug and info messages during every k-th
+// time step (steps 1, k+1, 2k+1, ...). Use 1 to log all steps.
+template <typename T = void>
+void setStepSampling(int k)
+{
+  if (k < 1){
+    throw std::runtime_error("log: the step sampling period must be >= 1");
+  }
+  impl::stepSamplingPeriod().store(k, std::memory_order_relaxed);
+}
+
 // Set global format string.
 // example: spdlog::set_pattern("%Y-%m-%d %H:%M:%S.%e %l : %v");
 template <typename ...Args>
@@ -217,28 +312,35 @@ inline void critical(const FormatString &fmt, Args&&...args)
   if (logger) (logger)->log(spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION}, level, __VA_ARGS__);
 
 #define PRESSIO_LOGGER_NOSRCLOC_CALL(logger, level, ...) if (logger) (logger)->log(level, __VA_ARGS__);
+
+// trace, debug and info are subject to the step sampling
+#define PRESSIO_LOGGER_SAMPLED_CALL(logger, level, ...) \
+  if (!::pressio::log::impl::isSampledOut()) PRESSIO_LOGGER_CALL(logger, level, __VA_ARGS__)
+
+#define PRESSIO_LOGGER_SAMPLED_NOSRCLOC_CALL(logger, level, ...) \
+  if (!::pressio::log::impl::isSampledOut()) PRESSIO_LOGGER_NOSRCLOC_CALL(logger, level, __VA_ARGS__)
 #endif
 
 ///// TRACE /////
 #if PRESSIO_LOG_ACTIVE_MIN_LEVEL <= PRESSIO_LOG_LEVEL_TRACE
-#define PRESSIOLOGGER_TRACE(logger, ...) PRESSIO_LOGGER_CALL(logger, spdlog::level::trace, __VA_ARGS__)
-#define PRESSIOLOG_TRACE(...) PRESSIOLOGGER_TRACE(spdlog::default_logger(), __VA_ARGS__)
+#define PRESSIOLOGGER_TRACE(logger, ...) PRESSIO_LOGGER_SAMPLED_CALL(logger, spdlog::level::trace, __VA_ARGS__)
+#define PRESSIOLOG_TRACE(...) PRESSIOLOGGER_TRACE(spdlog::default_logger_raw(), __VA_ARGS__)
 #else
 #define PRESSIOLOG_TRACE(...) (void)0
 #endif
 
 ///// DEBUG /////
 #if PRESSIO_LOG_ACTIVE_MIN_LEVEL <= PRESSIO_LOG_LEVEL_DEBUG
-#define PRESSIOLOGGER_DEBUG(logger, ...) PRESSIO_LOGGER_CALL(logger, spdlog::level::debug, __VA_ARGS__)
-#define PRESSIOLOG_DEBUG(...) PRESSIOLOGGER_DEBUG(spdlog::default_logger(), __VA_ARGS__)
+#define PRESSIOLOGGER_DEBUG(logger, ...) PRESSIO_LOGGER_SAMPLED_CALL(logger, spdlog::level::debug, __VA_ARGS__)
+#define PRESSIOLOG_DEBUG(...) PRESSIOLOGGER_DEBUG(spdlog::default_logger_raw(), __VA_ARGS__)
 #else
 #define PRESSIOLOG_DEBUG(...) (void)0
 #endif
 
 ///// INFO /////
 #if PRESSIO_LOG_ACTIVE_MIN_LEVEL <= PRESSIO_LOG_LEVEL_INFO
-#define PRESSIOLOGGER_INFO(logger, ...) PRESSIO_LOGGER_NOSRCLOC_CALL(logger, spdlog::level::info, __VA_ARGS__)
-#define PRESSIOLOG_INFO(...) PRESSIOLOGGER_INFO(spdlog::default_logger(), __VA_ARGS__)
+#define PRESSIOLOGGER_INFO(logger, ...) PRESSIO_LOGGER_SAMPLED_NOSRCLOC_CALL(logger, spdlog::level::info, __VA_ARGS__)
+#define PRESSIOLOG_INFO(...) PRESSIOLOGGER_INFO(spdlog::default_logger_raw(), __VA_ARGS__)
 #else
 #define PRESSIOLOG_INFO(...) (void)0
 #endif
@@ -246,7 +348,7 @@ inline void critical(const FormatString &fmt, Args&&...args)
 ///// WARN /////
 #if PRESSIO_LOG_ACTIVE_MIN_LEVEL <= PRESSIO_LOG_LEVEL_WARN
 #define PRESSIOLOGGER_WARN(logger, ...) PRESSIO_LOGGER_NOSRCLOC_CALL(logger, spdlog::level::warn, __VA_ARGS__)
-#define PRESSIOLOG_WARN(...) PRESSIOLOGGER_WARN(spdlog::default_logger(), __VA_ARGS__)
+#define PRESSIOLOG_WARN(...) PRESSIOLOGGER_WARN(spdlog::default_logger_raw(), __VA_ARGS__)
 #else
 #define PRESSIOLOG_WARN(...) (void)0
 #endif
@@ -254,7 +356,7 @@ inline void critical(const FormatString &fmt, Args&&...args)
 ///// ERROR /////
 #if PRESSIO_LOG_ACTIVE_MIN_LEVEL <= PRESSIO_LOG_LEVEL_ERROR
 #define PRESSIOLOGGER_ERROR(logger, ...) PRESSIO_LOGGER_NOSRCLOC_CALL(logger, spdlog::level::err, __VA_ARGS__)
-#define PRESSIOLOG_ERROR(...) PRESSIOLOGGER_ERROR(spdlog::default_logger(), __VA_ARGS__)
+#define PRESSIOLOG_ERROR(...) PRESSIOLOGGER_ERROR(spdlog::default_logger_raw(), __VA_ARGS__)
 #else
 #define PRESSIOLOG_ERROR(...) (void)0
 #endif
@@ -262,7 +364,7 @@ inline void critical(const FormatString &fmt, Args&&...args)
 ///// CRITICAL /////
 #if PRESSIO_LOG_ACTIVE_MIN_LEVEL <= PRESSIO_LOG_LEVEL_CRITICAL
 #define PRESSIOLOGGER_CRITICAL(logger, ...) PRESSIO_LOGGER_NOSRCLOC_CALL(logger, spdlog::level::critical, __VA_ARGS__)
-#define PRESSIOLOG_CRITICAL(...) PRESSIOLOGGER_CRITICAL(spdlog::default_logger(), __VA_ARGS__)
+#define PRESSIOLOG_CRITICAL(...) PRESSIOLOGGER_CRITICAL(spdlog::default_logger_raw(), __VA_ARGS__)
 #else
 #define PRESSIOLOG_CRITICAL(...) (void)0
 #endif
@@ -0,0 +1,265 @@
+
+#ifndef UTILS_LOGGER_UTILS_LOGGER_ASYNC_SINK_HPP_
+#define UTILS_LOGGER_UTILS_LOGGER_ASYNC_SINK_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pressio{ namespace log{ namespace impl{
+
+/*
+  Sink that moves the formatting and writing of the messages
+  off the calling thread:
+
+  - the payload is formatted by spdlog on the calling thread, which
+    then only copies it, the level, the time and the source location
+    into a slot of a preallocated bounded ring buffer, without locking
+    and without ever blocking;
+
+  - a background thread drains the ring buffer and forwards the
+    messages to the actual (synchronous) sinks, where the pattern
+    formatting and the writes happen. When the buffer is empty it
+    sleeps on a condition variable, and a producer only takes the
+    mutex to wake it up if it is sleeping.
+
+  The ring buffer is the bounded multi-producer queue by D. Vyukov:
+  each slot has a sequence number that tells producers and the consumer
+  whether the slot is free or holds a message. When the buffer is full
+  the new message is dropped and counted, see droppedCount().
+  Payloads longer than payloadCapacity are truncated.
+*/
+class AsyncSink final : public spdlog::sinks::sink
+{
+public:
+  static constexpr std::size_t payloadCapacity = 512;
+
+private:
+  struct Slot
+  {
+    std::atomic<std::size_t> sequence{0};
+    spdlog::level::level_enum level = spdlog::level::trace;
+    spdlog::log_clock::time_point time = {};
+    std::size_t threadId = 0;
+    spdlog::source_loc source = {};
+    std::size_t size = 0;
+    char payload[payloadCapacity];
+  };
+
+public:
+  // capacity is rounded up to a power of two
+  AsyncSink(std::vector<spdlog::sink_ptr> sinks,
+	    std::string loggerName,
+	    std::size_t capacity = 8192)
+    : sinks_(std::move(sinks)),
+      loggerName_(std::move(loggerName)),
+      slots_(roundUpToPowerOfTwo(capacity)),
+      mask_(slots_.size() - 1)
+  {
+    for (std::size_t i = 0; i < slots_.size(); ++i){
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    flusher_ = std::thread([this](){ this->flusherLoop(); });
+  }
+
+  AsyncSink(const AsyncSink &) = delete;
+  AsyncSink & operator=(const AsyncSink &) = delete;
+
+  ~AsyncSink() override
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_.store(true, std::memory_order_release);
+    }
+    wakeFlusher_.notify_one();
+    drained_.notify_all();
+    if (flusher_.joinable()){
+      flusher_.join();
+    }
+  }
+
+  void log(const spdlog::details::log_msg & msg) override
+  {
+    // do not enqueue what none of the sinks would write
+    if (!anySinkShouldLog(msg.level)){
+      return;
+    }
+
+    std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Slot * slot = nullptr;
+    for (;;){
+      slot = &slots_[pos & mask_];
+      const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0){
+	if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+	  break;
+	}
+      }
+      else if (diff < 0){
+	// full: drop rather than block the caller
+	dropped_.fetch_add(1, std::memory_order_relaxed);
+	return;
+      }
+      else{
+	pos = enqueuePos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->level = msg.level;
+    slot->time = msg.time;
+    slot->threadId = msg.thread_id;
+    slot->source = msg.source;
+    slot->size = (std::min)(msg.payload.size(), payloadCapacity);
+    std::memcpy(slot->payload, msg.payload.data(), slot->size);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    // pairs with the fence in waitForMessages: either the flusher sees
+    // this message before sleeping, or we see that it sleeps
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (flusherSleeping_.load(std::memory_order_relaxed)){
+      {
+	std::lock_guard<std::mutex> lock(mutex_);
+	flusherSleeping_.store(false, std::memory_order_relaxed);
+      }
+      wakeFlusher_.notify_one();
+    }
+  }
+
+  // waits until everything enqueued so far has been written
+  void flush() override
+  {
+    const std::size_t target = enqueuePos_.load(std::memory_order_acquire);
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      drained_.wait(lock, [&](){
+	return dequeuePos_.load(std::memory_order_acquire) >= target ||
+	  stop_.load(std::memory_order_acquire);
+      });
+    }
+    for (auto & s : sinks_){ s->flush(); }
+  }
+
+  void set_pattern(const std::string & pattern) override
+  {
+    for (auto & s : sinks_){ s->set_pattern(pattern); }
+  }
+
+  void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override
+  {
+    for (auto & s : sinks_){ s->set_formatter(sink_formatter->clone()); }
+  }
+
+  // the sinks where the messages are eventually written
+  std::vector<spdlog::sink_ptr> & sinks(){ return sinks_; }
+
+  std::size_t droppedCount() const{ return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  static std::size_t roundUpToPowerOfTwo(std::size_t n)
+  {
+    std::size_t result = 2;
+    while (result < n){ result <<= 1; }
+    return result;
+  }
+
+  bool anySinkShouldLog(spdlog::level::level_enum level) const
+  {
+    for (const auto & s : sinks_){
+      if (s->should_log(level)){ return true; }
+    }
+    return false;
+  }
+
+  // only called from the flusher thread
+  bool writeNext()
+  {
+    const std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Slot & slot = slots_[pos & mask_];
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1){
+      return false;
+    }
+
+    spdlog::details::log_msg msg(slot.time, slot.source, loggerName_, slot.level,
+				 spdlog::string_view_t(slot.payload, slot.size));
+    msg.thread_id = slot.threadId;
+    for (auto & s : sinks_){
+      if (s->should_log(msg.level)){
+	s->log(msg);
+      }
+    }
+
+    slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+    dequeuePos_.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // only called from the flusher thread
+  bool nextIsReady() const
+  {
+    const std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    return slots_[pos & mask_].sequence.load(std::memory_order_acquire) == pos + 1;
+  }
+
+  // only called from the flusher thread, with the lock held
+  void waitForMessages(std::unique_lock<std::mutex> & lock)
+  {
+    flusherSleeping_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (nextIsReady()){
+      flusherSleeping_.store(false, std::memory_order_relaxed);
+      return;
+    }
+    wakeFlusher_.wait(lock, [this](){
+      return !flusherSleeping_.load(std::memory_order_relaxed) ||
+	stop_.load(std::memory_order_acquire);
+    });
+    flusherSleeping_.store(false, std::memory_order_relaxed);
+  }
+
+  void flusherLoop()
+  {
+    while (!stop_.load(std::memory_order_acquire)){
+      bool wroteAny = false;
+      while (writeNext()){ wroteAny = true; }
+      if (wroteAny){
+	for (auto & s : sinks_){ s->flush(); }
+      }
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      // wake up the callers of flush waiting for what was just written
+      drained_.notify_all();
+      waitForMessages(lock);
+    }
+
+    // write what is left before exiting
+    while (writeNext()){}
+    for (auto & s : sinks_){ s->flush(); }
+    std::lock_guard<std::mutex> lock(mutex_);
+    drained_.notify_all();
+  }
+
+private:
+  std::vector<spdlog::sink_ptr> sinks_;
+  std::string loggerName_;
+  std::vector<Slot> slots_;
+  const std::size_t mask_;
+  std::atomic<std::size_t> enqueuePos_{0};
+  std::atomic<std::size_t> dequeuePos_{0};
+  std::atomic<std::size_t> dropped_{0};
+  std::atomic<bool> stop_{false};
+  // the flusher sleeps on wakeFlusher_ while the buffer is empty,
+  // the callers of flush wait on drained_
+  std::mutex mutex_;
+  std::condition_variable wakeFlusher_;
+  std::condition_variable drained_;
+  std::atomic<bool> flusherSleeping_{false};
+  std::thread flusher_;
+};
+
+}}}//end namespace pressio::log::impl
+
+#endif  // UTILS_LOGGER_UTILS_LOGGER_ASYNC_SINK_HPP_
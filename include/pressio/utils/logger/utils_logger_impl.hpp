@@ -26,6 +26,7 @@
 #include "./spdlog/spdlog.hpp"
 #include "./spdlog/sinks/stdout_color_sinks.hpp"
 #include "./spdlog/sinks/basic_file_sink.hpp"
+#include "./utils_logger_async_sink.hpp"
 
 namespace pressio{ namespace log{ namespace impl{
 
@@ -90,10 +91,9 @@ std::string appendRankIfNeeded(std::string fin)
 }
 
 template <typename T = void>
-std::shared_ptr<spdlog::logger> create(::pressio::logto en,
-				       std::string fileName = "log.txt")
+std::vector<spdlog::sink_ptr> createSinks(::pressio::logto en,
+					  std::string fileName = "log.txt")
 {
-  const auto loggerName = "pressioLogger";
   const auto mpiRank = myRank();
 
   using tsink = spdlog::sinks::stdout_color_sink_mt;
@@ -104,8 +104,7 @@ std::shared_ptr<spdlog::logger> create(::pressio::logto en,
     auto terminal_sink = std::make_shared<tsink>();
     terminal_sink->set_level(spdlog::level::info);
     terminal_sink->setMpiRank(mpiRank);
-    return std::make_shared<spdlog::logger>(loggerName,
-					    spdlog::sinks_init_list({terminal_sink}));
+    return {terminal_sink};
   }
   else if (en == ::pressio::logto::fileAndTerminal or
 	   en == ::pressio::logto::terminalAndFile)
@@ -122,8 +121,7 @@ std::shared_ptr<spdlog::logger> create(::pressio::logto en,
     terminal_sink->set_level(spdlog::level::info);
     file_sink->set_level(spdlog::level::info);
 
-    return std::make_shared<spdlog::logger>
-      (loggerName, spdlog::sinks_init_list({file_sink, terminal_sink}));
+    return {file_sink, terminal_sink};
   }
   else if (en == ::pressio::logto::file)
   {
@@ -133,14 +131,70 @@ std::shared_ptr<spdlog::logger> create(::pressio::logto en,
 
     auto file_sink = std::make_shared<fsink>(appendRankIfNeeded(fileName), true);
     file_sink->set_level(spdlog::level::info);
-    return std::make_shared<spdlog::logger>(loggerName,
-					    spdlog::sinks_init_list({file_sink}));
+    return {file_sink};
   }
   else{
     throw std::runtime_error("Invalid logto::enum value for logger");
   }
 }
 
+template <typename T = void>
+std::shared_ptr<spdlog::logger> create(::pressio::logto en,
+				       std::string fileName = "log.txt")
+{
+  const auto sinks = createSinks(en, fileName);
+  return std::make_shared<spdlog::logger>("pressioLogger", sinks.begin(), sinks.end());
+}
+
+// same sinks as create, but written from a background thread
+template <typename T = void>
+std::shared_ptr<spdlog::logger> createAsync(::pressio::logto en,
+					    std::string fileName,
+					    std::size_t queueCapacity)
+{
+  const auto loggerName = "pressioLogger";
+  auto async_sink = std::make_shared<AsyncSink>(createSinks(en, fileName),
+						loggerName, queueCapacity);
+  return std::make_shared<spdlog::logger>(loggerName,
+					  spdlog::sinks_init_list({async_sink}));
+}
+
+// the sinks where the messages are written, which for the async
+// logger are the ones behind the async sink
+template <typename T = void>
+std::vector<spdlog::sink_ptr> & writingSinks(spdlog::logger & logger)
+{
+  auto & sinks = logger.sinks();
+  if (sinks.size() == 1){
+    if (auto async_sink = std::dynamic_pointer_cast<AsyncSink>(sinks[0])){
+      return async_sink->sinks();
+    }
+  }
+  return sinks;
+}
+
+template <typename T = bool>
+T & thisRankIsActive()
+{
+  static T value = true;
+  return value;
+}
+
+// the logger level is the lowest level of its sinks, so that messages
+// that no sink would write are discarded before being formatted,
+// or off if this rank has been excluded
+template <typename T = void>
+void updateLoggerLevel(spdlog::logger & logger)
+{
+  auto level = spdlog::level::off;
+  if (thisRankIsActive()){
+    for (const auto & s : writingSinks(logger)){
+      level = (std::min)(level, s->level());
+    }
+  }
+  logger.set_level(level);
+}
+
 }}}//end namespace pressio::log::impl
 
 #endif  // UTILS_LOGGER_UTILS_LOGGER_IMPL_HPP_
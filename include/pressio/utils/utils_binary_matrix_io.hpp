@@ -0,0 +1,386 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// utils_binary_matrix_io.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef UTILS_UTILS_BINARY_MATRIX_IO_HPP_
+#define UTILS_UTILS_BINARY_MATRIX_IO_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PRESSIO_UTILS_BINARY_MATRIX_USE_MMAP
+#endif
+
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+#include <Eigen/Dense>
+#endif
+
+#ifdef PRESSIO_ENABLE_TPL_KOKKOS
+#include "Kokkos_Core.hpp"
+#endif
+
+namespace pressio{ namespace utils{
+
+/*
+  binary matrix format:
+  a 64-byte header followed by the rows*cols entries
+  stored contiguously in column-major order.
+
+  header:
+  - magic          : 8 chars, "PRSMAT01"
+  - rows           : uint64
+  - cols           : uint64
+  - scalar size    : uint32, sizeof of the scalar type used to write
+  - layout         : uint32, 0 = column-major (the only one supported)
+  - reserved       : 32 bytes, zero-filled
+
+  Everything is stored with the native endianness of the writing machine.
+  Since the header is 64 bytes, the data is suitably aligned for all
+  arithmetic scalar types when the file is memory-mapped.
+*/
+struct BinaryMatrixHeader
+{
+  char magic[8];
+  std::uint64_t rows;
+  std::uint64_t cols;
+  std::uint32_t scalarSize;
+  std::uint32_t layout;
+  char reserved[32];
+};
+static_assert(sizeof(BinaryMatrixHeader) == 64,
+	      "BinaryMatrixHeader must be 64 bytes");
+
+namespace impl{
+
+constexpr char binary_matrix_magic[8] = {'P','R','S','M','A','T','0','1'};
+constexpr std::uint32_t binary_matrix_column_major = 0;
+
+template<class ScalarType>
+void validate_binary_matrix_header(const BinaryMatrixHeader & header,
+				   std::uint64_t fileSizeInBytes,
+				   const std::string & filename)
+{
+  if (std::memcmp(header.magic, binary_matrix_magic, 8) != 0){
+    throw std::runtime_error("binary matrix: " + filename + " is not a pressio binary matrix file");
+  }
+  if (header.scalarSize != sizeof(ScalarType)){
+    throw std::runtime_error("binary matrix: scalar size in " + filename
+			     + " does not match the requested scalar type");
+  }
+  if (header.layout != binary_matrix_column_major){
+    throw std::runtime_error("binary matrix: unsupported layout in " + filename);
+  }
+  // rows*cols*sizeof(ScalarType) must neither overflow nor exceed what
+  // can be addressed in memory: check via division before multiplying
+  const std::uint64_t maxEntries =
+    (std::min)(std::uint64_t(std::numeric_limits<std::uint64_t>::max() - sizeof(BinaryMatrixHeader)),
+	       std::uint64_t(std::numeric_limits<std::size_t>::max()))
+    / sizeof(ScalarType);
+  if (header.rows != 0 && header.cols > maxEntries / header.rows){
+    throw std::runtime_error("binary matrix: the extents in " + filename + " are too large");
+  }
+
+  const std::uint64_t expected = sizeof(BinaryMatrixHeader)
+    + header.rows*header.cols*sizeof(ScalarType);
+  if (fileSizeInBytes != expected){
+    throw std::runtime_error("binary matrix: size of " + filename
+			     + " is inconsistent with its header");
+  }
+}
+
+// read exactly numBytes, throw on a short read
+inline void read_binary_matrix_bytes(std::ifstream & file, char * dest,
+				     std::uint64_t numBytes,
+				     const std::string & filename)
+{
+  file.read(dest, static_cast<std::streamsize>(numBytes));
+  if (!file || static_cast<std::uint64_t>(file.gcount()) != numBytes){
+    throw std::runtime_error("binary matrix: failed reading " + filename);
+  }
+}
+} // end namespace impl
+
+// writes the rows x cols column-major array pointed to by data
+template<class ScalarType, class IntType>
+void write_binary_matrix(const std::string & filename,
+			 const ScalarType * data,
+			 IntType rows,
+			 IntType cols)
+{
+  static_assert(std::is_arithmetic<ScalarType>::value,
+		"write_binary_matrix: the scalar type must be arithmetic");
+
+  BinaryMatrixHeader header = {};
+  std::memcpy(header.magic, impl::binary_matrix_magic, 8);
+  header.rows = static_cast<std::uint64_t>(rows);
+  header.cols = static_cast<std::uint64_t>(cols);
+  header.scalarSize = sizeof(ScalarType);
+  header.layout = impl::binary_matrix_column_major;
+
+  std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file){
+    throw std::runtime_error("binary matrix: cannot open " + filename + " for writing");
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(data),
+	     static_cast<std::streamsize>(header.rows*header.cols*sizeof(ScalarType)));
+  if (!file){
+    throw std::runtime_error("binary matrix: failed writing " + filename);
+  }
+}
+
+/*
+  read-only view of a binary matrix file.
+  Where available, the file is memory-mapped (copy-on-write, so writing
+  through data() never modifies the file), otherwise it is read into
+  an owned buffer. Either way, data() points to rows*cols contiguous
+  column-major entries that remain valid as long as this object is alive,
+  so one can wrap it as a non-owning matrix without copying.
+*/
+template<class ScalarType>
+class MappedBinaryMatrix
+{
+  static_assert(std::is_arithmetic<ScalarType>::value,
+		"MappedBinaryMatrix: the scalar type must be arithmetic");
+
+public:
+  explicit MappedBinaryMatrix(const std::string & filename)
+  {
+#ifdef PRESSIO_UTILS_BINARY_MATRIX_USE_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0){
+      throw std::runtime_error("binary matrix: cannot open " + filename);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 ||
+	static_cast<std::uint64_t>(st.st_size) < sizeof(BinaryMatrixHeader))
+    {
+      ::close(fd);
+      throw std::runtime_error("binary matrix: " + filename + " is too small");
+    }
+
+    mappedSize_ = static_cast<std::size_t>(st.st_size);
+    void * addr = ::mmap(nullptr, mappedSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after closing the descriptor
+    ::close(fd);
+    if (addr == MAP_FAILED){
+      throw std::runtime_error("binary matrix: cannot memory-map " + filename);
+    }
+    mapped_ = addr;
+
+    BinaryMatrixHeader header;
+    std::memcpy(&header, mapped_, sizeof(header));
+    try{
+      impl::validate_binary_matrix_header<ScalarType>(header, mappedSize_, filename);
+    }
+    catch (...){
+      release();
+      throw;
+    }
+    rows_ = header.rows;
+    cols_ = header.cols;
+    data_ = reinterpret_cast<ScalarType*>(static_cast<char*>(mapped_) + sizeof(header));
+#else
+    std::ifstream file(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file){
+      throw std::runtime_error("binary matrix: cannot open " + filename);
+    }
+    const auto fileSize = static_cast<std::uint64_t>(file.tellg());
+    if (fileSize < sizeof(BinaryMatrixHeader)){
+      throw std::runtime_error("binary matrix: " + filename + " is too small");
+    }
+    file.seekg(0);
+    BinaryMatrixHeader header;
+    impl::read_binary_matrix_bytes(file, reinterpret_cast<char*>(&header),
+				   sizeof(header), filename);
+    impl::validate_binary_matrix_header<ScalarType>(header, fileSize, filename);
+    rows_ = header.rows;
+    cols_ = header.cols;
+    buffer_.resize(static_cast<std::size_t>(rows_*cols_));
+    impl::read_binary_matrix_bytes(file, reinterpret_cast<char*>(buffer_.data()),
+				   rows_*cols_*sizeof(ScalarType), filename);
+    data_ = buffer_.data();
+#endif
+  }
+
+  MappedBinaryMatrix(const MappedBinaryMatrix &) = delete;
+  MappedBinaryMatrix & operator=(const MappedBinaryMatrix &) = delete;
+
+  MappedBinaryMatrix(MappedBinaryMatrix && other) noexcept
+    : mapped_(other.mapped_),
+      mappedSize_(other.mappedSize_),
+      buffer_(std::move(other.buffer_)),
+      data_(other.data_),
+      rows_(other.rows_),
+      cols_(other.cols_)
+  {
+    other.mapped_ = nullptr;
+    other.mappedSize_ = 0;
+    other.data_ = nullptr;
+    other.rows_ = 0;
+    other.cols_ = 0;
+  }
+
+  MappedBinaryMatrix & operator=(MappedBinaryMatrix &&) = delete;
+
+  ~MappedBinaryMatrix(){ release(); }
+
+  std::uint64_t rows() const{ return rows_; }
+  std::uint64_t cols() const{ return cols_; }
+  const ScalarType * data() const{ return data_; }
+  ScalarType * data(){ return data_; }
+
+private:
+  void release(){
+#ifdef PRESSIO_UTILS_BINARY_MATRIX_USE_MMAP
+    if (mapped_ != nullptr){
+      ::munmap(mapped_, mappedSize_);
+      mapped_ = nullptr;
+    }
+#endif
+  }
+
+private:
+  void * mapped_ = nullptr;
+  std::size_t mappedSize_ = 0;
+  std::vector<ScalarType> buffer_ = {};
+  ScalarType * data_ = nullptr;
+  std::uint64_t rows_ = 0;
+  std::uint64_t cols_ = 0;
+};
+
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+template<class ScalarType, int R, int C, int Options, int MaxR, int MaxC>
+void write_binary_matrix(const std::string & filename,
+			 const Eigen::Matrix<ScalarType, R, C, Options, MaxR, MaxC> & A)
+{
+  using matrix_type = Eigen::Matrix<ScalarType, R, C, Options, MaxR, MaxC>;
+  if (matrix_type::IsRowMajor && A.rows() > 1 && A.cols() > 1){
+    using col_major_t = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+    const col_major_t tmp = A;
+    write_binary_matrix(filename, tmp.data(), tmp.rows(), tmp.cols());
+  }
+  else{
+    write_binary_matrix(filename, A.data(), A.rows(), A.cols());
+  }
+}
+
+// non-owning Eigen view of the mapped entries, no copy is made
+template<class ScalarType>
+Eigen::Map<Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>>
+create_eigen_map(MappedBinaryMatrix<ScalarType> & mapped)
+{
+  using index_t = Eigen::Index;
+  return Eigen::Map<Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>>
+    (mapped.data(), static_cast<index_t>(mapped.rows()), static_cast<index_t>(mapped.cols()));
+}
+
+/*
+  reads the file straight into the storage of an Eigen matrix
+  with a single bulk read: the result can be moved into
+  create_trial_column_subspace to avoid any further copy.
+*/
+template<class ScalarType = double>
+Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>
+read_binary_matrix_eigen(const std::string & filename)
+{
+  std::ifstream file(filename, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file){
+    throw std::runtime_error("binary matrix: cannot open " + filename);
+  }
+  const auto fileSize = static_cast<std::uint64_t>(file.tellg());
+  if (fileSize < sizeof(BinaryMatrixHeader)){
+    throw std::runtime_error("binary matrix: " + filename + " is too small");
+  }
+  file.seekg(0);
+  BinaryMatrixHeader header;
+  impl::read_binary_matrix_bytes(file, reinterpret_cast<char*>(&header),
+				 sizeof(header), filename);
+  impl::validate_binary_matrix_header<ScalarType>(header, fileSize, filename);
+
+  Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic> A
+    (static_cast<Eigen::Index>(header.rows), static_cast<Eigen::Index>(header.cols));
+  impl::read_binary_matrix_bytes(file, reinterpret_cast<char*>(A.data()),
+				 header.rows*header.cols*sizeof(ScalarType), filename);
+  return A;
+}
+#endif
+
+#ifdef PRESSIO_ENABLE_TPL_KOKKOS
+/*
+  non-owning host view of the mapped entries, no copy is made.
+  The view can be passed (as an rvalue) to create_trial_column_subspace,
+  in which case the basis directly references the mapped file.
+*/
+template<class ScalarType>
+Kokkos::View<ScalarType**, Kokkos::LayoutLeft, Kokkos::HostSpace,
+	     Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+create_kokkos_unmanaged_view(MappedBinaryMatrix<ScalarType> & mapped)
+{
+  using view_type = Kokkos::View<ScalarType**, Kokkos::LayoutLeft, Kokkos::HostSpace,
+				 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  return view_type(mapped.data(),
+		   static_cast<std::size_t>(mapped.rows()),
+		   static_cast<std::size_t>(mapped.cols()));
+}
+#endif
+
+}}// end namespace pressio::utils
+
+#endif  // UTILS_UTILS_BINARY_MATRIX_IO_HPP_
@@ -0,0 +1,450 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+// utils_performance_monitor.hpp
+//                     		  Pressio
+//                             Copyright 2019
+//    National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the
+// U.S. Government retains certain rights in this software.
+//
+// Pressio is licensed under BSD-3-Clause terms of use:
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived
+// from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+// (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Francesco Rizzi (fnrizzi@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef UTILS_UTILS_PERFORMANCE_MONITOR_HPP_
+#define UTILS_UTILS_PERFORMANCE_MONITOR_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+  Lightweight hierarchical timing zones and counters.
+
+  The instrumentation points placed inside pressio (advancers, steppers,
+  rom systems, nonlinear solvers) use the PRESSIO_PERF_ZONE and
+  PRESSIO_PERF_COUNT macros below. These expand to nothing unless the
+  user defines PRESSIO_ENABLE_PERF_MONITOR before including pressio,
+  so there is no cost at all by default.
+
+  When enabled, zones nest following the call stack, and the results
+  can be exported via:
+    pressio::perf::write_json(os), pressio::perf::write_csv(os),
+    pressio::perf::report(os)
+
+  Each thread records its zones and counters in its own tree, guarded by
+  its own mutex: entering and leaving a zone only takes that lock, which
+  is uncontended unless the results are being queried at the same time.
+  The trees of all threads are merged by zone path, each under its lock,
+  when the results are queried or exported, so this can be done while
+  other threads (e.g. parareal workers) are timing.
+  As for reset, this must not be done while other threads are in a zone.
+
+  PRESSIO_ENABLE_TEUCHOS_TIMERS, independently, makes the same zones
+  drive the Teuchos stacked timer, so existing Teuchos reports keep working.
+*/
+
+namespace pressio{ namespace perf{ namespace impl{
+
+struct ZoneNode
+{
+  std::string name;
+  ZoneNode * parent = nullptr;
+  std::uint64_t calls = 0;
+  double seconds = 0.;
+  std::vector<std::unique_ptr<ZoneNode>> children;
+
+  ZoneNode * child(const std::string & childName){
+    for (auto & it : children){
+      if (it->name == childName){ return it.get(); }
+    }
+    children.emplace_back(new ZoneNode());
+    children.back()->name = childName;
+    children.back()->parent = this;
+    return children.back().get();
+  }
+};
+
+inline void merge_zone(ZoneNode & into, const ZoneNode & from)
+{
+  into.calls += from.calls;
+  into.seconds += from.seconds;
+  for (auto & it : from.children){
+    merge_zone(*into.child(it->name), *it);
+  }
+}
+
+// the zones and counters recorded by one thread: modified only
+// by that thread, read by the others, both under the mutex
+struct ThreadRecord
+{
+  std::mutex mutex;
+  std::unique_ptr<ZoneNode> root{new ZoneNode()};
+  ZoneNode * current = root.get();
+  std::map<std::string, std::uint64_t> counters;
+
+  void clear(){
+    root.reset(new ZoneNode());
+    current = root.get();
+    counters.clear();
+  }
+};
+
+class Registry
+{
+  // guards the list of records and retired_; each record has its own
+  // mutex, always taken after this one
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<ThreadRecord>> records_;
+  // what is left by the threads that have exited
+  ThreadRecord retired_;
+
+  // registers the record of the calling thread on first use,
+  // and merges it into retired_ when the thread exits
+  struct ThreadHandle{
+    ThreadRecord * record;
+    explicit ThreadHandle(Registry & reg) : record(reg.add()){}
+    ~ThreadHandle(){ Registry::instance().retire(record); }
+  };
+
+  ThreadRecord * add(){
+    std::lock_guard<std::mutex> lock(mutex_);
+    records_.emplace_back(new ThreadRecord());
+    return records_.back().get();
+  }
+
+  void retire(ThreadRecord * record){
+    // called by the owner of the record as it exits, and the
+    // others only read records under mutex_, so this is enough
+    std::lock_guard<std::mutex> lock(mutex_);
+    merge_zone(*retired_.root, *record->root);
+    for (auto & it : record->counters){ retired_.counters[it.first] += it.second; }
+    for (auto it = records_.begin(); it != records_.end(); ++it){
+      if (it->get() == record){ records_.erase(it); break; }
+    }
+  }
+
+  ThreadRecord & local(){
+    thread_local ThreadHandle handle(*this);
+    return *handle.record;
+  }
+
+public:
+  static Registry & instance(){
+    static Registry r;
+    return r;
+  }
+
+  ZoneNode * enter(const char * name){
+    auto & record = local();
+    std::lock_guard<std::mutex> lock(record.mutex);
+    record.current = record.current->child(name);
+    return record.current;
+  }
+
+  void leave(ZoneNode * node, double seconds){
+    auto & record = local();
+    std::lock_guard<std::mutex> lock(record.mutex);
+    ++node->calls;
+    node->seconds += seconds;
+    record.current = node->parent;
+  }
+
+  void count(const char * name, std::uint64_t value){
+    auto & record = local();
+    std::lock_guard<std::mutex> lock(record.mutex);
+    record.counters[name] += value;
+  }
+
+  // must not be called while a zone is open
+  void reset(){
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto & it : records_){
+      std::lock_guard<std::mutex> recordLock(it->mutex);
+      it->clear();
+    }
+    retired_.clear();
+  }
+
+  template<class F>
+  void visit(F && f) const{
+    ZoneNode root;
+    std::map<std::string, std::uint64_t> counters;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      merge_zone(root, *retired_.root);
+      counters = retired_.counters;
+      for (auto & record : records_){
+	std::lock_guard<std::mutex> recordLock(record->mutex);
+	merge_zone(root, *record->root);
+	for (auto & it : record->counters){ counters[it.first] += it.second; }
+      }
+    }
+    f(root, counters);
+  }
+};
+
+class ScopedZone
+{
+#ifdef PRESSIO_ENABLE_PERF_MONITOR
+  ZoneNode * node_;
+  std::chrono::steady_clock::time_point start_;
+#endif
+#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
+  const char * name_;
+  Teuchos::RCP<Teuchos::StackedTimer> teuchosTimer_;
+#endif
+
+public:
+#if defined PRESSIO_ENABLE_PERF_MONITOR || defined PRESSIO_ENABLE_TEUCHOS_TIMERS
+  explicit ScopedZone(const char * name)
+#else
+  explicit ScopedZone(const char * /*name*/)
+#endif
+#ifdef PRESSIO_ENABLE_PERF_MONITOR
+    : node_(Registry::instance().enter(name))
+#endif
+  {
+#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
+    name_ = name;
+    teuchosTimer_ = Teuchos::TimeMonitor::getStackedTimer();
+    teuchosTimer_->start(name);
+#endif
+#ifdef PRESSIO_ENABLE_PERF_MONITOR
+    start_ = std::chrono::steady_clock::now();
+#endif
+  }
+
+  ScopedZone(const ScopedZone &) = delete;
+  ScopedZone & operator=(const ScopedZone &) = delete;
+
+  ~ScopedZone(){
+#ifdef PRESSIO_ENABLE_PERF_MONITOR
+    const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start_;
+#endif
+#ifdef PRESSIO_ENABLE_TEUCHOS_TIMERS
+    teuchosTimer_->stop(name_);
+#endif
+#ifdef PRESSIO_ENABLE_PERF_MONITOR
+    Registry::instance().leave(node_, elapsed.count());
+#endif
+  }
+};
+
+// path is the '/'-separated list of nested zone names
+inline const ZoneNode * find_zone(const ZoneNode & root, const std::string & path)
+{
+  const ZoneNode * node = &root;
+  std::size_t begin = 0;
+  while (node != nullptr && begin <= path.size()){
+    auto end = path.find('/', begin);
+    if (end == std::string::npos){ end = path.size(); }
+    const auto name = path.substr(begin, end - begin);
+    const ZoneNode * next = nullptr;
+    for (auto & it : node->children){
+      if (it->name == name){ next = it.get(); break; }
+    }
+    node = next;
+    begin = end + 1;
+  }
+  return node;
+}
+
+inline std::string json_escape(const std::string & s){
+  std::string out;
+  for (auto c : s){
+    if (c == '"' || c == '\\'){ out += '\\'; }
+    out += c;
+  }
+  return out;
+}
+
+inline void write_json_zone(std::ostream & os, const ZoneNode & node, int indent)
+{
+  const std::string pad(indent, ' ');
+  os << pad << "{\"name\": \"" << json_escape(node.name) << "\", "
+     << "\"calls\": " << node.calls << ", "
+     << "\"seconds\": " << node.seconds << ", "
+     << "\"children\": [";
+  if (!node.children.empty()){
+    os << "\n";
+    for (std::size_t i=0; i<node.children.size(); ++i){
+      write_json_zone(os, *node.children[i], indent+2);
+      os << (i+1 < node.children.size() ? ",\n" : "\n");
+    }
+    os << pad;
+  }
+  os << "]}";
+}
+
+inline void write_csv_zone(std::ostream & os, const ZoneNode & node,
+			   const std::string & parentPath)
+{
+  const auto path = parentPath.empty() ? node.name : parentPath + "/" + node.name;
+  os << "zone," << path << "," << node.calls << "," << node.seconds << ",\n";
+  for (auto & it : node.children){ write_csv_zone(os, *it, path); }
+}
+
+inline void report_zone(std::ostream & os, const ZoneNode & node, int depth)
+{
+  os << std::string(2*depth, ' ') << std::left << std::setw(40 - 2*depth) << node.name
+     << std::right << std::setw(12) << node.calls
+     << std::setw(16) << node.seconds << "\n";
+  for (auto & it : node.children){ report_zone(os, *it, depth+1); }
+}
+
+} // end namespace impl
+
+inline void reset(){
+  impl::Registry::instance().reset();
+}
+
+inline std::uint64_t counter_value(const std::string & name)
+{
+  std::uint64_t result = 0;
+  impl::Registry::instance().visit
+    ([&](const impl::ZoneNode &, const std::map<std::string, std::uint64_t> & counters){
+      const auto it = counters.find(name);
+      if (it != counters.end()){ result = it->second; }
+    });
+  return result;
+}
+
+inline std::uint64_t zone_calls(const std::string & path)
+{
+  std::uint64_t result = 0;
+  impl::Registry::instance().visit
+    ([&](const impl::ZoneNode & root, const std::map<std::string, std::uint64_t> &){
+      const auto node = impl::find_zone(root, path);
+      if (node != nullptr){ result = node->calls; }
+    });
+  return result;
+}
+
+inline double zone_seconds(const std::string & path)
+{
+  double result = 0.;
+  impl::Registry::instance().visit
+    ([&](const impl::ZoneNode & root, const std::map<std::string, std::uint64_t> &){
+      const auto node = impl::find_zone(root, path);
+      if (node != nullptr){ result = node->seconds; }
+    });
+  return result;
+}
+
+inline void write_json(std::ostream & os)
+{
+  impl::Registry::instance().visit
+    ([&os](const impl::ZoneNode & root, const std::map<std::string, std::uint64_t> & counters){
+      os << "{\n  \"zones\": [";
+      if (!root.children.empty()){
+	os << "\n";
+	for (std::size_t i=0; i<root.children.size(); ++i){
+	  impl::write_json_zone(os, *root.children[i], 4);
+	  os << (i+1 < root.children.size() ? ",\n" : "\n");
+	}
+	os << "  ";
+      }
+      os << "],\n  \"counters\": {";
+      std::size_t i = 0;
+      for (auto & it : counters){
+	os << (i++ == 0 ? "\n" : ",\n")
+	   << "    \"" << impl::json_escape(it.first) << "\": " << it.second;
+      }
+      os << (counters.empty() ? "}" : "\n  }") << "\n}\n";
+    });
+}
+
+inline void write_csv(std::ostream & os)
+{
+  impl::Registry::instance().visit
+    ([&os](const impl::ZoneNode & root, const std::map<std::string, std::uint64_t> & counters){
+      os << "kind,name,calls,seconds,value\n";
+      for (auto & it : root.children){ impl::write_csv_zone(os, *it, ""); }
+      for (auto & it : counters){
+	os << "counter," << it.first << ",,," << it.second << "\n";
+      }
+    });
+}
+
+inline void report(std::ostream & os)
+{
+  impl::Registry::instance().visit
+    ([&os](const impl::ZoneNode & root, const std::map<std::string, std::uint64_t> & counters){
+      os << std::left << std::setw(40) << "zone"
+	 << std::right << std::setw(12) << "calls" << std::setw(16) << "seconds" << "\n";
+      for (auto & it : root.children){ impl::report_zone(os, *it, 0); }
+      if (!counters.empty()){
+	os << "\n" << std::left << std::setw(40) << "counter"
+	   << std::right << std::setw(12) << "value" << "\n";
+      }
+      for (auto & it : counters){
+	os << std::left << std::setw(40) << it.first
+	   << std::right << std::setw(12) << it.second << "\n";
+      }
+    });
+}
+
+}} // end namespace pressio::perf
+
+#define PRESSIO_PERF_CONCAT_IMPL(a, b) a##b
+#define PRESSIO_PERF_CONCAT(a, b) PRESSIO_PERF_CONCAT_IMPL(a, b)
+
+#if defined(PRESSIO_ENABLE_PERF_MONITOR) || defined(PRESSIO_ENABLE_TEUCHOS_TIMERS)
+#define PRESSIO_PERF_ZONE(name) \
+  ::pressio::perf::impl::ScopedZone PRESSIO_PERF_CONCAT(pressio_perf_zone_, __LINE__)(name)
+#else
+#define PRESSIO_PERF_ZONE(name) (void)0
+#endif
+
+// counters only exist in the pressio monitor, Teuchos timers have none
+#if defined(PRESSIO_ENABLE_PERF_MONITOR)
+#define PRESSIO_PERF_COUNT(name, value) \
+  ::pressio::perf::impl::Registry::instance().count(name, static_cast<std::uint64_t>(value))
+#else
+#define PRESSIO_PERF_COUNT(name, value) (void)0
+#endif
+
+#endif  // UTILS_UTILS_PERFORMANCE_MONITOR_HPP_
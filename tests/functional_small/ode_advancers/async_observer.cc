@@ -0,0 +1,107 @@
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include "pressio/ode_advancers.hpp"
+
+namespace{
+
+template<class StateType>
+struct IncrementStepper
+{
+  using state_type = StateType;
+  using independent_variable_type = double;
+
+  void operator()(state_type & odeState,
+		  pressio::ode::StepStartAt<independent_variable_type> /*unused*/,
+		  pressio::ode::StepCount /*unused*/,
+		  pressio::ode::StepSize<independent_variable_type> /*unused*/)
+  {
+    for (int i=0; i<(int)odeState.size(); i++){
+      odeState[i] += 1.;
+    }
+  }
+};
+
+// slow observer recording what it sees
+template<class StateType>
+struct RecordingObserver
+{
+  std::vector<int> steps_;
+  std::vector<double> times_;
+  std::vector<double> values_;
+  std::thread::id callerThread_ = {};
+
+  void operator()(pressio::ode::StepCount step,
+		  double time,
+		  const StateType & state)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    callerThread_ = std::this_thread::get_id();
+    steps_.push_back(step.get());
+    times_.push_back(time);
+    values_.push_back(state[0]);
+  }
+};
+}
+
+TEST(ode_advancers, async_observer_advance_n_steps)
+{
+  using state_t = std::vector<double>;
+  IncrementStepper<state_t> stepper;
+  state_t y(5, 0.);
+
+  RecordingObserver<state_t> observer;
+  {
+    auto asyncObserver = pressio::ode::create_async_observer<double>(observer, y, 2);
+    pressio::ode::advance_n_steps(stepper, y, 0., 0.5, pressio::ode::StepCount(20),
+				  asyncObserver);
+
+    // the advancer flushes before returning, so everything has been observed
+    ASSERT_EQ(observer.steps_.size(), 21u);
+    EXPECT_NE(observer.callerThread_, std::this_thread::get_id());
+  }
+
+  for (int i=0; i<=20; ++i){
+    EXPECT_EQ(observer.steps_[i], i);
+    EXPECT_DOUBLE_EQ(observer.times_[i], 0.5*i);
+    // each observed state is a copy taken right after the step
+    EXPECT_DOUBLE_EQ(observer.values_[i], (double) i);
+  }
+}
+
+TEST(ode_advancers, async_observer_to_target_time)
+{
+  using state_t = Eigen::VectorXd;
+  IncrementStepper<state_t> stepper;
+  state_t y(4);
+  y.setZero();
+
+  RecordingObserver<state_t> observer;
+  auto asyncObserver = pressio::ode::create_async_observer<double>(observer, y, 3);
+  auto dtPolicy = [](pressio::ode::StepCount, pressio::ode::StepStartAt<double>,
+		     pressio::ode::StepSize<double> & dt){ dt = 0.25; };
+  pressio::ode::advance_to_target_point(stepper, y, 0., 2., dtPolicy, asyncObserver);
+
+  ASSERT_EQ(observer.steps_.size(), 9u);
+  for (int i=0; i<=8; ++i){
+    EXPECT_DOUBLE_EQ(observer.values_[i], (double) i);
+  }
+}
+
+TEST(ode_advancers, async_observer_rethrows_observer_exception)
+{
+  using state_t = std::vector<double>;
+  IncrementStepper<state_t> stepper;
+  state_t y(2, 0.);
+
+  int numCalls = 0;
+  auto throwingObserver = [&numCalls](pressio::ode::StepCount step, double, const state_t &){
+    ++numCalls;
+    if (step.get() == 3){ throw std::runtime_error("observer failure"); }
+  };
+  auto asyncObserver = pressio::ode::create_async_observer<double>(throwingObserver, y);
+  EXPECT_THROW(pressio::ode::advance_n_steps(stepper, y, 0., 0.5,
+					     pressio::ode::StepCount(6), asyncObserver),
+	       std::runtime_error);
+  EXPECT_EQ(numCalls, 7);
+}
@@ -0,0 +1,271 @@
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include "pressio/ode_advancers.hpp"
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+// dy/dt = A y
+struct LinearSystem
+{
+  using independent_variable_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  Eigen::MatrixXd A_;
+
+  LinearSystem() : A_(3,3){
+    A_ << -1.0,  0.5,  0.0,
+	  -0.5, -1.0,  0.2,
+	   0.0, -0.2, -2.0;
+  }
+
+  state_type createState() const{ return state_type(3); }
+  rhs_type createRhs() const{ return rhs_type(3); }
+
+  void rhs(const state_type & y, independent_variable_type /*t*/, rhs_type & f) const{
+    f = A_*y;
+  }
+};
+
+// dy/dt = -y, advanced with its exact solution, recording the threads used
+struct ExactDecayStepper
+{
+  using state_type = Eigen::VectorXd;
+  using independent_variable_type = double;
+
+  std::set<std::thread::id> * threads_;
+  std::mutex * mutex_;
+
+  void operator()(state_type & y,
+		  pressio::ode::StepStartAt<independent_variable_type> /*unused*/,
+		  pressio::ode::StepCount /*unused*/,
+		  pressio::ode::StepSize<independent_variable_type> dt)
+  {
+    {
+      std::lock_guard<std::mutex> lock(*mutex_);
+      threads_->insert(std::this_thread::get_id());
+    }
+    // mimic an expensive step, so that all workers get some slices
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    y *= std::exp(-dt.get());
+  }
+};
+
+// dy/dt = -y, advanced with forward Euler
+struct EulerDecayStepper
+{
+  using state_type = Eigen::VectorXd;
+  using independent_variable_type = double;
+
+  void operator()(state_type & y,
+		  pressio::ode::StepStartAt<independent_variable_type> /*unused*/,
+		  pressio::ode::StepCount /*unused*/,
+		  pressio::ode::StepSize<independent_variable_type> dt)
+  {
+    y *= (1. - dt.get());
+  }
+};
+
+// dy/dt = A y with a slowly decaying subspace, usable as the FOM of a Galerkin ROM
+struct LinearFom
+{
+  using independent_variable_type = double;
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  Eigen::MatrixXd A_;
+
+  LinearFom() : A_(6,6){
+    A_.setZero();
+    A_.diagonal() << -0.2, -0.3, -0.4, -20., -25., -30.;
+    A_(0,1) = 0.5; A_(1,0) = -0.5;
+    A_(3,4) = 0.1; A_(4,3) = -0.1;
+    // weak coupling of the fast modes into the slow ones
+    A_(0,3) = 0.05; A_(2,5) = 0.05;
+  }
+
+  state_type createState() const{ return state_type(6); }
+  rhs_type createRhs() const{ return rhs_type(6); }
+
+  void rhs(const state_type & y, independent_variable_type /*t*/, rhs_type & f) const{
+    f = A_*y;
+  }
+};
+
+struct ThrowingStepper
+{
+  using state_type = Eigen::VectorXd;
+  using independent_variable_type = double;
+
+  void operator()(state_type & /*unused*/,
+		  pressio::ode::StepStartAt<independent_variable_type> /*unused*/,
+		  pressio::ode::StepCount /*unused*/,
+		  pressio::ode::StepSize<independent_variable_type> /*unused*/)
+  {
+    throw std::runtime_error("fine stepper failure");
+  }
+};
+}
+
+TEST(ode_advancers, parareal_matches_fine_solution_after_num_slices_iterations)
+{
+  using namespace pressio;
+  LinearSystem system;
+  const double sliceSize = 0.5;
+  const ode::StepCount numSlices(8);
+  const ode::StepCount coarseSteps(2);
+  const ode::StepCount fineSteps(20);
+
+  Eigen::VectorXd y0(3);
+  y0 << 1., 2., -1.;
+
+  // sequential fine reference
+  Eigen::VectorXd yGold = y0;
+  auto fineRef = ode::create_explicit_stepper(ode::StepScheme::RungeKutta4, system);
+  ode::advance_n_steps(fineRef, yGold, 0., sliceSize/fineSteps.get(),
+		       ode::StepCount(numSlices.get()*fineSteps.get()));
+
+  auto coarse = ode::create_explicit_stepper(ode::StepScheme::ForwardEuler, system);
+  using fine_t = decltype(ode::create_explicit_stepper(ode::StepScheme::RungeKutta4, system));
+  std::vector<fine_t> fine;
+  for (int i=0; i<3; ++i){
+    fine.push_back(ode::create_explicit_stepper(ode::StepScheme::RungeKutta4, system));
+  }
+
+  Eigen::VectorXd y = y0;
+  const int iters = ode::advance_parareal(coarse, fine, y, 0., sliceSize, numSlices,
+					  coarseSteps, fineSteps, numSlices.get(), 0.);
+  EXPECT_LE(iters, numSlices.get());
+  EXPECT_TRUE(y.isApprox(yGold, 1e-12));
+}
+
+TEST(ode_advancers, parareal_converges_before_num_slices_iterations)
+{
+  using namespace pressio;
+  std::set<std::thread::id> threads;
+  std::mutex mutex;
+
+  const double sliceSize = 0.25;
+  const ode::StepCount numSlices(16);
+  EulerDecayStepper coarse;
+  std::vector<ExactDecayStepper> fine(4, ExactDecayStepper{&threads, &mutex});
+
+  Eigen::VectorXd y(2);
+  y << 1., 3.;
+  const int iters = ode::advance_parareal(coarse, fine, y, 0., sliceSize, numSlices,
+					  ode::StepCount(1), ode::StepCount(4),
+					  100, 1e-10);
+
+  const double tf = sliceSize*numSlices.get();
+  EXPECT_LT(iters, numSlices.get());
+  EXPECT_NEAR(y(0), std::exp(-tf), 1e-9);
+  EXPECT_NEAR(y(1), 3.*std::exp(-tf), 1e-9);
+  // the fine propagation ran on more than the calling thread,
+  // and the same worker threads are used by all iterations
+  EXPECT_GT(threads.size(), 1u);
+  EXPECT_LE(threads.size(), fine.size());
+}
+
+TEST(ode_advancers, parareal_tolerance_is_relative)
+{
+  // scaling the state must not change the number of iterations
+  using namespace pressio;
+  std::set<std::thread::id> threads;
+  std::mutex mutex;
+  EulerDecayStepper coarse;
+  std::vector<ExactDecayStepper> fine(2, ExactDecayStepper{&threads, &mutex});
+
+  auto run = [&](double scale, double atol, double rtol){
+    Eigen::VectorXd y(2);
+    y << scale, 3.*scale;
+    return ode::advance_parareal(coarse, fine, y, 0., 0.25, ode::StepCount(16),
+				 ode::StepCount(1), ode::StepCount(4), 100, atol, rtol);
+  };
+  const int iters = run(1., 0., 1e-8);
+  EXPECT_GT(iters, 1);
+  EXPECT_LT(iters, 16);
+  EXPECT_EQ(run(1e6, 0., 1e-8), iters);
+  EXPECT_EQ(run(1e-6, 0., 1e-8), iters);
+
+  // a loose absolute tolerance stops the iteration earlier
+  EXPECT_LT(run(1., 1e-2, 0.), iters);
+}
+
+TEST(ode_advancers, parareal_rethrows_fine_stepper_exceptions)
+{
+  using namespace pressio;
+  EulerDecayStepper coarse;
+  std::vector<ThrowingStepper> fine(2);
+  Eigen::VectorXd y(2);
+  y << 1., 3.;
+  EXPECT_THROW(ode::advance_parareal(coarse, fine, y, 0., 0.1, ode::StepCount(4),
+				     ode::StepCount(1), ode::StepCount(2), 4, 1e-8),
+	       std::runtime_error);
+}
+
+TEST(ode_advancers, parareal_with_galerkin_coarse_stepper)
+{
+  using namespace pressio;
+  LinearFom fom;
+  const double sliceSize = 0.5;
+  const ode::StepCount numSlices(8);
+  const ode::StepCount fineSteps(20);
+
+  Eigen::VectorXd y0(6);
+  y0 << 1., 2., -1., 0.3, -0.2, 0.1;
+
+  Eigen::VectorXd yGold = y0;
+  auto fineRef = ode::create_explicit_stepper(ode::StepScheme::RungeKutta4, fom);
+  ode::advance_n_steps(fineRef, yGold, 0., sliceSize/fineSteps.get(),
+		       ode::StepCount(numSlices.get()*fineSteps.get()));
+
+  // the coarse propagator is a Galerkin ROM on the slow modes
+  Eigen::MatrixXd phi = Eigen::MatrixXd::Zero(6, 3);
+  phi(0,0) = phi(1,1) = phi(2,2) = 1.;
+  Eigen::VectorXd shift = Eigen::VectorXd::Zero(6);
+  const auto space = rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, true);
+  auto coarse = rom::galerkin::create_unsteady_explicit_problem(ode::StepScheme::RungeKutta4, space, fom);
+
+  int restrictCount = 0, liftCount = 0;
+  auto restrictOp = [&](const Eigen::VectorXd & u){
+    ++restrictCount;
+    Eigen::VectorXd q = space.createReducedState();
+    q = phi.transpose()*(u - shift);
+    return q;
+  };
+  auto liftOp = [&](const Eigen::VectorXd & q){
+    ++liftCount;
+    return space.createFullStateFromReducedState(q);
+  };
+
+  using fine_t = decltype(ode::create_explicit_stepper(ode::StepScheme::RungeKutta4, fom));
+  std::vector<fine_t> fine;
+  for (int i=0; i<3; ++i){
+    fine.push_back(ode::create_explicit_stepper(ode::StepScheme::RungeKutta4, fom));
+  }
+
+  // exact after numSlices iterations
+  Eigen::VectorXd y = y0;
+  int iters = ode::advance_parareal(coarse, fine, y, 0., sliceSize, numSlices,
+				    ode::StepCount(2), fineSteps, numSlices.get(), 0., 0.,
+				    restrictOp, liftOp);
+  EXPECT_EQ(iters, numSlices.get());
+  EXPECT_TRUE(y.isApprox(yGold, 1e-12));
+  EXPECT_GT(restrictCount, numSlices.get());
+  EXPECT_EQ(restrictCount, liftCount);
+
+  // and converges earlier with a tolerance
+  y = y0;
+  iters = ode::advance_parareal(coarse, fine, y, 0., sliceSize, numSlices,
+				ode::StepCount(2), fineSteps, 100, 0., 1e-10,
+				restrictOp, liftOp);
+  EXPECT_LT(iters, numSlices.get());
+  EXPECT_TRUE(y.isApprox(yGold, 1e-8));
+}
@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+#include "pressio/solvers_linear.hpp"
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/ode_advancers.hpp"
+
+namespace{
+
+// M dy/dt = f(y,t) with constant M, using the constant mass matrix API
+struct MyAppConstantMM
+{
+  using independent_variable_type = double;
+  using state_type           = Eigen::VectorXd;
+  using rhs_type = state_type;
+  using mass_matrix_type     = Eigen::MatrixXd;
+
+  const Eigen::MatrixXd & M_;
+  mutable int massMatrixCount_ = 0;
+
+  explicit MyAppConstantMM(const Eigen::MatrixXd & M) : M_(M){}
+
+  state_type createState() const{
+    state_type ret(3); ret.setZero();
+    return ret;
+  }
+
+  rhs_type createRhs() const{
+    rhs_type ret(3); ret.setZero();
+    return ret;
+  };
+
+  mass_matrix_type createMassMatrix() const{
+    mass_matrix_type ret(3,3); ret.setZero();
+    return ret;
+  };
+
+  void massMatrix(mass_matrix_type & M) const{
+    ++massMatrixCount_;
+    M = M_;
+  }
+
+  void rhs(const state_type & y,
+	   independent_variable_type evaltime,
+	   rhs_type & f) const
+  {
+    for (int i=0; i<f.size(); ++i){
+      f(i) = -0.1*y(i) + evaltime;
+    }
+  };
+};
+
+// same problem written as dy/dt = M^-1 f(y,t)
+struct MyAppNoMM
+{
+  using independent_variable_type = double;
+  using state_type           = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  Eigen::MatrixXd Minv_;
+
+  explicit MyAppNoMM(const Eigen::MatrixXd & M) : Minv_(M.inverse()){}
+
+  state_type createState() const{
+    state_type ret(3); ret.setZero();
+    return ret;
+  }
+
+  rhs_type createRhs() const{
+    rhs_type ret(3); ret.setZero();
+    return ret;
+  };
+
+  void rhs(const state_type & y,
+	   independent_variable_type evaltime,
+	   rhs_type & f) const
+  {
+    Eigen::VectorXd tmp(f.size());
+    for (int i=0; i<f.size(); ++i){
+      tmp(i) = -0.1*y(i) + evaltime;
+    }
+    f = Minv_*tmp;
+  };
+};
+
+// exposes the factorization so that the stepper can reuse it
+struct FactorizingLinearSolver
+{
+  using solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::PartialPivLU, Eigen::MatrixXd>;
+
+  int factorizeCount_ = 0;
+  int solveCount_ = 0;
+  solver_t solver_;
+
+  bool factorizeIfChanged(const Eigen::MatrixXd & A){
+    const bool factorized = solver_.factorizeIfChanged(A);
+    if (factorized){ ++factorizeCount_; }
+    return factorized;
+  }
+
+  void solveWithFactorization(const Eigen::VectorXd & b, Eigen::VectorXd & x){
+    ++solveCount_;
+    solver_.solveWithFactorization(b, x);
+  }
+
+  void solve(const Eigen::MatrixXd & /*A*/, Eigen::VectorXd & /*x*/, const Eigen::VectorXd & /*b*/){
+    FAIL() << "the factorization should have been reused";
+  }
+};
+
+// only provides solve: still works, but cannot reuse the factorization
+struct PlainLinearSolver
+{
+  int solveCount_ = 0;
+
+  void solve(const Eigen::MatrixXd & A, Eigen::VectorXd & x, const Eigen::VectorXd & b){
+    ++solveCount_;
+    x = A.colPivHouseholderQr().solve(b);
+  }
+};
+
+template<class StepperCreator>
+void run_and_compare(StepperCreator createStepper, int stagesPerStep)
+{
+  const auto nsteps = ::pressio::ode::StepCount(4);
+  const double dt = 0.5;
+
+  Eigen::MatrixXd M(3,3);
+  M << 4., 1., 0.,
+       1., 3., 1.,
+       0., 1., 2.;
+
+  Eigen::VectorXd yGold(3);
+  yGold << 1., 2., 3.;
+  {
+    MyAppNoMM appObj(M);
+    auto stepperObj = createStepper(appObj);
+    pressio::ode::advance_n_steps(stepperObj, yGold, 0.0, dt, nsteps);
+  }
+
+  {
+    MyAppConstantMM appObj(M);
+    auto stepperObj = createStepper(appObj);
+    // the mass matrix is assembled once, when the stepper is created
+    EXPECT_EQ(appObj.massMatrixCount_, 1);
+
+    Eigen::VectorXd y(3);
+    y << 1., 2., 3.;
+    FactorizingLinearSolver solver;
+    pressio::ode::advance_n_steps(stepperObj, y, 0.0, dt, nsteps, solver);
+    EXPECT_EQ(appObj.massMatrixCount_, 1);
+    EXPECT_EQ(solver.factorizeCount_, 1);
+    EXPECT_EQ(solver.solveCount_, stagesPerStep*nsteps.get());
+    EXPECT_TRUE(y.isApprox(yGold, 1e-12));
+  }
+
+  {
+    MyAppConstantMM appObj(M);
+    auto stepperObj = createStepper(appObj);
+    Eigen::VectorXd y(3);
+    y << 1., 2., 3.;
+    PlainLinearSolver solver;
+    pressio::ode::advance_n_steps(stepperObj, y, 0.0, dt, nsteps, solver);
+    EXPECT_EQ(appObj.massMatrixCount_, 1);
+    EXPECT_EQ(solver.solveCount_, stagesPerStep*nsteps.get());
+    EXPECT_TRUE(y.isApprox(yGold, 1e-12));
+  }
+  {
+    // the reuse is keyed on the mass matrix, not on the solver object:
+    // alternating two solvers factorizes each of them only once
+    MyAppConstantMM appObj(M);
+    auto stepperObj = createStepper(appObj);
+    Eigen::VectorXd y(3);
+    y << 1., 2., 3.;
+    FactorizingLinearSolver solverA;
+    FactorizingLinearSolver solverB;
+    for (int i=1; i<=nsteps.get(); ++i){
+      auto & solver = (i % 2 == 0) ? solverB : solverA;
+      stepperObj(y, ::pressio::ode::StepStartAt<double>((i-1)*dt),
+		 ::pressio::ode::StepCount(i),
+		 ::pressio::ode::StepSize<double>(dt), solver);
+    }
+    EXPECT_EQ(solverA.factorizeCount_, 1);
+    EXPECT_EQ(solverB.factorizeCount_, 1);
+    EXPECT_TRUE(y.isApprox(yGold, 1e-12));
+  }
+  {
+    // one solver shared by two steppers with different mass matrices:
+    // each stepper must solve with the factors of its own matrix
+    Eigen::MatrixXd M2(3,3);
+    M2 << 2., 0., 1.,
+	  0., 5., 0.,
+	  1., 0., 3.;
+    Eigen::VectorXd yGold2(3);
+    yGold2 << 1., 2., 3.;
+    {
+      MyAppNoMM appObj(M2);
+      auto stepperObj = createStepper(appObj);
+      pressio::ode::advance_n_steps(stepperObj, yGold2, 0.0, dt, nsteps);
+    }
+
+    MyAppConstantMM appObj1(M);
+    MyAppConstantMM appObj2(M2);
+    auto stepperObj1 = createStepper(appObj1);
+    auto stepperObj2 = createStepper(appObj2);
+    Eigen::VectorXd y1(3);
+    y1 << 1., 2., 3.;
+    Eigen::VectorXd y2 = y1;
+    FactorizingLinearSolver solver;
+    for (int i=1; i<=nsteps.get(); ++i){
+      stepperObj1(y1, ::pressio::ode::StepStartAt<double>((i-1)*dt),
+		  ::pressio::ode::StepCount(i),
+		  ::pressio::ode::StepSize<double>(dt), solver);
+      stepperObj2(y2, ::pressio::ode::StepStartAt<double>((i-1)*dt),
+		  ::pressio::ode::StepCount(i),
+		  ::pressio::ode::StepSize<double>(dt), solver);
+    }
+    EXPECT_EQ(solver.factorizeCount_, 2*nsteps.get());
+    EXPECT_TRUE(y1.isApprox(yGold, 1e-12));
+    EXPECT_TRUE(y2.isApprox(yGold2, 1e-12));
+
+    // the caller refactorizing the solver on another matrix
+    // does not make the stepper reuse those factors
+    Eigen::VectorXd y3(3);
+    y3 << 1., 2., 3.;
+    MyAppConstantMM appObj3(M);
+    auto stepperObj3 = createStepper(appObj3);
+    for (int i=1; i<=nsteps.get(); ++i){
+      solver.factorizeIfChanged(M2);
+      stepperObj3(y3, ::pressio::ode::StepStartAt<double>((i-1)*dt),
+		  ::pressio::ode::StepCount(i),
+		  ::pressio::ode::StepSize<double>(dt), solver);
+    }
+    EXPECT_TRUE(y3.isApprox(yGold, 1e-12));
+  }
+}
+}
+
+TEST(ode_explicit_steppers, forward_euler_constant_mass_matrix){
+  run_and_compare([](auto & app){ return pressio::ode::create_forward_euler_stepper(app); }, 1);
+}
+
+TEST(ode_explicit_steppers, ab2_constant_mass_matrix){
+  run_and_compare([](auto & app){ return pressio::ode::create_ab2_stepper(app); }, 1);
+}
+
+TEST(ode_explicit_steppers, rk4_constant_mass_matrix){
+  run_and_compare([](auto & app){ return pressio::ode::create_rk4_stepper(app); }, 4);
+}
+
+TEST(ode_explicit_steppers, ssprk3_constant_mass_matrix){
+  run_and_compare([](auto & app){ return pressio::ode::create_ssprk3_stepper(app); }, 3);
+}
@@ -0,0 +1,107 @@
+
+#include <gtest/gtest.h>
+#include "pressio/solvers.hpp"
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/ode_steppers_implicit.hpp"
+#include "pressio/ode_advancers.hpp"
+#include "testing_apps.hpp"
+
+namespace{
+
+// the stepper created with the scheme as template argument
+// must give exactly the same result as the runtime one
+template<class SchemeTag>
+void run_explicit(::pressio::ode::StepScheme name)
+{
+  using namespace pressio;
+  using problem_t = ode::testing::AppEigenA;
+  using state_t = typename problem_t::state_type;
+  problem_t problemObj;
+
+  state_t y1(3); y1(0) = 1.; y1(1) = 2.; y1(2) = 3.;
+  state_t y2 = y1;
+
+  auto stepper1 = ode::create_explicit_stepper(name, problemObj);
+  auto stepper2 = ode::create_explicit_stepper<SchemeTag>(problemObj);
+  static_assert(!std::is_same<decltype(stepper1), decltype(stepper2)>::value, "");
+
+  const double dt = 0.1;
+  ode::advance_n_steps(stepper1, y1, 0.0, dt, ode::StepCount(5));
+  ode::advance_n_steps(stepper2, y2, 0.0, dt, ode::StepCount(5));
+  for (int i=0; i<3; ++i){
+    EXPECT_DOUBLE_EQ(y1(i), y2(i));
+  }
+}
+
+template<class SchemeTag, class ProblemType>
+void run_implicit(::pressio::ode::StepScheme name)
+{
+  using namespace pressio;
+  using state_t = typename ProblemType::state_type;
+  using jac_t = typename ProblemType::jacobian_type;
+  ProblemType problemObj;
+
+  state_t y1 = problemObj.getInitCond();
+  state_t y2 = problemObj.getInitCond();
+
+  auto stepper1 = ode::create_implicit_stepper(name, problemObj);
+  auto stepper2 = ode::create_implicit_stepper<SchemeTag>(problemObj);
+
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::Bicgstab, jac_t>;
+  lin_solver_t linSolverObj;
+  auto nonLinSolver1 = create_newton_solver(stepper1, linSolverObj);
+  auto nonLinSolver2 = create_newton_solver(stepper2, linSolverObj);
+
+  const double dt = 0.01;
+  ode::advance_n_steps(stepper1, y1, 0.0, dt, ode::StepCount(4), nonLinSolver1);
+  ode::advance_n_steps(stepper2, y2, 0.0, dt, ode::StepCount(4), nonLinSolver2);
+  for (int i=0; i<3; ++i){
+    EXPECT_DOUBLE_EQ(y1(i), y2(i));
+  }
+}
+} // end anonymous namespace
+
+TEST(ode, compile_time_scheme_explicit)
+{
+  using namespace pressio::ode;
+  run_explicit<ForwardEuler>(StepScheme::ForwardEuler);
+  run_explicit<RungeKutta4>(StepScheme::RungeKutta4);
+  run_explicit<AdamsBashforth2>(StepScheme::AdamsBashforth2);
+  run_explicit<SSPRungeKutta3>(StepScheme::SSPRungeKutta3);
+  run_explicit<DormandPrince45>(StepScheme::DormandPrince45);
+  run_explicit<BogackiShampine23>(StepScheme::BogackiShampine23);
+  run_explicit<LowStorageRungeKutta4>(StepScheme::LowStorageRungeKutta4);
+}
+
+TEST(ode, compile_time_scheme_implicit)
+{
+  using namespace pressio::ode;
+  using problem_t = pressio::ode::testing::AppEigenB;
+  run_implicit<BDF1, problem_t>(StepScheme::BDF1);
+  run_implicit<BDF2, problem_t>(StepScheme::BDF2);
+  run_implicit<CrankNicolson, problem_t>(StepScheme::CrankNicolson);
+}
+
+TEST(ode, compile_time_scheme_implicit_bdf2_analytic)
+{
+  using namespace pressio;
+  using problem_t = ode::testing::AppEigenB;
+  using state_t = typename problem_t::state_type;
+  using jac_t = typename problem_t::jacobian_type;
+  problem_t problemObj;
+  state_t y = problemObj.getInitCond();
+
+  auto stepperObj = ode::create_implicit_stepper<ode::BDF2>(problemObj);
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::Bicgstab, jac_t>;
+  lin_solver_t linSolverObj;
+  auto nonLinSolver = create_newton_solver(stepperObj, linSolverObj);
+
+  const double dt = 0.01;
+  ode::advance_n_steps(stepperObj, y, 0.0, dt, ode::StepCount(4), nonLinSolver);
+
+  problemObj.analyticAdvanceBackEulerNSteps(dt, 1);
+  problemObj.analyticAdvanceBDF2NSteps(dt, 3);
+  EXPECT_NEAR(y(0), problemObj.y(0), 1e-15);
+  EXPECT_NEAR(y(1), problemObj.y(1), 1e-15);
+  EXPECT_NEAR(y(2), problemObj.y(2), 1e-15);
+}
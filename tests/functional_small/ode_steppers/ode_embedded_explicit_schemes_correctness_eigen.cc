@@ -0,0 +1,307 @@
+#include <gtest/gtest.h>
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/ode_advancers.hpp"
+
+namespace{
+
+// dy_i/dt = lambda_i*y_i + sin(t)
+struct AppForEmbeddedSchemes
+{
+  using independent_variable_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  std::array<double,3> lambdas_ = {-1., -2., -5.};
+
+  state_type createState() const{
+    state_type s(3);
+    s.setZero();
+    return s;
+  };
+
+  rhs_type createRhs() const{
+    rhs_type r(3);
+    r.setZero();
+    return r;
+  };
+
+  void rhs(const state_type & y,
+	   const independent_variable_type evaltime,
+	   rhs_type & rhs) const
+  {
+    for (int i=0; i<3; i++){
+      rhs[i] = lambdas_[i]*y[i] + std::sin(evaltime);
+    }
+  };
+
+  state_type exact(double t) const{
+    // y(0) = 1
+    state_type y(3);
+    for (int i=0; i<3; i++){
+      const double l = lambdas_[i];
+      const double c = 1./(1. + l*l);
+      y[i] = (1. + c)*std::exp(l*t) - c*(l*std::sin(t) + std::cos(t));
+    }
+    return y;
+  }
+};
+
+template<class StepperType>
+double error_at_final_time(StepperType & stepper, int numSteps, double finalTime)
+{
+  AppForEmbeddedSchemes app;
+  Eigen::VectorXd y(3);
+  y.setConstant(1.);
+  pressio::ode::advance_n_steps(stepper, y, 0.0, finalTime/numSteps,
+				pressio::ode::StepCount(numSteps));
+  return (y - app.exact(finalTime)).norm();
+}
+
+struct CountingAppForEmbeddedSchemes : AppForEmbeddedSchemes
+{
+  mutable int numRhs_ = 0;
+
+  void rhs(const state_type & y,
+	   const independent_variable_type evaltime,
+	   rhs_type & rhs) const
+  {
+    ++numRhs_;
+    AppForEmbeddedSchemes::rhs(y, evaltime, rhs);
+  }
+};
+
+// dy/dt = -10*y, with a nan rhs for a negative state,
+// which too large steps produce at the intermediate stages
+struct AppWithNanRhsForNegativeState
+{
+  using independent_variable_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  state_type createState() const{ return state_type::Zero(2); }
+  rhs_type createRhs() const{ return rhs_type::Zero(2); }
+
+  void rhs(const state_type & y,
+	   const independent_variable_type /*evaltime*/,
+	   rhs_type & rhs) const
+  {
+    rhs = -10.*y;
+    if ((y.array() < 0.).any()){
+      rhs.setConstant(std::nan(""));
+    }
+  }
+};
+
+struct AppWithNanRhs
+{
+  using independent_variable_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  state_type createState() const{ return state_type::Zero(3); }
+  rhs_type createRhs() const{ return rhs_type::Zero(3); }
+
+  void rhs(const state_type & /*y*/,
+	   const independent_variable_type evaltime,
+	   rhs_type & rhs) const
+  {
+    rhs.setConstant(evaltime > 0.5 ? std::nan("") : 1.);
+  }
+};
+
+struct FinalTimeObserver
+{
+  double lastTime_ = {};
+  int numSteps_ = {};
+  void operator()(pressio::ode::StepCount step, double time, const Eigen::VectorXd &){
+    lastTime_ = time;
+    numSteps_ = step.get();
+  }
+};
+}
+
+TEST(ode_explicit_steppers, dormand_prince45_convergence_order)
+{
+  AppForEmbeddedSchemes app;
+  auto stepper = pressio::ode::create_dormand_prince45_stepper(app);
+  EXPECT_EQ(stepper.errorEstimateOrder(), 4);
+  const double e1 = error_at_final_time(stepper, 10, 1.);
+  const double e2 = error_at_final_time(stepper, 20, 1.);
+  std::cout << e1 << " " << e2 << " " << e1/e2 << std::endl;
+  EXPECT_GT(e1/e2, 26.);
+  EXPECT_LT(e2, 1e-7);
+}
+
+TEST(ode_explicit_steppers, bogacki_shampine23_convergence_order)
+{
+  AppForEmbeddedSchemes app;
+  auto stepper = pressio::ode::create_bogacki_shampine23_stepper(app);
+  EXPECT_EQ(stepper.errorEstimateOrder(), 2);
+  const double e1 = error_at_final_time(stepper, 20, 1.);
+  const double e2 = error_at_final_time(stepper, 40, 1.);
+  std::cout << e1 << " " << e2 << " " << e1/e2 << std::endl;
+  EXPECT_GT(e1/e2, 7.);
+}
+
+TEST(ode_explicit_steppers, embedded_schemes_reuse_last_stage_rhs)
+{
+  // first same as last: after the first step, the first stage
+  // is the last stage of the previous step
+  using namespace pressio;
+  CountingAppForEmbeddedSchemes app;
+  auto dp = ode::create_explicit_stepper(ode::StepScheme::DormandPrince45, app);
+  EXPECT_LT(error_at_final_time(dp, 20, 1.), 1e-7);
+  EXPECT_EQ(app.numRhs_, 6*20 + 1);
+
+  app.numRhs_ = 0;
+  auto bs = ode::create_explicit_stepper<ode::BogackiShampine23>(app);
+  error_at_final_time(bs, 20, 1.);
+  EXPECT_EQ(app.numRhs_, 3*20 + 1);
+
+  // starting over from step 1 evaluates the first stage again
+  app.numRhs_ = 0;
+  error_at_final_time(bs, 20, 1.);
+  EXPECT_EQ(app.numRhs_, 3*20 + 1);
+
+  // a retried step keeps its first stage too
+  app.numRhs_ = 0;
+  auto stepper = ode::create_explicit_stepper(ode::StepScheme::DormandPrince45, app);
+  stepper.setErrorControlTolerances(1e-10, 1e-10);
+  Eigen::VectorXd y(3);
+  y.setConstant(1.);
+  EXPECT_THROW(stepper(y, ode::StepStartAt<double>(0.), ode::StepCount(1), ode::StepSize<double>(0.5)),
+	       pressio::eh::TimeStepFailure);
+  stepper(y, ode::StepStartAt<double>(0.), ode::StepCount(1), ode::StepSize<double>(1e-3));
+  EXPECT_EQ(app.numRhs_, 1 + 6 + 6);
+}
+
+TEST(ode_explicit_steppers, embedded_scheme_rejects_step_and_keeps_state)
+{
+  AppForEmbeddedSchemes app;
+  auto stepper = pressio::ode::create_explicit_stepper
+    (pressio::ode::StepScheme::DormandPrince45, app);
+  stepper.setErrorControlTolerances(1e-10, 1e-10);
+
+  Eigen::VectorXd y(3);
+  y.setConstant(1.);
+  const Eigen::VectorXd y0 = y;
+  using namespace pressio::ode;
+  EXPECT_THROW(stepper(y, StepStartAt<double>(0.), StepCount(1), StepSize<double>(0.5)),
+	       pressio::eh::TimeStepFailure);
+  EXPECT_GT(stepper.errorEstimate(), 1.);
+  EXPECT_TRUE(y == y0);
+
+  // a small enough step is accepted
+  stepper(y, StepStartAt<double>(0.), StepCount(1), StepSize<double>(1e-3));
+  EXPECT_LE(stepper.errorEstimate(), 1.);
+  EXPECT_FALSE(y == y0);
+}
+
+TEST(ode_explicit_steppers, embedded_schemes_with_pi_step_size_policy)
+{
+  using namespace pressio;
+  const double finalTime = 4.;
+  AppForEmbeddedSchemes app;
+
+  for (auto scheme : {ode::StepScheme::DormandPrince45, ode::StepScheme::BogackiShampine23})
+  {
+    auto stepper = ode::create_explicit_stepper(scheme, app);
+    auto policy = ode::create_pi_step_size_policy(stepper, 1e-8, 1e-8,
+						  ode::StepSize<double>(1e-4), finalTime);
+    Eigen::VectorXd y(3);
+    y.setConstant(1.);
+    FinalTimeObserver observer;
+    ode::advance_to_target_point_with_step_recovery(stepper, y, 0., finalTime, policy, observer);
+
+    const double err = (y - app.exact(finalTime)).norm();
+    std::cout << "steps = " << observer.numSteps_ << " error = " << err << std::endl;
+    EXPECT_DOUBLE_EQ(observer.lastTime_, finalTime);
+    EXPECT_LT(err, 1e-6);
+    // the step size must have grown well beyond the initial one,
+    // which would need 40000 steps
+    EXPECT_LT(observer.numSteps_, scheme == ode::StepScheme::DormandPrince45 ? 150 : 1000);
+  }
+}
+
+TEST(ode_explicit_steppers, pi_step_size_policy_recovers_from_too_large_initial_step)
+{
+  using namespace pressio;
+  const double finalTime = 4.;
+  AppForEmbeddedSchemes app;
+  auto stepper = ode::create_explicit_stepper(ode::StepScheme::DormandPrince45, app);
+  // the first step is far too large and must be retried
+  auto policy = ode::create_pi_step_size_policy(stepper, 1e-8, 1e-8,
+						ode::StepSize<double>(2.), finalTime);
+  Eigen::VectorXd y(3);
+  y.setConstant(1.);
+  FinalTimeObserver observer;
+  ode::advance_to_target_point_with_step_recovery(stepper, y, 0., finalTime, policy, observer);
+  EXPECT_DOUBLE_EQ(observer.lastTime_, finalTime);
+  EXPECT_LT((y - app.exact(finalTime)).norm(), 1e-6);
+  EXPECT_LT(observer.numSteps_, 150);
+}
+
+TEST(ode_explicit_steppers, pi_step_size_policy_retries_non_finite_error)
+{
+  // the first step is too large and gives a nan error estimate,
+  // which is rejected and retried with a smaller step
+  using namespace pressio;
+  AppWithNanRhsForNegativeState app;
+  for (auto scheme : {ode::StepScheme::DormandPrince45, ode::StepScheme::BogackiShampine23})
+  {
+    auto stepper = ode::create_explicit_stepper(scheme, app);
+    Eigen::VectorXd y(2);
+    y << 1., 2.;
+    using namespace pressio::ode;
+    stepper.setErrorControlTolerances(1e-8, 1e-8);
+    EXPECT_THROW(stepper(y, StepStartAt<double>(0.), StepCount(1), StepSize<double>(1.)),
+		 pressio::eh::TimeStepFailure);
+    EXPECT_FALSE(std::isfinite(stepper.errorEstimate()));
+
+    auto policy = ode::create_pi_step_size_policy(stepper, 1e-8, 1e-8,
+						  ode::StepSize<double>(1.), 1.);
+    ode::advance_to_target_point_with_step_recovery(stepper, y, 0., 1., policy);
+    EXPECT_NEAR(y(0), std::exp(-10.), 1e-6);
+    EXPECT_NEAR(y(1), 2.*std::exp(-10.), 1e-6);
+  }
+}
+
+TEST(ode_explicit_steppers, pi_step_size_policy_gives_up_on_persistent_non_finite_error)
+{
+  using namespace pressio;
+  AppWithNanRhs app;
+  auto stepper = ode::create_explicit_stepper(ode::StepScheme::BogackiShampine23, app);
+  auto policy = ode::create_pi_step_size_policy(stepper, 1e-6, 1e-6,
+						ode::StepSize<double>(0.1), 1.);
+  Eigen::VectorXd y(3);
+  y.setConstant(1.);
+  EXPECT_THROW(ode::advance_to_target_point_with_step_recovery(stepper, y, 0., 1., policy),
+	       std::runtime_error);
+
+  // and after too many rejections of the same step
+  auto stepper2 = ode::create_explicit_stepper(ode::StepScheme::BogackiShampine23, app);
+  auto policy2 = ode::create_pi_step_size_policy(stepper2, 1e-6, 1e-6,
+						 ode::StepSize<double>(0.1), 1.);
+  policy2.setMaxRejectionsPerStep(2);
+  y.setConstant(1.);
+  try{
+    ode::advance_to_target_point_with_step_recovery(stepper2, y, 0., 1., policy2);
+    FAIL();
+  }
+  catch (std::runtime_error const & e){
+    EXPECT_NE(std::string(e.what()).find("too many rejections"), std::string::npos);
+  }
+}
+
+TEST(ode_explicit_steppers, pi_step_size_policy_rejects_non_positive_min_step)
+{
+  using namespace pressio;
+  AppForEmbeddedSchemes app;
+  auto stepper = ode::create_explicit_stepper(ode::StepScheme::DormandPrince45, app);
+  auto policy = ode::create_pi_step_size_policy(stepper, 1e-6, 1e-6,
+						ode::StepSize<double>(0.1), 1.);
+  EXPECT_THROW(policy.setMinStepSize(0.), std::runtime_error);
+  EXPECT_THROW(ode::create_pi_step_size_policy(stepper, 1e-6, 1e-6,
+					       ode::StepSize<double>(0.), 1.),
+	       std::runtime_error);
+}
@@ -199,3 +199,59 @@ TEST(ode, stencil_states_data)
   EXPECT_TRUE(all_equal_to(v43r, 4.));
   EXPECT_TRUE(all_equal_to(v44r, 5.));
 }
+
+TEST(ode, stencil_states_rotate_and_rotate_back)
+{
+  using T = Eigen::VectorXd;
+  T a(5);
+
+  pressio::ode::ImplicitStencilStatesStaticContainer<T, 3> data(a);
+  data(pressio::ode::n()).setConstant(1.);
+  data(pressio::ode::nMinusOne()).setConstant(2.);
+  data(pressio::ode::nMinusTwo()).setConstant(3.);
+  const auto * ptrN   = data(pressio::ode::n()).data();
+  const auto * ptrNm1 = data(pressio::ode::nMinusOne()).data();
+
+  // rotating only shifts the history, no data is moved
+  data.rotate();
+  EXPECT_TRUE(data(pressio::ode::nMinusOne()).data() == ptrN);
+  EXPECT_TRUE(data(pressio::ode::nMinusTwo()).data() == ptrNm1);
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 1.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusTwo()), 2.));
+  data(pressio::ode::n()).setConstant(4.);
+
+  // rotating back restores the stencil, including the oldest state
+  data.rotateBack();
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::n()), 1.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 2.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusTwo()), 3.));
+
+  // two rotations
+  data.rotate();
+  data(pressio::ode::n()).setConstant(4.);
+  data.rotate();
+  data(pressio::ode::n()).setConstant(5.);
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::n()), 5.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 4.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusTwo()), 1.));
+}
+
+TEST(ode, stencil_states_dynamic_rotate_and_rotate_back)
+{
+  using T = Eigen::VectorXd;
+  T a(5);
+
+  pressio::ode::ImplicitStencilStatesDynamicContainer<T> data{a, a};
+  EXPECT_EQ(data.size(), 2);
+  data(pressio::ode::n()).setConstant(1.);
+  data(pressio::ode::nMinusOne()).setConstant(2.);
+
+  data.rotate();
+  data(pressio::ode::n()).setConstant(3.);
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::n()), 3.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 1.));
+
+  data.rotateBack();
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::n()), 1.));
+  EXPECT_TRUE(all_equal_to(data(pressio::ode::nMinusOne()), 2.));
+}
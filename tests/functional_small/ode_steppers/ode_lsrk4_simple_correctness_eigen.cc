@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "pressio/ode_steppers_explicit.hpp"
+#include "pressio/ode_advancers.hpp"
+
+namespace{
+
+// dy_i/dt = lambda_i*y_i + sin(t), y(0) = 1
+struct AppForLowStorageRK
+{
+  using independent_variable_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  std::array<double,3> lambdas_ = {-1., -2., -5.};
+  mutable int numCreatedStates_ = 0;
+  mutable int numCreatedRhs_ = 0;
+
+  state_type createState() const{
+    ++numCreatedStates_;
+    state_type s(3);
+    s.setZero();
+    return s;
+  };
+
+  rhs_type createRhs() const{
+    ++numCreatedRhs_;
+    rhs_type r(3);
+    r.setZero();
+    return r;
+  };
+
+  void rhs(const state_type & y,
+	   const independent_variable_type evaltime,
+	   rhs_type & rhs) const
+  {
+    for (int i=0; i<3; i++){
+      rhs[i] = lambdas_[i]*y[i] + std::sin(evaltime);
+    }
+  };
+
+  state_type exact(double t) const{
+    state_type y(3);
+    for (int i=0; i<3; i++){
+      const double l = lambdas_[i];
+      const double c = 1./(1. + l*l);
+      y[i] = (1. + c)*std::exp(l*t) - c*(l*std::sin(t) + std::cos(t));
+    }
+    return y;
+  }
+};
+
+template<class StepperType>
+Eigen::VectorXd advance(StepperType & stepper, int numSteps, double finalTime)
+{
+  Eigen::VectorXd y(3);
+  y.setConstant(1.);
+  pressio::ode::advance_n_steps(stepper, y, 0.0, finalTime/numSteps,
+				pressio::ode::StepCount(numSteps));
+  return y;
+}
+}
+
+TEST(ode_explicit_steppers, lsrk4_only_allocates_two_registers)
+{
+  AppForLowStorageRK app;
+  auto stepper = pressio::ode::create_lsrk4_stepper(app);
+  EXPECT_EQ(app.numCreatedStates_, 1);
+  EXPECT_EQ(app.numCreatedRhs_, 1);
+}
+
+TEST(ode_explicit_steppers, lsrk4_convergence_order)
+{
+  AppForLowStorageRK app;
+  auto stepper = pressio::ode::create_explicit_stepper
+    (pressio::ode::StepScheme::LowStorageRungeKutta4, app);
+  const double e1 = (advance(stepper, 10, 1.) - app.exact(1.)).norm();
+  const double e2 = (advance(stepper, 20, 1.) - app.exact(1.)).norm();
+  std::cout << e1 << " " << e2 << " " << e1/e2 << std::endl;
+  EXPECT_GT(e1/e2, 14.);
+  EXPECT_LT(e2, 1e-6);
+
+  // same accuracy as the classic rk4
+  auto stepperRk4 = pressio::ode::create_rk4_stepper(app);
+  const double e2Rk4 = (advance(stepperRk4, 20, 1.) - app.exact(1.)).norm();
+  std::cout << e2Rk4 << std::endl;
+  EXPECT_LT(e2, 2.*e2Rk4);
+}
+
+TEST(ode_explicit_steppers, lsrk4_calls_rhs_at_stage_times)
+{
+  AppForLowStorageRK app;
+  auto stepper = pressio::ode::create_lsrk4_stepper(app);
+  std::vector<double> stageTimes;
+  auto rhsObserver = [&](pressio::ode::StepCount,
+			 pressio::ode::IntermediateStepCount stage,
+			 double time,
+			 const Eigen::VectorXd &)
+  {
+    EXPECT_EQ(stage.get(), (int) stageTimes.size());
+    stageTimes.push_back(time);
+  };
+
+  Eigen::VectorXd y(3);
+  y.setConstant(1.);
+  using namespace pressio::ode;
+  stepper(y, StepStartAt<double>(1.), StepCount(1), StepSize<double>(0.5), rhsObserver);
+  ASSERT_EQ(stageTimes.size(), 5u);
+  EXPECT_DOUBLE_EQ(stageTimes[0], 1.);
+  for (std::size_t i=1; i<5; ++i){
+    EXPECT_GT(stageTimes[i], stageTimes[i-1]);
+    EXPECT_LT(stageTimes[i], 1.5);
+  }
+}
@@ -137,3 +137,27 @@ TEST(ops_eigen, dense_matrix_T_diag_prod)
   OPS_EIGEN_DENSEMATRIX_T_VEC_PROD(exp);
 }
 
+
+TEST(ops_eigen, dense_matrix_vec_prod_aliased)
+{
+  // y aliases x or is a view of A: the result must match the
+  // product computed into a separate vector
+  Eigen::MatrixXd M(3,3);
+  M << 1.,0.,2.,2.,1.,3.,0.,0.,1.;
+  Eigen::VectorXd x(3);
+  x << 1.,2.,3.;
+
+  const Eigen::VectorXd gold1 = 2.*M*x;
+  ::pressio::ops::product(::pressio::nontranspose(), 2., M, x, 0., x);
+  ASSERT_TRUE(x.isApprox(gold1));
+
+  const Eigen::VectorXd gold2 = 0.5*x + M.transpose()*x;
+  ::pressio::ops::product(::pressio::transpose(), 1., M, x, 0.5, x);
+  ASSERT_TRUE(x.isApprox(gold2));
+
+  Eigen::MatrixXd A = M;
+  const Eigen::VectorXd gold3 = A*Eigen::VectorXd(A.diagonal());
+  auto d = ::pressio::diag(A);
+  ::pressio::ops::product(::pressio::nontranspose(), 1., A, d, 0., d);
+  ASSERT_TRUE(A.diagonal().isApprox(gold3));
+}
@@ -237,3 +237,85 @@ TEST_F(ops_eigen, diagexpr_dense_matrix_prod)
 {
   test_impl(::pressio::nontranspose(), A_diag(), B);
 }
+
+//-------------------------------------------
+// Test fused normal equations kernel
+//-------------------------------------------
+
+TEST_F(ops_eigen, dense_matrix_normal_equations)
+{
+  // use enough rows to span multiple blocks
+  const int m = 20011;
+  const int n = 7;
+  Eigen::MatrixXd J = Eigen::MatrixXd::Random(m, n);
+  Eigen::VectorXd r = Eigen::VectorXd::Random(m);
+  Eigen::MatrixXd H(n, n);
+  Eigen::VectorXd g(n);
+  ::pressio::ops::fill(H, std::nan("0"));
+  ::pressio::ops::fill(g, std::nan("0"));
+
+  const double rr = ::pressio::ops::normal_equations(J, r, H, g);
+
+  const Eigen::MatrixXd H0 = J.transpose() * J;
+  const Eigen::VectorXd g0 = J.transpose() * r;
+  EXPECT_NEAR(rr, r.squaredNorm(), 1e-8);
+  for (int i = 0; i < n; ++i){
+    EXPECT_NEAR(g(i), g0(i), 1e-8);
+    for (int j = 0; j < n; ++j){
+      EXPECT_NEAR(H(i,j), H0(i,j), 1e-8);
+    }
+  }
+}
+
+TEST_F(ops_eigen, dense_matrix_weighted_normal_equations)
+{
+  const int m = 20011;
+  const int n = 7;
+  Eigen::MatrixXd J = Eigen::MatrixXd::Random(m, n);
+  Eigen::VectorXd r = Eigen::VectorXd::Random(m);
+  const Eigen::VectorXd w = Eigen::VectorXd::Random(m).cwiseAbs();
+  Eigen::MatrixXd WJ = w.asDiagonal() * J;
+  Eigen::VectorXd Wr = w.asDiagonal() * r;
+  Eigen::MatrixXd H(n, n);
+  Eigen::VectorXd g(n);
+  ::pressio::ops::fill(H, std::nan("0"));
+  ::pressio::ops::fill(g, std::nan("0"));
+
+  const double rWr = ::pressio::ops::normal_equations(J, WJ, r, Wr, H, g);
+
+  const Eigen::MatrixXd H0 = J.transpose() * WJ;
+  const Eigen::VectorXd g0 = J.transpose() * Wr;
+  EXPECT_NEAR(rWr, r.dot(Wr), 1e-8);
+  for (int i = 0; i < n; ++i){
+    EXPECT_NEAR(g(i), g0(i), 1e-8);
+    for (int j = 0; j < n; ++j){
+      EXPECT_NEAR(H(i,j), H0(i,j), 1e-8);
+    }
+  }
+}
+
+TEST_F(ops_eigen, dense_matrix_prod_aliased)
+{
+  // C aliases one of the operands: the result must match the
+  // product computed into a separate matrix
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(4, 4);
+  Eigen::MatrixXd B = Eigen::MatrixXd::Random(4, 4);
+
+  const Eigen::MatrixXd gold1 = 2.*A*B;
+  Eigen::MatrixXd C = A;
+  ::pressio::ops::product(::pressio::nontranspose(), ::pressio::nontranspose(),
+			  2., C, B, 0., C);
+  ASSERT_TRUE(C.isApprox(gold1));
+
+  const Eigen::MatrixXd gold2 = 0.5*B + A.transpose()*B;
+  C = B;
+  ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
+			  1., A, C, 0.5, C);
+  ASSERT_TRUE(C.isApprox(gold2));
+
+  const Eigen::MatrixXd gold3 = A.transpose()*A;
+  C = A;
+  ::pressio::ops::product(::pressio::transpose(), ::pressio::nontranspose(),
+			  1., C, 0., C);
+  ASSERT_TRUE(C.isApprox(gold3));
+}
@@ -174,6 +174,31 @@ TEST(ops_eigen, dense_matrix_update)
   EXPECT_DOUBLE_EQ(M(1, 1), 0.);
 }
 
+TEST(ops_eigen, dense_matrix_update3_update4)
+{
+  Eigen::MatrixXd M(2, 3);
+  Eigen::MatrixXd A(2, 3);
+  Eigen::MatrixXd B(2, 3);
+  Eigen::MatrixXd C(2, 3);
+  M.setConstant(1.);
+  A.setConstant(2.);
+  B.setConstant(3.);
+  C.setConstant(4.);
+
+  pressio::ops::update(M, 2., A, 3., B, -1.);
+  EXPECT_TRUE(M.isApprox(Eigen::MatrixXd::Constant(2, 3, 5.)));
+
+  pressio::ops::update(M, 1., A, 1., B, 1., C, 1.);
+  EXPECT_TRUE(M.isApprox(Eigen::MatrixXd::Constant(2, 3, 14.)));
+
+  // NaN injection through zero coefficients
+  const auto nan = std::nan("0");
+  pressio::ops::fill(M, nan);
+  pressio::ops::fill(C, nan);
+  pressio::ops::update(M, 0., A, 1., B, 1., C, 0.);
+  EXPECT_TRUE(M.isApprox(Eigen::MatrixXd::Constant(2, 3, 5.)));
+}
+
 TEST(ops_eigen, dense_matrix_update_epxr)
 {
   Eigen::Matrix<double, 4, 4> M0;
@@ -127,4 +127,59 @@ TEST_F(epetraMultiVectorGlobSize15Fixture, mv_T_self_storein_eigen_C_beta0)
         }
     }
 }
+namespace{
+// entry (g,j) of the fixture multivector, g being the global row
+double fixture_entry(int g, int j, int numVecs){
+  return (double)(g * numVecs + j + 1.);
+}
+}
+
+TEST_F(epetraMultiVectorGlobSize15Fixture, mv_T_mv_storein_eigen_C_non_uniform)
+{
+    // a view of some of the columns of myMv_ does not have constant stride,
+    // so this covers both the local gemm and the column by column path
+    std::vector<int> idx{0, 2, 3};
+    Epetra_MultiVector B(View, *myMv_, idx.data(), (int)idx.size());
+    EXPECT_TRUE(myMv_->ConstantStride());
+    EXPECT_FALSE(B.ConstantStride());
+
+    auto gold = [&](int iA, int jB){
+      double sum = 0.;
+      for (int g=0; g<numGlobalEntries_; ++g){
+        sum += fixture_entry(g, iA, numVecs_) * fixture_entry(g, jB, numVecs_);
+      }
+      return sum;
+    };
+
+    Eigen::MatrixXd C(numVecs_, (int)idx.size());
+    C.setConstant(1.);
+    // C = 0.5*C + 1.5 A^T B
+    pressio::ops::product(pressio::transpose(), pressio::nontranspose(),
+        1.5, *myMv_, B, 0.5, C);
+    for (auto i=0; i<C.rows(); i++){
+        for (auto j=0; j<C.cols(); j++){
+            EXPECT_NEAR( C(i,j), 0.5 + 1.5*gold(i, idx[j]), 1e-8);
+        }
+    }
+
+    // A^T A with non-constant stride, after a product of a different size
+    Eigen::MatrixXd D(idx.size(), idx.size());
+    D.setConstant(std::nan("0"));
+    pressio::ops::product(pressio::transpose(), pressio::nontranspose(),
+        1., B, 0., D);
+    for (auto i=0; i<D.rows(); i++){
+        for (auto j=0; j<D.cols(); j++){
+            EXPECT_NEAR( D(i,j), gold(idx[i], idx[j]), 1e-8);
+        }
+    }
+
+    // A^T A with constant stride, larger than the previous one
+    auto E = pressio::ops::product<Eigen::MatrixXd>(pressio::transpose(), pressio::nontranspose(),
+        1., *myMv_);
+    for (auto i=0; i<E.rows(); i++){
+        for (auto j=0; j<E.cols(); j++){
+            EXPECT_NEAR( E(i,j), gold(i, j), 1e-8);
+        }
+    }
+}
 #endif
@@ -166,3 +166,104 @@ TEST(ops_kokkos, dense_matrix_T_self_prod)
   OPS_KOKKOS_DENSE_MAT_T_SELF_PROD;
 }
 
+
+TEST(ops_kokkos, dense_matrix_normal_equations)
+{
+  using vec_t = Kokkos::View<double*>;
+  // use enough rows to span multiple blocks
+  const int m = 20011;
+  const int n = 3;
+  mat_t J("J", m, n);
+  vec_t r("r", m);
+  auto J_h = Kokkos::create_mirror_view(J);
+  auto r_h = Kokkos::create_mirror_view(r);
+  for (int i=0; i<m; ++i){
+    r_h(i) = (double) (i % 5) - 2.;
+    for (int j=0; j<n; ++j){
+      J_h(i,j) = (double) ((i+j) % 7) - 3.;
+    }
+  }
+  Kokkos::deep_copy(J, J_h);
+  Kokkos::deep_copy(r, r_h);
+
+  mat_t H("H", n, n);
+  vec_t g("g", n);
+  const double rr = pressio::ops::normal_equations(J, r, H, g);
+
+  double rr0 = 0.;
+  for (int i=0; i<m; ++i){ rr0 += r_h(i)*r_h(i); }
+  EXPECT_DOUBLE_EQ(rr, rr0);
+
+  auto H_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), H);
+  auto g_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), g);
+  for (int a=0; a<n; ++a){
+    double ga = 0.;
+    for (int i=0; i<m; ++i){ ga += J_h(i,a)*r_h(i); }
+    EXPECT_DOUBLE_EQ(g_h(a), ga);
+    for (int b=0; b<n; ++b){
+      double hab = 0.;
+      for (int i=0; i<m; ++i){ hab += J_h(i,a)*J_h(i,b); }
+      EXPECT_DOUBLE_EQ(H_h(a,b), hab);
+    }
+  }
+}
+
+TEST(ops_kokkos, dense_matrix_weighted_normal_equations_with_workspace)
+{
+  using vec_t = Kokkos::View<double*>;
+  // enough columns and rows for several teams and a partial last row block
+  const int m = 3001;
+  const int n = 9;
+  mat_t J("J", m, n);
+  mat_t WJ("WJ", m, n);
+  vec_t r("r", m);
+  vec_t Wr("Wr", m);
+  auto J_h = Kokkos::create_mirror_view(J);
+  auto WJ_h = Kokkos::create_mirror_view(WJ);
+  auto r_h = Kokkos::create_mirror_view(r);
+  auto Wr_h = Kokkos::create_mirror_view(Wr);
+  for (int i=0; i<m; ++i){
+    r_h(i) = (double) (i % 5) - 2.;
+    Wr_h(i) = (double) (i % 3) * r_h(i);
+    for (int j=0; j<n; ++j){
+      J_h(i,j) = (double) ((i+j) % 7) - 3.;
+      WJ_h(i,j) = (double) (i % 3) * J_h(i,j);
+    }
+  }
+  Kokkos::deep_copy(J, J_h);
+  Kokkos::deep_copy(WJ, WJ_h);
+  Kokkos::deep_copy(r, r_h);
+  Kokkos::deep_copy(Wr, Wr_h);
+
+  mat_t H("H", n, n);
+  vec_t g("g", n);
+  auto check = [&](double rWr, bool weighted){
+    const auto & WJ_ref = weighted ? WJ_h : J_h;
+    const auto & Wr_ref = weighted ? Wr_h : r_h;
+    double rWr0 = 0.;
+    for (int i=0; i<m; ++i){ rWr0 += r_h(i)*Wr_ref(i); }
+    EXPECT_DOUBLE_EQ(rWr, rWr0);
+
+    auto H_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), H);
+    auto g_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), g);
+    for (int a=0; a<n; ++a){
+      double ga = 0.;
+      for (int i=0; i<m; ++i){ ga += J_h(i,a)*Wr_ref(i); }
+      EXPECT_DOUBLE_EQ(g_h(a), ga);
+      for (int b=0; b<n; ++b){
+	double hab = 0.;
+	for (int i=0; i<m; ++i){ hab += J_h(i,a)*WJ_ref(i,b); }
+	EXPECT_DOUBLE_EQ(H_h(a,b), hab);
+      }
+    }
+  };
+
+  check(pressio::ops::normal_equations(J, WJ, r, Wr, H, g), true);
+
+  // repeated evaluations reuse the workspace buffer
+  pressio::ops::NormalEquationsWorkspace<mat_t> workspace;
+  check(pressio::ops::normal_equations(J, r, H, g, workspace), false);
+  const auto * buffer = workspace.buffer(n).data();
+  check(pressio::ops::normal_equations(J, r, H, g, workspace), false);
+  EXPECT_EQ(buffer, workspace.buffer(n).data());
+}
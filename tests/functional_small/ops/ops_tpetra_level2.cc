@@ -106,6 +106,15 @@ TEST_F(ops_tpetra, mv_prod_teuchos_vector)
   test_impl(*this, ::pressio::nontranspose{}, *myMv_, x_teuchos, *y_tpetra);
 }
 
+TEST_F(ops_tpetra, mv_T_vector_storein_teuchos_vector)
+{
+  Teuchos::SerialDenseVector<int, double> y_teuchos(numVecs_);
+  for (size_t i = 0; i < (size_t)numVecs_; ++i) {
+    y_teuchos(i) = 1.;
+  }
+  test_impl(*this, ::pressio::transpose{}, *myMv_, *x_tpetra, y_teuchos);
+}
+
 //-------------------------------------------
 // Test Kokkos x
 //-------------------------------------------
@@ -258,4 +267,28 @@ TEST_F(ops_tpetra, mv_T_vector_storein_eigen_diag)
 
   test_impl(*this, ::pressio::transpose{}, *myMv_, *x_tpetra, y_eigen_diag);
 }
+
+TEST_F(ops_tpetra, mv_T_vector_nonblocking_storein_eigen_vector)
+{
+  Eigen::VectorXd y_eigen{numVecs_};
+  y_eigen.setConstant(1.);
+  Eigen::VectorXd y_gold = y_eigen;
+
+  ::pressio::ops::product(::pressio::transpose{}, 2., *myMv_, *x_tpetra, -1., y_gold);
+  auto request = ::pressio::ops::iproduct(::pressio::transpose{}, 2., *myMv_, *x_tpetra, -1., y_eigen);
+  // other work could be overlapped here
+  request.wait();
+  for (int i = 0; i < numVecs_; ++i) {
+    EXPECT_DOUBLE_EQ(y_eigen(i), y_gold(i));
+  }
+
+  // the reduction is completed by the destructor if wait is not called
+  y_eigen.setConstant(1.);
+  {
+    auto request2 = ::pressio::ops::iproduct(::pressio::transpose{}, 2., *myMv_, *x_tpetra, -1., y_eigen);
+  }
+  for (int i = 0; i < numVecs_; ++i) {
+    EXPECT_DOUBLE_EQ(y_eigen(i), y_gold(i));
+  }
+}
 #endif
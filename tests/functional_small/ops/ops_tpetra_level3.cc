@@ -319,3 +319,83 @@ TEST_F(tpetraMultiVectorGlobSize15Fixture, mv_T_mv_storein_kokkos_C_beta0)
         }
     }
 }
+
+#ifdef PRESSIO_ENABLE_TPL_EIGEN
+TEST_F(tpetraMultiVectorGlobSize15Fixture, mv_normal_equations_storein_eigen)
+{
+  auto J = pressio::ops::clone(*myMv_);
+  std::array<double, 4> ac{1.,2.,3.,4.};
+  for (std::size_t i=0; i<J.getNumVectors(); ++i) {
+    J.getVectorNonConst(i)->putScalar(ac[i]);
+  }
+  vec_t r(contigMap_);
+  r.putScalar(0.5);
+
+  Eigen::MatrixXd H(J.getNumVectors(), J.getNumVectors());
+  Eigen::VectorXd g(J.getNumVectors());
+  const auto rr = pressio::ops::normal_equations(J, r, H, g);
+
+  const double N = J.getGlobalLength();
+  EXPECT_NEAR(rr, 0.25*N, 1e-12);
+  for (auto i=0; i<H.rows(); i++){
+    EXPECT_NEAR( g(i), ac[i]*0.5*N, 1e-12);
+    for (auto j=0; j<H.cols(); j++){
+      EXPECT_NEAR( H(i,j), ac[i]*ac[j]*N, 1e-12);
+    }
+  }
+}
+#endif
+
+TEST_F(tpetraMultiVectorGlobSize15Fixture, mv_normal_equations_storein_kokkos)
+{
+  auto J = pressio::ops::clone(*myMv_);
+  std::array<double, 4> ac{1.,2.,3.,4.};
+  for (std::size_t i=0; i<J.getNumVectors(); ++i) {
+    J.getVectorNonConst(i)->putScalar(ac[i]);
+  }
+  vec_t r(contigMap_);
+  r.putScalar(0.5);
+
+  Kokkos::View<double**, Kokkos::LayoutLeft, Kokkos::HostSpace> H("H", J.getNumVectors(), J.getNumVectors());
+  Kokkos::View<double*, Kokkos::HostSpace> g("g", J.getNumVectors());
+  const auto rr = pressio::ops::normal_equations(J, r, H, g);
+
+  const double N = J.getGlobalLength();
+  EXPECT_NEAR(rr, 0.25*N, 1e-12);
+  for (std::size_t i=0; i<H.extent(0); i++){
+    EXPECT_NEAR( g(i), ac[i]*0.5*N, 1e-12);
+    for (std::size_t j=0; j<H.extent(1); j++){
+      EXPECT_NEAR( H(i,j), ac[i]*ac[j]*N, 1e-12);
+    }
+  }
+}
+
+TEST_F(tpetraMultiVectorGlobSize15Fixture, mv_normal_equations_with_workspace_storein_kokkos_device)
+{
+  auto J = pressio::ops::clone(*myMv_);
+  std::array<double, 4> ac{1.,2.,3.,4.};
+  for (std::size_t i=0; i<J.getNumVectors(); ++i) {
+    J.getVectorNonConst(i)->putScalar(ac[i]);
+  }
+  vec_t r(contigMap_);
+
+  // H and g in the default memory space, the workspace is reused
+  Kokkos::View<double**, Kokkos::LayoutLeft> H("H", J.getNumVectors(), J.getNumVectors());
+  Kokkos::View<double*> g("g", J.getNumVectors());
+  pressio::ops::NormalEquationsWorkspace<mvec_t> workspace;
+  const double N = J.getGlobalLength();
+  for (double rValue : {0.5, 2.}){
+    r.putScalar(rValue);
+    const auto rr = pressio::ops::normal_equations(J, r, H, g, workspace);
+    EXPECT_NEAR(rr, rValue*rValue*N, 1e-12);
+
+    auto H_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), H);
+    auto g_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), g);
+    for (std::size_t i=0; i<H_h.extent(0); i++){
+      EXPECT_NEAR( g_h(i), ac[i]*rValue*N, 1e-12);
+      for (std::size_t j=0; j<H_h.extent(1); j++){
+	EXPECT_NEAR( H_h(i,j), ac[i]*ac[j]*N, 1e-12);
+      }
+    }
+  }
+}
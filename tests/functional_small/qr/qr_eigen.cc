@@ -36,3 +36,87 @@ TEST_F(eigenDenseR9Fixture,
   	    << y << std::endl;
   gold_.checkYForRsolve(y);
 }
+
+template<class qr_algo>
+void run_comm_avoiding_eigen_r9(eigenDenseR9Fixture & fix)
+{
+  using namespace pressio;
+  const Eigen::MatrixXd Acopy = fix.A_;
+  qr::QRSolver<Eigen::MatrixXd, qr_algo> qrObj;
+  qrObj.computeThin( fix.A_ );
+  EXPECT_TRUE( fix.A_ == Acopy );
+  fix.checkQFactor(qrObj.cRefQFactor());
+
+  Eigen::VectorXd rhs(pressio::qr::test::numVectors_);
+  qrObj.applyQTranspose(fix.v_, rhs);
+  Eigen::VectorXd y(pressio::qr::test::numVectors_);
+  qrObj.solve(rhs, y);
+  fix.gold_.checkYForRsolve(y);
+}
+
+TEST_F(eigenDenseR9Fixture, CholQR2EigenDenseOutOfPlaceAndSolve)
+{
+  run_comm_avoiding_eigen_r9<pressio::qr::CholQR2>(*this);
+}
+
+TEST_F(eigenDenseR9Fixture, CGS2EigenDenseOutOfPlaceAndSolve)
+{
+  run_comm_avoiding_eigen_r9<pressio::qr::CGS2>(*this);
+}
+
+template<class qr_algo>
+void run_comm_avoiding_eigen_many_columns()
+{
+  // more columns than a CGS2 panel, so that the
+  // projection against previous panels is exercised
+  using namespace pressio;
+  const int rows = 200;
+  const int cols = 37;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(rows, cols);
+  // make the columns strongly correlated
+  for (int j=1; j<cols; ++j){
+    A.col(j) += 0.9*A.col(j-1);
+  }
+
+  qr::QRSolver<Eigen::MatrixXd, qr_algo> qrObj;
+  qrObj.computeThin(A);
+  const auto & Q = qrObj.cRefQFactor();
+  EXPECT_EQ(Q.rows(), rows);
+  EXPECT_EQ(Q.cols(), cols);
+
+  const Eigen::MatrixXd QtQ = Q.transpose()*Q;
+  EXPECT_TRUE( QtQ.isApprox(Eigen::MatrixXd::Identity(cols, cols), 1e-12) );
+
+  // Q R = A, checked column by column by solving R x = Q^T A e_j
+  for (int j=0; j<cols; ++j){
+    Eigen::VectorXd rhs(cols);
+    qrObj.applyQTranspose(A.col(j).eval(), rhs);
+    Eigen::VectorXd x(cols);
+    qrObj.solve(rhs, x);
+    EXPECT_TRUE( x.isApprox(Eigen::VectorXd::Unit(cols, j), 1e-9) );
+  }
+
+  // computing again with a different matrix reuses the storage
+  Eigen::MatrixXd B = Eigen::MatrixXd::Random(rows, cols);
+  qrObj.computeThin(B);
+  const Eigen::MatrixXd QtQB = qrObj.cRefQFactor().transpose()*qrObj.cRefQFactor();
+  EXPECT_TRUE( QtQB.isApprox(Eigen::MatrixXd::Identity(cols, cols), 1e-12) );
+}
+
+TEST(qr_eigen, CholQR2ManyColumns)
+{
+  run_comm_avoiding_eigen_many_columns<pressio::qr::CholQR2>();
+}
+
+TEST(qr_eigen, CGS2ManyColumns)
+{
+  run_comm_avoiding_eigen_many_columns<pressio::qr::CGS2>();
+}
+
+TEST(qr_eigen, CholQR2ThrowsForRankDeficientMatrix)
+{
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(20, 4);
+  A.col(3) = A.col(1);
+  pressio::qr::QRSolver<Eigen::MatrixXd, pressio::qr::CholQR2> qrObj;
+  EXPECT_THROW(qrObj.computeThin(A), std::runtime_error);
+}
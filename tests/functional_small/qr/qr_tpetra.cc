@@ -101,5 +101,39 @@ TEST_F(tpetraR9Fixture,
 
   gold_.checkYForRsolve(y);
 }
-#endif
+TEST_F(tpetraR9Fixture,
+       CholQR2TpetraMVOutOfPlaceAndSolveEigenVecDynamic)
+{
+  using namespace pressio;
+
+  // default: R_type == void, in_place = false
+  using qr_algo = qr::CholQR2;
+  qr::QRSolver<mymvec_t, qr_algo> qrObj;
+  qrObj.computeThin( *A_ );
+  checkQFactor(qrObj.cRefQFactor());
+
+  Eigen::VectorXd rhs(pressio::qr::test::numVectors_);
+  qrObj.applyQTranspose(*v_, rhs);
+  Eigen::VectorXd y(pressio::qr::test::numVectors_);
+  qrObj.solve(rhs, y);
+  gold_.checkYForRsolve(y);
+}
 
+TEST_F(tpetraR9Fixture,
+       CGS2TpetraMVOutOfPlaceAndSolveEigenVecDynamic)
+{
+  using namespace pressio;
+
+  // default: R_type == void, in_place = false
+  using qr_algo = qr::CGS2;
+  qr::QRSolver<mymvec_t, qr_algo> qrObj;
+  qrObj.computeThin( *A_ );
+  checkQFactor(qrObj.cRefQFactor());
+
+  Eigen::VectorXd rhs(pressio::qr::test::numVectors_);
+  qrObj.applyQTranspose(*v_, rhs);
+  Eigen::VectorXd y(pressio::qr::test::numVectors_);
+  qrObj.solve(rhs, y);
+  gold_.checkYForRsolve(y);
+}
+#endif
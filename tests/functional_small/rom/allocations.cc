@@ -0,0 +1,335 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_steady.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+#include "pressio/rom_lspg_unsteady.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/*
+  counting global allocator: every heap allocation made by this
+  executable goes through here, so we can check that, after the
+  warm-up, the time steps and nonlinear iterations do not allocate.
+  With glibc, malloc itself is interposed because Eigen allocates
+  dynamic objects via malloc and not via operator new.
+*/
+namespace{
+std::atomic<long> g_allocations{0};
+
+long allocations_count(){ return g_allocations.load(); }
+}
+
+#if defined(__GLIBC__)
+extern "C" {
+void * __libc_malloc(std::size_t);
+void * __libc_calloc(std::size_t, std::size_t);
+void * __libc_realloc(void *, std::size_t);
+void * __libc_memalign(std::size_t, std::size_t);
+
+void * malloc(std::size_t size){
+  ++g_allocations;
+  return __libc_malloc(size);
+}
+
+void * calloc(std::size_t num, std::size_t size){
+  ++g_allocations;
+  return __libc_calloc(num, size);
+}
+
+void * realloc(void * ptr, std::size_t size){
+  ++g_allocations;
+  return __libc_realloc(ptr, size);
+}
+
+void * aligned_alloc(std::size_t alignment, std::size_t size){
+  ++g_allocations;
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void ** ptr, std::size_t alignment, std::size_t size){
+  ++g_allocations;
+  *ptr = __libc_memalign(alignment, size);
+  return (*ptr == nullptr) ? ENOMEM : 0;
+}
+}
+#else
+void * operator new(std::size_t size){
+  ++g_allocations;
+  if (void * ptr = std::malloc(size)){ return ptr; }
+  throw std::bad_alloc();
+}
+void operator delete(void * ptr) noexcept{ std::free(ptr); }
+void operator delete(void * ptr, std::size_t) noexcept{ std::free(ptr); }
+#endif
+
+namespace{
+
+constexpr int nFull = 30;
+constexpr int nRom = 3;
+
+// f_i(u) = -u_i + 0.1*u_i^2 + t
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  rhs_type createRhs() const{ return rhs_type(nFull); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type timeIn, rhs_type & f) const{
+    for (int i=0; i<nFull; ++i){
+      f(i) = -u(i) + 0.1*u(i)*u(i) + timeIn;
+    }
+  }
+
+  void applyJacobian(const state_type & u, const Eigen::MatrixXd & B,
+		     const time_type & /*time*/, Eigen::MatrixXd & A) const{
+    for (int i=0; i<nFull; ++i){
+      for (int j=0; j<B.cols(); ++j){
+	A(i,j) = (-1. + 0.2*u(i))*B(i,j);
+      }
+    }
+  }
+};
+
+// steady version: r_i(u) = u_i + 0.1*u_i^2 - 1
+struct MySteadyFom
+{
+  using state_type = Eigen::VectorXd;
+  using residual_type = state_type;
+
+  residual_type createResidual() const{ return residual_type(nFull); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  void residualAndJacobianAction(const state_type & u,
+				 residual_type & r,
+				 const Eigen::MatrixXd & B,
+#ifdef PRESSIO_ENABLE_CXX17
+				 std::optional<Eigen::MatrixXd *> JA) const
+#else
+				 Eigen::MatrixXd * JA) const
+#endif
+  {
+    for (int i=0; i<nFull; ++i){
+      r(i) = u(i) + 0.1*u(i)*u(i) - 1.;
+    }
+    if (JA){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & A = *JA.value();
+#else
+      auto & A = *JA;
+#endif
+      for (int i=0; i<nFull; ++i){
+	for (int j=0; j<B.cols(); ++j){
+	  A(i,j) = (1. + 0.2*u(i))*B(i,j);
+	}
+      }
+    }
+  }
+};
+
+// fully discrete BDF1 of MyFom: R = y_np1 - y_n - dt*f(y_np1, t_np1)
+struct MyFullyDiscreteFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using discrete_residual_type = state_type;
+
+  discrete_residual_type createDiscreteTimeResidual() const{
+    return discrete_residual_type(nFull);
+  }
+
+  Eigen::MatrixXd createResultOfDiscreteTimeJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  template<class StepCountType>
+  void discreteTimeResidualAndJacobianAction(StepCountType /*stepId*/,
+					     double time,
+					     double dt,
+					     discrete_residual_type & R,
+					     const Eigen::MatrixXd & B,
+#ifdef PRESSIO_ENABLE_CXX17
+					     std::optional<Eigen::MatrixXd *> JA,
+#else
+					     Eigen::MatrixXd * JA,
+#endif
+					     const state_type & y_np1,
+					     const state_type & y_n) const
+  {
+    for (int i=0; i<nFull; ++i){
+      R(i) = y_np1(i) - y_n(i) - dt*(-y_np1(i) + 0.1*y_np1(i)*y_np1(i) + time);
+    }
+    if (JA){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & A = *JA.value();
+#else
+      auto & A = *JA;
+#endif
+      for (int i=0; i<nFull; ++i){
+	for (int j=0; j<B.cols(); ++j){
+	  A(i,j) = (1. - dt*(-1. + 0.2*y_np1(i)))*B(i,j);
+	}
+      }
+    }
+  }
+};
+
+Eigen::MatrixXd create_basis(){
+  Eigen::MatrixXd phi(nFull, nRom);
+  for (int i=0; i<nFull; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = 0.1*i;
+    phi(i,2) = (i % 3);
+  }
+  return phi;
+}
+
+auto create_space(){
+  Eigen::VectorXd shift(nFull);
+  shift.setZero();
+  return pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(create_basis(), shift, false);
+}
+
+Eigen::VectorXd create_rom_state(){
+  Eigen::VectorXd romState(nRom);
+  romState << 0.1, 0.2, 0.3;
+  return romState;
+}
+
+// warm up with a few steps, so that everything lazily sized is sized,
+// then count the allocations of the following steps
+template<class F>
+long allocations_after_warmup(F && advance)
+{
+  advance();
+  const long start = allocations_count();
+  advance();
+  return allocations_count() - start;
+}
+} // end anonymous namespace
+
+TEST(rom_allocations, galerkin_explicit)
+{
+  namespace pode = pressio::ode;
+  const auto space = create_space();
+  MyFom fom;
+  auto problem = pressio::rom::galerkin::create_unsteady_explicit_problem(
+    pode::StepScheme::RungeKutta4, space, fom);
+
+  auto romState = create_rom_state();
+  double time = 0.;
+  const double dt = 0.01;
+  const auto count = allocations_after_warmup([&](){
+    pode::advance_n_steps(problem, romState, time, dt, pode::StepCount(5));
+    time += 5*dt;
+  });
+  EXPECT_EQ(count, 0);
+}
+
+TEST(rom_allocations, galerkin_implicit_newton)
+{
+  namespace pode = pressio::ode;
+  const auto space = create_space();
+  MyFom fom;
+  auto problem = pressio::rom::galerkin::create_unsteady_implicit_problem(
+    pode::StepScheme::BDF2, space, fom);
+
+  using jacobian_t = typename decltype(problem)::jacobian_type;
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::HouseholderQR, jacobian_t>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-12);
+
+  auto romState = create_rom_state();
+  double time = 0.;
+  const double dt = 0.05;
+  const auto count = allocations_after_warmup([&](){
+    pode::advance_n_steps(problem, romState, time, dt, pode::StepCount(5), solver);
+    time += 5*dt;
+  });
+  EXPECT_EQ(count, 0);
+}
+
+TEST(rom_allocations, galerkin_steady_newton)
+{
+  const auto space = create_space();
+  MySteadyFom fom;
+  auto problem = pressio::rom::galerkin::create_steady_problem(space, fom);
+
+  using jacobian_t = typename decltype(problem)::jacobian_type;
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::HouseholderQR, jacobian_t>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-12);
+
+  const auto romState0 = create_rom_state();
+  auto romState = create_rom_state();
+  const auto count = allocations_after_warmup([&](){
+    romState = romState0;
+    solver.solve(romState);
+  });
+  EXPECT_EQ(count, 0);
+}
+
+TEST(rom_allocations, lspg_unsteady_gauss_newton)
+{
+  namespace pode = pressio::ode;
+  const auto space = create_space();
+  MyFom fom;
+  auto problem = pressio::rom::lspg::create_unsteady_problem(
+    pode::StepScheme::BDF1, space, fom);
+
+  using hessian_t = typename pressio::rom::UnsteadyLspgDefaultReducedOperatorsTraits<
+    Eigen::VectorXd>::hessian_type;
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::HouseholderQR, hessian_t>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_gauss_newton_solver(problem.lspgStepper(), linSolver);
+  solver.setStopTolerance(1e-12);
+
+  auto romState = create_rom_state();
+  double time = 0.;
+  const double dt = 0.05;
+  const auto count = allocations_after_warmup([&](){
+    pode::advance_n_steps(problem, romState, time, dt, pode::StepCount(5), solver);
+    time += 5*dt;
+  });
+  EXPECT_EQ(count, 0);
+}
+
+TEST(rom_allocations, lspg_fully_discrete_gauss_newton)
+{
+  namespace pode = pressio::ode;
+  const auto space = create_space();
+  MyFullyDiscreteFom fom;
+  auto problem = pressio::rom::lspg::create_unsteady_problem<2>(space, fom);
+
+  using hessian_t = typename pressio::rom::UnsteadyLspgDefaultReducedOperatorsTraits<
+    Eigen::VectorXd>::hessian_type;
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::HouseholderQR, hessian_t>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_gauss_newton_solver(problem.lspgStepper(), linSolver);
+  solver.setStopTolerance(1e-12);
+
+  auto romState = create_rom_state();
+  double time = 0.;
+  const double dt = 0.05;
+  const auto count = allocations_after_warmup([&](){
+    pode::advance_n_steps(problem, romState, time, dt, pode::StepCount(5), solver);
+    time += 5*dt;
+  });
+  EXPECT_EQ(count, 0);
+}
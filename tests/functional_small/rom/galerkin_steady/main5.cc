@@ -0,0 +1,171 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_steady.hpp"
+
+namespace{
+
+constexpr int nFull = 15;
+constexpr int nRom = 3;
+
+// r(u) = K u + f + c u.*u, with K tridiagonal
+struct MyFom
+{
+  using state_type    = Eigen::VectorXd;
+  using residual_type = state_type;
+
+  double c_ = {};
+  mutable int numCalls_ = 0;
+
+  explicit MyFom(double c) : c_(c){}
+
+  residual_type createResidual() const{ return residual_type(nFull); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  void residualAndJacobianAction(const state_type & u,
+				 residual_type & r,
+				 const Eigen::MatrixXd & B,
+#ifdef PRESSIO_ENABLE_CXX17
+				 std::optional<Eigen::MatrixXd *> Ain) const
+#else
+				 Eigen::MatrixXd * Ain) const
+#endif
+  {
+    ++numCalls_;
+    const auto K = stiffness();
+    r = K*u;
+    for (int i=0; i<nFull; ++i){
+      r(i) += 1. + 0.1*i + c_*u(i)*u(i);
+    }
+
+    if (Ain){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & A = *Ain.value();
+#else
+      auto & A = *Ain;
+#endif
+      A = K*B;
+      for (int i=0; i<nFull; ++i){
+	A.row(i) += 2.*c_*u(i)*B.row(i);
+      }
+    }
+  }
+
+  static Eigen::MatrixXd stiffness(){
+    Eigen::MatrixXd K = Eigen::MatrixXd::Zero(nFull, nFull);
+    for (int i=0; i<nFull; ++i){
+      K(i,i) = -3.;
+      if (i>0) K(i,i-1) = 1.;
+      if (i<nFull-1) K(i,i+1) = 1.2;
+    }
+    return K;
+  }
+};
+
+auto create_space(){
+  Eigen::MatrixXd phi(nFull, nRom);
+  for (int i=0; i<nFull; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = 0.1*i;
+    phi(i,2) = (i % 3);
+  }
+  Eigen::VectorXd shift(nFull);
+  for (int i=0; i<nFull; ++i){ shift(i) = 0.05*i; }
+  return pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, true);
+}
+
+template<class ProblemType>
+Eigen::VectorXd solve(const ProblemType & problem)
+{
+  using jac_t = typename ProblemType::jacobian_type;
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::HouseholderQR, jac_t>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-13);
+
+  Eigen::VectorXd romState(nRom);
+  romState.setConstant(0.1);
+  solver.solve(romState);
+  return romState;
+}
+
+void run(double c, pressio::rom::FomPolynomialDegree degree)
+{
+  namespace gal = pressio::rom::galerkin;
+  const auto space = create_space();
+  MyFom fom(c);
+  auto defaultProblem = gal::create_steady_problem(space, fom);
+
+  // offline
+  const auto reducedOperators = gal::create_reduced_operators(space, fom, degree);
+  EXPECT_EQ(reducedOperators.dimension(), (std::size_t) nRom);
+  EXPECT_EQ(reducedOperators.hasQuadraticTerm(), degree == pressio::rom::FomPolynomialDegree::Quadratic);
+
+  // online: the fom is never called
+  fom.numCalls_ = 0;
+  auto problem = gal::create_steady_problem(reducedOperators);
+
+  Eigen::VectorXd romState(nRom);
+  romState << 0.3, -0.2, 0.7;
+  auto R = problem.createResidual();
+  auto J = problem.createJacobian();
+  problem.residualAndJacobian(romState, R, &J);
+  EXPECT_EQ(fom.numCalls_, 0);
+
+  auto goldR = defaultProblem.createResidual();
+  auto goldJ = defaultProblem.createJacobian();
+  defaultProblem.residualAndJacobian(romState, goldR, &goldJ);
+  EXPECT_TRUE(R.isApprox(goldR, 1e-12));
+  EXPECT_TRUE(J.isApprox(goldJ, 1e-12));
+
+  fom.numCalls_ = 0;
+  const auto x = solve(problem);
+  EXPECT_EQ(fom.numCalls_, 0);
+  const auto goldX = solve(defaultProblem);
+  std::cout << x.transpose() << " | " << goldX.transpose() << std::endl;
+  EXPECT_TRUE(x.isApprox(goldX, 1e-10));
+}
+} // end anonymous namespace
+
+TEST(rom_galerkin_steady, reduced_operators_linear_fom)
+{
+  run(0., pressio::rom::FomPolynomialDegree::Linear);
+}
+
+TEST(rom_galerkin_steady, reduced_operators_quadratic_fom)
+{
+  run(0.1, pressio::rom::FomPolynomialDegree::Quadratic);
+}
+
+TEST(rom_galerkin_steady, reduced_operators_user_provided)
+{
+  using ops_t = pressio::rom::GalerkinReducedOperators<Eigen::VectorXd>;
+  Eigen::MatrixXd A(2,2);
+  A << 1., 2., 3., 4.;
+  Eigen::VectorXd b(2);
+  b << 1., -1.;
+  std::vector<Eigen::MatrixXd> H(2, Eigen::MatrixXd::Zero(2,2));
+  H[0](0,1) = 1.;    // q_0 = x_0 x_1
+  H[1](1,1) = 2.;    // q_1 = 2 x_1^2
+  ops_t reducedOperators(A, b, H);
+
+  auto problem = pressio::rom::galerkin::create_steady_problem(reducedOperators);
+  Eigen::VectorXd x(2);
+  x << 2., 3.;
+  auto R = problem.createResidual();
+  auto J = problem.createJacobian();
+  problem.residualAndJacobian(x, R, &J);
+  EXPECT_DOUBLE_EQ(R(0), 1. + 2. + 6. + 6.);
+  EXPECT_DOUBLE_EQ(R(1), -1. + 6. + 12. + 18.);
+  EXPECT_DOUBLE_EQ(J(0,0), 1. + 3.);
+  EXPECT_DOUBLE_EQ(J(0,1), 2. + 2.);
+  EXPECT_DOUBLE_EQ(J(1,0), 3.);
+  EXPECT_DOUBLE_EQ(J(1,1), 4. + 12.);
+
+  std::vector<Eigen::MatrixXd> wrongH(1, Eigen::MatrixXd::Zero(2,2));
+  EXPECT_THROW(ops_t(A, b, wrongH), std::runtime_error);
+}
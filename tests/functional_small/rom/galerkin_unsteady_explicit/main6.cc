@@ -0,0 +1,89 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+constexpr int N = 10;
+
+// f_i(u) = -(1 + 0.5*i)*u_i + sin(t)
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  rhs_type createRhs() const{
+    rhs_type r(N);
+    r.setConstant(0);
+    return r;
+  }
+
+  void rhs(const state_type & u,
+	   const time_type evalTime,
+	   rhs_type & f) const
+  {
+    for (int i=0; i<N; ++i){
+      f(i) = -(1. + 0.5*i)*u(i) + std::sin(evalTime);
+    }
+  }
+};
+
+struct StepCounter
+{
+  int numSteps_ = 0;
+  void operator()(pressio::ode::StepCount step, double, const Eigen::VectorXd &){
+    numSteps_ = step.get();
+  }
+};
+}
+
+TEST(rom_galerkin_explicit, dormand_prince45_with_pi_step_size_policy)
+{
+  pressio::log::initialize(pressio::logto::terminal);
+  pressio::log::setVerbosity({pressio::log::level::info});
+
+  MyFom fomSystem;
+  Eigen::MatrixXd phi(N, 3);
+  for (int i=0; i<N; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = i;
+    phi(i,2) = i*i;
+  }
+  Eigen::HouseholderQR<Eigen::MatrixXd> qr(phi);
+  phi = qr.householderQ()*Eigen::MatrixXd::Identity(N, 3);
+
+  Eigen::VectorXd shift(N);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, false);
+  namespace gal = pressio::rom::galerkin;
+  const double finalTime = 3.;
+
+  // reference: rk4 with a small fixed step size
+  auto romStateGold = space.createReducedState();
+  romStateGold.setConstant(1.);
+  auto problemGold = gal::create_unsteady_explicit_problem
+    (pressio::ode::StepScheme::RungeKutta4, space, fomSystem);
+  pressio::ode::advance_n_steps(problemGold, romStateGold, 0., 1e-3,
+				::pressio::ode::StepCount(3000));
+
+  auto romState = space.createReducedState();
+  romState.setConstant(1.);
+  auto problem = gal::create_unsteady_explicit_problem
+    (pressio::ode::StepScheme::DormandPrince45, space, fomSystem);
+  EXPECT_EQ(problem.errorEstimateOrder(), 4);
+  auto policy = pressio::ode::create_pi_step_size_policy
+    (problem, 1e-9, 1e-9, pressio::ode::StepSize<double>(1e-3), finalTime);
+  StepCounter counter;
+  pressio::ode::advance_to_target_point_with_step_recovery
+    (problem, romState, 0., finalTime, policy, counter);
+
+  std::cout << "steps = " << counter.numSteps_ << "\n"
+	    << romState.transpose() << "\n"
+	    << romStateGold.transpose() << std::endl;
+  EXPECT_TRUE(romState.isApprox(romStateGold, 1e-8));
+  EXPECT_LT(counter.numSteps_, 300);
+
+  pressio::log::finalize();
+}
@@ -0,0 +1,188 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+constexpr int nFull = 20;
+
+// f_i(u) = -u_i + 0.1*u_i^2 + t
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  const std::vector<int> indices_to_corrupt_ = {};
+  mutable int fullMeshEvaluations_ = 0;
+  mutable int fullSizeCreations_ = 0;
+
+  explicit MyFom(std::vector<int> ind) : indices_to_corrupt_(ind){}
+
+  rhs_type createRhs() const{
+    ++fullSizeCreations_;
+    return rhs_type(nFull);
+  }
+
+  void rhs(const state_type & u, const time_type timeIn, rhs_type & f) const
+  {
+    ++fullMeshEvaluations_;
+    for (int i=0; i<nFull; ++i){
+      f(i) = -u(i) + 0.1*u(i)*u(i) + timeIn;
+    }
+    // corrupt some to ensure masking works
+    for (auto & it : indices_to_corrupt_){
+      f(it) = -1114;
+    }
+  }
+};
+
+// same as MyFom but also able to evaluate the rhs only at the sample mesh
+struct MySampleMeshFom : MyFom
+{
+  const std::vector<int> sample_indices_ = {};
+
+  MySampleMeshFom(std::vector<int> ind, std::vector<int> sample_indices)
+    : MyFom(ind), sample_indices_(sample_indices){}
+
+  void rhsAtSampleMesh(const state_type & u, const time_type & timeIn,
+		       Eigen::VectorXd & f) const
+  {
+    for (std::size_t k=0; k<sample_indices_.size(); ++k){
+      const auto i = sample_indices_[k];
+      f(k) = -u(i) + 0.1*u(i)*u(i) + timeIn;
+    }
+  }
+};
+
+// same as MySampleMeshFom but also creating the masked rhs itself
+struct MySampleMeshFomWithFactories : MySampleMeshFom
+{
+  using MySampleMeshFom::MySampleMeshFom;
+
+  Eigen::VectorXd createRhsAtSampleMesh() const{
+    return Eigen::VectorXd(sample_indices_.size());
+  }
+};
+
+class MyMasker
+{
+  const std::vector<int> sample_indices_ = {};
+
+public:
+  MyMasker(std::vector<int> sample_indices) : sample_indices_(sample_indices){}
+
+  auto createResultOfMaskActionOn(const Eigen::VectorXd & /*operand*/) const{
+    return Eigen::VectorXd(sample_indices_.size());
+  }
+
+  auto createResultOfMaskActionOn(const Eigen::MatrixXd & operand) const{
+    return Eigen::MatrixXd(sample_indices_.size(), operand.cols());
+  }
+
+  template<class T1, class T2>
+  void operator()(const Eigen::MatrixBase<T1> & operand,
+		  Eigen::MatrixBase<T2> & result) const
+  {
+    for (std::size_t i=0; i<sample_indices_.size(); ++i){
+      for (int j=0; j<operand.cols(); ++j){
+        result(i,j) = operand(sample_indices_[i],j);
+      }
+    }
+  }
+};
+
+class HypRedOperator
+{
+  Eigen::MatrixXd matrix_;
+
+public:
+  HypRedOperator(const Eigen::MatrixXd & phi) : matrix_(phi){}
+
+  template<class OperandType>
+  void operator()(const OperandType & operand, double /*time*/, OperandType & result) const{
+    result = matrix_.transpose() * operand;
+  }
+};
+
+template<class FomType, class SpaceType>
+Eigen::VectorXd run(pressio::ode::StepScheme odeScheme,
+		    const SpaceType & space,
+		    const FomType & fomSystem,
+		    const MyMasker & masker,
+		    const HypRedOperator & hrOp)
+{
+  namespace gal = pressio::rom::galerkin;
+  auto problem = gal::create_unsteady_explicit_problem(odeScheme, space, fomSystem, masker, hrOp);
+
+  auto romState = space.createReducedState();
+  romState[0] = 0.1;
+  romState[1] = 0.2;
+  romState[2] = 0.3;
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.05,
+				::pressio::ode::StepCount(5));
+  return romState;
+}
+
+void run_and_compare(pressio::ode::StepScheme odeScheme)
+{
+  const std::vector<int> sample_indices = {0,2,4,6,8,10,12,14,16,18};
+  const int nMasked = sample_indices.size();
+  const std::vector<int> corrupt_indices = {1,7,13,19};
+
+  Eigen::MatrixXd phiFull(nFull, 3);
+  for (int i=0; i<nFull; ++i){
+    phiFull(i,0) = 1.;
+    phiFull(i,1) = 0.1*i;
+    phiFull(i,2) = (i % 3);
+  }
+
+  typename MyFom::state_type shift(nFull);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phiFull, shift, false);
+
+  Eigen::MatrixXd matForProj(nMasked, 3);
+  for (int i = 0; i < nMasked; ++i){
+    matForProj.row(i) = phiFull.row(sample_indices[i]);
+  }
+  HypRedOperator hrOp(matForProj);
+  MyMasker masker(sample_indices);
+
+  MyFom fom(corrupt_indices);
+  const auto romStateMasked = run(odeScheme, space, fom, masker, hrOp);
+  EXPECT_TRUE(fom.fullMeshEvaluations_ > 0);
+
+  MySampleMeshFom sampleMeshFom(corrupt_indices, sample_indices);
+  const auto romStateSampleMesh = run(odeScheme, space, sampleMeshFom, masker, hrOp);
+  // the full-size operators must never be computed
+  EXPECT_EQ(sampleMeshFom.fullMeshEvaluations_, 0);
+
+  std::cout << romStateMasked.transpose() << " | "
+	    << romStateSampleMesh.transpose() << std::endl;
+  EXPECT_TRUE(romStateMasked.isApprox(romStateSampleMesh, 1e-12));
+
+  // with the factory, no full-size object is ever created
+  MySampleMeshFomWithFactories factoriesFom(corrupt_indices, sample_indices);
+  const auto romStateFactories = run(odeScheme, space, factoriesFom, masker, hrOp);
+  EXPECT_EQ(factoriesFom.fullMeshEvaluations_, 0);
+  EXPECT_EQ(factoriesFom.fullSizeCreations_, 0);
+  EXPECT_TRUE(romStateMasked.isApprox(romStateFactories, 1e-12));
+}
+}
+
+TEST(rom_galerkin_explicit, masked_at_sample_mesh_euler_forward)
+{
+  pressio::log::initialize(pressio::logto::terminal);
+  pressio::log::setVerbosity({pressio::log::level::info});
+  run_and_compare(pressio::ode::StepScheme::ForwardEuler);
+  pressio::log::finalize();
+}
+
+TEST(rom_galerkin_explicit, masked_at_sample_mesh_rk4)
+{
+  pressio::log::initialize(pressio::logto::terminal);
+  pressio::log::setVerbosity({pressio::log::level::info});
+  run_and_compare(pressio::ode::StepScheme::RungeKutta4);
+  pressio::log::finalize();
+}
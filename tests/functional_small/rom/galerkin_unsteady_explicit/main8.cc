@@ -0,0 +1,132 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+constexpr int N = 8;
+
+Eigen::MatrixXd create_fom_mass_matrix(){
+  Eigen::MatrixXd M(N, N);
+  M.setZero();
+  for (int i=0; i<N; ++i){
+    M(i,i) = 4.;
+    if (i>0){ M(i,i-1) = 1.; }
+    if (i<N-1){ M(i,i+1) = 1.; }
+  }
+  return M;
+}
+
+// M dy/dt = -0.2*y + t, with a constant M
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  Eigen::MatrixXd M_ = create_fom_mass_matrix();
+  mutable int massMatrixCount_ = 0;
+
+  rhs_type createRhs() const{
+    rhs_type r(N);
+    r.setConstant(0);
+    return r;
+  }
+
+  void rhs(const state_type & u, const time_type evalTime, rhs_type & f) const{
+    f = -0.2*u;
+    f.array() += evalTime;
+  }
+
+  Eigen::MatrixXd createResultOfMassMatrixActionOn(const Eigen::MatrixXd & operand) const{
+    return Eigen::MatrixXd(N, operand.cols());
+  }
+
+  void applyMassMatrix(const state_type & /*state*/,
+		       const Eigen::MatrixXd & operand,
+		       double /*evalTime*/,
+		       Eigen::MatrixXd & result) const
+  {
+    ++massMatrixCount_;
+    result = M_ * operand;
+  }
+};
+
+// same fom, but also telling that the mass matrix is constant
+struct MyFomConstantMM : MyFom
+{
+  mutable int constantMassMatrixCount_ = 0;
+
+  using MyFom::applyMassMatrix;
+  void applyMassMatrix(const Eigen::MatrixXd & operand, Eigen::MatrixXd & result) const
+  {
+    ++constantMassMatrixCount_;
+    result = M_ * operand;
+  }
+};
+
+struct LinearSolver
+{
+  void solve(const Eigen::MatrixXd & A, Eigen::VectorXd & x, const Eigen::VectorXd & b){
+    x = A.partialPivLu().solve(b);
+  }
+};
+
+Eigen::MatrixXd create_basis(){
+  Eigen::MatrixXd phi(N, 3);
+  for (int i=0; i<N; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = i;
+    phi(i,2) = i*i;
+  }
+  Eigen::HouseholderQR<Eigen::MatrixXd> qr(phi);
+  return qr.householderQ()*Eigen::MatrixXd::Identity(N, 3);
+}
+}
+
+TEST(rom_galerkin_explicit, constant_mass_matrix_rk4)
+{
+  pressio::log::initialize(pressio::logto::terminal);
+  pressio::log::setVerbosity({pressio::log::level::info});
+
+  const auto phi = create_basis();
+  Eigen::VectorXd shift(N);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, false);
+
+  const auto odeScheme = pressio::ode::StepScheme::RungeKutta4;
+  const auto nSteps = ::pressio::ode::StepCount(5);
+  const double dt = 0.1;
+  namespace gal = pressio::rom::galerkin;
+
+  // reference: the reduced mass matrix is recomputed at every stage
+  MyFom fom;
+  auto romStateGold = space.createReducedState();
+  romStateGold << 0.1, 0.2, 0.3;
+  {
+    auto problem = gal::create_unsteady_explicit_problem(odeScheme, space, fom);
+    LinearSolver linSolver;
+    pressio::ode::advance_n_steps(problem, romStateGold, 0., dt, nSteps, linSolver);
+  }
+  EXPECT_EQ(fom.massMatrixCount_, 4*nSteps.get());
+
+  // phi^T M phi is computed once and its factorization is reused
+  MyFomConstantMM fomConstMM;
+  auto romState = space.createReducedState();
+  romState << 0.1, 0.2, 0.3;
+  {
+    auto problem = gal::create_unsteady_explicit_problem(odeScheme, space, fomConstMM);
+    using lin_solver_t = pressio::linearsolvers::Solver<
+      pressio::linearsolvers::direct::PartialPivLU, Eigen::MatrixXd>;
+    lin_solver_t linSolver;
+    pressio::ode::advance_n_steps(problem, romState, 0., dt, nSteps, linSolver);
+  }
+  EXPECT_EQ(fomConstMM.constantMassMatrixCount_, 1);
+  EXPECT_EQ(fomConstMM.massMatrixCount_, 0);
+
+  std::cout << romStateGold.transpose() << " | " << romState.transpose() << std::endl;
+  EXPECT_TRUE(romState.isApprox(romStateGold, 1e-12));
+
+  pressio::log::finalize();
+}
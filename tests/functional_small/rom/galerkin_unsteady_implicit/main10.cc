@@ -0,0 +1,125 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+constexpr int nFull = 20;
+constexpr int nRom = 3;
+
+// autonomous and quadratic: f_i(u) = -u_i + 0.5*u_{i-1} + 0.1*u_i^2 + 1
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  mutable int numCalls_ = 0;
+
+  rhs_type createRhs() const{ return rhs_type(nFull); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type /*time*/, rhs_type & f) const{
+    ++numCalls_;
+    for (int i=0; i<nFull; ++i){
+      f(i) = -u(i) + 0.1*u(i)*u(i) + 1.;
+      if (i>0) f(i) += 0.5*u(i-1);
+    }
+  }
+
+  void applyJacobian(const state_type & u, const Eigen::MatrixXd & B,
+		     const time_type & /*time*/, Eigen::MatrixXd & A) const{
+    ++numCalls_;
+    for (int i=0; i<nFull; ++i){
+      A.row(i) = (-1. + 0.2*u(i))*B.row(i);
+      if (i>0) A.row(i) += 0.5*B.row(i-1);
+    }
+  }
+};
+
+auto create_space(){
+  Eigen::MatrixXd phi(nFull, nRom);
+  for (int i=0; i<nFull; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = 0.1*i;
+    phi(i,2) = (i % 3);
+  }
+  // orthonormal basis, as expected by Galerkin
+  Eigen::HouseholderQR<Eigen::MatrixXd> qr(phi);
+  phi = qr.householderQ() * Eigen::MatrixXd::Identity(nFull, nRom);
+  Eigen::VectorXd shift(nFull);
+  for (int i=0; i<nFull; ++i){ shift(i) = 0.01*i; }
+  return pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, true);
+}
+
+template<class ProblemType>
+Eigen::VectorXd run_implicit(ProblemType & problem)
+{
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::ColPivHouseholderQR, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-13);
+
+  Eigen::VectorXd romState(nRom);
+  romState << 0.1, 0.2, 0.3;
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.05,
+				::pressio::ode::StepCount(5), solver);
+  return romState;
+}
+
+template<class ProblemType>
+Eigen::VectorXd run_explicit(ProblemType & problem)
+{
+  Eigen::VectorXd romState(nRom);
+  romState << 0.1, 0.2, 0.3;
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.01,
+				::pressio::ode::StepCount(5));
+  return romState;
+}
+} // end anonymous namespace
+
+TEST(rom_galerkin_implicit, reduced_operators_quadratic_fom)
+{
+  namespace gal = pressio::rom::galerkin;
+  const auto space = create_space();
+  MyFom fom;
+  const auto reducedOperators = gal::create_reduced_operators(
+    space, fom, 0., pressio::rom::FomPolynomialDegree::Quadratic);
+
+  for (auto scheme : {pressio::ode::StepScheme::BDF1, pressio::ode::StepScheme::BDF2}){
+    auto defaultProblem = gal::create_unsteady_implicit_problem(scheme, space, fom);
+    const auto gold = run_implicit(defaultProblem);
+
+    fom.numCalls_ = 0;
+    auto problem = gal::create_unsteady_implicit_problem(scheme, reducedOperators);
+    const auto romState = run_implicit(problem);
+    EXPECT_EQ(fom.numCalls_, 0);
+    std::cout << romState.transpose() << " | " << gold.transpose() << "\n";
+    EXPECT_TRUE(romState.isApprox(gold, 1e-11));
+  }
+}
+
+TEST(rom_galerkin_explicit, reduced_operators_quadratic_fom)
+{
+  namespace gal = pressio::rom::galerkin;
+  const auto space = create_space();
+  MyFom fom;
+  const auto reducedOperators = gal::create_reduced_operators(
+    space, fom, 0., pressio::rom::FomPolynomialDegree::Quadratic);
+
+  const auto scheme = pressio::ode::StepScheme::RungeKutta4;
+  auto defaultProblem = gal::create_unsteady_explicit_problem(scheme, space, fom);
+  const auto gold = run_explicit(defaultProblem);
+
+  fom.numCalls_ = 0;
+  auto problem = gal::create_unsteady_explicit_problem(scheme, reducedOperators);
+  const auto romState = run_explicit(problem);
+  EXPECT_EQ(fom.numCalls_, 0);
+  std::cout << romState.transpose() << " | " << gold.transpose() << "\n";
+  EXPECT_TRUE(romState.isApprox(gold, 1e-12));
+}
@@ -0,0 +1,240 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+constexpr int N = 10;
+constexpr int K = 3;
+
+// f_i(u; mu) = -mu*u_i + 0.1*u_i^2 + t
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = Eigen::VectorXd;
+
+  double mu_;
+
+  explicit MyFom(double mu) : mu_(mu){}
+
+  rhs_type createRhs() const{
+    rhs_type r(N);
+    r.setConstant(0);
+    return r;
+  }
+
+  void rhs(const state_type & u, const time_type evalTime, rhs_type & f) const{
+    for (int i=0; i<N; ++i){
+      f(i) = -mu_*u(i) + 0.1*u(i)*u(i) + evalTime;
+    }
+  }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & A) const{
+    return Eigen::MatrixXd(N, A.cols());
+  }
+
+  void applyJacobian(const state_type & u, const Eigen::MatrixXd & A,
+		     const time_type & /*evalTime*/, Eigen::MatrixXd & result) const{
+    for (int i=0; i<N; ++i){
+      result.row(i) = (-mu_ + 0.2*u(i))*A.row(i);
+    }
+  }
+};
+
+// same as MyFom, evaluated for all the samples at once
+struct MyFomEnsemble
+{
+  using time_type = double;
+  using state_type = Eigen::MatrixXd;
+  using rhs_type = Eigen::MatrixXd;
+
+  std::vector<MyFom> foms_;
+
+  explicit MyFomEnsemble(const std::vector<double> & mus){
+    for (auto mu : mus){ foms_.emplace_back(mu); }
+  }
+
+  rhs_type createRhs() const{
+    rhs_type r(N, foms_.size());
+    r.setConstant(0);
+    return r;
+  }
+
+  void rhs(const state_type & U, const time_type evalTime, rhs_type & F) const{
+    for (std::size_t s=0; s<foms_.size(); ++s){
+      Eigen::VectorXd f(N);
+      foms_[s].rhs(U.col(s), evalTime, f);
+      F.col(s) = f;
+    }
+  }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & A) const{
+    return Eigen::MatrixXd(N, A.cols());
+  }
+
+  void applyJacobian(const state_type & U, const Eigen::MatrixXd & A,
+		     const time_type & evalTime,
+		     std::vector<Eigen::MatrixXd> & results) const{
+    for (std::size_t s=0; s<foms_.size(); ++s){
+      foms_[s].applyJacobian(U.col(s), A, evalTime, results[s]);
+    }
+  }
+};
+
+template<class LinearSolverTag = pressio::linearsolvers::direct::PartialPivLU, class SpaceType>
+void run_ensemble_and_compare(pressio::ode::StepScheme odeScheme,
+			      const SpaceType & space,
+			      const std::vector<double> & mus)
+{
+  const double dt = 0.05;
+  const auto numSteps = ::pressio::ode::StepCount(6);
+  namespace gal = pressio::rom::galerkin;
+
+  MyFomEnsemble fomEnsemble(mus);
+#ifdef PRESSIO_ENABLE_CXX20
+  static_assert(pressio::rom::SemiDiscreteFomEnsembleWithJacobianAction<
+		MyFomEnsemble, Eigen::MatrixXd>, "");
+#else
+  static_assert(pressio::rom::SemiDiscreteFomEnsembleWithJacobianAction<
+		MyFomEnsemble, Eigen::MatrixXd>::value, "");
+#endif
+
+  auto ensemble = gal::experimental::create_unsteady_implicit_ensemble_problem
+    <LinearSolverTag>(odeScheme, space, fomEnsemble);
+  ensemble.setStopTolerance(1e-13);
+  auto romStates = ensemble.createState();
+  EXPECT_EQ(romStates.rows(), K);
+  EXPECT_EQ(romStates.cols(), (int) mus.size());
+  for (std::size_t s=0; s<mus.size(); ++s){
+    romStates.col(s).setConstant(0.1*(s+1));
+  }
+  pressio::ode::advance_n_steps(ensemble, romStates, 0., dt, numSteps);
+
+  // each sample run independently must match the ensemble
+  for (std::size_t s=0; s<mus.size(); ++s){
+    MyFom fomSystem(mus[s]);
+    auto problem = gal::create_unsteady_implicit_problem(odeScheme, space, fomSystem);
+
+    using jac_t = Eigen::MatrixXd;
+    using lin_solver_t = pressio::linearsolvers::Solver<LinearSolverTag, jac_t>;
+    lin_solver_t linSolver;
+    auto solver = pressio::create_newton_solver(problem, linSolver);
+    solver.setStopTolerance(1e-13);
+
+    auto romState = space.createReducedState();
+    romState.setConstant(0.1*(s+1));
+    pressio::ode::advance_n_steps(problem, romState, 0., dt, numSteps, solver);
+    std::cout << romState.transpose() << " | "
+	      << romStates.col(s).transpose() << std::endl;
+    EXPECT_TRUE( romState.isApprox(romStates.col(s), 1e-10) );
+  }
+}
+
+Eigen::MatrixXd create_basis(){
+  Eigen::MatrixXd phi(N, K);
+  for (int i=0; i<N; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = i;
+    phi(i,2) = (i % 3);
+  }
+  Eigen::HouseholderQR<Eigen::MatrixXd> qr(phi);
+  return qr.householderQ()*Eigen::MatrixXd::Identity(N, K);
+}
+}
+
+TEST(rom_galerkin_implicit, ensemble_matches_independent_samples_bdf1)
+{
+  pressio::log::initialize(pressio::logto::terminal);
+  pressio::log::setVerbosity({pressio::log::level::info});
+
+  const auto phi = create_basis();
+  Eigen::VectorXd shift(N);
+  shift.setConstant(0.5);
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, true);
+  run_ensemble_and_compare(pressio::ode::StepScheme::BDF1, space, {0.5, 1., 2., 4.});
+
+  pressio::log::finalize();
+}
+
+TEST(rom_galerkin_implicit, ensemble_matches_independent_samples_bdf2)
+{
+  pressio::log::initialize(pressio::logto::terminal);
+  pressio::log::setVerbosity({pressio::log::level::info});
+
+  const auto phi = create_basis();
+  Eigen::VectorXd shift(N);
+  shift.setConstant(0.);
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, false);
+  run_ensemble_and_compare(pressio::ode::StepScheme::BDF2, space, {0.5, 1., 2.});
+
+  pressio::log::finalize();
+}
+
+TEST(rom_galerkin_implicit, ensemble_with_other_linear_solvers)
+{
+  const auto phi = create_basis();
+  Eigen::VectorXd shift(N);
+  shift.setConstant(0.5);
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, true);
+  run_ensemble_and_compare<pressio::linearsolvers::direct::HouseholderQR>
+    (pressio::ode::StepScheme::BDF1, space, {0.5, 1., 2.});
+  run_ensemble_and_compare<pressio::linearsolvers::iterative::Bicgstab>
+    (pressio::ode::StepScheme::BDF2, space, {0.5, 1., 2.});
+}
+
+TEST(rom_galerkin_implicit, ensemble_residual_stop_criterion)
+{
+  const auto phi = create_basis();
+  Eigen::VectorXd shift(N);
+  shift.setConstant(0.);
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, false);
+
+  MyFomEnsemble fomEnsemble({0.5, 1.});
+  namespace gal = pressio::rom::galerkin;
+  auto ensemble = gal::experimental::create_unsteady_implicit_ensemble_problem
+    (pressio::ode::StepScheme::BDF1, space, fomEnsemble);
+  ensemble.setStopCriterion(pressio::nonlinearsolvers::Stop::WhenAbsolutel2NormOfResidualBelowTolerance);
+  ensemble.setStopTolerance(1e-12);
+  auto romStates = ensemble.createState();
+  romStates.setConstant(0.1);
+  pressio::ode::advance_n_steps(ensemble, romStates, 0., 0.05, pressio::ode::StepCount(1));
+
+  // the converged states must satisfy the BDF1 system:
+  // y - y_n - dt*phi^T f(phi y, t_n+1) = 0
+  for (int s=0; s<2; ++s){
+    MyFom fom(s == 0 ? 0.5 : 1.);
+    Eigen::VectorXd f(N);
+    fom.rhs(phi*romStates.col(s), 0.05, f);
+    const Eigen::VectorXd R = romStates.col(s) - Eigen::VectorXd::Constant(K, 0.1)
+      - 0.05*phi.transpose()*f;
+    EXPECT_LT(R.norm(), 1e-12);
+  }
+
+  EXPECT_THROW(ensemble.setStopCriterion(pressio::nonlinearsolvers::Stop::AfterMaxIters),
+	       std::runtime_error);
+}
+
+TEST(rom_galerkin_implicit, ensemble_throws_and_restores_state_if_not_converged)
+{
+  const auto phi = create_basis();
+  Eigen::VectorXd shift(N);
+  shift.setConstant(0.);
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, false);
+
+  MyFomEnsemble fomEnsemble({0.5, 1.});
+  namespace gal = pressio::rom::galerkin;
+  auto ensemble = gal::experimental::create_unsteady_implicit_ensemble_problem
+    (pressio::ode::StepScheme::BDF2, space, fomEnsemble);
+  ensemble.setStopTolerance(1e-15);
+  ensemble.setMaxIterations(1);
+  auto romStates = ensemble.createState();
+  romStates.setConstant(0.1);
+  const Eigen::MatrixXd romStates0 = romStates;
+
+  using namespace pressio::ode;
+  EXPECT_THROW(ensemble(romStates, StepStartAt<double>(0.), StepCount(1), StepSize<double>(0.05)),
+	       pressio::eh::TimeStepFailure);
+  EXPECT_TRUE(romStates == romStates0);
+}
@@ -0,0 +1,150 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+
+namespace{
+
+constexpr int nFull = 20;
+constexpr int nRom = 3;
+
+// f_i(u) = -u_i + 0.1*u_i^2 + t
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  rhs_type createRhs() const{ return rhs_type(nFull); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type timeIn, rhs_type & f) const{
+    for (int i=0; i<nFull; ++i){
+      f(i) = -u(i) + 0.1*u(i)*u(i) + timeIn;
+    }
+  }
+
+  void applyJacobian(const state_type & u, const Eigen::MatrixXd & B,
+		     const time_type & /*time*/, Eigen::MatrixXd & A) const{
+    for (int i=0; i<nFull; ++i){
+      A.row(i) = (-1. + 0.2*u(i))*B.row(i);
+    }
+  }
+};
+
+Eigen::MatrixXd create_basis(){
+  Eigen::MatrixXd phi(nFull, nRom);
+  for (int i=0; i<nFull; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = 0.1*i;
+    phi(i,2) = (i % 3);
+  }
+  return phi;
+}
+
+template<class RomStateType>
+Eigen::VectorXd run_implicit(pressio::ode::StepScheme odeScheme)
+{
+  MyFom fomSystem;
+  Eigen::VectorXd shift(nFull);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<RomStateType>(create_basis(), shift, false);
+
+  auto problem = pressio::rom::galerkin::create_unsteady_implicit_problem(odeScheme, space, fomSystem);
+
+  // with a fixed-size reduced state, the reduced jacobian is fixed-size too
+  using jacobian_t = typename decltype(problem)::jacobian_type;
+  static_assert(int(jacobian_t::RowsAtCompileTime) == int(RomStateType::RowsAtCompileTime), "");
+  static_assert(int(jacobian_t::ColsAtCompileTime) == int(RomStateType::RowsAtCompileTime), "");
+
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::ColPivHouseholderQR, jacobian_t>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-13);
+
+  auto romState = space.createReducedState();
+  romState[0] = 0.1;
+  romState[1] = 0.2;
+  romState[2] = 0.3;
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.05,
+				::pressio::ode::StepCount(5), solver);
+  return romState;
+}
+
+template<class RomStateType>
+Eigen::VectorXd run_explicit()
+{
+  MyFom fomSystem;
+  Eigen::VectorXd shift(nFull);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<RomStateType>(create_basis(), shift, false);
+
+  auto problem = pressio::rom::galerkin::create_unsteady_explicit_problem(
+    pressio::ode::StepScheme::RungeKutta4, space, fomSystem);
+
+  auto romState = space.createReducedState();
+  romState[0] = 0.1;
+  romState[1] = 0.2;
+  romState[2] = 0.3;
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.01,
+				::pressio::ode::StepCount(5));
+  return romState;
+}
+} // end anonymous namespace
+
+TEST(rom_galerkin_implicit, fixed_size_reduced_state)
+{
+  using fixed_t = Eigen::Matrix<double, nRom, 1>;
+  for (auto scheme : {pressio::ode::StepScheme::BDF1, pressio::ode::StepScheme::BDF2}){
+    const auto gold = run_implicit<Eigen::VectorXd>(scheme);
+    const auto romState = run_implicit<fixed_t>(scheme);
+    std::cout << romState.transpose() << "\n";
+    for (int i=0; i<nRom; ++i){
+      EXPECT_NEAR(romState(i), gold(i), 1e-13);
+    }
+  }
+}
+
+TEST(rom_galerkin_explicit, fixed_size_reduced_state)
+{
+  using fixed_t = Eigen::Matrix<double, nRom, 1>;
+  const auto gold = run_explicit<Eigen::VectorXd>();
+  const auto romState = run_explicit<fixed_t>();
+  std::cout << romState.transpose() << "\n";
+  for (int i=0; i<nRom; ++i){
+    EXPECT_NEAR(romState(i), gold(i), 1e-13);
+  }
+}
+
+TEST(rom_galerkin_implicit, fixed_size_reduced_state_wrong_size)
+{
+  Eigen::VectorXd shift(nFull);
+  shift.setZero();
+  using fixed_t = Eigen::Matrix<double, nRom+1, 1>;
+  auto space = pressio::rom::create_trial_column_subspace<fixed_t>(create_basis(), shift, false);
+  EXPECT_THROW(space.createReducedState(), std::runtime_error);
+}
+
+TEST(rom_galerkin_implicit, large_fixed_size_reduced_state_uses_dynamic_matrices)
+{
+  // fixed-size n x n operators are only used for small n
+  using small_t = Eigen::Matrix<double, 30, 1>;
+  using large_t = Eigen::Matrix<double, 31, 1>;
+  using small_traits = pressio::rom::ImplicitGalerkinDefaultReducedOperatorsTraits<small_t>;
+  using large_traits = pressio::rom::ImplicitGalerkinDefaultReducedOperatorsTraits<large_t>;
+  static_assert(small_traits::reduced_jacobian_type::RowsAtCompileTime == 30, "");
+  static_assert(large_traits::reduced_jacobian_type::RowsAtCompileTime == Eigen::Dynamic, "");
+  static_assert(large_traits::reduced_mass_matrix_type::ColsAtCompileTime == Eigen::Dynamic, "");
+  // the reduced state itself stays fixed-size
+  static_assert(std::is_same<large_traits::reduced_residual_type, large_t>::value, "");
+
+  using hessian_t = pressio::nonlinearsolvers::normal_eqs_default_types<large_t>::hessian_type;
+  static_assert(hessian_t::RowsAtCompileTime == Eigen::Dynamic, "");
+  const auto H = pressio::nonlinearsolvers::normal_eqs_default_types<large_t>::createHessian(large_t{});
+  EXPECT_EQ(H.rows(), 31);
+  EXPECT_EQ(H.cols(), 31);
+}
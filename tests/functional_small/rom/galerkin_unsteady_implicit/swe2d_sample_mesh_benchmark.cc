@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+#include "../../../test_apps/swe2d/apps_swe2d_eigen.hpp"
+#include "../../../test_apps/swe2d/apps_swe2d_hyper_eigen.hpp"
+
+/*
+  masked Galerkin on the 2d shallow water equations: compares the
+  regular masked path, where the FOM rhs and jacobian action are
+  computed on the full mesh and then masked, against the sample mesh
+  path, where the FOM only computes them at the sample mesh cells
+  using swe2d_hyper on the stencil mesh
+*/
+
+namespace{
+
+using gids_t = std::vector<int>;
+const double swe2dParams[3] = {9.8, 0.125, 0.2};
+
+// the full mesh app with the rom FOM api
+struct Swe2dFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  pressio::apps::swe2d app_;
+
+  explicit Swe2dFom(int n) : app_(n, swe2dParams){}
+
+  rhs_type createRhs() const{ return app_.createVelocity(); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(app_.numDofs(), B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type t, rhs_type & f) const{
+    app_.velocity(u, t, f);
+  }
+
+  void applyJacobian(const state_type & u, const Eigen::MatrixXd & B,
+		     const time_type & t, Eigen::MatrixXd & A) const{
+    app_.applyJacobian(u, B, t, A);
+  }
+};
+
+// same as Swe2dFom, also able to evaluate only at the sample mesh
+struct Swe2dSampleMeshFom : Swe2dFom
+{
+  pressio::apps::swe2d_hyper<gids_t> hyperApp_;
+  // full state dofs of the stencil mesh, in stencil mesh order
+  std::vector<int> stencilDofs_;
+  mutable Eigen::VectorXd stencilState_;
+  mutable Eigen::MatrixXd stencilOperand_;
+
+  Swe2dSampleMeshFom(int n, const gids_t & sampleGids, const gids_t & stencilGids)
+    : Swe2dFom(n), hyperApp_(n, swe2dParams, sampleGids, stencilGids),
+      stencilState_(3*stencilGids.size())
+  {
+    for (auto gid : stencilGids){
+      for (int k=0; k<3; ++k){ stencilDofs_.push_back(3*gid+k); }
+    }
+  }
+
+  void rhsAtSampleMesh(const state_type & u, const time_type & t, Eigen::VectorXd & f) const{
+    gatherStencilState(u);
+    hyperApp_.velocity(stencilState_, t, f);
+  }
+
+  void applyJacobianAtSampleMesh(const state_type & u, const Eigen::MatrixXd & B,
+				 const time_type & t, Eigen::MatrixXd & A) const
+  {
+    gatherStencilState(u);
+    stencilOperand_.resize(stencilDofs_.size(), B.cols());
+    for (std::size_t i=0; i<stencilDofs_.size(); ++i){
+      stencilOperand_.row(i) = B.row(stencilDofs_[i]);
+    }
+    hyperApp_.applyJacobian(stencilState_, stencilOperand_, t, A);
+  }
+
+private:
+  void gatherStencilState(const state_type & u) const{
+    for (std::size_t i=0; i<stencilDofs_.size(); ++i){
+      stencilState_(i) = u(stencilDofs_[i]);
+    }
+  }
+};
+
+class SampleMeshMasker
+{
+  std::vector<int> sampleDofs_;
+
+public:
+  explicit SampleMeshMasker(std::vector<int> sampleDofs) : sampleDofs_(std::move(sampleDofs)){}
+
+  Eigen::VectorXd createResultOfMaskActionOn(const Eigen::VectorXd & /*operand*/) const{
+    return Eigen::VectorXd(sampleDofs_.size());
+  }
+
+  Eigen::MatrixXd createResultOfMaskActionOn(const Eigen::MatrixXd & operand) const{
+    return Eigen::MatrixXd(sampleDofs_.size(), operand.cols());
+  }
+
+  template<class T1, class T2>
+  void operator()(const Eigen::MatrixBase<T1> & operand, Eigen::MatrixBase<T2> & result) const{
+    for (std::size_t i=0; i<sampleDofs_.size(); ++i){
+      result.row(i) = operand.row(sampleDofs_[i]);
+    }
+  }
+};
+
+class HypRedOperator
+{
+  Eigen::MatrixXd matrix_;
+
+public:
+  explicit HypRedOperator(const Eigen::MatrixXd & phiSample) : matrix_(phiSample){}
+
+  template<class OperandType>
+  void operator()(const OperandType & operand, double /*time*/, OperandType & result) const{
+    result = matrix_.transpose() * operand;
+  }
+};
+
+template<class FomType, class SpaceType>
+Eigen::VectorXd run(const SpaceType & space,
+		    const FomType & fomSystem,
+		    const SampleMeshMasker & masker,
+		    const HypRedOperator & hrOp,
+		    double & elapsedSeconds)
+{
+  auto problem = pressio::rom::galerkin::create_unsteady_implicit_problem(
+    pressio::ode::StepScheme::BDF1, space, fomSystem, masker, hrOp);
+
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::PartialPivLU, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-12);
+
+  auto romState = space.createReducedState();
+  romState.setZero();
+  const auto start = std::chrono::steady_clock::now();
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.01,
+				::pressio::ode::StepCount(10), solver);
+  elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return romState;
+}
+}
+
+TEST(rom_galerkin_implicit, swe2d_sample_mesh_benchmark)
+{
+  const int n = 64;
+  const int numModes = 8;
+  const Swe2dFom fom(n);
+  const int nDofs = fom.app_.numDofs();
+
+  // sample every 16th cell, the stencil mesh adds their four neighbors
+  auto cellGid = [n](int i, int j){ return ((j+n) % n)*n + (i+n) % n; };
+  gids_t sampleGids, stencilGids;
+  for (int gid=0; gid<n*n; gid+=16){
+    sampleGids.push_back(gid);
+    const int i = gid % n, j = gid / n;
+    for (int s : {cellGid(i,j), cellGid(i-1,j), cellGid(i+1,j), cellGid(i,j-1), cellGid(i,j+1)}){
+      stencilGids.push_back(s);
+    }
+  }
+  std::sort(stencilGids.begin(), stencilGids.end());
+  stencilGids.erase(std::unique(stencilGids.begin(), stencilGids.end()), stencilGids.end());
+
+  std::vector<int> sampleDofs;
+  for (auto gid : sampleGids){
+    for (int k=0; k<3; ++k){ sampleDofs.push_back(3*gid+k); }
+  }
+
+  // affine trial space around the initial condition with an orthonormal basis
+  Eigen::MatrixXd phi = Eigen::MatrixXd::Zero(nDofs, numModes);
+  for (int i=0; i<nDofs; ++i){
+    for (int j=0; j<numModes; ++j){
+      phi(i,j) = std::sin(0.001*(j+1)*i + 0.3*j);
+    }
+  }
+  phi = Eigen::HouseholderQR<Eigen::MatrixXd>(phi).householderQ()
+    * Eigen::MatrixXd::Identity(nDofs, numModes);
+  const Eigen::VectorXd shift = fom.app_.getGaussianIC(0.125);
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, true);
+
+  Eigen::MatrixXd phiSample(sampleDofs.size(), numModes);
+  for (std::size_t i=0; i<sampleDofs.size(); ++i){
+    phiSample.row(i) = phi.row(sampleDofs[i]);
+  }
+  const HypRedOperator hrOp(phiSample);
+  const SampleMeshMasker masker(sampleDofs);
+
+  double fullMeshSeconds = 0., sampleMeshSeconds = 0.;
+  const auto romStateFullMesh = run(space, fom, masker, hrOp, fullMeshSeconds);
+  const Swe2dSampleMeshFom sampleMeshFom(n, sampleGids, stencilGids);
+  const auto romStateSampleMesh = run(space, sampleMeshFom, masker, hrOp, sampleMeshSeconds);
+
+  std::cout << "swe2d " << n << "x" << n << ", " << sampleGids.size() << " sample cells, "
+	    << stencilGids.size() << " stencil cells\n"
+	    << "  masked full mesh evaluation: " << fullMeshSeconds << " s\n"
+	    << "  sample mesh evaluation:      " << sampleMeshSeconds << " s\n"
+	    << "  speedup: " << fullMeshSeconds/sampleMeshSeconds << std::endl;
+
+  EXPECT_TRUE(romStateFullMesh.norm() > 0.);
+  EXPECT_TRUE(romStateFullMesh.isApprox(romStateSampleMesh, 1e-10));
+}
@@ -0,0 +1,126 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_lspg_steady.hpp"
+#include "pressio/rom_galerkin_steady.hpp"
+
+namespace{
+
+constexpr int nFull = 15;
+constexpr int nRom = 3;
+
+// r(u) = K u + f, with K tridiagonal
+struct MyFom
+{
+  using state_type    = Eigen::VectorXd;
+  using residual_type = state_type;
+
+  mutable int numCalls_ = 0;
+
+  residual_type createResidual() const{ return residual_type(nFull); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  void residualAndJacobianAction(const state_type & u,
+				 residual_type & r,
+				 const Eigen::MatrixXd & B,
+#ifdef PRESSIO_ENABLE_CXX17
+				 std::optional<Eigen::MatrixXd *> Ain) const
+#else
+				 Eigen::MatrixXd * Ain) const
+#endif
+  {
+    ++numCalls_;
+    Eigen::MatrixXd K = Eigen::MatrixXd::Zero(nFull, nFull);
+    for (int i=0; i<nFull; ++i){
+      K(i,i) = -3.;
+      if (i>0) K(i,i-1) = 1.;
+      if (i<nFull-1) K(i,i+1) = 1.2;
+    }
+    r = K*u;
+    for (int i=0; i<nFull; ++i){ r(i) += 1. + 0.1*i; }
+
+    if (Ain){
+#ifdef PRESSIO_ENABLE_CXX17
+      *Ain.value() = K*B;
+#else
+      *Ain = K*B;
+#endif
+    }
+  }
+};
+} // end anonymous namespace
+
+TEST(rom_lspg_steady, reduced_operators_linear_fom)
+{
+  namespace lspg = pressio::rom::lspg;
+
+  Eigen::MatrixXd phi(nFull, nRom);
+  for (int i=0; i<nFull; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = 0.1*i;
+    phi(i,2) = (i % 3);
+  }
+  Eigen::VectorXd shift(nFull);
+  for (int i=0; i<nFull; ++i){ shift(i) = 0.05*i; }
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, true);
+  MyFom fom;
+
+  // default lspg solved with gauss-newton
+  auto defaultProblem = lspg::create_steady_problem(space, fom);
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::HouseholderQR, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto gnSolver = pressio::create_gauss_newton_solver(defaultProblem, linSolver);
+  gnSolver.setStopTolerance(1e-13);
+  Eigen::VectorXd goldX(nRom);
+  goldX.setConstant(0.1);
+  gnSolver.solve(goldX);
+
+  // with precomputed operators, the fom is never called online
+  const auto reducedOperators = lspg::create_reduced_operators(space, fom);
+  fom.numCalls_ = 0;
+  auto problem = lspg::create_steady_problem(reducedOperators);
+  auto solver = pressio::create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-13);
+  Eigen::VectorXd x(nRom);
+  x.setConstant(0.1);
+  solver.solve(x);
+  EXPECT_EQ(fom.numCalls_, 0);
+
+  std::cout << x.transpose() << " | " << goldX.transpose() << std::endl;
+  EXPECT_TRUE(x.isApprox(goldX, 1e-10));
+}
+
+namespace{
+template<class T, class = void>
+struct lspg_accepts_reduced_operators : std::false_type{};
+
+template<class T>
+struct lspg_accepts_reduced_operators<
+  T, pressio::mpl::void_t<
+       decltype(pressio::rom::lspg::create_steady_problem(std::declval<const T &>()))>
+  > : std::true_type{};
+
+template<class T, class = void>
+struct galerkin_accepts_reduced_operators : std::false_type{};
+
+template<class T>
+struct galerkin_accepts_reduced_operators<
+  T, pressio::mpl::void_t<
+       decltype(pressio::rom::galerkin::create_steady_problem(std::declval<const T &>()))>
+  > : std::true_type{};
+}
+
+TEST(rom_lspg_steady, reduced_operators_kind_is_checked)
+{
+  // the lspg normal equations and the galerkin system cannot be swapped
+  using lspg_ops_t     = pressio::rom::LspgReducedOperators<Eigen::VectorXd>;
+  using galerkin_ops_t = pressio::rom::GalerkinReducedOperators<Eigen::VectorXd>;
+  static_assert(lspg_accepts_reduced_operators<lspg_ops_t>::value, "");
+  static_assert(!lspg_accepts_reduced_operators<galerkin_ops_t>::value, "");
+  static_assert(galerkin_accepts_reduced_operators<galerkin_ops_t>::value, "");
+  static_assert(!galerkin_accepts_reduced_operators<lspg_ops_t>::value, "");
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_lspg_unsteady.hpp"
+
+namespace{
+
+constexpr int nFull = 20;
+constexpr int nRom = 3;
+
+// f_i(u) = -u_i + 0.1*u_i^2 + t
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  rhs_type createRhs() const{ return rhs_type(nFull); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type timeIn, rhs_type & f) const{
+    for (int i=0; i<nFull; ++i){
+      f(i) = -u(i) + 0.1*u(i)*u(i) + timeIn;
+    }
+  }
+
+  void applyJacobian(const state_type & u, const Eigen::MatrixXd & B,
+		     const time_type & /*time*/, Eigen::MatrixXd & A) const{
+    for (int i=0; i<nFull; ++i){
+      A.row(i) = (-1. + 0.2*u(i))*B.row(i);
+    }
+  }
+};
+
+template<class RomStateType>
+Eigen::VectorXd run(pressio::ode::StepScheme odeScheme)
+{
+  Eigen::MatrixXd phi(nFull, nRom);
+  for (int i=0; i<nFull; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = 0.1*i;
+    phi(i,2) = (i % 3);
+  }
+  Eigen::VectorXd shift(nFull);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<RomStateType>(phi, shift, false);
+
+  MyFom fomSystem;
+  auto problem = pressio::rom::lspg::create_unsteady_problem(odeScheme, space, fomSystem);
+
+  // with a fixed-size reduced state, the normal equations are fixed-size too
+  using hessian_t = typename pressio::rom::UnsteadyLspgDefaultReducedOperatorsTraits<
+    RomStateType>::hessian_type;
+  static_assert(int(hessian_t::RowsAtCompileTime) == int(RomStateType::RowsAtCompileTime), "");
+  static_assert(int(hessian_t::ColsAtCompileTime) == int(RomStateType::RowsAtCompileTime), "");
+
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::HouseholderQR, hessian_t>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_gauss_newton_solver(problem.lspgStepper(), linSolver);
+  solver.setStopTolerance(1e-13);
+
+  auto romState = space.createReducedState();
+  romState[0] = 0.1;
+  romState[1] = 0.2;
+  romState[2] = 0.3;
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.05,
+				::pressio::ode::StepCount(5), solver);
+  return romState;
+}
+}
+
+TEST(rom_lspg_unsteady, fixed_size_reduced_state)
+{
+  using fixed_t = Eigen::Matrix<double, nRom, 1>;
+  for (auto scheme : {pressio::ode::StepScheme::BDF1, pressio::ode::StepScheme::BDF2}){
+    const auto gold = run<Eigen::VectorXd>(scheme);
+    const auto romState = run<fixed_t>(scheme);
+    std::cout << romState.transpose() << "\n";
+    for (int i=0; i<nRom; ++i){
+      EXPECT_NEAR(romState(i), gold(i), 1e-13);
+    }
+  }
+}
@@ -66,3 +66,176 @@ TEST(solvers_linear_eigen, dense_direct_houseqr)
   using tag = pressio::linearsolvers::direct::HouseholderQR;
   PRESSIO_SOLVERS_LINEAR_EIGEN_DENSE_UTEST(tag);
 }
+
+TEST(solvers_linear_eigen, dense_direct_partialpivlu_reuse_factorization)
+{
+  using matrix_t = Eigen::MatrixXd;
+  using vector_t = Eigen::VectorXd;
+
+  matrix_t A(3, 3);
+  A << 4.0, 1.0, 0.0,
+       1.0, 3.0, 1.0,
+       0.0, 1.0, 2.0;
+
+  using tag = pressio::linearsolvers::direct::PartialPivLU;
+  using solver_t = pressio::linearsolvers::Solver<tag, matrix_t>;
+  solver_t solver;
+  ASSERT_FALSE(solver.isFactorized());
+
+  // first solve factorizes
+  ASSERT_TRUE(solver.factorizeIfChanged(A));
+  ASSERT_TRUE(solver.isFactorized());
+  // same matrix: no new factorization
+  ASSERT_FALSE(solver.factorizeIfChanged(A));
+
+  vector_t b1(3); b1 << 1.0, 2.0, 3.0;
+  vector_t b2(3); b2 << -1.0, 0.5, 4.0;
+  vector_t y(3);
+  solver.solveWithFactorization(b1, y);
+  ASSERT_TRUE( (A*y - b1).norm() <= 1e-13 );
+  solver.solveWithFactorization(b2, y);
+  ASSERT_TRUE( (A*y - b2).norm() <= 1e-13 );
+
+  // changing the matrix triggers a new factorization
+  A(0,0) = 5.0;
+  ASSERT_TRUE(solver.factorizeIfChanged(A));
+  solver.solve(A, b1, y);
+  ASSERT_TRUE( (A*y - b1).norm() <= 1e-13 );
+}
+
+TEST(solvers_linear_eigen, matrix_fingerprint_detects_any_change)
+{
+  using matrix_t = Eigen::MatrixXd;
+  pressio::linearsolvers::impl::MatrixFingerprint fp;
+
+  matrix_t A(2, 3);
+  A << 1.0, 2.0, 3.0,
+       4.0, 5.0, 6.0;
+  ASSERT_TRUE(fp.update(A));
+  ASSERT_FALSE(fp.update(A));
+
+  // a one-ulp change is a different matrix
+  A(1,2) = std::nextafter(A(1,2), 10.0);
+  ASSERT_TRUE(fp.update(A));
+  ASSERT_FALSE(fp.update(A));
+
+  // same values in the same storage order, but different extents
+  const matrix_t B = Eigen::Map<const matrix_t>(A.data(), 3, 2);
+  ASSERT_TRUE(fp.update(B));
+  ASSERT_FALSE(fp.update(B));
+
+  // a smaller matrix whose entries match the start of the stored ones
+  const matrix_t C = B.topRows(2);
+  ASSERT_TRUE(fp.update(C));
+  ASSERT_FALSE(fp.update(C));
+}
+
+#define PRESSIO_SOLVERS_LINEAR_EIGEN_DENSE_MULTI_RHS_UTEST(TAGIN) \
+  using matrix_t = Eigen::MatrixXd; \
+  matrix_t A(3, 3); \
+  A << 4.0, 1.0, 0.0, \
+       1.0, 3.0, 1.0, \
+       0.0, 1.0, 2.0; \
+  matrix_t B(3, 4); \
+  B << 1.0, 2.0, 3.0, -1.0, \
+       2.0, 0.5, 1.0,  2.0, \
+       3.0, 4.0, 0.0,  1.0; \
+  matrix_t Y(3, 4); \
+  using solver_t = pressio::linearsolvers::Solver<TAGIN, matrix_t>; \
+  solver_t solver; \
+  solver.solve(A, B, Y); \
+  ASSERT_TRUE( (A*Y - B).norm() <= 1e-13 ); \
+
+
+TEST(solvers_linear_eigen, dense_direct_partialpivlu_multi_rhs)
+{
+  using tag = pressio::linearsolvers::direct::PartialPivLU;
+  PRESSIO_SOLVERS_LINEAR_EIGEN_DENSE_MULTI_RHS_UTEST(tag);
+}
+
+TEST(solvers_linear_eigen, dense_direct_houseqr_multi_rhs)
+{
+  using tag = pressio::linearsolvers::direct::HouseholderQR;
+  PRESSIO_SOLVERS_LINEAR_EIGEN_DENSE_MULTI_RHS_UTEST(tag);
+}
+
+TEST(solvers_linear_eigen, dense_direct_potrsL_multi_rhs)
+{
+  using tag = pressio::linearsolvers::direct::potrsL;
+  PRESSIO_SOLVERS_LINEAR_EIGEN_DENSE_MULTI_RHS_UTEST(tag);
+}
+
+TEST(solvers_linear_eigen, dense_direct_potrsU_multi_rhs)
+{
+  using tag = pressio::linearsolvers::direct::potrsU;
+  PRESSIO_SOLVERS_LINEAR_EIGEN_DENSE_MULTI_RHS_UTEST(tag);
+}
+
+TEST(solvers_linear_eigen, sparse_direct_colpivhouseqr_uncompressed_reuse_factorization)
+{
+  using matrix_t = Eigen::SparseMatrix<double>;
+  using vector_t = Eigen::VectorXd;
+
+  // filled via insert, so the matrix is not compressed
+  matrix_t A(3, 3);
+  A.reserve(Eigen::VectorXi::Constant(3, 3));
+  A.insert(0,0) = 4.0; A.insert(0,1) = 1.0;
+  A.insert(1,0) = 1.0; A.insert(1,1) = 3.0; A.insert(1,2) = 1.0;
+  A.insert(2,1) = 1.0; A.insert(2,2) = 2.0;
+  ASSERT_FALSE(A.isCompressed());
+
+  using tag = pressio::linearsolvers::direct::ColPivHouseholderQR;
+  using solver_t = pressio::linearsolvers::Solver<tag, matrix_t>;
+  solver_t solver;
+  ASSERT_FALSE(solver.isFactorized());
+  solver.factorize(A);
+  ASSERT_TRUE(solver.isFactorized());
+  ASSERT_FALSE(A.isCompressed());
+  ASSERT_FALSE(solver.factorizeIfChanged(A));
+
+  vector_t b(3); b << 1.0, 2.0, 3.0;
+  vector_t y(3);
+  solver.solveWithFactorization(b, y);
+  ASSERT_TRUE( (A*y - b).norm() <= 1e-13 );
+
+  A.coeffRef(0,0) = 5.0;
+  ASSERT_TRUE(solver.factorizeIfChanged(A));
+  ASSERT_TRUE(solver.isFactorized());
+  solver.solve(A, b, y);
+  ASSERT_TRUE( (A*y - b).norm() <= 1e-13 );
+}
+
+TEST(solvers_linear_eigen, dense_direct_partialpivlu_mark_matrix_unchanged)
+{
+  using matrix_t = Eigen::MatrixXd;
+  using vector_t = Eigen::VectorXd;
+
+  matrix_t A(3, 3);
+  A << 4.0, 1.0, 0.0,
+       1.0, 3.0, 1.0,
+       0.0, 1.0, 2.0;
+
+  using tag = pressio::linearsolvers::direct::PartialPivLU;
+  using solver_t = pressio::linearsolvers::Solver<tag, matrix_t>;
+  solver_t solver;
+
+  // nothing factorized yet: the statement is ignored
+  solver.markMatrixUnchanged();
+  ASSERT_TRUE(solver.factorizeIfChanged(A));
+
+  // the caller states A is unchanged: the current factors are used
+  // even though A was modified, since A is not checked
+  const matrix_t A0 = A;
+  A(0,0) = 5.0;
+  solver.markMatrixUnchanged();
+  ASSERT_FALSE(solver.factorizeIfChanged(A));
+  vector_t b(3); b << 1.0, 2.0, 3.0;
+  vector_t y(3);
+  solver.solveWithFactorization(b, y);
+  ASSERT_TRUE( (A0*y - b).norm() <= 1e-13 );
+
+  // the statement only applies to the next check
+  ASSERT_TRUE(solver.factorizeIfChanged(A));
+  solver.solveWithFactorization(b, y);
+  ASSERT_TRUE( (A*y - b).norm() <= 1e-13 );
+}
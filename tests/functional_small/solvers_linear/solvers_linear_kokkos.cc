@@ -1,5 +1,7 @@
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include "pressio/ops.hpp"
 #include "pressio/solvers_linear.hpp"
 
 TEST(solvers_linear_kokkos, dense_getrs)
@@ -61,6 +63,54 @@ TEST(solvers_linear_kokkos, dense_getrs)
 
 }
 
+TEST(solvers_linear_kokkos, dense_getrs_reuse_factorization)
+{
+  using d_layout = Kokkos::LayoutLeft;
+  using exe_space = Kokkos::DefaultExecutionSpace;
+  using k1d_d = Kokkos::View<double*, d_layout, exe_space>;
+  using k1d_h = typename k1d_d::host_mirror_type;
+  using k2d_d = Kokkos::View<double**, d_layout, exe_space>;
+  using k2d_h = typename k2d_d::host_mirror_type;
+
+  constexpr int Nr = 4;
+  constexpr int Nc = 4;
+
+  k2d_h A_h("Ah", Nr, Nc);
+  A_h(0,0)=1.; A_h(0,1)=3.; A_h(0,2)=2.; A_h(0,3)=3.;
+  A_h(1,0)=2.; A_h(1,1)=4.; A_h(1,2)=1.; A_h(1,3)=2.;
+  A_h(2,0)=1.; A_h(2,1)=6.; A_h(2,2)=3.; A_h(2,3)=1.;
+  A_h(3,0)=0.; A_h(3,1)=2.; A_h(3,2)=2.; A_h(3,3)=1.;
+  k2d_d A_d("Ad", Nr, Nc);
+  Kokkos::deep_copy(A_d, A_h);
+
+  using solver_tag   = pressio::linearsolvers::direct::getrs;
+  using linear_solver_t = pressio::linearsolvers::Solver<solver_tag, k2d_d>;
+  linear_solver_t lsObj;
+  EXPECT_TRUE(lsObj.factorizeIfChanged(A_d));
+  // A is unchanged, so the factorization is reused
+  EXPECT_FALSE(lsObj.factorizeIfChanged(A_d));
+
+  for (int k=0; k<3; ++k){
+    k1d_h b_h("bh", Nr);
+    for (int i=0; i<Nr; ++i){ b_h(i) = (double) (i+k+1); }
+    k1d_d b_d("bd", Nr);
+    Kokkos::deep_copy(b_d, b_h);
+
+    k1d_d x_d("xd", Nr);
+    lsObj.solve(A_d, b_d, x_d);
+    k1d_h x_h("xh", Nc);
+    Kokkos::deep_copy(x_h, x_d);
+
+    for (int i=0; i<Nr; ++i){
+      double sum = 0.;
+      for (int j=0; j<Nc; ++j){
+	sum += A_h(i,j) * x_h(j);
+      }
+      EXPECT_NEAR(sum, b_h(i), 1e-12);
+    }
+  }
+}
+
 TEST(solvers_linear_kokkos, dense_geqrf)
 {
   using d_layout = Kokkos::LayoutLeft;
@@ -122,4 +172,138 @@ TEST(solvers_linear_kokkos, dense_geqrf)
     EXPECT_TRUE( err < 1e-12);
   }
 
-}
\ No newline at end of file
+}
+template<class TagType>
+void run_kokkos_dense_multi_rhs()
+{
+  using d_layout = Kokkos::LayoutLeft;
+  using exe_space = Kokkos::DefaultExecutionSpace;
+  using k2d_d = Kokkos::View<double**, d_layout, exe_space>;
+  using k2d_h = typename k2d_d::host_mirror_type;
+
+  constexpr int N = 4;
+  constexpr int nRhs = 3;
+
+  // symmetric positive definite so that all tags can be used
+  k2d_h A_h("Ah", N, N);
+  A_h(0,0)=4.; A_h(0,1)=1.; A_h(0,2)=0.; A_h(0,3)=0.;
+  A_h(1,0)=1.; A_h(1,1)=4.; A_h(1,2)=1.; A_h(1,3)=0.;
+  A_h(2,0)=0.; A_h(2,1)=1.; A_h(2,2)=4.; A_h(2,3)=1.;
+  A_h(3,0)=0.; A_h(3,1)=0.; A_h(3,2)=1.; A_h(3,3)=4.;
+  k2d_d A_d("Ad", N, N);
+  Kokkos::deep_copy(A_d, A_h);
+
+  k2d_h B_h("Bh", N, nRhs);
+  for (int i=0; i<N; ++i){
+    for (int j=0; j<nRhs; ++j){
+      B_h(i,j) = (double) (i+1)*(j+1);
+    }
+  }
+  k2d_d B_d("Bd", N, nRhs);
+  Kokkos::deep_copy(B_d, B_h);
+
+  using linear_solver_t = pressio::linearsolvers::Solver<TagType, k2d_d>;
+  linear_solver_t lsObj;
+  k2d_d X_d("Xd", N, nRhs);
+  lsObj.solve(A_d, B_d, X_d);
+
+  k2d_h X_h("Xh", N, nRhs);
+  Kokkos::deep_copy(X_h, X_d);
+  for (int j=0; j<nRhs; ++j){
+    for (int i=0; i<N; ++i){
+      double sum = 0.;
+      for (int k=0; k<N; ++k){
+	sum += A_h(i,k) * X_h(k,j);
+      }
+      EXPECT_NEAR(sum, B_h(i,j), 1e-12);
+    }
+  }
+}
+
+TEST(solvers_linear_kokkos, dense_getrs_multi_rhs){
+  run_kokkos_dense_multi_rhs<pressio::linearsolvers::direct::getrs>();
+}
+
+TEST(solvers_linear_kokkos, dense_potrsL_multi_rhs){
+  run_kokkos_dense_multi_rhs<pressio::linearsolvers::direct::potrsL>();
+}
+
+TEST(solvers_linear_kokkos, dense_potrsU_multi_rhs){
+  run_kokkos_dense_multi_rhs<pressio::linearsolvers::direct::potrsU>();
+}
+
+TEST(solvers_linear_kokkos, dense_geqrf_multi_rhs){
+  run_kokkos_dense_multi_rhs<pressio::linearsolvers::direct::geqrf>();
+}
+
+TEST(solvers_linear_kokkos, dense_nopivot_lu_multi_rhs){
+  run_kokkos_dense_multi_rhs<pressio::linearsolvers::direct::NoPivotLU>();
+}
+
+// compares the device-resident LU against the host LAPACK
+// path on a normal equations matrix, and reports both timings
+TEST(solvers_linear_kokkos, dense_nopivot_lu_vs_getrs)
+{
+  using d_layout = Kokkos::LayoutLeft;
+  using exe_space = Kokkos::DefaultExecutionSpace;
+  using k1d_d = Kokkos::View<double*, d_layout, exe_space>;
+  using k1d_h = typename k1d_d::host_mirror_type;
+  using k2d_d = Kokkos::View<double**, d_layout, exe_space>;
+  using k2d_h = typename k2d_d::host_mirror_type;
+
+  constexpr int M = 200;
+  constexpr int N = 20;
+  constexpr int nSolves = 100;
+
+  // H = J^T J is symmetric positive definite
+  k2d_h J_h("Jh", M, N);
+  for (int i=0; i<M; ++i){
+    for (int j=0; j<N; ++j){
+      J_h(i,j) = std::sin(0.1*(i+1)*(j+1)) + (i==j ? 2. : 0.);
+    }
+  }
+  k2d_d J_d("Jd", M, N);
+  Kokkos::deep_copy(J_d, J_h);
+  k2d_d H_d("Hd", N, N);
+  pressio::ops::product(pressio::transpose(), pressio::nontranspose(), 1., J_d, 0., H_d);
+
+  k1d_h b_h("bh", N);
+  for (int i=0; i<N; ++i){ b_h(i) = (double) (i+1); }
+  k1d_d b_d("bd", N);
+  Kokkos::deep_copy(b_d, b_h);
+
+  k1d_d x1_d("x1", N);
+  k1d_d x2_d("x2", N);
+
+  using device_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::NoPivotLU, k2d_d>;
+  device_solver_t deviceSolver;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int k=0; k<nSolves; ++k){ deviceSolver.solve(H_d, b_d, x1_d); }
+  Kokkos::fence();
+  auto t1 = std::chrono::steady_clock::now();
+
+  using host_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::getrs, k2d_d>;
+  host_solver_t hostSolver;
+  k2d_d Hcopy_d("Hcopy", N, N);
+  for (int k=0; k<nSolves; ++k){
+    Kokkos::deep_copy(Hcopy_d, H_d);
+    hostSolver.solveAllowMatOverwrite(Hcopy_d, b_d, x2_d);
+  }
+  Kokkos::fence();
+  auto t2 = std::chrono::steady_clock::now();
+
+  std::cout << "NoPivotLU: "
+	    << std::chrono::duration<double, std::milli>(t1-t0).count()/nSolves << " ms/solve, "
+	    << "getrs: "
+	    << std::chrono::duration<double, std::milli>(t2-t1).count()/nSolves << " ms/solve\n";
+
+  k1d_h x1_h("x1h", N);
+  k1d_h x2_h("x2h", N);
+  Kokkos::deep_copy(x1_h, x1_d);
+  Kokkos::deep_copy(x2_h, x2_d);
+  for (int i=0; i<N; ++i){
+    EXPECT_NEAR(x1_h(i), x2_h(i), 1e-10);
+  }
+}
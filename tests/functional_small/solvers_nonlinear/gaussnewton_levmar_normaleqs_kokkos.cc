@@ -0,0 +1,97 @@
+
+#include <gtest/gtest.h>
+#include "pressio/solvers_linear.hpp"
+#include "pressio/solvers_nonlinear_gaussnewton.hpp"
+#include "pressio/solvers_nonlinear_levmarq.hpp"
+
+namespace{
+
+// same as problems/problem3.hpp, but with kokkos data
+// and the residual and jacobian computed in the execution space
+struct Problem3Kokkos
+{
+  using exe_space     = Kokkos::DefaultExecutionSpace;
+  using scalar_type   = double;
+  using state_type    = Kokkos::View<double*, Kokkos::LayoutLeft, exe_space>;
+  using residual_type = state_type;
+  using jacobian_type = Kokkos::View<double**, Kokkos::LayoutLeft, exe_space>;
+
+  state_type createState() const { return state_type("x", 2); }
+  residual_type createResidual() const { return residual_type("r", 8); }
+  jacobian_type createJacobian() const { return jacobian_type("J", 8, 2); }
+
+  void residualAndJacobian(const state_type & x,
+			   residual_type & res,
+#ifdef PRESSIO_ENABLE_CXX17
+			   std::optional<jacobian_type*> Jin) const
+#else
+			   jacobian_type* Jin) const
+#endif
+  {
+#ifdef PRESSIO_ENABLE_CXX17
+    auto * jac = Jin.value_or(nullptr);
+#else
+    auto * jac = Jin;
+#endif
+
+    const bool computeJac = jac != nullptr;
+    const auto J = computeJac ? *jac : jacobian_type();
+    const auto r = res;
+    Kokkos::parallel_for(Kokkos::RangePolicy<exe_space>(0, 8),
+			 KOKKOS_LAMBDA(const int i){
+			   const double y[8] = {3.29, 4.27, 5.3, 7.1, 10.1, 9.8, 16.1, 20.2};
+			   const double t = i+1;
+			   const double expval = exp(x(1) * t);
+			   r(i) = x(0) * expval - y[i];
+			   if (computeJac){
+			     J(i,0) = expval;
+			     J(i,1) = x(0)*t*expval;
+			   }
+			 });
+  }
+};
+
+template<class SolverType>
+void solve_and_check(SolverType & solver, Problem3Kokkos & problem, double tol)
+{
+  auto x = problem.createState();
+  auto x_h = Kokkos::create_mirror_view(x);
+  x_h(0) = 2.; x_h(1) = 0.25;
+  Kokkos::deep_copy(x, x_h);
+
+  solver.setStopTolerance(1e-8);
+  solver.solve(problem, x);
+
+  Kokkos::deep_copy(x_h, x);
+  EXPECT_NEAR(x_h(0), 2.4173449278229, tol);
+  EXPECT_NEAR(x_h(1), 0.26464986197941, tol);
+}
+}
+
+TEST(solvers_nonlinear_kokkos, gauss_newton_device_resident_lu)
+{
+  using problem_t = Problem3Kokkos;
+  using state_t = typename problem_t::state_type;
+  using hessian_t = pressio::nonlinearsolvers::normal_eqs_default_hessian_t<state_t>;
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::NoPivotLU, hessian_t>;
+
+  problem_t problem;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_gauss_newton_solver(problem, linSolver);
+  solve_and_check(solver, problem, 1e-7);
+}
+
+TEST(solvers_nonlinear_kokkos, levenberg_marquardt_device_resident_lu)
+{
+  using problem_t = Problem3Kokkos;
+  using state_t = typename problem_t::state_type;
+  using hessian_t = pressio::nonlinearsolvers::normal_eqs_default_hessian_t<state_t>;
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::NoPivotLU, hessian_t>;
+
+  problem_t problem;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_levenberg_marquardt_solver(problem, linSolver);
+  solve_and_check(solver, problem, 1e-6);
+}
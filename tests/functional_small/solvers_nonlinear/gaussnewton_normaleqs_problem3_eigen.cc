@@ -53,6 +53,24 @@ void testC3(std::string & sentinel,
   }
 }
 
+template <typename problem_t, typename state_t, typename solver>
+void testC4(std::string & sentinel,
+            problem_t & problem,
+            state_t & x,
+            solver & GNSolver)
+{
+  // reuse the jacobian and hessian across iterations
+  using namespace pressio::nonlinearsolvers;
+  GNSolver.setStopCriterion(Stop::WhenAbsolutel2NormOfCorrectionBelowTolerance);
+  GNSolver.setStopTolerance(1e-8);
+  GNSolver.setJacobianReuse(2, 0.9);
+  GNSolver.solve(problem, x);
+  GNSolver.setJacobianReuse(0);
+  if ( (std::abs(x(0) - 2.4173449278229) > 1e-7 )or
+       (std::abs(x(1) - 0.26464986197941) > 1e-7) ){
+    sentinel = "FAILED";
+  }
+}
 
 int main()
 {
@@ -88,6 +106,10 @@ int main()
   testC3(sentinel, problem, x, GNSolver);
   std::cout << "\n" << std::endl;
 
+  x(0) = 2.0; x(1) = 0.25;
+  testC4(sentinel, problem, x, GNSolver);
+  std::cout << "\n" << std::endl;
+
   std::cout << sentinel << std::endl;
 
   std::cout << std::setprecision(14) << x << std::endl;
@@ -3,6 +3,17 @@
 #include "pressio/solvers_nonlinear_gaussnewton.hpp"
 #include "./problems/problem5.hpp"
 
+// counts how many times the solver creates a new state
+struct CountingProblem5a : pressio::solvers::test::Problem5a<double>
+{
+  mutable int count_ = 0;
+
+  state_type createState() const{
+    ++count_;
+    return Problem5a<double>::createState();
+  }
+};
+
 int main()
 {
   namespace plog   = pressio::log;
@@ -12,7 +23,7 @@ int main()
   using namespace pressio;
   Eigen::Vector4d state;
 
-  using problem_t = solvers::test::Problem5a<double>;
+  using problem_t = CountingProblem5a;
   using state_t   = typename problem_t::state_type;
   using hessian_t = Eigen::MatrixXd;
 
@@ -42,6 +53,16 @@ int main()
   if (e1>1e-6 or e2>1e-6  or e3>1e-6 or e4>1e-6){
     sentinel = "FAILED";
   }
+
+  // repeated solves with line search reuse the trial state of the solver
+  const int countBefore = problem.count_;
+  GNSolver.setUpdateCriterion(pressio::nonlinearsolvers::Update::BacktrackStrictlyDecreasingObjective);
+  for (int i=0; i<3; ++i){
+    x(0) = -0.05; x(1) = 1.1; x(2) = 1.2; x(3) = 1.5;
+    GNSolver.solve(problem, x);
+    if (std::abs(x(0) - gold[0]) > 1e-6){ sentinel = "FAILED"; }
+  }
+  if (problem.count_ != countBefore){ sentinel = "FAILED"; }
   std::cout << sentinel << std::endl;
 
   plog::finalize();
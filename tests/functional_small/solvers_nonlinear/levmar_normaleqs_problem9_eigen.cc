@@ -59,6 +59,18 @@ void testC2(std::string & sentinel,
   if (!gold.isApprox(x)){ sentinel = "FAILED"; }
 }
 
+// counts how many times the solver creates a new state
+template<class ProblemType>
+struct CountingStateCreation : ProblemType
+{
+  mutable int count_ = 0;
+
+  typename ProblemType::state_type createState() const{
+    ++count_;
+    return ProblemType::createState();
+  }
+};
+
 int main()
 {
   namespace plog = pressio::log;
@@ -67,7 +79,7 @@ int main()
 
   using namespace pressio;
 
-  using problem_t = solvers::test::Problem9<double>;
+  using problem_t = CountingStateCreation<solvers::test::Problem9<double>>;
   using hessian_t = Eigen::MatrixXd;
 
   problem_t problem;
@@ -77,12 +89,17 @@ int main()
   lin_solver_t linSolver;
   std::string sentinel = "PASSED";
   auto solver = pressio::create_levenberg_marquardt_solver(problem, linSolver);
+  const int countAfterConstruction = problem.count_;
   testC1(sentinel, problem, solver);
   std::cout << "\n" << std::endl;
 
   testC2(sentinel, problem, solver);
   std::cout << "\n" << std::endl;
 
+  // the only states created after the solver are the initial guesses
+  // created in testC1 and testC2: the solves themselves do not allocate
+  if (problem.count_ != countAfterConstruction + 2){ sentinel = "FAILED"; }
+
   std::cout << sentinel << "\n";
   plog::finalize();
   return 0;
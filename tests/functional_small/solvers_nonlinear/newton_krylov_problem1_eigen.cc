@@ -0,0 +1,194 @@
+
+#include <gtest/gtest.h>
+#include "pressio/solvers_linear.hpp"
+#include "pressio/solvers_nonlinear_newton.hpp"
+#include "pressio/ode_steppers_implicit.hpp"
+#include "pressio/ode_advancers.hpp"
+#include "./problems/problem1.hpp"
+
+namespace{
+
+// same as Problem1, but only providing the residual and the action of the jacobian
+struct Problem1JacobianAction
+{
+  using state_type = Eigen::VectorXd;
+  using residual_type = state_type;
+
+  state_type createState() const {
+    state_type a(2);
+    a.setZero();
+    return a;
+  }
+
+  residual_type createResidual() const {
+    residual_type a(2);
+    a.setZero();
+    return a;
+  }
+
+  void residual(const state_type& x, residual_type& res) const
+  {
+    res(0) =  x(0)*x(0)*x(0) + x(1) - 1.0;
+    res(1) = -x(0) + x(1)*x(1)*x(1) + 1.0;
+  }
+
+  void applyJacobian(const state_type& x, const state_type& v, residual_type& Jv) const
+  {
+    ++jacobianActionCount;
+    Jv(0) = 3.0*x(0)*x(0)*v(0) + v(1);
+    Jv(1) = -v(0) + 3.0*x(1)*x(1)*v(1);
+  }
+
+  mutable int jacobianActionCount = 0;
+};
+
+// du_i/dt = -u_i + 0.1 u_i u_{i-1} + 0.5 sin(t)
+struct NonlinearApp
+{
+  using independent_variable_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+  using jacobian_type = Eigen::SparseMatrix<double>;
+
+  static constexpr int N = 20;
+
+  state_type createState() const{ return state_type(N); }
+  rhs_type createRhs() const{ return rhs_type(N); }
+  jacobian_type createJacobian() const{ return jacobian_type(N, N); }
+
+  void rhsAndJacobian(const state_type & u, independent_variable_type t,
+		      rhs_type & f,
+#ifdef PRESSIO_ENABLE_CXX17
+		      std::optional<jacobian_type*> Jo) const
+#else
+		      jacobian_type* Jo) const
+#endif
+  {
+    for (int i=0; i<N; ++i){
+      const double left = (i==0) ? 1. : u(i-1);
+      f(i) = -u(i) + 0.1*u(i)*left + 0.5*std::sin(t);
+    }
+
+    if (Jo){
+#ifdef PRESSIO_ENABLE_CXX17
+      auto & J = *Jo.value();
+#else
+      auto & J = *Jo;
+#endif
+      std::vector<Eigen::Triplet<double>> trips;
+      for (int i=0; i<N; ++i){
+	const double left = (i==0) ? 1. : u(i-1);
+	trips.emplace_back(i, i, -1. + 0.1*left);
+	if (i>0){ trips.emplace_back(i, i-1, 0.1*u(i)); }
+      }
+      J.setFromTriplets(trips.begin(), trips.end());
+    }
+  }
+};
+
+template<class SolverType, class SystemType>
+void solve_and_check(SolverType & solver, const SystemType & sys)
+{
+  Eigen::VectorXd y(2);
+  y(0) = 0.001; y(1) = 0.0001;
+  solver.solve(sys, y);
+  std::cout << y << std::endl;
+  EXPECT_NEAR(y(0), 1., 1e-8);
+  EXPECT_NEAR(y(1), 0., 1e-8);
+}
+} // end anonymous namespace
+
+TEST(solvers_nonlinear, newton_krylov_problem1_finite_difference)
+{
+  pressio::log::initialize(pressio::logto::terminal);
+  pressio::log::setVerbosity({pressio::log::level::debug});
+
+  pressio::solvers::test::Problem1 sys;
+  auto solver = pressio::create_newton_krylov_solver(sys);
+  solver.setStopTolerance(1e-10);
+  solve_and_check(solver, sys);
+
+  pressio::log::finalize();
+}
+
+TEST(solvers_nonlinear, newton_krylov_problem1_repeated_solve)
+{
+  pressio::solvers::test::Problem1 sys;
+  auto solver = pressio::create_newton_krylov_solver(sys);
+  solver.setStopTolerance(1e-10);
+  solver.setConstantForcingTerm(1e-4);
+  solver.setKrylovRestart(2);
+  for (int i=0; i<20; ++i){
+    solve_and_check(solver, sys);
+  }
+}
+
+TEST(solvers_nonlinear, newton_krylov_problem1_jacobian_action)
+{
+  Problem1JacobianAction sys;
+  auto solver = pressio::create_newton_krylov_solver(sys);
+  solver.setStopTolerance(1e-10);
+  solve_and_check(solver, sys);
+  // the user-provided action must be used instead of finite differences
+  EXPECT_GT(sys.jacobianActionCount, 0);
+}
+
+TEST(solvers_nonlinear, newton_krylov_gmres_linear_system)
+{
+  // on a linear system, gmres must converge in at most n iterations
+  using vec_t = Eigen::VectorXd;
+  const int n = 12;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n);
+  A += 5.*Eigen::MatrixXd::Identity(n, n);
+  const vec_t xTrue = vec_t::Random(n);
+  const vec_t b = A*xTrue;
+
+  pressio::nonlinearsolvers::impl::MatrixFreeGmres<vec_t, double> gmres(b);
+  gmres.setRestart(n);
+  vec_t x(n);
+  const bool converged = gmres.solve(
+    [&A](const vec_t & v, vec_t & Av){ Av = A*v; }, b, x, 1e-12);
+  EXPECT_TRUE(converged);
+  EXPECT_LE(gmres.iterations(), n);
+  EXPECT_LT((x - xTrue).norm(), 1e-9);
+
+  // with a short restart it still converges, just with more iterations
+  gmres.setRestart(3);
+  gmres.setMaxIterations(1000);
+  EXPECT_TRUE(gmres.solve(
+    [&A](const vec_t & v, vec_t & Av){ Av = A*v; }, b, x, 1e-12));
+  EXPECT_LT((x - xTrue).norm(), 1e-9);
+}
+
+TEST(solvers_nonlinear, newton_krylov_implicit_stepper)
+{
+  // the matrix-free solve must match the one using the assembled jacobian
+  namespace pode = pressio::ode;
+  NonlinearApp app;
+  using jacobian_t = NonlinearApp::jacobian_type;
+
+  Eigen::VectorXd y0(NonlinearApp::N);
+  for (int i=0; i<NonlinearApp::N; ++i){ y0(i) = 1. + 0.05*i; }
+  const double dt = 0.05;
+
+  Eigen::VectorXd yRef = y0;
+  {
+    auto stepper = pode::create_implicit_stepper(pode::StepScheme::BDF2, app);
+    using lin_solver_t = pressio::linearsolvers::Solver<
+      pressio::linearsolvers::iterative::Bicgstab, jacobian_t>;
+    lin_solver_t linSolver;
+    auto solver = pressio::create_newton_solver(stepper, linSolver);
+    solver.setStopTolerance(1e-12);
+    pode::advance_n_steps(stepper, yRef, 0.0, dt, pode::StepCount(10), solver);
+  }
+
+  Eigen::VectorXd y = y0;
+  {
+    auto stepper = pode::create_implicit_stepper(pode::StepScheme::BDF2, app);
+    auto solver = pressio::create_newton_krylov_solver(stepper);
+    solver.setStopTolerance(1e-12);
+    pode::advance_n_steps(stepper, y, 0.0, dt, pode::StepCount(10), solver);
+  }
+
+  EXPECT_LT((y - yRef).norm(), 1e-8);
+}
@@ -75,3 +75,73 @@ TEST(solvers_nonlinear, problem1_call_solve_with_only_state){
 TEST(solvers_nonlinear, problem1_repeated_solve_call_solve_with_only_state){
   run_impl<pressio::solvers::test::Problem1>(100, false, true);
 }
+
+TEST(solvers_nonlinear, problem1_jacobian_reuse){
+  using namespace pressio;
+  using problem_t  = pressio::solvers::test::Problem1;
+  using state_t    = typename problem_t::state_type;
+  using jacobian_t = typename problem_t::jacobian_type;
+
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::LSCG, jacobian_t>;
+  lin_solver_t linearSolverObj;
+
+  problem_t sys;
+  state_t y(2);
+  auto nonLinSolver = create_newton_solver(sys, linearSolverObj);
+  nonLinSolver.setJacobianReuse(3, 0.5);
+  // the frozen-jacobian iterations converge linearly
+  nonLinSolver.setStopTolerance(1e-10);
+
+  y(0) = 0.001; y(1) = 0.0001;
+  nonLinSolver.solve(sys, y);
+  std::cout << y << std::endl;
+  ASSERT_TRUE(std::abs(y(0) - (1.)) < 1e-8);
+  ASSERT_TRUE(std::abs(y(1) - (0.)) < 1e-8);
+}
+
+namespace{
+// counts the residual and jacobian evaluations
+struct Problem1WithCounters : pressio::solvers::test::Problem1
+{
+  mutable int residualCount_ = 0;
+  mutable int jacobianCount_ = 0;
+
+  void residualAndJacobian(const state_type& x,
+			   residual_type& res,
+#ifdef PRESSIO_ENABLE_CXX17
+			   std::optional<jacobian_type*> Jin) const
+#else
+                           jacobian_type* Jin) const
+#endif
+  {
+    ++residualCount_;
+    if (Jin){ ++jacobianCount_; }
+    pressio::solvers::test::Problem1::residualAndJacobian(x, res, Jin);
+  }
+};
+}
+
+TEST(solvers_nonlinear, problem1_jacobian_reuse_evaluation_counts){
+  using namespace pressio;
+  using problem_t  = Problem1WithCounters;
+  using jacobian_t = typename problem_t::jacobian_type;
+  using lin_solver_t = linearsolvers::Solver<linearsolvers::iterative::LSCG, jacobian_t>;
+  lin_solver_t linearSolverObj;
+
+  const int maxIters = 20;
+  problem_t sys;
+  auto nonLinSolver = create_newton_solver(sys, linearSolverObj);
+  nonLinSolver.setStopCriterion(nonlinearsolvers::Stop::AfterMaxIters);
+  nonLinSolver.setMaxIterations(maxIters);
+  nonLinSolver.setJacobianReuse(3, 0.5);
+
+  typename problem_t::state_type y(2);
+  y(0) = 0.001; y(1) = 0.0001;
+  nonLinSolver.solve(sys, y);
+  ASSERT_TRUE(std::abs(y(0) - (1.)) < 1e-8);
+  ASSERT_TRUE(std::abs(y(1) - (0.)) < 1e-8);
+  // the residual is evaluated exactly once per iteration,
+  // whether the jacobian is reused or not
+  EXPECT_EQ(sys.residualCount_, maxIters);
+  EXPECT_EQ(sys.jacobianCount_, 8);
+}
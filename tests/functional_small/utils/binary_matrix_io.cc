@@ -0,0 +1,171 @@
+
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+#include <cstdio>
+
+namespace{
+
+Eigen::MatrixXd create_matrix(int rows, int cols){
+  Eigen::MatrixXd A(rows, cols);
+  for (int j=0; j<cols; ++j){
+    for (int i=0; i<rows; ++i){
+      A(i,j) = 1.5*i - 0.25*j + i*j;
+    }
+  }
+  return A;
+}
+
+// f_i(u) = -u_i + 0.1*u_i^2 + t
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  rhs_type createRhs() const{ return rhs_type(12); }
+
+  void rhs(const state_type & u, const time_type t, rhs_type & f) const{
+    for (int i=0; i<f.size(); ++i){
+      f(i) = -u(i) + 0.1*u(i)*u(i) + t;
+    }
+  }
+};
+
+template<class SpaceType>
+Eigen::VectorXd run_galerkin_explicit(const SpaceType & space)
+{
+  MyFom fomSystem;
+  auto problem = pressio::rom::galerkin::create_unsteady_explicit_problem(
+    pressio::ode::StepScheme::RungeKutta4, space, fomSystem);
+  auto romState = space.createReducedState();
+  romState.setConstant(0.01);
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.001,
+				::pressio::ode::StepCount(5));
+  return romState;
+}
+}
+
+TEST(utils_binary_matrix, write_and_read_eigen)
+{
+  const std::string fileName = "binary_matrix_io_test_1.bin";
+  const auto A = create_matrix(17, 5);
+  pressio::utils::write_binary_matrix(fileName, A);
+
+  const auto B = pressio::utils::read_binary_matrix_eigen<double>(fileName);
+  EXPECT_EQ(B.rows(), 17);
+  EXPECT_EQ(B.cols(), 5);
+  EXPECT_TRUE(A == B);
+
+  // a row-major matrix is stored column-major
+  Eigen::Matrix<double, -1, -1, Eigen::RowMajor> Arm = A;
+  pressio::utils::write_binary_matrix(fileName, Arm);
+  const auto C = pressio::utils::read_binary_matrix_eigen<double>(fileName);
+  EXPECT_TRUE(A == C);
+  std::remove(fileName.c_str());
+}
+
+TEST(utils_binary_matrix, mapped_matrix)
+{
+  const std::string fileName = "binary_matrix_io_test_2.bin";
+  const auto A = create_matrix(23, 4);
+  pressio::utils::write_binary_matrix(fileName, A.data(), A.rows(), A.cols());
+
+  {
+    pressio::utils::MappedBinaryMatrix<double> mapped(fileName);
+    EXPECT_EQ(mapped.rows(), 23u);
+    EXPECT_EQ(mapped.cols(), 4u);
+
+    auto map = pressio::utils::create_eigen_map(mapped);
+    EXPECT_EQ(map.data(), mapped.data());
+    EXPECT_TRUE(A == map);
+
+    // writing through the view must not change the file
+    map(0,0) = 1234.;
+    auto moved = std::move(mapped);
+    EXPECT_EQ(moved.data(), map.data());
+    EXPECT_EQ(moved.data()[0], 1234.);
+  }
+
+  const auto B = pressio::utils::read_binary_matrix_eigen<double>(fileName);
+  EXPECT_TRUE(A == B);
+  std::remove(fileName.c_str());
+}
+
+TEST(utils_binary_matrix, trial_subspace_from_binary_basis)
+{
+  const std::string fileName = "binary_matrix_io_test_3.bin";
+  const auto A = create_matrix(12, 3);
+  pressio::utils::write_binary_matrix(fileName, A);
+
+  auto phi = pressio::utils::read_binary_matrix_eigen<double>(fileName);
+  const auto phiData = phi.data();
+  Eigen::VectorXd shift(12);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<
+    Eigen::VectorXd>(std::move(phi), std::move(shift), false);
+  EXPECT_EQ(space.basisOfTranslatedSpace().data(), phiData);
+  EXPECT_TRUE(space.basisOfTranslatedSpace() == A);
+  std::remove(fileName.c_str());
+}
+
+TEST(utils_binary_matrix, galerkin_on_mapped_basis)
+{
+  const std::string fileName = "binary_matrix_io_test_5.bin";
+  const Eigen::MatrixXd A = Eigen::HouseholderQR<Eigen::MatrixXd>(create_matrix(12, 3))
+    .householderQ() * Eigen::MatrixXd::Identity(12, 3);
+  pressio::utils::write_binary_matrix(fileName, A);
+  Eigen::VectorXd shift(12);
+  shift.setConstant(0.5);
+
+  {
+    // the subspace and the problem read the basis straight from the mapping
+    pressio::utils::MappedBinaryMatrix<double> mapped(fileName);
+    auto space = pressio::rom::create_trial_column_subspace<
+      Eigen::VectorXd>(pressio::utils::create_eigen_map(mapped), shift, false);
+    EXPECT_EQ(space.basisOfTranslatedSpace().data(), mapped.data());
+    const auto spaceCopy = space;
+    EXPECT_EQ(spaceCopy.basisOfTranslatedSpace().data(), mapped.data());
+
+    auto spaceRef = pressio::rom::create_trial_column_subspace<
+      Eigen::VectorXd>(A, shift, false);
+    EXPECT_TRUE(run_galerkin_explicit(space) == run_galerkin_explicit(spaceRef));
+  }
+  std::remove(fileName.c_str());
+}
+
+TEST(utils_binary_matrix, invalid_files_throw)
+{
+  using pressio::utils::MappedBinaryMatrix;
+  EXPECT_THROW(MappedBinaryMatrix<double>("binary_matrix_io_missing.bin"), std::runtime_error);
+
+  const std::string fileName = "binary_matrix_io_test_4.bin";
+  {
+    std::ofstream f(fileName);
+    f << "this is not a binary matrix file, it is just some text long enough for a header";
+  }
+  EXPECT_THROW(MappedBinaryMatrix<double>{fileName}, std::runtime_error);
+  EXPECT_THROW(pressio::utils::read_binary_matrix_eigen<double>(fileName), std::runtime_error);
+
+  // scalar size mismatch
+  const auto A = create_matrix(4, 2);
+  pressio::utils::write_binary_matrix(fileName, A);
+  EXPECT_THROW(MappedBinaryMatrix<float>{fileName}, std::runtime_error);
+  EXPECT_NO_THROW(MappedBinaryMatrix<double>{fileName});
+
+  // extents whose byte count overflows to zero must not be accepted
+  // for a file that only contains a header
+  {
+    pressio::utils::BinaryMatrixHeader header = {};
+    std::memcpy(header.magic, "PRSMAT01", 8);
+    header.rows = std::uint64_t(1) << 61;
+    header.cols = 16;
+    header.scalarSize = sizeof(double);
+    header.layout = 0;
+    std::ofstream f(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  }
+  EXPECT_THROW(MappedBinaryMatrix<double>{fileName}, std::runtime_error);
+  EXPECT_THROW(pressio::utils::read_binary_matrix_eigen<double>(fileName), std::runtime_error);
+  std::remove(fileName.c_str());
+}
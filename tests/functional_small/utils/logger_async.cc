@@ -0,0 +1,133 @@
+
+#define PRESSIO_LOG_ACTIVE_MIN_LEVEL 0
+
+#include <gtest/gtest.h>
+#include "pressio/utils.hpp"
+#include <fstream>
+#include <thread>
+
+namespace{
+std::vector<std::string> read_lines(const std::string & fileName)
+{
+  std::ifstream file(fileName);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line)){
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+int count_lines_containing(const std::vector<std::string> & lines,
+			   const std::string & what)
+{
+  int count = 0;
+  for (const auto & line : lines){
+    if (line.find(what) != std::string::npos){ ++count; }
+  }
+  return count;
+}
+}
+
+TEST(utils_logger, async)
+{
+  pressio::log::initializeAsync(pressio::logto::file, "log_async.txt");
+  for (int i=0; i<200; ++i){
+    PRESSIOLOG_INFO("message {}", i);
+  }
+  // debug is below the level of the file sink
+  PRESSIOLOG_DEBUG("this message should not appear");
+  pressio::log::finalize();
+
+  const auto lines = read_lines("log_async.txt");
+  EXPECT_EQ(count_lines_containing(lines, "message "), 200);
+  EXPECT_EQ(count_lines_containing(lines, "message 0"), 1);
+  EXPECT_EQ(count_lines_containing(lines, "message 199"), 1);
+  EXPECT_EQ(count_lines_containing(lines, "should not appear"), 0);
+}
+
+TEST(utils_logger, async_flush_from_many_threads)
+{
+  // flush returns once everything logged before it is written,
+  // also after the flusher has been idle
+  pressio::log::initializeAsync(pressio::logto::file, "log_async_flush.txt");
+  auto logger = pressio::log::getLogger();
+  for (int round=0; round<3; ++round){
+    std::vector<std::thread> threads;
+    for (int t=0; t<4; ++t){
+      threads.emplace_back([round, t](){
+	for (int i=0; i<100; ++i){
+	  PRESSIOLOG_INFO("round {} thread {} message {}", round, t, i);
+	}
+      });
+    }
+    for (auto & th : threads){ th.join(); }
+    logger->flush();
+    EXPECT_EQ(count_lines_containing(read_lines("log_async_flush.txt"), "round " + std::to_string(round)), 400);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  pressio::log::finalize();
+}
+
+TEST(utils_logger, step_sampling)
+{
+  pressio::log::initializeAsync(pressio::logto::file, "log_sampling.txt");
+  pressio::log::setStepSampling(3);
+  {
+    const pressio::log::impl::StepSamplingScope logSampling;
+    for (int step=1; step<=7; ++step){
+      pressio::log::impl::beginSampledStep(step);
+      PRESSIOLOG_INFO("sampled step={}", step);
+      PRESSIOLOG_WARN("warning step={}", step);
+    }
+  }
+  PRESSIOLOG_INFO("after the time loop");
+  pressio::log::setStepSampling(1);
+  pressio::log::finalize();
+
+  const auto lines = read_lines("log_sampling.txt");
+  EXPECT_EQ(count_lines_containing(lines, "sampled step="), 3);
+  EXPECT_EQ(count_lines_containing(lines, "sampled step=1"), 1);
+  EXPECT_EQ(count_lines_containing(lines, "sampled step=4"), 1);
+  EXPECT_EQ(count_lines_containing(lines, "sampled step=7"), 1);
+  // warnings are never sampled out
+  EXPECT_EQ(count_lines_containing(lines, "warning step="), 7);
+  EXPECT_EQ(count_lines_containing(lines, "after the time loop"), 1);
+}
+
+TEST(utils_logger, step_sampling_is_per_thread)
+{
+  pressio::log::initializeAsync(pressio::logto::file, "log_sampling_threads.txt");
+  pressio::log::setStepSampling(3);
+  {
+    const pressio::log::impl::StepSamplingScope logSampling;
+    // step 2 is sampled out on this thread only
+    pressio::log::impl::beginSampledStep(2);
+    PRESSIOLOG_INFO("sampled out on the main thread");
+    std::thread other([](){
+      PRESSIOLOG_INFO("logged from another thread");
+    });
+    other.join();
+  }
+  pressio::log::setStepSampling(1);
+  pressio::log::finalize();
+
+  const auto lines = read_lines("log_sampling_threads.txt");
+  EXPECT_EQ(count_lines_containing(lines, "sampled out on the main thread"), 0);
+  EXPECT_EQ(count_lines_containing(lines, "logged from another thread"), 1);
+}
+
+TEST(utils_logger, active_ranks)
+{
+  // serial run, so this is rank 0
+  pressio::log::initialize(pressio::logto::file, "log_ranks.txt");
+  pressio::log::setActiveRanks({1});
+  PRESSIOLOG_WARN("from an inactive rank");
+  pressio::log::setActiveRanks({0, 1});
+  PRESSIOLOG_WARN("from an active rank");
+  pressio::log::finalize();
+
+  const auto lines = read_lines("log_ranks.txt");
+  EXPECT_EQ(count_lines_containing(lines, "from an inactive rank"), 0);
+  EXPECT_EQ(count_lines_containing(lines, "from an active rank"), 1);
+}
@@ -0,0 +1,202 @@
+
+#define PRESSIO_ENABLE_PERF_MONITOR
+#include <gtest/gtest.h>
+#include "pressio/rom_subspaces.hpp"
+#include "pressio/rom_galerkin_unsteady.hpp"
+#include <sstream>
+#include <thread>
+
+namespace{
+
+constexpr int nFull = 20;
+constexpr int nRom = 3;
+
+// f_i(u) = -u_i + 0.1*u_i^2 + t
+struct MyFom
+{
+  using time_type = double;
+  using state_type = Eigen::VectorXd;
+  using rhs_type = state_type;
+
+  rhs_type createRhs() const{ return rhs_type(nFull); }
+
+  Eigen::MatrixXd createResultOfJacobianActionOn(const Eigen::MatrixXd & B) const{
+    return Eigen::MatrixXd(nFull, B.cols());
+  }
+
+  void rhs(const state_type & u, const time_type timeIn, rhs_type & f) const{
+    for (int i=0; i<nFull; ++i){
+      f(i) = -u(i) + 0.1*u(i)*u(i) + timeIn;
+    }
+  }
+
+  void applyJacobian(const state_type & u, const Eigen::MatrixXd & B,
+		     const time_type & /*time*/, Eigen::MatrixXd & A) const{
+    for (int i=0; i<nFull; ++i){
+      A.row(i) = (-1. + 0.2*u(i))*B.row(i);
+    }
+  }
+};
+
+void run_galerkin_implicit(int numSteps)
+{
+  Eigen::MatrixXd phi(nFull, nRom);
+  for (int i=0; i<nFull; ++i){
+    phi(i,0) = 1.;
+    phi(i,1) = 0.1*i;
+    phi(i,2) = (i % 3);
+  }
+  Eigen::VectorXd shift(nFull);
+  shift.setZero();
+  auto space = pressio::rom::create_trial_column_subspace<Eigen::VectorXd>(phi, shift, false);
+
+  MyFom fomSystem;
+  auto problem = pressio::rom::galerkin::create_unsteady_implicit_problem(
+    pressio::ode::StepScheme::BDF1, space, fomSystem);
+
+  using lin_solver_t = pressio::linearsolvers::Solver<
+    pressio::linearsolvers::direct::HouseholderQR, Eigen::MatrixXd>;
+  lin_solver_t linSolver;
+  auto solver = pressio::create_newton_solver(problem, linSolver);
+  solver.setStopTolerance(1e-13);
+
+  auto romState = space.createReducedState();
+  romState.setConstant(0.1);
+  pressio::ode::advance_n_steps(problem, romState, 0., 0.05,
+				::pressio::ode::StepCount(numSteps), solver);
+}
+} // end anonymous namespace
+
+TEST(utils_perf_monitor, zones_and_counters)
+{
+  namespace perf = pressio::perf;
+  perf::reset();
+  run_galerkin_implicit(5);
+
+  const std::string step = "time loop/time step";
+  const std::string solve = step + "/nonlinear solve";
+  EXPECT_EQ(perf::zone_calls("time loop"), 1u);
+  EXPECT_EQ(perf::zone_calls(step), 5u);
+  EXPECT_EQ(perf::zone_calls(solve), 5u);
+
+  const auto iterations = perf::counter_value("nonlinear iterations");
+  EXPECT_TRUE(iterations >= 5u);
+  EXPECT_EQ(perf::zone_calls(solve + "/linear solve"), iterations);
+  EXPECT_EQ(perf::zone_calls(solve + "/residual and jacobian"),
+	    perf::counter_value("jacobian evaluations"));
+  EXPECT_EQ(perf::zone_calls(solve + "/residual and jacobian/fom rhs"),
+	    perf::zone_calls(solve + "/residual and jacobian"));
+  EXPECT_EQ(perf::zone_calls(solve + "/residual and jacobian/fom jacobian action"),
+	    perf::zone_calls(solve + "/residual and jacobian"));
+  EXPECT_TRUE(perf::counter_value("residual evaluations") >= iterations);
+  EXPECT_TRUE(perf::counter_value("bytes streamed") > 0u);
+  EXPECT_TRUE(perf::zone_seconds("time loop") >= perf::zone_seconds(step));
+  EXPECT_EQ(perf::zone_calls("time loop/nonexisting"), 0u);
+
+  std::ostringstream json;
+  perf::write_json(json);
+  EXPECT_NE(json.str().find("\"zones\""), std::string::npos);
+  EXPECT_NE(json.str().find("\"name\": \"time step\""), std::string::npos);
+  EXPECT_NE(json.str().find("\"nonlinear iterations\": " + std::to_string(iterations)),
+	    std::string::npos);
+
+  std::ostringstream csv;
+  perf::write_csv(csv);
+  std::cout << csv.str();
+  EXPECT_EQ(csv.str().rfind("kind,name,calls,seconds,value\n", 0), 0u);
+  EXPECT_NE(csv.str().find("zone," + solve + "/linear solve,"), std::string::npos);
+
+  perf::report(std::cout);
+
+  perf::reset();
+  EXPECT_EQ(perf::zone_calls("time loop"), 0u);
+  EXPECT_EQ(perf::counter_value("nonlinear iterations"), 0u);
+}
+
+TEST(utils_perf_monitor, threads)
+{
+  namespace perf = pressio::perf;
+  perf::reset();
+
+  auto work = [](){
+    for (int i=0; i<10; ++i){
+      PRESSIO_PERF_ZONE("outer");
+      PRESSIO_PERF_ZONE("inner");
+      PRESSIO_PERF_COUNT("work items", 2);
+    }
+  };
+  std::thread t1(work);
+  std::thread t2(work);
+  t1.join();
+  t2.join();
+
+  // each thread nests its own zones, results are merged by path
+  EXPECT_EQ(perf::zone_calls("outer"), 20u);
+  EXPECT_EQ(perf::zone_calls("outer/inner"), 20u);
+  EXPECT_EQ(perf::zone_calls("inner"), 0u);
+  EXPECT_EQ(perf::counter_value("work items"), 40u);
+  perf::reset();
+}
+
+TEST(utils_perf_monitor, live_and_exited_threads)
+{
+  namespace perf = pressio::perf;
+  perf::reset();
+
+  // the main thread is still alive when querying, the worker has exited
+  PRESSIO_PERF_COUNT("work items", 1);
+  {
+    PRESSIO_PERF_ZONE("outer");
+  }
+  std::thread worker([](){
+    PRESSIO_PERF_ZONE("outer");
+    PRESSIO_PERF_COUNT("work items", 3);
+  });
+  worker.join();
+
+  EXPECT_EQ(perf::zone_calls("outer"), 2u);
+  EXPECT_EQ(perf::counter_value("work items"), 4u);
+
+  // the records of both are cleared by reset
+  perf::reset();
+  EXPECT_EQ(perf::zone_calls("outer"), 0u);
+  EXPECT_EQ(perf::counter_value("work items"), 0u);
+  {
+    PRESSIO_PERF_ZONE("outer");
+  }
+  EXPECT_EQ(perf::zone_calls("outer"), 1u);
+  perf::reset();
+}
+
+TEST(utils_perf_monitor, query_while_threads_are_timing)
+{
+  namespace perf = pressio::perf;
+  perf::reset();
+
+  // workers keep creating zones and counters while the
+  // main thread queries and exports the merged results
+  auto work = [](){
+    for (int i=0; i<2000; ++i){
+      PRESSIO_PERF_ZONE("outer");
+      PRESSIO_PERF_ZONE((i % 2 == 0) ? "even" : "odd");
+      PRESSIO_PERF_COUNT((i % 3 == 0) ? "a" : "b", 1);
+    }
+  };
+  std::thread t1(work);
+  std::thread t2(work);
+  std::uint64_t last = 0;
+  for (int i=0; i<200; ++i){
+    const auto calls = perf::zone_calls("outer");
+    EXPECT_GE(calls, last);
+    last = calls;
+    std::ostringstream ss;
+    perf::write_json(ss);
+  }
+  t1.join();
+  t2.join();
+
+  EXPECT_EQ(perf::zone_calls("outer"), 4000u);
+  EXPECT_EQ(perf::zone_calls("outer/even"), 2000u);
+  EXPECT_EQ(perf::counter_value("a") + perf::counter_value("b"), 4000u);
+  perf::reset();
+}